@@ -0,0 +1,292 @@
+#ifndef VERTEXCFD_BENCHMARK_CLOSUREBENCHMARK_HPP
+#define VERTEXCFD_BENCHMARK_CLOSUREBENCHMARK_HPP
+
+#include "VertexCFD_Benchmark_Results.hpp"
+
+#include <VertexCFD_EvaluatorTestHarness.hpp>
+
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
+
+#include <Panzer_Evaluator_WithBaseImpl.hpp>
+#include <Panzer_IntegrationRule.hpp>
+#include <Panzer_Traits.hpp>
+
+#include <Phalanx_Evaluator_Derived.hpp>
+#include <Phalanx_MDField.hpp>
+
+#include <Shards_BasicTopologies.hpp>
+#include <Shards_CellTopology.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Timer.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Benchmark
+{
+//---------------------------------------------------------------------------//
+// Evaluate the dependent fields of an evaluator with constant values.
+template<class EvalType>
+class ConstantDependencies
+    : public panzer::EvaluatorWithBaseImpl<panzer::Traits>,
+      public PHX::EvaluatorDerived<EvalType, panzer::Traits>
+{
+  public:
+    using scalar_type = typename EvalType::ScalarT;
+
+    explicit ConstantDependencies(
+        const PHX::EvaluatorWithBaseImpl<panzer::Traits>& evaluator)
+    {
+        // Use distinct positive values so that the closures do not take
+        // degenerate branches.
+        const auto& tags = evaluator.dependentFields();
+        for (std::size_t i = 0; i < tags.size(); ++i)
+        {
+            const double value = 1.0 + 0.125 * (i % 8);
+            if (tags[i]->dataTypeInfo() == typeid(double))
+            {
+                _double_fields.emplace_back(tags[i]);
+                _double_values.push_back(value);
+                this->addEvaluatedField(_double_fields.back());
+            }
+            else if (tags[i]->dataTypeInfo() == typeid(scalar_type))
+            {
+                _scalar_fields.emplace_back(tags[i]);
+                _scalar_values.push_back(value);
+                this->addEvaluatedField(_scalar_fields.back());
+            }
+            else
+            {
+                throw std::runtime_error("Unsupported data type of dependent "
+                                         "field "
+                                         + tags[i]->identifier());
+            }
+        }
+
+        this->setName("Benchmark Dependencies: " + evaluator.getName());
+    }
+
+    void evaluateFields(typename panzer::Traits::EvalData) override
+    {
+        for (std::size_t i = 0; i < _double_fields.size(); ++i)
+            _double_fields[i].deep_copy(_double_values[i]);
+        for (std::size_t i = 0; i < _scalar_fields.size(); ++i)
+            _scalar_fields[i].deep_copy(scalar_type(_scalar_values[i]));
+    }
+
+  private:
+    // The fields are bound by reference so their addresses must not change
+    // after registration.
+    std::deque<PHX::MDField<double>> _double_fields;
+    std::deque<PHX::MDField<scalar_type>> _scalar_fields;
+    std::vector<double> _double_values;
+    std::vector<double> _scalar_values;
+};
+
+//---------------------------------------------------------------------------//
+// Benchmark parameters.
+struct BenchmarkOptions
+{
+    // Number of cells of the benchmarked worksets.
+    std::vector<int> workset_sizes = {128, 1024};
+
+    // Number of evaluations per timing sample. The time of an evaluation is
+    // the average over the sample.
+    int num_evaluation = 10;
+
+    // Number of timing samples. The fastest sample is reported.
+    int num_sample = 5;
+
+    // Number of derivatives of the Jacobian scalar type. If not positive,
+    // the number of basis functions times the number of incompressible
+    // Navier-Stokes equations is used.
+    int derivative_dimension = -1;
+
+    int integration_order = 2;
+    int basis_order = 1;
+
+    // Only run the benchmarks whose name contains this string.
+    std::string filter;
+};
+
+//---------------------------------------------------------------------------//
+// Build a test fixture with a row of unit quadrilaterals or hexahedra.
+inline std::shared_ptr<Test::EvaluatorTestFixture>
+buildBenchmarkFixture(const int num_space_dim,
+                      const int num_cell,
+                      const int integration_order,
+                      const int basis_order)
+{
+    // Nodes of the unit cell in the Shards ordering.
+    const double quad_nodes[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+    const double hex_nodes[8][3] = {{0, 0, 0},
+                                    {1, 0, 0},
+                                    {1, 1, 0},
+                                    {0, 1, 0},
+                                    {0, 0, 1},
+                                    {1, 0, 1},
+                                    {1, 1, 1},
+                                    {0, 1, 1}};
+
+    const CellTopologyData* cell_topo_data = nullptr;
+    int num_node = 0;
+    if (2 == num_space_dim)
+    {
+        cell_topo_data
+            = shards::getCellTopologyData<shards::Quadrilateral<4>>();
+        num_node = 4;
+    }
+    else if (3 == num_space_dim)
+    {
+        cell_topo_data = shards::getCellTopologyData<shards::Hexahedron<8>>();
+        num_node = 8;
+    }
+    else
+    {
+        std::ostringstream msg;
+        msg << "Invalid spatial dimensions (" << num_space_dim
+            << "): must be 2 or 3.";
+        throw std::runtime_error(msg.str());
+    }
+
+    Test::EvaluatorTestFixture::host_coords_view host_coords(
+        "coords", num_cell, num_node, num_space_dim);
+    for (int cell = 0; cell < num_cell; ++cell)
+    {
+        for (int node = 0; node < num_node; ++node)
+        {
+            for (int dim = 0; dim < num_space_dim; ++dim)
+            {
+                host_coords(cell, node, dim) = 2 == num_space_dim
+                                                   ? quad_nodes[node][dim]
+                                                   : hex_nodes[node][dim];
+            }
+            host_coords(cell, node, 0) += cell;
+        }
+    }
+
+    return std::make_shared<Test::EvaluatorTestFixture>(
+        cell_topo_data, host_coords, integration_order, basis_order);
+}
+
+//---------------------------------------------------------------------------//
+// Time the evaluation of an evaluator on a workset. The evaluator is built
+// with build_evaluator(EvalType(), ir) and its dependent fields are set to
+// constant values.
+template<class EvalType, class Builder>
+BenchmarkResult benchmarkEvaluator(const std::string& name,
+                                   const int num_space_dim,
+                                   const int num_cell,
+                                   const Builder& build_evaluator,
+                                   const BenchmarkOptions& options)
+{
+    auto fixture = buildBenchmarkFixture(num_space_dim,
+                                         num_cell,
+                                         options.integration_order,
+                                         options.basis_order);
+
+    auto eval = build_evaluator(EvalType(), *fixture->ir);
+    auto deps = Teuchos::rcp(new ConstantDependencies<EvalType>(*eval));
+    fixture->registerEvaluator<EvalType>(deps);
+    fixture->registerEvaluator<EvalType>(eval);
+    for (const auto& tag : eval->evaluatedFields())
+        fixture->fm->requireField<EvalType>(*tag);
+    for (const auto& tag : eval->contributedFields())
+        fixture->fm->requireField<EvalType>(*tag);
+
+    const int derivative_dimension
+        = options.derivative_dimension > 0
+              ? options.derivative_dimension
+              : fixture->cardinality() * (num_space_dim + 1);
+    fixture->setup(derivative_dimension);
+
+    // Evaluate the dependencies once. This also warms up the evaluator.
+    fixture->evaluateFields<EvalType>();
+
+    // Time the evaluator alone.
+    double seconds = std::numeric_limits<double>::max();
+    for (int sample = 0; sample < options.num_sample; ++sample)
+    {
+        Kokkos::fence();
+        Kokkos::Timer timer;
+        for (int i = 0; i < options.num_evaluation; ++i)
+            eval->evaluateFields(*fixture->workset);
+        Kokkos::fence();
+        seconds = std::min(seconds, timer.seconds() / options.num_evaluation);
+    }
+
+    auto& profiler = Utils::EvaluatorProfiler::inst();
+    const int profiler_derivative_dimension = profiler.derivativeDimension();
+    profiler.setDerivativeDimension(derivative_dimension);
+
+    BenchmarkResult result;
+    result.name = name;
+    result.evaluation_type = Utils::evaluationTypeName<EvalType>();
+    result.num_cell = num_cell;
+    result.seconds = seconds;
+    result.bytes = Utils::evaluatorFieldBytes<EvalType>(*eval, num_cell);
+
+    profiler.setDerivativeDimension(profiler_derivative_dimension);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+// Run benchmarks for the residual and Jacobian evaluation types over the
+// workset sizes of the options.
+//---------------------------------------------------------------------------//
+class ClosureBenchmarkSuite
+{
+  public:
+    ClosureBenchmarkSuite(const int num_space_dim,
+                          const BenchmarkOptions& options)
+        : _num_space_dim(num_space_dim)
+        , _options(options)
+    {
+    }
+
+    // Run a benchmark. The builder is called as build(EvalType(), ir) and
+    // returns an RCP to the evaluator. The benchmark name is suffixed with
+    // the number of space dimensions.
+    template<class Builder>
+    void run(const std::string& name, const Builder& build)
+    {
+        const std::string full_name
+            = name + " " + std::to_string(_num_space_dim) + "D";
+        if (full_name.find(_options.filter) == std::string::npos)
+            return;
+
+        for (const int num_cell : _options.workset_sizes)
+        {
+            _results.add(benchmarkEvaluator<panzer::Traits::Residual>(
+                full_name, _num_space_dim, num_cell, build, _options));
+            _results.add(benchmarkEvaluator<panzer::Traits::Jacobian>(
+                full_name, _num_space_dim, num_cell, build, _options));
+        }
+    }
+
+    const BenchmarkResults& results() const { return _results; }
+
+  private:
+    int _num_space_dim;
+    BenchmarkOptions _options;
+    BenchmarkResults _results;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Benchmark
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_BENCHMARK_CLOSUREBENCHMARK_HPP
@@ -0,0 +1,174 @@
+#include "VertexCFD_Benchmark_Results.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_XMLParameterListHelpers.hpp>
+
+#include <algorithm>
+#include <iomanip>
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace Benchmark
+{
+//---------------------------------------------------------------------------//
+const BenchmarkResult*
+BenchmarkResults::find(const std::string& name,
+                       const std::string& evaluation_type,
+                       const int num_cell) const
+{
+    for (const auto& result : _results)
+    {
+        if (result.name == name && result.evaluation_type == evaluation_type
+            && result.num_cell == num_cell)
+        {
+            return &result;
+        }
+    }
+    return nullptr;
+}
+
+//---------------------------------------------------------------------------//
+void BenchmarkResults::print(std::ostream& os) const
+{
+    std::size_t name_width = 9;
+    for (const auto& result : _results)
+        name_width = std::max(name_width, result.name.size());
+
+    os << std::left << std::setw(name_width + 2) << "Benchmark"
+       << std::setw(10) << "Type" << std::right << std::setw(10) << "Cells"
+       << std::setw(14) << "Time [s]" << std::setw(14) << "Cells/s"
+       << std::setw(10) << "GB/s"
+       << "\n";
+    for (const auto& result : _results)
+    {
+        os << std::left << std::setw(name_width + 2) << result.name
+           << std::setw(10) << result.evaluation_type << std::right
+           << std::setw(10) << result.num_cell << std::scientific
+           << std::setprecision(4) << std::setw(14) << result.seconds
+           << std::setw(14) << result.cellsPerSecond() << std::fixed
+           << std::setprecision(3) << std::setw(10)
+           << result.gigabytesPerSecond() << "\n";
+    }
+    os << std::defaultfloat;
+}
+
+//---------------------------------------------------------------------------//
+void BenchmarkResults::write(const std::string& file_name) const
+{
+    Teuchos::ParameterList params("Benchmark Results");
+    for (const auto& result : _results)
+    {
+        auto& result_params
+            = params.sublist(result.name)
+                  .sublist(result.evaluation_type)
+                  .sublist("Workset Size " + std::to_string(result.num_cell));
+        result_params.set("Number of Cells", result.num_cell);
+        result_params.set("Time Per Evaluation", result.seconds);
+        result_params.set("Bytes Per Evaluation", result.bytes);
+    }
+    Teuchos::writeParameterListToXmlFile(params, file_name);
+}
+
+//---------------------------------------------------------------------------//
+BenchmarkResults BenchmarkResults::read(const std::string& file_name)
+{
+    const auto params = Teuchos::getParametersFromXmlFile(file_name);
+
+    // Iterate over the sublists of a parameter list.
+    auto for_each_sublist = [](const Teuchos::ParameterList& list,
+                               const auto& function) {
+        for (auto it = list.begin(); it != list.end(); ++it)
+        {
+            const std::string& name = list.name(it);
+            if (list.isSublist(name))
+                function(name, list.sublist(name));
+        }
+    };
+
+    BenchmarkResults results;
+    for_each_sublist(*params, [&](const std::string& name,
+                                  const Teuchos::ParameterList& name_params) {
+        for_each_sublist(
+            name_params,
+            [&](const std::string& evaluation_type,
+                const Teuchos::ParameterList& type_params) {
+                for_each_sublist(
+                    type_params,
+                    [&](const std::string&,
+                        const Teuchos::ParameterList& result_params) {
+                        BenchmarkResult result;
+                        result.name = name;
+                        result.evaluation_type = evaluation_type;
+                        result.num_cell
+                            = result_params.get<int>("Number of Cells");
+                        result.seconds
+                            = result_params.get<double>("Time Per Evaluation");
+                        result.bytes = result_params.get<double>(
+                            "Bytes Per Evaluation");
+                        results.add(result);
+                    });
+            });
+    });
+    return results;
+}
+
+//---------------------------------------------------------------------------//
+int BenchmarkResults::compare(const BenchmarkResults& baseline,
+                              const double tolerance,
+                              std::ostream& os) const
+{
+    if (tolerance < 0.0)
+    {
+        throw std::runtime_error(
+            "Benchmark comparison tolerance must be non-negative.");
+    }
+
+    std::size_t name_width = 9;
+    for (const auto& result : _results)
+        name_width = std::max(name_width, result.name.size());
+
+    os << "Comparison against baseline (tolerance " << 100.0 * tolerance
+       << "%)\n";
+    os << std::left << std::setw(name_width + 2) << "Benchmark"
+       << std::setw(10) << "Type" << std::right << std::setw(10) << "Cells"
+       << std::setw(14) << "Cells/s" << std::setw(14) << "Baseline"
+       << std::setw(10) << "Change" << "  Status\n";
+
+    int num_regression = 0;
+    for (const auto& result : _results)
+    {
+        os << std::left << std::setw(name_width + 2) << result.name
+           << std::setw(10) << result.evaluation_type << std::right
+           << std::setw(10) << result.num_cell << std::scientific
+           << std::setprecision(4) << std::setw(14) << result.cellsPerSecond();
+
+        const auto* reference = baseline.find(
+            result.name, result.evaluation_type, result.num_cell);
+        if (reference == nullptr || reference->cellsPerSecond() <= 0.0)
+        {
+            os << std::setw(14) << "-" << std::setw(10) << "-"
+               << "  no baseline\n";
+            continue;
+        }
+
+        const double change = result.cellsPerSecond()
+                                  / reference->cellsPerSecond()
+                              - 1.0;
+        const bool regression = change < -tolerance;
+        if (regression)
+            ++num_regression;
+
+        os << std::setw(14) << reference->cellsPerSecond() << std::fixed
+           << std::setprecision(1) << std::showpos << std::setw(9)
+           << 100.0 * change << "%" << std::noshowpos
+           << (regression ? "  REGRESSION" : "  ok") << "\n";
+    }
+    os << std::defaultfloat;
+    return num_regression;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Benchmark
+} // end namespace VertexCFD
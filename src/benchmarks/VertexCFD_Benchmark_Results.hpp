@@ -0,0 +1,80 @@
+#ifndef VERTEXCFD_BENCHMARK_RESULTS_HPP
+#define VERTEXCFD_BENCHMARK_RESULTS_HPP
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Benchmark
+{
+//---------------------------------------------------------------------------//
+// Timing of an evaluator for an evaluation type and a workset size.
+struct BenchmarkResult
+{
+    std::string name;
+    std::string evaluation_type;
+    int num_cell = 0;
+
+    // Time of one evaluation of the workset.
+    double seconds = 0.0;
+
+    // Estimated number of bytes read and written by one evaluation.
+    double bytes = 0.0;
+
+    double cellsPerSecond() const
+    {
+        return seconds > 0.0 ? num_cell / seconds : 0.0;
+    }
+
+    double gigabytesPerSecond() const
+    {
+        return seconds > 0.0 ? 1.0e-9 * bytes / seconds : 0.0;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Collection of benchmark results that can be stored in an XML file and
+// compared against a stored baseline.
+//---------------------------------------------------------------------------//
+class BenchmarkResults
+{
+  public:
+    void add(const BenchmarkResult& result) { _results.push_back(result); }
+
+    const std::vector<BenchmarkResult>& results() const { return _results; }
+
+    // Find the result of a benchmark. Returns nullptr if there is none.
+    const BenchmarkResult* find(const std::string& name,
+                                const std::string& evaluation_type,
+                                const int num_cell) const;
+
+    // Print the results as a table.
+    void print(std::ostream& os) const;
+
+    // Write the results to an XML parameter list file.
+    void write(const std::string& file_name) const;
+
+    // Read results written with write().
+    static BenchmarkResults read(const std::string& file_name);
+
+    // Compare the throughput against a baseline and print the comparison. A
+    // benchmark regresses if its throughput is lower than the baseline by
+    // more than the given relative tolerance. Benchmarks missing from the
+    // baseline are reported but not counted. Returns the number of
+    // regressions.
+    int compare(const BenchmarkResults& baseline,
+                const double tolerance,
+                std::ostream& os) const;
+
+  private:
+    std::vector<BenchmarkResult> _results;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Benchmark
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_BENCHMARK_RESULTS_HPP
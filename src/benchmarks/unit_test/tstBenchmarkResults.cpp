@@ -0,0 +1,104 @@
+#include <VertexCFD_Benchmark_Results.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace VertexCFD;
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+Benchmark::BenchmarkResult makeResult(const std::string& name,
+                                      const std::string& evaluation_type,
+                                      const int num_cell,
+                                      const double seconds,
+                                      const double bytes)
+{
+    Benchmark::BenchmarkResult result;
+    result.name = name;
+    result.evaluation_type = evaluation_type;
+    result.num_cell = num_cell;
+    result.seconds = seconds;
+    result.bytes = bytes;
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+TEST(BenchmarkResults, throughput)
+{
+    const auto result = makeResult("Flux 3D", "Residual", 100, 0.5, 2.0e9);
+    EXPECT_DOUBLE_EQ(200.0, result.cellsPerSecond());
+    EXPECT_DOUBLE_EQ(4.0, result.gigabytesPerSecond());
+
+    const auto empty = makeResult("Flux 3D", "Residual", 100, 0.0, 2.0e9);
+    EXPECT_EQ(0.0, empty.cellsPerSecond());
+    EXPECT_EQ(0.0, empty.gigabytesPerSecond());
+}
+
+//---------------------------------------------------------------------------//
+TEST(BenchmarkResults, writeRead)
+{
+    Benchmark::BenchmarkResults results;
+    results.add(makeResult("Flux 3D", "Residual", 128, 1.0e-4, 1.0e6));
+    results.add(makeResult("Flux 3D", "Jacobian", 128, 2.0e-3, 3.0e7));
+    results.add(makeResult("Flux 3D", "Residual", 1024, 8.0e-4, 8.0e6));
+    results.add(makeResult("Source 3D", "Residual", 128, 5.0e-5, 4.0e5));
+
+    int comm_rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+    const std::string file_name
+        = "benchmark_results_test_" + std::to_string(comm_rank) + ".xml";
+    results.write(file_name);
+    const auto read_results = Benchmark::BenchmarkResults::read(file_name);
+    std::remove(file_name.c_str());
+
+    ASSERT_EQ(results.results().size(), read_results.results().size());
+    for (const auto& result : results.results())
+    {
+        const auto* read_result = read_results.find(
+            result.name, result.evaluation_type, result.num_cell);
+        ASSERT_NE(nullptr, read_result);
+        EXPECT_DOUBLE_EQ(result.seconds, read_result->seconds);
+        EXPECT_DOUBLE_EQ(result.bytes, read_result->bytes);
+    }
+    EXPECT_EQ(nullptr, read_results.find("Flux 3D", "Jacobian", 1024));
+}
+
+//---------------------------------------------------------------------------//
+TEST(BenchmarkResults, compare)
+{
+    Benchmark::BenchmarkResults baseline;
+    baseline.add(makeResult("Flux 3D", "Residual", 100, 1.0, 0.0));
+    baseline.add(makeResult("Flux 3D", "Jacobian", 100, 1.0, 0.0));
+    baseline.add(makeResult("Source 3D", "Residual", 100, 1.0, 0.0));
+
+    // Faster, within the tolerance, slower than the tolerance, and missing
+    // from the baseline.
+    Benchmark::BenchmarkResults results;
+    results.add(makeResult("Flux 3D", "Residual", 100, 0.5, 0.0));
+    results.add(makeResult("Flux 3D", "Jacobian", 100, 1.1, 0.0));
+    results.add(makeResult("Source 3D", "Residual", 100, 2.0, 0.0));
+    results.add(makeResult("Source 3D", "Jacobian", 100, 2.0, 0.0));
+
+    std::ostringstream os;
+    EXPECT_EQ(1, results.compare(baseline, 0.2, os));
+    const std::string table = os.str();
+    EXPECT_NE(std::string::npos, table.find("REGRESSION"));
+    EXPECT_NE(std::string::npos, table.find("no baseline"));
+
+    // Every slower benchmark regresses without tolerance.
+    std::ostringstream strict_os;
+    EXPECT_EQ(2, results.compare(baseline, 0.0, strict_os));
+
+    EXPECT_THROW(results.compare(baseline, -0.1, os), std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+
+} // namespace Test
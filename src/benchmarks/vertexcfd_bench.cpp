@@ -0,0 +1,278 @@
+// Due to a conflict with FAD types and Kokkos views, this file needs to be
+// included before other VertexCFD includes
+#include "utils/VertexCFD_Utils_KokkosFadFixup.hpp"
+
+#include "VertexCFD_Benchmark_ClosureBenchmark.hpp"
+#include "VertexCFD_Benchmark_Results.hpp"
+
+#include "full_induction_mhd_solver/closure_models/VertexCFD_Closure_InductionConvectiveFlux.hpp"
+#include "full_induction_mhd_solver/mhd_properties/VertexCFD_FullInductionMHDProperties.hpp"
+#include "incompressible_solver/boundary_conditions/VertexCFD_BoundaryState_IncompressibleNoSlip.hpp"
+#include "incompressible_solver/closure_models/VertexCFD_Closure_IncompressibleConvectiveFlux.hpp"
+#include "incompressible_solver/closure_models/VertexCFD_Closure_IncompressibleViscousFlux.hpp"
+#include "incompressible_solver/fluid_properties/VertexCFD_ConstantFluidProperties.hpp"
+#include "induction_less_mhd_solver/closure_models/VertexCFD_Closure_LorentzForce.hpp"
+#include "turbulence_models/closure_models/VertexCFD_Closure_IncompressibleKEpsilonSource.hpp"
+#include "turbulence_models/closure_models/VertexCFD_Closure_IncompressibleSpalartAllmarasSource.hpp"
+
+#include <Panzer_IntegrationRule.hpp>
+#include <Panzer_Traits.hpp>
+
+#include <Teuchos_CommandLineProcessor.hpp>
+#include <Teuchos_GlobalMPISession.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace VertexCFD;
+
+//---------------------------------------------------------------------------//
+// Parse a comma separated list of workset sizes.
+std::vector<int> parse_workset_sizes(const std::string& sizes)
+{
+    std::vector<int> workset_sizes;
+    std::istringstream stream(sizes);
+    std::string size;
+    while (std::getline(stream, size, ','))
+    {
+        std::size_t end = 0;
+        int num_cell = 0;
+        try
+        {
+            num_cell = std::stoi(size, &end);
+        }
+        catch (const std::exception&)
+        {
+            end = 0;
+        }
+        if (end != size.size() || num_cell < 1)
+        {
+            throw std::runtime_error("Invalid workset size '" + size
+                                     + "' in '" + sizes + "'");
+        }
+        workset_sizes.push_back(num_cell);
+    }
+    if (workset_sizes.empty())
+        throw std::runtime_error("No workset size given");
+    return workset_sizes;
+}
+
+//---------------------------------------------------------------------------//
+// Run the closure model benchmarks. Each benchmark is named after the type of
+// the closure model in the input files.
+template<int NumSpaceDim>
+Benchmark::BenchmarkResults
+run_benchmarks(const Benchmark::BenchmarkOptions& options)
+{
+    constexpr int num_space_dim = NumSpaceDim;
+    Benchmark::ClosureBenchmarkSuite suite(num_space_dim, options);
+
+    Teuchos::ParameterList fluid_prop_list;
+    fluid_prop_list.set("Kinematic viscosity", 0.375);
+    fluid_prop_list.set("Artificial compressibility", 2.0);
+    fluid_prop_list.set("Build Temperature Equation", true);
+    fluid_prop_list.set("Thermal conductivity", 0.5);
+    fluid_prop_list.set("Specific heat capacity", 5.0);
+    fluid_prop_list.set("Build Inductionless MHD Equation", true);
+    fluid_prop_list.set("Electrical conductivity", 3.0);
+    const FluidProperties::ConstantFluidProperties fluid_prop(fluid_prop_list);
+
+    Teuchos::ParameterList mhd_prop_list;
+    mhd_prop_list.set("Vacuum Magnetic Permeability", 0.05);
+    mhd_prop_list.set("Build Magnetic Correction Potential Equation", true);
+    mhd_prop_list.set("Hyperbolic Divergence Cleaning Speed", 5.0);
+    const MHDProperties::FullInductionMHDProperties mhd_prop(mhd_prop_list);
+
+    const Teuchos::ParameterList user_params;
+    Teuchos::ParameterList bc_params;
+    bc_params.set("Wall Temperature", 1.5);
+
+    // Fluxes
+    suite.run("IncompressibleConvectiveFlux",
+              [&](auto eval_type, const panzer::IntegrationRule& ir) {
+                  using EvalType = decltype(eval_type);
+                  return Teuchos::rcp(
+                      new ClosureModel::IncompressibleConvectiveFlux<
+                          EvalType,
+                          panzer::Traits,
+                          num_space_dim>(ir, fluid_prop));
+              });
+    suite.run("IncompressibleViscousFlux",
+              [&](auto eval_type, const panzer::IntegrationRule& ir) {
+                  using EvalType = decltype(eval_type);
+                  return Teuchos::rcp(
+                      new ClosureModel::IncompressibleViscousFlux<
+                          EvalType,
+                          panzer::Traits,
+                          num_space_dim>(ir, fluid_prop, user_params, false));
+              });
+
+    // Turbulence sources
+    suite.run("IncompressibleSpalartAllmarasSource",
+              [&](auto eval_type, const panzer::IntegrationRule& ir) {
+                  using EvalType = decltype(eval_type);
+                  return Teuchos::rcp(
+                      new ClosureModel::IncompressibleSpalartAllmarasSource<
+                          EvalType,
+                          panzer::Traits,
+                          num_space_dim>(ir, fluid_prop));
+              });
+    suite.run("IncompressibleKEpsilonSource",
+              [&](auto eval_type, const panzer::IntegrationRule& ir) {
+                  using EvalType = decltype(eval_type);
+                  return Teuchos::rcp(
+                      new ClosureModel::IncompressibleKEpsilonSource<
+                          EvalType,
+                          panzer::Traits,
+                          num_space_dim>(ir));
+              });
+
+    // MHD
+    suite.run("LorentzForce",
+              [&](auto eval_type, const panzer::IntegrationRule& ir) {
+                  using EvalType = decltype(eval_type);
+                  return Teuchos::rcp(
+                      new ClosureModel::
+                          LorentzForce<EvalType, panzer::Traits, num_space_dim>(
+                              ir, fluid_prop));
+              });
+    suite.run("InductionConvectiveFlux",
+              [&](auto eval_type, const panzer::IntegrationRule& ir) {
+                  using EvalType = decltype(eval_type);
+                  return Teuchos::rcp(
+                      new ClosureModel::InductionConvectiveFlux<EvalType,
+                                                                panzer::Traits,
+                                                                num_space_dim>(
+                          ir, mhd_prop));
+              });
+
+    // Boundary states
+    suite.run("IncompressibleNoSlip",
+              [&](auto eval_type, const panzer::IntegrationRule& ir) {
+                  using EvalType = decltype(eval_type);
+                  return Teuchos::rcp(
+                      new BoundaryCondition::IncompressibleNoSlip<EvalType,
+                                                                  panzer::Traits,
+                                                                  num_space_dim>(
+                          ir, fluid_prop, bc_params, "AC"));
+              });
+
+    return suite.results();
+}
+
+//---------------------------------------------------------------------------//
+int main(int argc, char* argv[])
+{
+    Teuchos::GlobalMPISession mpi_session(&argc, &argv, nullptr);
+    Kokkos::ScopeGuard kokkos(argc, argv);
+
+    int comm_rank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+
+    // Parse the command line.
+    Benchmark::BenchmarkOptions options;
+    int num_space_dim = 3;
+    std::string workset_sizes = "128,1024";
+    std::string baseline_file;
+    std::string output_file;
+    double tolerance = 0.2;
+
+    Teuchos::CommandLineProcessor clp;
+    clp.recogniseAllOptions(false);
+    clp.setDocString(
+        "Time the closure models for the residual and Jacobian evaluations "
+        "and optionally compare the throughput against a baseline.");
+    clp.setOption("dim", &num_space_dim, "Number of space dimensions");
+    clp.setOption("workset-sizes",
+                  &workset_sizes,
+                  "Comma separated list of the number of cells per workset");
+    clp.setOption("evaluations",
+                  &options.num_evaluation,
+                  "Number of evaluations per timing sample");
+    clp.setOption("samples",
+                  &options.num_sample,
+                  "Number of timing samples, the fastest is reported");
+    clp.setOption("derivative-dimension",
+                  &options.derivative_dimension,
+                  "Number of derivatives of the Jacobian scalar type (default "
+                  "is the number of basis functions times the number of "
+                  "Navier-Stokes equations)");
+    clp.setOption("integration-order",
+                  &options.integration_order,
+                  "Integration order");
+    clp.setOption("basis-order", &options.basis_order, "Basis order");
+    clp.setOption("filter",
+                  &options.filter,
+                  "Only run the benchmarks whose name contains this string");
+    clp.setOption(
+        "baseline", &baseline_file, "Baseline XML file to compare against");
+    clp.setOption("output", &output_file, "XML file to write the results to");
+    clp.setOption("tolerance",
+                  &tolerance,
+                  "Relative throughput loss allowed against the baseline");
+    const auto parse_result = clp.parse(argc, argv, &std::cerr);
+    if (parse_result == Teuchos::CommandLineProcessor::PARSE_HELP_PRINTED)
+        return 0;
+    if (parse_result != Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL)
+        return 1;
+
+    options.workset_sizes = parse_workset_sizes(workset_sizes);
+    if (options.num_evaluation < 1 || options.num_sample < 1)
+    {
+        throw std::runtime_error(
+            "The number of evaluations and samples must be positive.");
+    }
+
+    // Run the benchmarks.
+    Benchmark::BenchmarkResults results;
+    switch (num_space_dim)
+    {
+        case 2:
+            results = run_benchmarks<2>(options);
+            break;
+        case 3:
+            results = run_benchmarks<3>(options);
+            break;
+        default:
+            throw std::runtime_error("Invalid spatial dimensions ("
+                                     + std::to_string(num_space_dim)
+                                     + "): must be 2 or 3.");
+    }
+
+    // Report the results on the first rank.
+    int num_regression = 0;
+    if (comm_rank == 0)
+    {
+        std::cout << "\nClosure model benchmarks (" << num_space_dim
+                  << "D, Kokkos execution space "
+                  << Kokkos::DefaultExecutionSpace::name() << ")\n";
+        results.print(std::cout);
+
+        if (!output_file.empty())
+            results.write(output_file);
+
+        if (!baseline_file.empty())
+        {
+            const auto baseline
+                = Benchmark::BenchmarkResults::read(baseline_file);
+            std::cout << "\n";
+            num_regression = results.compare(baseline, tolerance, std::cout);
+            std::cout << "\n"
+                      << num_regression << " regression(s) found.\n";
+        }
+    }
+    MPI_Bcast(&num_regression, 1, MPI_INT, 0, MPI_COMM_WORLD);
+
+    return num_regression > 0 ? 1 : 0;
+}
+
+//---------------------------------------------------------------------------//
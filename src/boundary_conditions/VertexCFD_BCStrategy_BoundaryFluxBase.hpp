@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_BOUNDARYCONDITION_BOUNDARYFLUXBASE_HPP
 #define VERTEXCFD_BOUNDARYCONDITION_BOUNDARYFLUXBASE_HPP
 
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
+
 #include <Panzer_BCStrategy.hpp>
 #include <Panzer_Evaluator_WithBaseImpl.hpp>
 #include <Panzer_GlobalDataAcceptor_DefaultImpl.hpp>
@@ -19,9 +21,10 @@ namespace BoundaryCondition
 {
 //---------------------------------------------------------------------------//
 template<class EvalType, int NumSpaceDim>
-class BoundaryFluxBase : public panzer::BCStrategy<EvalType>,
-                         public panzer::GlobalDataAcceptorDefaultImpl,
-                         public panzer::EvaluatorWithBaseImpl<panzer::Traits>
+class BoundaryFluxBase
+    : public Utils::ProfiledRegistrar<panzer::BCStrategy<EvalType>>,
+      public panzer::GlobalDataAcceptorDefaultImpl,
+      public panzer::EvaluatorWithBaseImpl<panzer::Traits>
 {
   public:
     // Space dimension
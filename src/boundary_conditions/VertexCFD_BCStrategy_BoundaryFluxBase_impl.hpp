@@ -28,7 +28,7 @@ namespace BoundaryCondition
 template<class EvalType, int NumSpaceDim>
 BoundaryFluxBase<EvalType, NumSpaceDim>::BoundaryFluxBase(
     const panzer::BC& bc, const Teuchos::RCP<panzer::GlobalData>& global_data)
-    : panzer::BCStrategy<EvalType>(bc)
+    : Utils::ProfiledRegistrar<panzer::BCStrategy<EvalType>>(bc)
     , panzer::GlobalDataAcceptorDefaultImpl(global_data)
 {
     // Initialize `bnd_prefix` to use with second-order flux
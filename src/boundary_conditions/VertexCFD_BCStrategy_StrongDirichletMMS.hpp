@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_BOUNDARYCONDITION_STORNGDIRICHLETMMS_HPP
 #define VERTEXCFD_BOUNDARYCONDITION_STORNGDIRICHLETMMS_HPP
 
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
+
 #include <Panzer_BCStrategy_Dirichlet_DefaultImpl.hpp>
 #include <Panzer_PhysicsBlock.hpp>
 #include <Panzer_PureBasis.hpp>
@@ -19,7 +21,8 @@ namespace BoundaryCondition
 //---------------------------------------------------------------------------//
 template<class EvalType>
 class StrongDirichletMMS
-    : public panzer::BCStrategy_Dirichlet_DefaultImpl<EvalType>
+    : public Utils::ProfiledRegistrar<
+          panzer::BCStrategy_Dirichlet_DefaultImpl<EvalType>>
 {
   public:
     StrongDirichletMMS(const panzer::BC& bc,
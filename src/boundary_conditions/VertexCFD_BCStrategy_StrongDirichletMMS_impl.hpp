@@ -11,7 +11,8 @@ namespace BoundaryCondition
 template<class EvalType>
 StrongDirichletMMS<EvalType>::StrongDirichletMMS(
     const panzer::BC& bc, const Teuchos::RCP<panzer::GlobalData>& global_data)
-    : panzer::BCStrategy_Dirichlet_DefaultImpl<EvalType>(bc, global_data)
+    : Utils::ProfiledRegistrar<
+        panzer::BCStrategy_Dirichlet_DefaultImpl<EvalType>>(bc, global_data)
 {
     if (this->m_bc.strategy() != "StrongDirichletMMS")
     {
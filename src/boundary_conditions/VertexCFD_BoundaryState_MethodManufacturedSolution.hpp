@@ -38,8 +38,7 @@ class MethodManufacturedSolution
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point>
         _boundary_lagrange_pressure;
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_VISCOUSPENALTYPARAMETER_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_VISCOUSPENALTYPARAMETER_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
+
 #include "Panzer_Workset_Utilities.hpp"
 #include <Panzer_HierarchicParallelism.hpp>
 
@@ -66,39 +68,34 @@ void ViscousPenaltyParameter<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
     _ip_gradients = this->wda(workset).bases[_basis_index]->grad_basis;
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _ip_gradients.extent(2);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 ViscousPenaltyParameter<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
     const int num_basis = _ip_gradients.extent(1);
-    const int num_point = _ip_gradients.extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            using std::sqrt;
-            double one_over_h = 0.0;
-            for (int basis = 0; basis < num_basis; ++basis)
-            {
-                double one_over_h2_basis = 0.0;
-                for (int dim = 0; dim < _num_space_dim; ++dim)
-                {
-                    one_over_h2_basis
-                        += _ip_gradients(cell, basis, point, dim)
-                           * _ip_gradients(cell, basis, point, dim);
-                }
-                one_over_h += sqrt(one_over_h2_basis);
-            }
-
-            _penalty_param(cell, point) = _penalty * one_over_h;
-        });
+    using std::sqrt;
+    double one_over_h = 0.0;
+    for (int basis = 0; basis < num_basis; ++basis)
+    {
+        double one_over_h2_basis = 0.0;
+        for (int dim = 0; dim < _num_space_dim; ++dim)
+        {
+            one_over_h2_basis
+                += _ip_gradients(cell, basis, point, dim)
+                   * _ip_gradients(cell, basis, point, dim);
+        }
+        one_over_h += sqrt(one_over_h2_basis);
+    }
+
+    _penalty_param(cell, point) = _penalty * one_over_h;
 }
 
 //---------------------------------------------------------------------------//
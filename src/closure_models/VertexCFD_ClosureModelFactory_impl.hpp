@@ -17,6 +17,7 @@
 #include "induction_less_mhd_solver/closure_models/VertexCFD_InductionlessClosureModelFactory.hpp"
 #include "turbulence_models/closure_models/VertexCFD_TurbulenceClosureModelFactory.hpp"
 
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
 #include "utils/VertexCFD_Utils_VectorizeOutputFieldNames.hpp"
 
 namespace VertexCFD
@@ -286,6 +287,10 @@ Factory<EvalType, NumSpaceDim>::buildClosureModels(
         }
     }
 
+    // Time the closure models when evaluator profiling is enabled.
+    for (auto& eval : *evaluators)
+        eval = Utils::profiledEvaluator<EvalType>(eval);
+
     return evaluators;
 }
 
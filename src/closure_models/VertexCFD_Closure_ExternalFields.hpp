@@ -26,7 +26,9 @@ namespace ClosureModel
 {
 //---------------------------------------------------------------------------//
 // Add external fields from another physics manager as a closure model. This
-// will gather the fields and put them at the basis points.
+// will gather the fields and put them at the basis points, or copy the values
+// interpolated at the basis points if the external fields manager
+// interpolates to this mesh.
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 class ExternalFields : public panzer::EvaluatorWithBaseImpl<Traits>,
@@ -57,6 +59,9 @@ class ExternalFields : public panzer::EvaluatorWithBaseImpl<Traits>,
     Teuchos::RCP<const panzer::GlobalIndexer> _global_indexer;
     std::vector<int> _field_ids;
     Kokkos::View<double*, PHX::Device> _ghosted_field_data;
+    bool _interpolated;
+    std::vector<int> _field_indices;
+    Kokkos::View<double***, PHX::Device> _interpolated_field_data;
     Kokkos::View<int**, PHX::Device> _scratch_lids;
     std::vector<Kokkos::View<int*, PHX::Device>> _scratch_offsets;
 };
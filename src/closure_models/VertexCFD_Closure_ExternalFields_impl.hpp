@@ -3,6 +3,8 @@
 
 #include <Panzer_HierarchicParallelism.hpp>
 
+#include <stdexcept>
+
 namespace VertexCFD
 {
 namespace ClosureModel
@@ -20,6 +22,7 @@ ExternalFields<EvalType, Traits>::ExternalFields(
     , _global_indexer(external_fields_manager->globalIndexer())
     , _field_ids(_num_field)
     , _ghosted_field_data(external_fields_manager->ghostedFieldData())
+    , _interpolated(external_fields_manager->isInterpolated())
 {
     // Setup evaluator data.
     for (int f = 0; f < _num_field; ++f)
@@ -31,6 +34,27 @@ ExternalFields<EvalType, Traits>::ExternalFields(
     }
     this->setName(evaluator_name);
 
+    // Get the interpolated field indices.
+    if (_interpolated)
+    {
+        _interpolated_field_data
+            = external_fields_manager->interpolatedFieldData();
+        if (basis->cardinality()
+            != static_cast<int>(_interpolated_field_data.extent(1)))
+        {
+            throw std::runtime_error(
+                "External field interpolation basis order does not match "
+                "the basis of the external field closure model");
+        }
+        _field_indices.resize(_num_field);
+        for (int f = 0; f < _num_field; ++f)
+        {
+            _field_indices[f] = external_fields_manager->interpolatedFieldIndex(
+                external_field_names[f]);
+        }
+        return;
+    }
+
     // Get the field ids.
     for (int f = 0; f < _num_field; ++f)
     {
@@ -43,6 +67,9 @@ template<class EvalType, class Traits>
 void ExternalFields<EvalType, Traits>::postRegistrationSetup(
     typename Traits::SetupData d, PHX::FieldManager<Traits>&)
 {
+    if (_interpolated)
+        return;
+
     // Setup scratch data for reading the vector data.
     _scratch_offsets.resize(_num_field);
     const auto& workset_0 = (*d.worksets_)[0];
@@ -72,6 +99,29 @@ void ExternalFields<EvalType, Traits>::postRegistrationSetup(
 template<class EvalType, class Traits>
 void ExternalFields<EvalType, Traits>::evaluateFields(typename Traits::EvalData d)
 {
+    if (_interpolated)
+    {
+        // Copy the values interpolated at the basis points of each cell.
+        auto cell_ids = this->wda(d).cell_local_ids_k;
+        auto field_data = _interpolated_field_data;
+        for (int f = 0; f < _num_field; ++f)
+        {
+            const int index = _field_indices[f];
+            auto gather_field = _external_fields[f].get_static_view();
+            Kokkos::parallel_for(
+                Kokkos::RangePolicy<PHX::Device>(0, d.num_cells),
+                KOKKOS_LAMBDA(const int cell) {
+                    const int num_basis = gather_field.extent(1);
+                    for (int basis = 0; basis < num_basis; ++basis)
+                    {
+                        gather_field(cell, basis)
+                            = field_data(cell_ids(cell), basis, index);
+                    }
+                });
+        }
+        return;
+    }
+
     // Get the local ids.
     _global_indexer->getElementLIDs(this->wda(d).cell_local_ids_k,
                                     _scratch_lids);
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_CLOSURE_MEASUREELEMENTLENGTH_HPP
 #define VERTEXCFD_CLOSURE_MEASUREELEMENTLENGTH_HPP
 
+#include "utils/VertexCFD_Utils_WorksetFieldCache.hpp"
+
 #include <Panzer_Dimension.hpp>
 #include <Panzer_Evaluator_WithBaseImpl.hpp>
 
@@ -38,10 +40,16 @@ class MeasureElementLength : public panzer::EvaluatorWithBaseImpl<Traits>,
         const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
 
   private:
+    // Compute the element length of the cells of a workset.
+    void computeElementLength(const panzer::Workset& workset);
+
     int _ir_degree;
     int _ir_index;
 
     PHX::MDField<const double, panzer::Cell, panzer::Point> _cell_det;
+
+    // Element length of each workset computed during setup
+    Utils::WorksetFieldCache<decltype(_element_length)> _cache;
 };
 
 //---------------------------------------------------------------------------//
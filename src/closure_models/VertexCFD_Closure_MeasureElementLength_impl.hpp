@@ -35,12 +35,33 @@ void MeasureElementLength<EvalType, Traits>::postRegistrationSetup(
     typename Traits::SetupData sd, PHX::FieldManager<Traits>&)
 {
     _ir_index = panzer::getIntegrationRuleIndex(_ir_degree, (*sd.worksets_)[0]);
+
+    // The element length only depends on the mesh geometry and is computed
+    // once for each workset.
+    _cache.initialize(*sd.worksets_);
+    for (const auto& workset : *sd.worksets_)
+    {
+        if (workset.num_cells > 0)
+        {
+            this->computeElementLength(workset);
+            _cache.store(workset, _element_length);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 void MeasureElementLength<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
+{
+    if (!_cache.load(workset, _element_length))
+        this->computeElementLength(workset);
+}
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits>
+void MeasureElementLength<EvalType, Traits>::computeElementLength(
+    const panzer::Workset& workset)
 {
     _cell_det = workset.int_rules[_ir_index]->jac_det;
     auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
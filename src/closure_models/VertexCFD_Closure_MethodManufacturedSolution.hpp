@@ -36,8 +36,7 @@ class MethodManufacturedSolution
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
     PHX::MDField<double, panzer::Cell, panzer::Point> _lagrange_pressure;
     Kokkos::Array<PHX::MDField<double, panzer::Cell, panzer::Point>, num_space_dim>
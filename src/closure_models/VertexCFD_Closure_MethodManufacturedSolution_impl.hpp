@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_METHODMANUFACTUREDSOLUTION_IMPL_HPP
 #define VERTEXCFD_CLOSURE_METHODMANUFACTUREDSOLUTION_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_Constants.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
@@ -101,51 +102,46 @@ void MethodManufacturedSolution<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
     _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 MethodManufacturedSolution<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
     using Constants::pi;
     using std::sin;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // function = B + A * sin(2*pi*f_x*(x-phi_x)) *
-            // sin(2*pi*f_y*(y-phi_y))
-            //                  * sin(2*pi*f_z*(z-phi_z)) for 3D
-            auto set_function =
-                [=](const Kokkos::Array<double, num_coeff> coeff,
-                    const Kokkos::Array<double, num_space_dim> x) {
-                    double val = coeff[0]
-                                 * sin(2.0 * pi * coeff[2] * (x[0] - coeff[3]))
-                                 * sin(2.0 * pi * coeff[4] * (x[1] - coeff[5]));
-                    double return_val = num_space_dim == 2
-                                            ? val + coeff[1]
-                                            : val
-                                                      * sin(2.0 * pi * coeff[6]
-                                                            * (x[2] - coeff[7]))
-                                                  + coeff[1];
-                    return return_val;
-                };
-
-            Kokkos::Array<double, num_space_dim> x;
-            for (int dim = 0; dim < num_space_dim; ++dim)
-                x[dim] = _ip_coords(cell, point, dim);
-
-            _lagrange_pressure(cell, point) = set_function(_phi_coeff, x);
-            _temperature(cell, point) = set_function(_T_coeff, x);
-            for (int i = 0; i < num_space_dim; ++i)
-                _velocity[i](cell, point) = set_function(_vel_coeff[i], x);
-        });
+    // function = B + A * sin(2*pi*f_x*(x-phi_x)) *
+    // sin(2*pi*f_y*(y-phi_y))
+    //                  * sin(2*pi*f_z*(z-phi_z)) for 3D
+    auto set_function =
+        [=](const Kokkos::Array<double, num_coeff> coeff,
+            const Kokkos::Array<double, num_space_dim> x) {
+            double val = coeff[0]
+                         * sin(2.0 * pi * coeff[2] * (x[0] - coeff[3]))
+                         * sin(2.0 * pi * coeff[4] * (x[1] - coeff[5]));
+            double return_val = num_space_dim == 2
+                                    ? val + coeff[1]
+                                    : val
+                                              * sin(2.0 * pi * coeff[6]
+                                                    * (x[2] - coeff[7]))
+                                          + coeff[1];
+            return return_val;
+        };
+
+    Kokkos::Array<double, num_space_dim> x;
+    for (int dim = 0; dim < num_space_dim; ++dim)
+        x[dim] = _ip_coords(cell, point, dim);
+
+    _lagrange_pressure(cell, point) = set_function(_phi_coeff, x);
+    _temperature(cell, point) = set_function(_T_coeff, x);
+    for (int i = 0; i < num_space_dim; ++i)
+        _velocity[i](cell, point) = set_function(_vel_coeff[i], x);
 }
 
 //---------------------------------------------------------------------------//
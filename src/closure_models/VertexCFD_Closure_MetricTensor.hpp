@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_CLOSURE_METRICTENSOR_HPP
 #define VERTEXCFD_CLOSURE_METRICTENSOR_HPP
 
+#include "utils/VertexCFD_Utils_WorksetFieldCache.hpp"
+
 #include <Panzer_Dimension.hpp>
 #include <Panzer_Evaluator_WithBaseImpl.hpp>
 #include <Panzer_IntegrationRule.hpp>
@@ -41,6 +43,9 @@ class MetricTensor : public panzer::EvaluatorWithBaseImpl<Traits>,
                const int point) const;
 
   private:
+    // Compute the metric tensor of the cells of a workset.
+    void computeMetricTensor(const panzer::Workset& workset);
+
     const int _ir_degree;
     const int _num_topo_dim;
     int _ir_index;
@@ -49,6 +54,9 @@ class MetricTensor : public panzer::EvaluatorWithBaseImpl<Traits>,
         _jacobian;
 
     Kokkos::View<double**, PHX::mem_space> _element_map;
+
+    // Metric tensor of each workset computed during setup
+    Utils::WorksetFieldCache<decltype(_metric_tensor)> _cache;
 };
 
 //---------------------------------------------------------------------------//
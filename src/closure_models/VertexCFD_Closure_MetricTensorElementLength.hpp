@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_CLOSURE_METRICTENSORELEMENTLENGTH_HPP
 #define VERTEXCFD_CLOSURE_METRICTENSORELEMENTLENGTH_HPP
 
+#include "utils/VertexCFD_Utils_WorksetFieldCache.hpp"
+
 #include <Panzer_Dimension.hpp>
 #include <Panzer_Evaluator_WithBaseImpl.hpp>
 
@@ -29,6 +31,9 @@ class MetricTensorElementLength
     MetricTensorElementLength(const panzer::IntegrationRule& ir,
                               const std::string& prefix = "");
 
+    void postRegistrationSetup(typename Traits::SetupData sd,
+                               PHX::FieldManager<Traits>& fm) override;
+
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
@@ -38,6 +43,9 @@ class MetricTensorElementLength
   private:
     PHX::MDField<const double, panzer::Cell, panzer::Point, panzer::Dim, panzer::Dim>
         _metric_tensor;
+
+    // Element length of each workset computed at its first evaluation
+    Utils::WorksetFieldCache<decltype(_element_length)> _cache;
 };
 
 //---------------------------------------------------------------------------//
@@ -22,14 +22,29 @@ MetricTensorElementLength<EvalType, Traits>::MetricTensorElementLength(
     this->setName("Metric Tensor Element Length");
 }
 
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits>
+void MetricTensorElementLength<EvalType, Traits>::postRegistrationSetup(
+    typename Traits::SetupData sd, PHX::FieldManager<Traits>&)
+{
+    _cache.initialize(*sd.worksets_);
+}
+
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 void MetricTensorElementLength<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
+    // The element length only depends on the mesh geometry. The metric
+    // tensor is not available during setup, so the element length of a
+    // workset is stored after its first evaluation.
+    if (_cache.load(workset, _element_length))
+        return;
+
     auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
         workset.num_cells);
     Kokkos::parallel_for(this->getName(), policy, *this);
+    _cache.store(workset, _element_length);
 }
 
 //---------------------------------------------------------------------------//
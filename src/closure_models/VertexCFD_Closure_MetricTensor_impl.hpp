@@ -123,12 +123,33 @@ void MetricTensor<EvalType, Traits>::postRegistrationSetup(
     typename Traits::SetupData sd, PHX::FieldManager<Traits>&)
 {
     _ir_index = panzer::getIntegrationRuleIndex(_ir_degree, (*sd.worksets_)[0]);
+
+    // The metric tensor only depends on the mesh geometry and is computed
+    // once for each workset.
+    _cache.initialize(*sd.worksets_);
+    for (const auto& workset : *sd.worksets_)
+    {
+        if (workset.num_cells > 0)
+        {
+            this->computeMetricTensor(workset);
+            _cache.store(workset, _metric_tensor);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 void MetricTensor<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
+{
+    if (!_cache.load(workset, _metric_tensor))
+        this->computeMetricTensor(workset);
+}
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits>
+void MetricTensor<EvalType, Traits>::computeMetricTensor(
+    const panzer::Workset& workset)
 {
     _jacobian = workset.int_rules[_ir_index]->jac;
 
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_CLOSURE_SINGULARVALUEELEMENTLENGTH_HPP
 #define VERTEXCFD_CLOSURE_SINGULARVALUEELEMENTLENGTH_HPP
 
+#include "utils/VertexCFD_Utils_WorksetFieldCache.hpp"
+
 #include <Panzer_Dimension.hpp>
 #include <Panzer_Evaluator_WithBaseImpl.hpp>
 
@@ -36,10 +38,12 @@ class SingularValueElementLength
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   private:
+    // Compute the element length of the cells of a workset.
+    void computeElementLength(const panzer::Workset& workset);
+
     int _ir_degree;
     int _ir_index;
 
@@ -52,6 +56,9 @@ class SingularValueElementLength
 
     PHX::MDField<const double, panzer::Cell, panzer::Point, panzer::Dim, panzer::Dim>
         _cell_jac;
+
+    // Element length of each workset computed during setup
+    Utils::WorksetFieldCache<decltype(_element_length)> _cache;
 };
 
 //---------------------------------------------------------------------------//
@@ -35,8 +35,7 @@ class VectorFieldDivergence : public panzer::EvaluatorWithBaseImpl<Traits>,
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   private:
     int _num_grad_dim;
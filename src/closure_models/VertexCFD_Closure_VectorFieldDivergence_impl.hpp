@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_VECTORFIELDDIVERGENCE_IMPL_HPP
 #define VERTEXCFD_CLOSURE_VECTORFIELDDIVERGENCE_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_SmoothMath.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
@@ -40,35 +41,30 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void VectorFieldDivergence<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _grad_vector_field[0].extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 VectorFieldDivergence<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _grad_vector_field[0].extent(1);
     const double abs_tol = 1.0e-12;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            _vector_field_divergence(cell, point) = 0.0;
-            for (int d = 0; d < _num_grad_dim; ++d)
-            {
-                _vector_field_divergence(cell, point)
-                    += _grad_vector_field[d](cell, point, d);
-            }
-            if (_use_abs)
-            {
-                _vector_field_divergence(cell, point) = SmoothMath::abs(
-                    _vector_field_divergence(cell, point), abs_tol);
-            }
-        });
+    _vector_field_divergence(cell, point) = 0.0;
+    for (int d = 0; d < _num_grad_dim; ++d)
+    {
+        _vector_field_divergence(cell, point)
+            += _grad_vector_field[d](cell, point, d);
+    }
+    if (_use_abs)
+    {
+        _vector_field_divergence(cell, point) = SmoothMath::abs(
+            _vector_field_divergence(cell, point), abs_tol);
+    }
 }
 
 //---------------------------------------------------------------------------//
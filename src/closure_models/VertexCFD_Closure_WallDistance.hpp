@@ -2,6 +2,7 @@
 #define VERTEXCFD_CLOSURE_WALLDISTANCE_HPP
 
 #include <drivers/VertexCFD_MeshManager.hpp>
+#include <mesh/VertexCFD_Mesh_BoundingVolumeHierarchy.hpp>
 #include <mesh/VertexCFD_Mesh_GeometryData.hpp>
 
 #include <Panzer_Dimension.hpp>
@@ -16,12 +17,17 @@
 #include <Shards_CellTopology.hpp>
 
 #include <Kokkos_Core.hpp>
+#include <Kokkos_DynRankView.hpp>
 
 #include "Panzer_CommonArrayFactories.hpp"
 #include <Panzer_CellData.hpp>
 #include <Panzer_STK_Interface.hpp>
 #include <Panzer_STK_SetupUtilities.hpp>
 
+#include <cstdint>
+#include <string>
+#include <vector>
+
 namespace VertexCFD
 {
 namespace ClosureModel
@@ -40,6 +46,9 @@ class WallDistance : public panzer::EvaluatorWithBaseImpl<Traits>,
     struct RegistrationTag
     {
     };
+    struct InterpolationTag
+    {
+    };
 
     using scalar_type = typename EvalType::ScalarT;
     static constexpr int num_space_dim = NumSpaceDim;
@@ -59,11 +68,22 @@ class WallDistance : public panzer::EvaluatorWithBaseImpl<Traits>,
     KOKKOS_INLINE_FUNCTION
     void operator()(RegistrationTag, const int cell) const;
 
+    KOKKOS_INLINE_FUNCTION
+    void operator()(InterpolationTag, const int cell) const;
+
   public:
     // Panzer field for storing wall distance
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point> _distance;
 
   private:
+    // Build the wall side data or solve for the nodal distance needed to
+    // compute the distance at the integration points.
+    void setupDistance();
+
+    // Distance from an integration point to a single wall side.
+    KOKKOS_INLINE_FUNCTION
+    double sideDistance(const int side, const int cell, const int point) const;
+
     // Integration rule cubature degree needed for getting integration point
     // coordinates
     double _ir_degree;
@@ -81,6 +101,10 @@ class WallDistance : public panzer::EvaluatorWithBaseImpl<Traits>,
     // Field of the coordinates of the integration points
     PHX::MDField<const double, panzer::Cell, panzer::Point, panzer::Dim> _ip_coords;
 
+    // Mesh and names of the wall sidesets
+    Teuchos::RCP<panzer_stk::STK_Interface> _mesh;
+    std::vector<std::string> _wall_names;
+
     Teuchos::RCP<const shards::CellTopology> _topology;
     unsigned _key;
 
@@ -93,6 +117,45 @@ class WallDistance : public panzer::EvaluatorWithBaseImpl<Traits>,
     // View for storing the surface normal of global sides
     Kokkos::View<double**, PHX::mem_space> _normals;
 
+    // Method used to compute the wall distance.
+    enum DistanceMethod
+    {
+        geometric,
+        eikonal
+    };
+
+    DistanceMethod _distance_method;
+
+    // Nodal wall distance of the Eikonal method given as (element local id,
+    // node) and the linear basis values at the integration points
+    Kokkos::View<double**, PHX::mem_space> _element_node_distance;
+    Kokkos::DynRankView<double, PHX::Device> _basis_values;
+
+    // Local ids of the cells in the current workset
+    Kokkos::View<const int*, PHX::Device> _cell_local_ids;
+
+    // Method used to find the nearest wall side. The brute force search
+    // checks every side and is kept as a reference for validation.
+    enum SearchMethod
+    {
+        bounding_volume_hierarchy,
+        brute_force
+    };
+
+    SearchMethod _search_method;
+
+    // Gather only the wall sides of the ranks that may hold the nearest
+    // wall instead of replicating all sides.
+    bool _distributed;
+
+    // File used to store the distance between runs and hash of the
+    // parameters the stored distance depends on.
+    std::string _cache_file;
+    std::uint64_t _parameter_hash;
+
+    // Spatial search tree over the wall sides
+    Mesh::Topology::BoundingVolumeHierarchy<> _bvh;
+
     // Vector which stores the workset_id for each workset
     std::vector<std::size_t> _workset_id;
 };
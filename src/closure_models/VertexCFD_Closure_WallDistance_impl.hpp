@@ -2,14 +2,24 @@
 #define VERTEXCFD_CLOSURE_WALLDISTANCE_IMPL_HPP
 
 #include <drivers/VertexCFD_MeshManager.hpp>
+#include <mesh/VertexCFD_Mesh_EikonalWallDistance.hpp>
 #include <mesh/VertexCFD_Mesh_GeometryData.hpp>
 #include <mesh/VertexCFD_Mesh_GeometryPrimitives.hpp>
+#include <mesh/VertexCFD_Mesh_WallDistanceCache.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
+#include <Panzer_IntrepidBasisFactory.hpp>
 #include <Panzer_String_Utilities.hpp>
 #include <Panzer_Workset_Utilities.hpp>
 
+#include <Intrepid2_DefaultCubatureFactory.hpp>
+
+#include <Teuchos_StandardParameterEntryValidators.hpp>
+
 #include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 namespace VertexCFD
 {
@@ -24,26 +34,136 @@ WallDistance<EvalType, Traits, NumSpaceDim>::WallDistance(
     const Teuchos::ParameterList closure_params)
     : _distance("distance", ir.dl_scalar)
     , _ir_degree(ir.cubature_degree)
+    , _mesh(mesh_manager->mesh())
+    , _distance_method(DistanceMethod::geometric)
+    , _search_method(SearchMethod::bounding_volume_hierarchy)
+    , _distributed(false)
+    , _parameter_hash(0)
 {
     this->addEvaluatedField(_distance);
     this->setName("distance");
 
     // Extract the wall names from input to be used to construct the _sides
     // view
-    std::vector<std::string> wall_names;
     auto wall_names_list = closure_params.get<std::string>("Wall Names");
-    panzer::StringTokenizer(wall_names, wall_names_list, ",", true);
+    panzer::StringTokenizer(_wall_names, wall_names_list, ",", true);
 
-    // create a sidesetGeometry instance and store the side data in the _sides
-    // view
-    VertexCFD::Mesh::Topology::SidesetGeometry surfaces(mesh_manager->mesh(),
-                                                        wall_names);
-    _topology = surfaces.topology();
-    _key = _topology->getKey();
-    _sides = surfaces.sides();
-
-    _normals = Kokkos::View<double**, PHX::mem_space>(
-        "normals", _sides.extent(0), num_space_dim);
+    // Get the wall distance method. The geometric method computes the exact
+    // distance to the wall sides while the Eikonal method solves for the
+    // distance on the mesh nodes.
+    if (closure_params.isType<std::string>("Wall Distance Method"))
+    {
+        const auto method_validator = Teuchos::rcp(
+            new Teuchos::StringToIntegralParameterEntryValidator<
+                DistanceMethod>(
+                Teuchos::tuple<std::string>("Geometric", "Eikonal"),
+                "Geometric"));
+        _distance_method = method_validator->getIntegralValue(
+            closure_params.get<std::string>("Wall Distance Method"));
+    }
+
+    // Get the wall side distribution. By default all wall sides are
+    // replicated on every rank. In distributed mode each rank only gathers
+    // the sides of the ranks that may hold the nearest wall of its elements.
+    if (closure_params.isType<std::string>("Wall Distance Distribution"))
+    {
+        const auto distribution_validator = Teuchos::rcp(
+            new Teuchos::StringToIntegralParameterEntryValidator<bool>(
+                Teuchos::tuple<std::string>("Replicated", "Distributed"),
+                Teuchos::tuple<bool>(false, true),
+                "Replicated"));
+        _distributed = distribution_validator->getIntegralValue(
+            closure_params.get<std::string>("Wall Distance Distribution"));
+    }
+
+    // Get the nearest side search method
+    if (closure_params.isType<std::string>("Wall Distance Search"))
+    {
+        const auto type_validator = Teuchos::rcp(
+            new Teuchos::StringToIntegralParameterEntryValidator<SearchMethod>(
+                Teuchos::tuple<std::string>("Bounding Volume Hierarchy",
+                                            "Brute Force"),
+                "Bounding Volume Hierarchy"));
+        _search_method = type_validator->getIntegralValue(
+            closure_params.get<std::string>("Wall Distance Search"));
+    }
+
+    // Get the optional cache file. The distance is only computed if the
+    // file does not exist or was written for a different mesh or set of
+    // parameters, in which case the file is overwritten. The search method
+    // and wall side distribution do not change the result and are not part
+    // of the hash.
+    if (closure_params.isType<std::string>("Wall Distance Cache File"))
+    {
+        _cache_file
+            = closure_params.get<std::string>("Wall Distance Cache File");
+        _parameter_hash = Mesh::WallDistanceCache::hashString(
+            wall_names_list, num_space_dim);
+        _parameter_hash = Mesh::WallDistanceCache::hashValue(
+            static_cast<std::uint64_t>(_ir_degree), _parameter_hash);
+        _parameter_hash = Mesh::WallDistanceCache::hashValue(
+            _distance_method, _parameter_hash);
+    }
+
+    if (_cache_file.empty())
+        this->setupDistance();
+}
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+void WallDistance<EvalType, Traits, NumSpaceDim>::setupDistance()
+{
+    if (_distance_method == DistanceMethod::eikonal)
+    {
+        std::vector<std::string> e_block_names;
+        _mesh->getElementBlockNames(e_block_names);
+        _topology = _mesh->getCellTopology(e_block_names[0]);
+        _key = _topology->getKey();
+
+        // Solve for the nodal wall distance
+        const Mesh::Topology::EikonalWallDistance eikonal(_mesh, _wall_names);
+        _element_node_distance = eikonal.elementNodeDistance();
+
+        // Evaluate the linear nodal basis at the reference integration
+        // points to interpolate the nodal distance
+        Intrepid2::DefaultCubatureFactory cubature_factory;
+        const auto cubature
+            = cubature_factory.create<PHX::exec_space, double, double>(
+                *_topology, static_cast<int>(_ir_degree));
+        const int num_point = cubature->getNumPoints();
+        Kokkos::DynRankView<double, PHX::Device> ref_points(
+            "ref_points", num_point, num_space_dim);
+        Kokkos::DynRankView<double, PHX::Device> ref_weights("ref_weights",
+                                                             num_point);
+        cubature->getCubature(ref_points, ref_weights);
+
+        const auto basis
+            = panzer::createIntrepid2Basis<PHX::exec_space, double, double>(
+                "HGrad", 1, *_topology);
+        _basis_values = Kokkos::DynRankView<double, PHX::Device>(
+            "basis_values", basis->getCardinality(), num_point);
+        basis->getValues(_basis_values, ref_points, Intrepid2::OPERATOR_VALUE);
+    }
+    else
+    {
+        // create a sidesetGeometry instance and store the side data in the
+        // _sides view
+        VertexCFD::Mesh::Topology::SidesetGeometry surfaces(
+            _mesh, _wall_names, _distributed);
+        _topology = surfaces.topology();
+        _key = _topology->getKey();
+        _sides = surfaces.sides();
+
+        _normals = Kokkos::View<double**, PHX::mem_space>(
+            "normals", _sides.extent(0), num_space_dim);
+
+        // Build the spatial search tree over the wall sides
+        if (_search_method == SearchMethod::bounding_volume_hierarchy)
+        {
+            _bvh = Mesh::Topology::BoundingVolumeHierarchy<>(_sides,
+                                                             num_space_dim);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -64,21 +184,98 @@ void WallDistance<EvalType, Traits, NumSpaceDim>::postRegistrationSetup(
     // size the iterator vectors for storing intial workset cell data
     _workset_id.resize(_number_worksets);
 
-    // Loop over worksets to calculate wall distance and fill iterator data
+    // Store the workset identifiers
     for (std::size_t wks = 0; wks < (*sd.worksets_).size(); ++wks)
     {
-        _current_workset = wks;
-        panzer::Workset workset = (*sd.worksets_)[wks];
         // If the workset is empty, skip the iterator setup
+        const panzer::Workset& workset = (*sd.worksets_)[wks];
         if (workset.num_cells > 0)
         {
             _workset_id[wks] = workset.getIdentifier();
         }
-        _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
-        auto policy = Kokkos::RangePolicy<PHX::exec_space, RegistrationTag>(
-            0, workset.num_cells);
-        // Call operator for wall distance over cells in workset "wks"
-        Kokkos::parallel_for(this->getName(), policy, *this);
+    }
+
+    // Load the distance from the cache file of this element block if it
+    // matches the current mesh and parameters.
+    const int num_point = _distance.extent(1);
+    std::unique_ptr<Mesh::WallDistanceCache> cache;
+    if (!_cache_file.empty())
+    {
+        std::vector<int> element_lids;
+        for (const auto& workset : *sd.worksets_)
+        {
+            for (int cell = 0; cell < workset.num_cells; ++cell)
+                element_lids.push_back(workset.cell_local_ids[cell]);
+        }
+        cache = std::make_unique<Mesh::WallDistanceCache>(
+            _mesh,
+            _cache_file + "." + (*sd.worksets_)[0].block_id,
+            element_lids,
+            num_point,
+            _parameter_hash);
+
+        std::vector<double> values;
+        if (cache->read(values))
+        {
+            auto distance_host = Kokkos::create_mirror_view(_distance_vector);
+            int index = 0;
+            for (std::size_t wks = 0; wks < (*sd.worksets_).size(); ++wks)
+            {
+                const int num_cells = (*sd.worksets_)[wks].num_cells;
+                for (int cell = 0; cell < num_cells; ++cell)
+                {
+                    for (int point = 0; point < num_point; ++point)
+                        distance_host(wks, cell, point) = values[index++];
+                }
+            }
+            Kokkos::deep_copy(_distance_vector, distance_host);
+            return;
+        }
+
+        this->setupDistance();
+    }
+
+    // Loop over worksets to calculate wall distance
+    for (std::size_t wks = 0; wks < (*sd.worksets_).size(); ++wks)
+    {
+        _current_workset = wks;
+        panzer::Workset workset = (*sd.worksets_)[wks];
+        if (_distance_method == DistanceMethod::eikonal)
+        {
+            // Interpolate the nodal distance of the cells in workset "wks"
+            _cell_local_ids = workset.cell_local_ids_k;
+            auto policy
+                = Kokkos::RangePolicy<PHX::exec_space, InterpolationTag>(
+                    0, workset.num_cells);
+            Kokkos::parallel_for(this->getName(), policy, *this);
+        }
+        else
+        {
+            _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
+            auto policy
+                = Kokkos::RangePolicy<PHX::exec_space, RegistrationTag>(
+                    0, workset.num_cells);
+            // Call operator for wall distance over cells in workset "wks"
+            Kokkos::parallel_for(this->getName(), policy, *this);
+        }
+    }
+
+    // Save the distance for subsequent runs
+    if (cache)
+    {
+        auto distance_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), _distance_vector);
+        std::vector<double> values;
+        for (std::size_t wks = 0; wks < (*sd.worksets_).size(); ++wks)
+        {
+            const int num_cells = (*sd.worksets_)[wks].num_cells;
+            for (int cell = 0; cell < num_cells; ++cell)
+            {
+                for (int point = 0; point < num_point; ++point)
+                    values.push_back(distance_host(wks, cell, point));
+            }
+        }
+        cache->write(values);
     }
 }
 
@@ -121,43 +318,33 @@ WallDistance<EvalType, Traits, NumSpaceDim>::operator()(RegistrationTag,
     for (int point = 0; point < num_point; ++point)
     {
         double distance = 1e8;
-        double temp = 1e8;
 
-        // loop over sides and calculate the minimum distance to the current ip
-        for (long unsigned int n = 0; n < _sides.extent(0); ++n)
+        if (_search_method == SearchMethod::bounding_volume_hierarchy)
         {
-            // call the triangle distance function and store the distance if
-            // it is a minimum
-            if constexpr (num_space_dim == 3)
+            // traverse the search tree and only calculate the distance to
+            // sides whose bounding box is closer than the current minimum
+            double ip[3] = {0.0, 0.0, 0.0};
+            for (int dim = 0; dim < num_space_dim; ++dim)
+                ip[dim] = _ip_coords(cell, point, dim);
+            distance = _bvh.nearest(
+                ip,
+                [&](const int side) {
+                    return this->sideDistance(side, cell, point);
+                },
+                distance);
+        }
+        else
+        {
+            // loop over sides and calculate the minimum distance to the
+            // current ip
+            for (long unsigned int n = 0; n < _sides.extent(0); ++n)
             {
-                if (_key == shards::Tetrahedron<4>::key)
-                {
-                    int index[3] = {0, 1, 2};
-                    temp = GeometryPrimitives::distanceToTriangleFace(
-                        _sides, _normals, n, _ip_coords, cell, point, index);
-                }
-                if (_key == shards::Hexahedron<8>::key)
+                const double temp = sideDistance(n, cell, point);
+                if (temp < distance)
                 {
-                    int index[3] = {0, 1, 2};
-                    double t2 = GeometryPrimitives::distanceToTriangleFace(
-                        _sides, _normals, n, _ip_coords, cell, point, index);
-                    index[1] = 2;
-                    index[2] = 3;
-                    double t1 = GeometryPrimitives::distanceToTriangleFace(
-                        _sides, _normals, n, _ip_coords, cell, point, index);
-                    temp = std::fmin(t1, t2);
+                    distance = temp;
                 }
             }
-            if constexpr (num_space_dim == 2)
-            {
-                int index[2] = {0, 1};
-                temp = GeometryPrimitives::distanceToLinearEdge(
-                    _sides, n, _ip_coords, cell, point, 2, index);
-            }
-            if (temp < distance)
-            {
-                distance = temp;
-            }
         }
 
         _distance_vector(_current_workset, cell, point) = distance;
@@ -165,6 +352,69 @@ WallDistance<EvalType, Traits, NumSpaceDim>::operator()(RegistrationTag,
 }
 //---------------------------------------------------------------------------//
 
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+KOKKOS_INLINE_FUNCTION void
+WallDistance<EvalType, Traits, NumSpaceDim>::operator()(InterpolationTag,
+                                                        const int cell) const
+{
+    const int num_point = _distance.extent(1);
+    const int num_basis = _basis_values.extent(0);
+    const int lid = _cell_local_ids(cell);
+    for (int point = 0; point < num_point; ++point)
+    {
+        double distance = 0.0;
+        for (int basis = 0; basis < num_basis; ++basis)
+        {
+            distance += _basis_values(basis, point)
+                        * _element_node_distance(lid, basis);
+        }
+        _distance_vector(_current_workset, cell, point) = distance;
+    }
+}
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+KOKKOS_INLINE_FUNCTION double
+WallDistance<EvalType, Traits, NumSpaceDim>::sideDistance(const int side,
+                                                          const int cell,
+                                                          const int point) const
+{
+    double distance = 1e8;
+
+    // call the triangle distance function
+    if constexpr (num_space_dim == 3)
+    {
+        if (_key == shards::Tetrahedron<4>::key)
+        {
+            int index[3] = {0, 1, 2};
+            distance = GeometryPrimitives::distanceToTriangleFace(
+                _sides, _normals, side, _ip_coords, cell, point, index);
+        }
+        if (_key == shards::Hexahedron<8>::key)
+        {
+            int index[3] = {0, 1, 2};
+            double t2 = GeometryPrimitives::distanceToTriangleFace(
+                _sides, _normals, side, _ip_coords, cell, point, index);
+            index[1] = 2;
+            index[2] = 3;
+            double t1 = GeometryPrimitives::distanceToTriangleFace(
+                _sides, _normals, side, _ip_coords, cell, point, index);
+            distance = std::fmin(t1, t2);
+        }
+    }
+    if constexpr (num_space_dim == 2)
+    {
+        int index[2] = {0, 1};
+        distance = GeometryPrimitives::distanceToLinearEdge(
+            _sides, side, _ip_coords, cell, point, 2, index);
+    }
+
+    return distance;
+}
+//---------------------------------------------------------------------------//
+
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
@@ -11,6 +11,8 @@
 
 #include <closure_models/VertexCFD_Closure_ExternalFields.hpp>
 
+#include <Panzer_STK_SquareQuadMeshFactory.hpp>
+
 #include <Phalanx_Evaluator_Derived.hpp>
 #include <Phalanx_Evaluator_WithBaseImpl.hpp>
 
@@ -23,7 +25,9 @@
 #include <mpi.h>
 
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 //---------------------------------------------------------------------------//
 // TESTS
@@ -109,6 +113,76 @@ void testEval()
     }
 }
 
+//---------------------------------------------------------------------------//
+// The external fields are interpolated on a mesh that does not match the
+// external mesh. The test fixture cell has the local id of the first element
+// of the target mesh.
+template<class EvalType>
+void testInterpolated()
+{
+    // Get the MPI communicator.
+    auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+        Teuchos::DefaultComm<int>::getComm());
+
+    constexpr auto num_space_dim = std::integral_constant<int, 2>{};
+
+    // The external fields are constant on a 3x5 mesh of [0,1]x[0,2].
+    const std::string location = VERTEXCFD_DRIVER_TEST_DATA_DIR;
+    auto fields_manager
+        = Teuchos::rcp(new VertexCFD::ExternalFieldsManager<panzer::Traits>(
+            num_space_dim, comm, location + "external_fields_test.xml"));
+
+    auto mesh_factory = Teuchos::rcp(new panzer_stk::SquareQuadMeshFactory());
+    auto mesh_params = Teuchos::parameterList();
+    mesh_params->set("X0", 0.0);
+    mesh_params->set("Y0", 0.0);
+    mesh_params->set("Xf", 1.0);
+    mesh_params->set("Yf", 2.0);
+    mesh_params->set("X Elements", 2);
+    mesh_params->set("Y Elements", 4);
+    mesh_factory->setParameterList(mesh_params);
+    auto target_mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+    mesh_factory->completeMeshConstruction(*target_mesh, MPI_COMM_WORLD);
+
+    // Setup test fixture.
+    const int integration_order = 1;
+    const int basis_order = 1;
+    EvaluatorTestFixture test_fixture(
+        num_space_dim, integration_order, basis_order);
+    const auto basis = test_fixture.basis_ir_layout->getBasis();
+    std::vector<std::string> field_names
+        = {"lagrange_pressure", "velocity_0", "velocity_1"};
+
+    // The interpolation basis must match the basis of the closure model.
+    fields_manager->interpolateToMesh(target_mesh, 2);
+    EXPECT_THROW(ClosureModel::ExternalFields<EvalType, panzer::Traits>(
+                     "external_fields", fields_manager, field_names, basis),
+                 std::runtime_error);
+
+    fields_manager->interpolateToMesh(target_mesh, basis_order);
+    auto external_field_eval = Teuchos::rcp(
+        new ClosureModel::ExternalFields<EvalType, panzer::Traits>(
+            "external_fields", fields_manager, field_names, basis));
+    test_fixture.registerEvaluator<EvalType>(external_field_eval);
+    for (int f = 0; f < 3; ++f)
+    {
+        test_fixture.registerTestField<EvalType>(
+            external_field_eval->_external_fields[f]);
+    }
+
+    test_fixture.evaluate<EvalType>();
+
+    const double values[3] = {1.0, 2.0, 3.0};
+    const int num_point = test_fixture.cardinality();
+    for (int f = 0; f < 3; ++f)
+    {
+        const auto field = test_fixture.getTestFieldData<EvalType>(
+            external_field_eval->_external_fields[f]);
+        for (int i = 0; i < num_point; ++i)
+            EXPECT_NEAR(values[f], fieldValue(field, 0, i), 1.0e-12);
+    }
+}
+
 //---------------------------------------------------------------------------//
 TEST(ExternalFields, residual_test)
 {
@@ -121,6 +195,18 @@ TEST(ExternalFields, jacobian_test)
     testEval<panzer::Traits::Jacobian>();
 }
 
+//---------------------------------------------------------------------------//
+TEST(ExternalFields, interpolated_residual_test)
+{
+    testInterpolated<panzer::Traits::Residual>();
+}
+
+//---------------------------------------------------------------------------//
+TEST(ExternalFields, interpolated_jacobian_test)
+{
+    testInterpolated<panzer::Traits::Jacobian>();
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -73,6 +73,80 @@ TEST(MeasureElementLength, jacobian_test)
     testEval<panzer::Traits::Jacobian>();
 }
 
+//---------------------------------------------------------------------------//
+// The element length of the worksets given at setup is computed once and
+// loaded from the cache in subsequent evaluations. The element length of
+// other worksets is computed at each evaluation.
+template<class EvalType>
+void testCache()
+{
+    // Setup test fixture.
+    int num_space_dim = 2;
+    const int integration_order = 2;
+    const int basis_order = 1;
+    EvaluatorTestFixture test_fixture(
+        num_space_dim, integration_order, basis_order);
+    test_fixture.workset->setIdentifier(1);
+
+    // Create evaluator.
+    auto measure_element_length_eval = Teuchos::rcp(
+        new ClosureModel::MeasureElementLength<EvalType, panzer::Traits>(
+            *test_fixture.ir));
+    test_fixture.registerEvaluator<EvalType>(measure_element_length_eval);
+    test_fixture.registerTestField<EvalType>(
+        measure_element_length_eval->_element_length);
+    test_fixture.setup();
+    const auto element_length_view
+        = measure_element_length_eval->_element_length.get_static_view();
+
+    // Evaluate and check the element length of the workset.
+    const auto evaluate_and_check = [&](const double expected) {
+        Kokkos::deep_copy(element_length_view, 0.0);
+        test_fixture.evaluateFields<EvalType>();
+        auto element_length_result = test_fixture.getTestFieldData<EvalType>(
+            measure_element_length_eval->_element_length);
+        int num_point = element_length_result.extent(1);
+        for (int qp = 0; qp < num_point; ++qp)
+        {
+            EXPECT_DOUBLE_EQ(expected,
+                             fieldValue(element_length_result, 0, qp, 0));
+            EXPECT_DOUBLE_EQ(expected,
+                             fieldValue(element_length_result, 0, qp, 1));
+        }
+    };
+
+    // The second evaluation loads the same values.
+    evaluate_and_check(0.5);
+    evaluate_and_check(0.5);
+
+    // Scale the cell by 2. The cached element length of the workset is not
+    // recomputed.
+    EvaluatorTestFixture::host_coords_view coords("coords", 1, 4, 2);
+    coords(0, 1, 0) = 2.0;
+    coords(0, 2, 0) = 2.0;
+    coords(0, 2, 1) = 2.0;
+    coords(0, 3, 1) = 2.0;
+    test_fixture.setCoordinates(coords);
+    evaluate_and_check(0.5);
+
+    // A workset that was not given at setup is computed.
+    test_fixture.workset->setIdentifier(2);
+    evaluate_and_check(1.0);
+    evaluate_and_check(1.0);
+}
+
+//---------------------------------------------------------------------------//
+TEST(MeasureElementLength, residual_cache_test)
+{
+    testCache<panzer::Traits::Residual>();
+}
+
+//---------------------------------------------------------------------------//
+TEST(MeasureElementLength, jacobian_cache_test)
+{
+    testCache<panzer::Traits::Jacobian>();
+}
+
 //---------------------------------------------------------------------------//
 
 template<class EvalType, int NumSpaceDim>
@@ -12,6 +12,8 @@
 
 #include <Teuchos_RCP.hpp>
 
+#include <Kokkos_Core.hpp>
+
 #include <gtest/gtest.h>
 
 #include <cmath>
@@ -527,6 +529,89 @@ TYPED_TEST(MetricTensorTest, AnisotropicWedge)
     testWedge<TypeParam, AnisotropicCellTest>();
 }
 
+//---------------------------------------------------------------------------//
+// Check the metric tensor of the quadrilateral [0,L]^2, which is L^2 times
+// the identity.
+template<class EvalType, class Field>
+void checkSquareMetric(const EvaluatorTestFixture& test_fixture,
+                       const Field& metric_tensor,
+                       const double length)
+{
+    const auto result = test_fixture.getTestFieldData<EvalType>(metric_tensor);
+    for (int i = 0; i < 2; ++i)
+    {
+        for (int j = 0; j < 2; ++j)
+        {
+            EXPECT_NEAR(i == j ? length * length : 0.0,
+                        fieldValue(result, 0, 0, i, j),
+                        1.0e-14)
+                << "M[" << i << ", " << j << ']';
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// The metric tensor of the worksets given at setup is computed once and
+// loaded from the cache in subsequent evaluations. The metric tensor of
+// other worksets is computed at each evaluation.
+template<class EvalType>
+void testCache()
+{
+    const int num_space_dim = 2;
+    const int integration_order = 0;
+    const int basis_order = 1;
+    EvaluatorTestFixture test_fixture(
+        num_space_dim, integration_order, basis_order);
+    test_fixture.workset->setIdentifier(1);
+
+    auto metric_tensor_eval = Teuchos::rcp(
+        new ClosureModel::MetricTensor<EvalType, panzer::Traits>(
+            *test_fixture.ir));
+    test_fixture.registerEvaluator<EvalType>(metric_tensor_eval);
+    test_fixture.registerTestField<EvalType>(
+        metric_tensor_eval->_metric_tensor);
+    test_fixture.setup();
+    const auto metric_tensor_view
+        = metric_tensor_eval->_metric_tensor.get_static_view();
+
+    // Evaluate twice. The second evaluation loads the same values.
+    for (int i = 0; i < 2; ++i)
+    {
+        Kokkos::deep_copy(metric_tensor_view, 0.0);
+        test_fixture.evaluateFields<EvalType>();
+        checkSquareMetric<EvalType>(
+            test_fixture, metric_tensor_eval->_metric_tensor, 1.0);
+    }
+
+    // Scale the cell by 2. The cached metric tensor of the workset is not
+    // recomputed.
+    EvaluatorTestFixture::host_coords_view coords("coords", 1, 4, 2);
+    coords(0, 1, 0) = 2.0;
+    coords(0, 2, 0) = 2.0;
+    coords(0, 2, 1) = 2.0;
+    coords(0, 3, 1) = 2.0;
+    test_fixture.setCoordinates(coords);
+    Kokkos::deep_copy(metric_tensor_view, 0.0);
+    test_fixture.evaluateFields<EvalType>();
+    checkSquareMetric<EvalType>(
+        test_fixture, metric_tensor_eval->_metric_tensor, 1.0);
+
+    // A workset that was not given at setup is computed.
+    test_fixture.workset->setIdentifier(2);
+    for (int i = 0; i < 2; ++i)
+    {
+        Kokkos::deep_copy(metric_tensor_view, 0.0);
+        test_fixture.evaluateFields<EvalType>();
+        checkSquareMetric<EvalType>(
+            test_fixture, metric_tensor_eval->_metric_tensor, 2.0);
+    }
+}
+
+TYPED_TEST(MetricTensorTest, Cache)
+{
+    testCache<TypeParam>();
+}
+
 //---------------------------------------------------------------------------//
 // Try to construct the evaluator for an unsupported cell topology.
 template<class EvalType>
@@ -42,6 +42,9 @@ struct Dependencies : public PHX::EvaluatorWithBaseImpl<panzer::Traits>,
     PHX::MDField<double, panzer::Cell, panzer::Point, panzer::Dim, panzer::Dim>
         _metric_tensor;
 
+    // Scaling of the metric tensor.
+    double _scale = 1.0;
+
     Dependencies(const panzer::IntegrationRule& ir)
         : _metric_tensor("metric_tensor", ir.dl_tensor)
     {
@@ -69,7 +72,8 @@ struct Dependencies : public PHX::EvaluatorWithBaseImpl<panzer::Traits>,
 
             for (int d = 0; d < num_space_dim; ++d)
             {
-                _metric_tensor(c, qp, d, d) = 0.0625 * (d + 1) * (d + 1);
+                _metric_tensor(c, qp, d, d)
+                    = _scale * 0.0625 * (d + 1) * (d + 1);
             }
         }
     }
@@ -126,6 +130,79 @@ TEST(MetricTensorElementLength, jacobian_test)
     testEval<panzer::Traits::Jacobian>();
 }
 
+//---------------------------------------------------------------------------//
+// The element length of the worksets given at setup is stored at their first
+// evaluation and loaded from the cache in subsequent evaluations. The element
+// length of other worksets is computed at each evaluation.
+template<class EvalType>
+void testCache()
+{
+    // Setup test fixture.
+    const int num_space_dim = 2;
+    const int integration_order = 2;
+    const int basis_order = 1;
+    EvaluatorTestFixture test_fixture(
+        num_space_dim, integration_order, basis_order);
+    test_fixture.workset->setIdentifier(1);
+
+    // Create dependencies.
+    auto dep_eval = Teuchos::rcp(new Dependencies<EvalType>(*test_fixture.ir));
+    test_fixture.registerEvaluator<EvalType>(dep_eval);
+
+    // Create evaluator.
+    auto metric_tensor_eval = Teuchos::rcp(
+        new ClosureModel::MetricTensorElementLength<EvalType, panzer::Traits>(
+            *test_fixture.ir));
+    test_fixture.registerEvaluator<EvalType>(metric_tensor_eval);
+    test_fixture.registerTestField<EvalType>(
+        metric_tensor_eval->_element_length);
+    test_fixture.setup();
+    const auto element_length_view
+        = metric_tensor_eval->_element_length.get_static_view();
+
+    // Evaluate and check the element length of the workset.
+    const auto evaluate_and_check = [&](const double expected) {
+        Kokkos::deep_copy(element_length_view, 0.0);
+        test_fixture.evaluateFields<EvalType>();
+        auto element_length_result = test_fixture.getTestFieldData<EvalType>(
+            metric_tensor_eval->_element_length);
+        int num_point = element_length_result.extent(1);
+        for (int qp = 0; qp < num_point; ++qp)
+        {
+            EXPECT_DOUBLE_EQ(0.25 * expected,
+                             fieldValue(element_length_result, 0, qp, 0));
+            EXPECT_DOUBLE_EQ(0.50 * expected,
+                             fieldValue(element_length_result, 0, qp, 1));
+        }
+    };
+
+    // The second evaluation loads the same values.
+    evaluate_and_check(1.0);
+    evaluate_and_check(1.0);
+
+    // Scale the metric tensor by 4. The cached element length of the
+    // workset is not recomputed.
+    dep_eval->_scale = 4.0;
+    evaluate_and_check(1.0);
+
+    // A workset that was not given at setup is computed.
+    test_fixture.workset->setIdentifier(2);
+    evaluate_and_check(2.0);
+    evaluate_and_check(2.0);
+}
+
+//---------------------------------------------------------------------------//
+TEST(MetricTensorElementLength, residual_cache_test)
+{
+    testCache<panzer::Traits::Residual>();
+}
+
+//---------------------------------------------------------------------------//
+TEST(MetricTensorElementLength, jacobian_cache_test)
+{
+    testCache<panzer::Traits::Jacobian>();
+}
+
 //---------------------------------------------------------------------------//
 
 template<class EvalType, int NumSpaceDim>
@@ -10,6 +10,14 @@
 
 #include <gtest/gtest.h>
 
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
 namespace VertexCFD
 {
 namespace Test
@@ -64,7 +72,11 @@ struct Dependencies : public panzer::EvaluatorWithBaseImpl<panzer::Traits>,
 };
 
 template<class EvalType, int NumSpaceDim>
-void testEval(const std::string element_type)
+void testEval(const std::string element_type,
+              const std::string search = "Bounding Volume Hierarchy",
+              const std::string distribution = "Replicated",
+              const std::string cache_file = "",
+              const std::vector<double>& cached_distance = {})
 {
     constexpr int num_space_dim = NumSpaceDim;
     const int integration_order = 2;
@@ -107,6 +119,14 @@ void testEval(const std::string element_type)
 
     Teuchos::ParameterList closure_params;
     closure_params.set<std::string>("Wall Names", "top,bottom,front,back");
+    closure_params.set<std::string>("Wall Distance Search", search);
+    closure_params.set<std::string>("Wall Distance Distribution",
+                                    distribution);
+    if (!cache_file.empty())
+    {
+        closure_params.set<std::string>("Wall Distance Cache File",
+                                        cache_file);
+    }
 
     const auto dep_eval = Teuchos::rcp(new Dependencies<EvalType>(ir));
     test_fixture.registerEvaluator<EvalType>(dep_eval);
@@ -129,11 +149,103 @@ void testEval(const std::string element_type)
     const int num_point = ir.num_points;
     for (int qp = 0; qp < num_point; ++qp)
     {
-        // Wall distance
-        EXPECT_EQ(fieldValue(fv_exp_dist, 0, qp), fieldValue(fv_dist, 0, qp));
+        // Wall distance, or the distance stored in the cache file if given.
+        const double exp_dist = cached_distance.empty()
+                                    ? fieldValue(fv_exp_dist, 0, qp)
+                                    : cached_distance[qp];
+        EXPECT_EQ(exp_dist, fieldValue(fv_dist, 0, qp));
+    }
+}
+
+//-----------------------------------------------------------------//
+// The Eikonal method interpolates the nodal distance with the linear basis
+// of the element with the local id of the workset cell. The mesh is a single
+// unit element matching the test fixture cell with a wall at y = 0, for
+// which the interpolated distance is exact.
+template<class EvalType, int NumSpaceDim>
+void testEikonal(const std::string element_type)
+{
+    constexpr int num_space_dim = NumSpaceDim;
+    const int integration_order = 2;
+    const int basis_order = 1;
+    EvaluatorTestFixture test_fixture(
+        num_space_dim, integration_order, basis_order);
+
+    auto& ir = *test_fixture.ir;
+
+    auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+        Teuchos::DefaultComm<int>::getComm());
+    Parameter::ParameterDatabase parameter_db(comm);
+    auto mesh_params = parameter_db.meshParameters();
+    mesh_params->set("Mesh Input Type", "Inline");
+    auto& inline_params = mesh_params->sublist("Inline");
+    inline_params.set("Element Type", element_type);
+    auto& mesh_details = inline_params.sublist("Mesh");
+    mesh_details.set("X0", 0.0);
+    mesh_details.set("Xf", 1.0);
+    mesh_details.set("X Elements", 1);
+    mesh_details.set("Y0", 0.0);
+    mesh_details.set("Yf", 1.0);
+    mesh_details.set("Y Elements", 1);
+    if (num_space_dim == 3)
+    {
+        mesh_details.set("Z0", 0.0);
+        mesh_details.set("Zf", 1.0);
+        mesh_details.set("Z Elements", 1);
+    }
+
+    Teuchos::RCP<MeshManager> mesh_manager{
+        Teuchos::rcp(new MeshManager(parameter_db, comm))};
+    mesh_manager->completeMeshConstruction();
+
+    Teuchos::ParameterList closure_params;
+    closure_params.set<std::string>("Wall Names", "bottom");
+    closure_params.set<std::string>("Wall Distance Method", "Eikonal");
+
+    auto eval = Teuchos::rcp(
+        new ClosureModel::WallDistance<EvalType, panzer::Traits, num_space_dim>(
+            ir, mesh_manager, closure_params));
+    test_fixture.registerEvaluator<EvalType>(eval);
+    test_fixture.registerTestField<EvalType>(eval->_distance);
+
+    test_fixture.evaluate<EvalType>();
+
+    auto fv_dist = test_fixture.getTestFieldData<EvalType>(eval->_distance);
+    auto ip_coords = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(),
+        test_fixture.int_values->ip_coordinates.get_static_view());
+
+    const int num_point = ir.num_points;
+    for (int qp = 0; qp < num_point; ++qp)
+    {
+        EXPECT_NEAR(ip_coords(0, qp, 1), fieldValue(fv_dist, 0, qp), 1.0e-12);
     }
 }
 
+//-----------------------------------------------------------------//
+TEST(WallDistanceQuad4, eikonal_residual_test)
+{
+    testEikonal<panzer::Traits::Residual, 2>("Quad4");
+}
+
+//-----------------------------------------------------------------//
+TEST(WallDistanceQuad4, eikonal_jacobian_test)
+{
+    testEikonal<panzer::Traits::Jacobian, 2>("Quad4");
+}
+
+//-----------------------------------------------------------------//
+TEST(WallDistanceHex8, eikonal_residual_test)
+{
+    testEikonal<panzer::Traits::Residual, 3>("Hex8");
+}
+
+//-----------------------------------------------------------------//
+TEST(WallDistanceHex8, eikonal_jacobian_test)
+{
+    testEikonal<panzer::Traits::Jacobian, 3>("Hex8");
+}
+
 //-----------------------------------------------------------------//
 TEST(WallDistanceTet4, residual_test)
 {
@@ -182,6 +294,104 @@ TEST(WallDistanceQuad4, jacobian_test)
     testEval<panzer::Traits::Jacobian, 2>("Quad4");
 }
 
+//-----------------------------------------------------------------//
+TEST(WallDistanceTet4, brute_force_test)
+{
+    testEval<panzer::Traits::Residual, 3>("Tet4", "Brute Force");
+}
+
+//-----------------------------------------------------------------//
+TEST(WallDistanceHex8, brute_force_test)
+{
+    testEval<panzer::Traits::Residual, 3>("Hex8", "Brute Force");
+}
+
+//-----------------------------------------------------------------//
+TEST(WallDistanceQuad4, brute_force_test)
+{
+    testEval<panzer::Traits::Residual, 2>("Quad4", "Brute Force");
+}
+
+//-----------------------------------------------------------------//
+// These tests run on a single rank and only check the closure setup with
+// distributed sides. The exchange of the sides between ranks is tested in
+// the MPI mesh test tstSidesetGeometry.
+TEST(WallDistanceTet4, distributed_test)
+{
+    testEval<panzer::Traits::Residual, 3>(
+        "Tet4", "Bounding Volume Hierarchy", "Distributed");
+}
+
+//-----------------------------------------------------------------//
+TEST(WallDistanceQuad4, distributed_test)
+{
+    testEval<panzer::Traits::Residual, 2>(
+        "Quad4", "Bounding Volume Hierarchy", "Distributed");
+}
+
+//-----------------------------------------------------------------//
+// The first evaluation computes the distance and writes the cache file. The
+// distance values in the file are then overwritten so that the second
+// evaluation can only pass if it reads them back. The file name includes
+// the process id as the tests with different numbers of threads run
+// concurrently.
+template<int NumSpaceDim>
+void testCache(const std::string& element_type)
+{
+    const std::string cache_file = "wall_distance_" + element_type + "_"
+                                   + std::to_string(getpid()) + ".cache";
+
+    // The cache file of each element block is suffixed with the block id.
+    const std::string block_file = cache_file + ".block_0";
+    std::remove(block_file.c_str());
+
+    testEval<panzer::Traits::Residual, NumSpaceDim>(
+        element_type, "Bounding Volume Hierarchy", "Replicated", cache_file);
+
+    // The file stores a header of five 64-bit integers followed by the
+    // distance at each integration point of the single test cell.
+    std::vector<double> cached_distance;
+    {
+        std::ifstream file(block_file, std::ios::binary | std::ios::ate);
+        ASSERT_TRUE(file.good());
+        const std::streamoff header_size = 5 * sizeof(std::uint64_t);
+        const std::streamoff num_point
+            = (static_cast<std::streamoff>(file.tellg()) - header_size)
+              / sizeof(double);
+        ASSERT_GT(num_point, 0);
+        for (int qp = 0; qp < num_point; ++qp)
+            cached_distance.push_back(0.5 + 0.125 * qp);
+    }
+    {
+        std::fstream file(block_file,
+                          std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(5 * sizeof(std::uint64_t));
+        file.write(reinterpret_cast<const char*>(cached_distance.data()),
+                   cached_distance.size() * sizeof(double));
+        ASSERT_TRUE(file.good());
+    }
+
+    testEval<panzer::Traits::Residual, NumSpaceDim>(element_type,
+                                                    "Bounding Volume Hierarchy",
+                                                    "Replicated",
+                                                    cache_file,
+                                                    cached_distance);
+
+    EXPECT_EQ(0, std::remove(block_file.c_str()));
+}
+
+//-----------------------------------------------------------------//
+TEST(WallDistanceQuad4, cache_test)
+{
+    testCache<2>("Quad4");
+}
+
+//-----------------------------------------------------------------//
+TEST(WallDistanceHex8, cache_test)
+{
+    testCache<3>("Hex8");
+}
+
 template<class EvalType, int NumSpaceDim>
 void testFactory()
 {
@@ -1,23 +1,37 @@
 #ifndef VERTEXCFD_EXTERNALFIELDSMANAGER_HPP
 #define VERTEXCFD_EXTERNALFIELDSMANAGER_HPP
 
+#include "VertexCFD_MeshManager.hpp"
+#include "VertexCFD_PhysicsManager.hpp"
+
+#include "mesh/VertexCFD_Mesh_FieldInterpolation.hpp"
+
 #include <Thyra_VectorBase.hpp>
 
 #include <Panzer_GlobalIndexer.hpp>
+#include <Panzer_ReadOnlyVector_GlobalEvaluationData.hpp>
+#include <Panzer_STK_Interface.hpp>
 
 #include <Phalanx_KokkosDeviceTypes.hpp>
 
 #include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 
 #include <Kokkos_Core.hpp>
 
 #include <string>
 #include <type_traits>
+#include <vector>
 
 namespace VertexCFD
 {
 //---------------------------------------------------------------------------//
+// Fields of an external simulation given by its input file. By default the
+// fields are gathered with the DOF layout of the external mesh, which must
+// then match the mesh of this simulation. Otherwise the fields can be
+// interpolated at the basis nodes of the elements of this mesh.
+//---------------------------------------------------------------------------//
 template<class Traits>
 class ExternalFieldsManager
 {
@@ -28,15 +42,51 @@ class ExternalFieldsManager
         const Teuchos::RCP<const Teuchos::MpiComm<int>>& comm,
         const std::string& filename);
 
+    // Interpolate the external fields at the nodes of the HGrad basis of the
+    // given order in the local elements of the target mesh, which may differ
+    // from the external mesh and its decomposition. Collective.
+    void interpolateToMesh(
+        const Teuchos::RCP<const panzer_stk::STK_Interface>& target_mesh,
+        const int basis_order);
+
+    // Read a new external solution from a restart file of the external
+    // simulation, such as the next state of a time series, and update the
+    // field data in place. Collective.
+    void update(const Teuchos::ParameterList& read_restart_params);
+
     Teuchos::RCP<const panzer::GlobalIndexer> globalIndexer() const;
     Kokkos::View<double*, PHX::Device> ghostedFieldData() const;
 
+    // Interpolated fields (cell,basis,field) indexed by the local element id
+    // in the target mesh.
+    bool isInterpolated() const;
+    int interpolatedFieldIndex(const std::string& field_name) const;
+    Kokkos::View<double***, PHX::Device> interpolatedFieldData() const;
+
+  private:
+    // Gather the ghosted solution and interpolate it if needed.
+    void updateFieldData();
+
   private:
+    // External simulation.
+    Teuchos::RCP<MeshManager> _mesh_manager;
+    Teuchos::RCP<PhysicsManager> _physics_manager;
+    Teuchos::RCP<Thyra::VectorBase<double>> _solution;
+    Teuchos::RCP<panzer::ReadOnlyVector_GlobalEvaluationData> _ged;
+
     // External global indexer (DOF manager).
     Teuchos::RCP<const panzer::GlobalIndexer> _global_indexer;
 
     // Gathered local field values.
     Kokkos::View<double*, PHX::Device> _ghosted_field_data;
+
+    // Interpolation to the target mesh.
+    std::vector<std::string> _field_names;
+    Teuchos::RCP<Mesh::FieldInterpolation> _interpolation;
+    Kokkos::View<int*, PHX::Device> _point_cells;
+    Kokkos::View<int*, PHX::Device> _point_bases;
+    Kokkos::View<double**, PHX::Device> _point_values;
+    Kokkos::View<double***, PHX::Device> _interpolated_field_data;
 };
 
 //---------------------------------------------------------------------------//
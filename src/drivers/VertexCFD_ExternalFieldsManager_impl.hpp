@@ -2,14 +2,20 @@
 #define VERTEXCFD_EXTERNALFIELDSMANAGER_IMPL_HPP
 
 #include "VertexCFD_InitialConditionManager.hpp"
-#include "VertexCFD_MeshManager.hpp"
-#include "VertexCFD_PhysicsManager.hpp"
+#include "mesh/VertexCFD_Mesh_Restart.hpp"
 #include "parameters/VertexCFD_ParameterDatabase.hpp"
 
-#include <Panzer_ReadOnlyVector_GlobalEvaluationData.hpp>
+#include <Panzer_IntrepidBasisFactory.hpp>
+
+#include <Intrepid2_CellTools.hpp>
 
 #include <Thyra_DefaultSpmdVector.hpp>
 
+#include <Kokkos_DynRankView.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
 namespace VertexCFD
 {
 //---------------------------------------------------------------------------//
@@ -22,43 +28,125 @@ ExternalFieldsManager<Traits>::ExternalFieldsManager(
 {
     auto parameter_db
         = Teuchos::rcp(new Parameter::ParameterDatabase(comm, filename));
-    auto mesh_manager = Teuchos::rcp(new MeshManager(*parameter_db, comm));
-    auto physics_manager = Teuchos::rcp(
-        new PhysicsManager(num_space_dim, parameter_db, mesh_manager));
-    physics_manager->setupModel();
+    _mesh_manager = Teuchos::rcp(new MeshManager(*parameter_db, comm));
+    _physics_manager = Teuchos::rcp(
+        new PhysicsManager(num_space_dim, parameter_db, _mesh_manager));
+    _physics_manager->setupModel();
 
-    _global_indexer = physics_manager->dofManager();
+    _global_indexer = _physics_manager->dofManager();
+    _field_names.resize(_global_indexer->getNumFields());
+    for (std::size_t f = 0; f < _field_names.size(); ++f)
+        _field_names[f] = _global_indexer->getFieldString(f);
 
     auto ic_manager = Teuchos::rcp(
-        new InitialConditionManager(parameter_db, mesh_manager));
-    Teuchos::RCP<Thyra::VectorBase<double>> solution;
+        new InitialConditionManager(parameter_db, _mesh_manager));
     Teuchos::RCP<Thyra::VectorBase<double>> solution_dot;
     ic_manager->applyInitialConditions(
-        num_space_dim, *physics_manager, solution, solution_dot);
+        num_space_dim, *_physics_manager, _solution, solution_dot);
 
     // Create a global evaluation container for the field data.
-    Teuchos::RCP<panzer::ReadOnlyVector_GlobalEvaluationData> ged;
-    ged = physics_manager->linearObjectFactory()->buildReadOnlyDomainContainer();
-    ged->setOwnedVector(solution);
+    _ged = _physics_manager->linearObjectFactory()
+               ->buildReadOnlyDomainContainer();
 
-    // Gather the ghosted vector of field data.
-    ged->globalToGhost(0);
+    updateFieldData();
+}
 
-    // Get the local vector data.
-    auto ghosted_vector
-        = Teuchos::rcp_dynamic_cast<const Thyra::SpmdVectorBase<double>>(
-            ged->getGhostedVector());
-    auto ghosted_data_host = ghosted_vector->getLocalSubVector();
+//---------------------------------------------------------------------------//
+template<class Traits>
+void ExternalFieldsManager<Traits>::interpolateToMesh(
+    const Teuchos::RCP<const panzer_stk::STK_Interface>& target_mesh,
+    const int basis_order)
+{
+    const int num_space_dim = target_mesh->getDimension();
+
+    // Basis nodes of the owned and ghosted elements of each block.
+    std::vector<std::string> blocks;
+    target_mesh->getElementBlockNames(blocks);
+    std::vector<double> coords;
+    std::vector<int> point_cells;
+    std::vector<int> point_bases;
+    int num_cells = 0;
+    int num_bases = 0;
+    for (const auto& block : blocks)
+    {
+        std::vector<stk::mesh::Entity> elements;
+        target_mesh->getMyElements(block, elements);
+        std::vector<stk::mesh::Entity> neighbor_elements;
+        target_mesh->getNeighborElements(block, neighbor_elements);
+        elements.insert(elements.end(),
+                        neighbor_elements.begin(),
+                        neighbor_elements.end());
+        if (elements.empty())
+            continue;
+
+        const auto topology = target_mesh->getCellTopology(block);
+        const auto basis
+            = panzer::createIntrepid2Basis<PHX::Device, double, double>(
+                "HGrad", basis_order, *topology);
+        const int num_block_bases = basis->getCardinality();
+        num_bases = std::max(num_bases, num_block_bases);
 
-    // Thyra only provides the ghosted data via a host-side array.
-    // We need to copy this data to a device view so that it can be accessed
-    // from the device in kernel below.
-    _ghosted_field_data = Kokkos::View<double*, PHX::Device>(
-        "ghosted_field_data", ghosted_data_host.subDim());
-    auto ghost_mirror = Kokkos::create_mirror(_ghosted_field_data);
-    for (int i = 0; i < ghosted_data_host.subDim(); ++i)
-        ghost_mirror(i) = ghosted_data_host[i];
-    Kokkos::deep_copy(_ghosted_field_data, ghost_mirror);
+        Kokkos::DynRankView<double, PHX::Device> dof_coords(
+            "dof_coords", num_block_bases, num_space_dim);
+        basis->getDofCoords(dof_coords);
+
+        Kokkos::DynRankView<double, PHX::Device> vertices;
+        target_mesh->getElementVertices(elements, block, vertices);
+        Kokkos::DynRankView<double, PHX::Device> nodes(
+            "nodes", elements.size(), num_block_bases, num_space_dim);
+        Intrepid2::CellTools<PHX::Device>::mapToPhysicalFrame(
+            nodes, dof_coords, vertices, *topology);
+        auto nodes_host
+            = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), nodes);
+
+        for (std::size_t e = 0; e < elements.size(); ++e)
+        {
+            const int cell = target_mesh->elementLocalId(elements[e]);
+            num_cells = std::max(num_cells, cell + 1);
+            for (int n = 0; n < num_block_bases; ++n)
+            {
+                for (int dim = 0; dim < num_space_dim; ++dim)
+                    coords.push_back(nodes_host(e, n, dim));
+                point_cells.push_back(cell);
+                point_bases.push_back(n);
+            }
+        }
+    }
+
+    const int num_points = point_cells.size();
+    Kokkos::View<const double**, Kokkos::HostSpace> points(
+        coords.data(), num_points, num_space_dim);
+    _interpolation = Teuchos::rcp(new Mesh::FieldInterpolation(
+        _mesh_manager->mesh(), _global_indexer, _field_names, points));
+
+    _point_cells = Kokkos::View<int*, PHX::Device>("point_cells", num_points);
+    _point_bases = Kokkos::View<int*, PHX::Device>("point_bases", num_points);
+    Kokkos::deep_copy(_point_cells,
+                      Kokkos::View<const int*, Kokkos::HostSpace>(
+                          point_cells.data(), num_points));
+    Kokkos::deep_copy(_point_bases,
+                      Kokkos::View<const int*, Kokkos::HostSpace>(
+                          point_bases.data(), num_points));
+    _point_values = Kokkos::View<double**, PHX::Device>(
+        "point_values", num_points, _field_names.size());
+    _interpolated_field_data = Kokkos::View<double***, PHX::Device>(
+        "interpolated_field_data", num_cells, num_bases, _field_names.size());
+
+    updateFieldData();
+}
+
+//---------------------------------------------------------------------------//
+template<class Traits>
+void ExternalFieldsManager<Traits>::update(
+    const Teuchos::ParameterList& read_restart_params)
+{
+    Mesh::RestartReader restart_reader(_mesh_manager->comm(),
+                                       read_restart_params);
+    auto solution_dot = _solution->clone_v();
+    restart_reader.readSolution(
+        _mesh_manager->mesh(), _global_indexer, _solution, solution_dot);
+
+    updateFieldData();
 }
 
 //---------------------------------------------------------------------------//
@@ -77,6 +165,86 @@ ExternalFieldsManager<Traits>::ghostedFieldData() const
     return _ghosted_field_data;
 }
 
+//---------------------------------------------------------------------------//
+template<class Traits>
+bool ExternalFieldsManager<Traits>::isInterpolated() const
+{
+    return Teuchos::nonnull(_interpolation);
+}
+
+//---------------------------------------------------------------------------//
+template<class Traits>
+int ExternalFieldsManager<Traits>::interpolatedFieldIndex(
+    const std::string& field_name) const
+{
+    const auto itr
+        = std::find(_field_names.begin(), _field_names.end(), field_name);
+    if (itr == _field_names.end())
+    {
+        throw std::runtime_error("External field '" + field_name
+                                 + "' is not defined");
+    }
+    return itr - _field_names.begin();
+}
+
+//---------------------------------------------------------------------------//
+template<class Traits>
+Kokkos::View<double***, PHX::Device>
+ExternalFieldsManager<Traits>::interpolatedFieldData() const
+{
+    return _interpolated_field_data;
+}
+
+//---------------------------------------------------------------------------//
+template<class Traits>
+void ExternalFieldsManager<Traits>::updateFieldData()
+{
+    // Gather the ghosted vector of field data.
+    _ged->setOwnedVector(_solution);
+    _ged->globalToGhost(0);
+
+    // Get the local vector data.
+    auto ghosted_vector
+        = Teuchos::rcp_dynamic_cast<const Thyra::SpmdVectorBase<double>>(
+            _ged->getGhostedVector());
+    auto ghosted_data_host = ghosted_vector->getLocalSubVector();
+
+    // Thyra only provides the ghosted data via a host-side array, which is
+    // copied to the device in one transfer. The device view is updated in
+    // place so that evaluators holding it see the new data.
+    if (_ghosted_field_data.extent(0)
+        != static_cast<std::size_t>(ghosted_data_host.subDim()))
+    {
+        _ghosted_field_data = Kokkos::View<double*, PHX::Device>(
+            "ghosted_field_data", ghosted_data_host.subDim());
+    }
+    Kokkos::View<const double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+        ghosted_data_view(ghosted_data_host.values().get(),
+                          ghosted_data_host.subDim());
+    Kokkos::deep_copy(_ghosted_field_data, ghosted_data_view);
+
+    if (Teuchos::is_null(_interpolation))
+        return;
+
+    // Interpolate and scatter the values to the elements.
+    _interpolation->interpolate(_ghosted_field_data, _point_values);
+    auto point_cells = _point_cells;
+    auto point_bases = _point_bases;
+    auto point_values = _point_values;
+    auto field_data = _interpolated_field_data;
+    const int num_fields = _field_names.size();
+    Kokkos::parallel_for(
+        "VertexCFD::ExternalFieldsManager::updateFieldData",
+        Kokkos::RangePolicy<PHX::exec_space>(0, point_cells.extent(0)),
+        KOKKOS_LAMBDA(const int p) {
+            for (int f = 0; f < num_fields; ++f)
+            {
+                field_data(point_cells(p), point_bases(p), f)
+                    = point_values(p, f);
+            }
+        });
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace VertexCFD
@@ -3,6 +3,8 @@
 #include "closure_models/VertexCFD_ClosureModelFactory_TemplateBuilder.hpp"
 #include "equation_sets/VertexCFD_EquationSet_Factory.hpp"
 #include "linear_solvers/VertexCFD_LinearSolvers_LOWSFactoryBuilder.hpp"
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
 
 #include <PanzerAdaptersSTK_config.hpp>
 #include <Panzer_BlockedEpetraLinearObjFactory.hpp>
@@ -15,6 +17,7 @@
 #include <Panzer_STK_WorksetFactory.hpp>
 #include <Panzer_String_Utilities.hpp>
 
+#include <algorithm>
 #include <map>
 #include <string>
 #include <vector>
@@ -110,6 +113,18 @@ PhysicsManager::PhysicsManager(
         _physics_blocks,
         conn_manager);
 
+    // The number of derivatives of the Jacobian evaluation is the largest
+    // number of element degrees of freedom. It is used to estimate the
+    // memory traffic of the evaluators.
+    int num_element_dofs = 0;
+    for (const auto& pb : _physics_blocks)
+    {
+        num_element_dofs = std::max(
+            num_element_dofs,
+            _dof_manager->getElementBlockGIDCount(pb->elementBlockID()));
+    }
+    Utils::EvaluatorProfiler::inst().setDerivativeDimension(num_element_dofs);
+
     // Toggle on linear algebra type to construct linear object factory
     const std::string lin_alg_type
         = user_params->get<std::string>("Linear Algebra Type", "Tpetra");
@@ -220,6 +235,13 @@ void PhysicsManager::setupModel()
     // Turn on shared memory versions of Panzer kernels when available
     panzer::HP::inst().setUseSharedMemory(true, true);
 
+    // Execution policy of the closure model point kernels.
+    if (user_params->isType<std::string>("Closure Execution Policy"))
+    {
+        Utils::CellPointPolicy::inst().setType(
+            user_params->get<std::string>("Closure Execution Policy"));
+    }
+
     // Setup model.
     auto closure_params = _parameter_db->closureModelParameters();
     const bool write_graph = user_params->get<bool>("Output Graph");
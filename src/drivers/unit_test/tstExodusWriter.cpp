@@ -0,0 +1,153 @@
+#include <VertexCFD_DriverUnitTestConfig.hpp>
+
+#include <drivers/VertexCFD_InitialConditionManager.hpp>
+#include <drivers/VertexCFD_MeshManager.hpp>
+#include <drivers/VertexCFD_PhysicsManager.hpp>
+#include <mesh/VertexCFD_Mesh_ExodusWriter.hpp>
+#include <mesh/VertexCFD_Mesh_StkReaderFactory.hpp>
+
+#include <parameters/VertexCFD_ParameterDatabase.hpp>
+
+#include <Panzer_ClosureModel_Factory_TemplateManager.hpp>
+#include <Panzer_ResponseLibrary.hpp>
+#include <Panzer_STK_IOClosureModel_Factory_TemplateBuilder.hpp>
+
+#include <Thyra_VectorStdOps.hpp>
+
+#include <stk_mesh/base/MetaData.hpp>
+
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Read a time step of an Exodus file and check the time and the nodal
+// values of the solution fields.
+void checkExodusFile(const std::string& file_name,
+                     const int step,
+                     const double time,
+                     const double scale)
+{
+    Mesh::StkReaderFactory reader(file_name, step);
+    auto mesh = reader.buildMesh(MPI_COMM_WORLD);
+    EXPECT_EQ(time, mesh->getInitialStateTime());
+
+    // The initial conditions of the test input are constant.
+    const std::vector<std::string> field_names
+        = {"lagrange_pressure", "velocity_0", "velocity_1"};
+    const std::vector<double> field_values = {1.0, 2.0, 3.0};
+
+    std::vector<stk::mesh::Entity> elements;
+    mesh->getMyElements(elements);
+    ASSERT_FALSE(elements.empty());
+    auto bulk = mesh->getBulkData();
+    for (std::size_t f = 0; f < field_names.size(); ++f)
+    {
+        const auto* field = stk::mesh::get_field_by_name(field_names[f],
+                                                         *mesh->getMetaData());
+        ASSERT_NE(nullptr, field);
+        for (const auto& element : elements)
+        {
+            const stk::mesh::Entity* nodes = bulk->begin_nodes(element);
+            for (unsigned n = 0; n < bulk->num_nodes(element); ++n)
+            {
+                const double* value = static_cast<const double*>(
+                    stk::mesh::field_data(*field, nodes[n]));
+                EXPECT_DOUBLE_EQ(scale * field_values[f], *value);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Write two time steps and read them back. The second solution is a
+// multiple of the first one.
+TEST(ExodusWriter, write)
+{
+    auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+        Teuchos::DefaultComm<int>::getComm());
+
+    const std::string location = VERTEXCFD_DRIVER_TEST_DATA_DIR;
+    auto parameter_db = Teuchos::rcp(new Parameter::ParameterDatabase(
+        comm, location + "exodus_writer_test.xml"));
+
+    auto mesh_manager = Teuchos::rcp(new MeshManager(*parameter_db, comm));
+    auto physics_manager = Teuchos::rcp(new PhysicsManager(
+        std::integral_constant<int, 2>{}, parameter_db, mesh_manager));
+    physics_manager->setupModel();
+
+    // The file name includes the process id as the tests with different
+    // numbers of threads run concurrently.
+    const std::string file_name = "exodus_writer_test_"
+                                  + std::to_string(getpid()) + ".exo";
+    Teuchos::ParameterList output_params;
+    output_params.set("Exodus Output File", file_name);
+    output_params.sublist("Cell Average Quantities");
+    output_params.sublist("Cell Average Vectors");
+    output_params.sublist("Cell Quantities");
+    output_params.sublist("Nodal Quantities");
+
+    {
+        auto response_library
+            = Teuchos::rcp(new panzer::ResponseLibrary<panzer::Traits>(
+                physics_manager->worksetContainer(),
+                physics_manager->dofManager(),
+                physics_manager->linearObjectFactory()));
+        Mesh::ExodusWriter exodus_writer(mesh_manager->mesh(),
+                                         physics_manager->dofManager(),
+                                         physics_manager->linearObjectFactory(),
+                                         response_library,
+                                         output_params);
+
+        panzer_stk::IOClosureModelFactory_TemplateBuilder<panzer::Traits>
+            io_cm_builder(*physics_manager->closureModelFactory(),
+                          mesh_manager->mesh(),
+                          output_params);
+        panzer::ClosureModelFactory_TemplateManager<panzer::Traits>
+            io_cm_factory;
+        io_cm_factory.buildObjects(io_cm_builder);
+        response_library->buildResponseEvaluators(
+            physics_manager->physicsBlocks(),
+            io_cm_factory,
+            *parameter_db->closureModelParameters(),
+            *parameter_db->userParameters());
+
+        InitialConditionManager ic_manager(parameter_db, mesh_manager);
+        Teuchos::RCP<Thyra::VectorBase<double>> x;
+        Teuchos::RCP<Thyra::VectorBase<double>> x_dot;
+        ic_manager.applyInitialConditions(
+            std::integral_constant<int, 2>{}, *physics_manager, x, x_dot);
+
+        exodus_writer.writeSolution(x, x_dot, 0.5, 0.5);
+
+        auto x_2 = Thyra::createMember(x->space());
+        Thyra::V_StV(x_2.ptr(), 2.0, *x);
+        exodus_writer.writeSolution(x_2, x_dot, 1.0, 0.5);
+    }
+
+    checkExodusFile(file_name, 1, 0.5, 1.0);
+    checkExodusFile(file_name, 2, 1.0, 2.0);
+
+    EXPECT_EQ(0, std::remove(file_name.c_str()));
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
@@ -0,0 +1,254 @@
+#include <VertexCFD_DriverUnitTestConfig.hpp>
+
+#include <drivers/VertexCFD_ExternalFieldsManager.hpp>
+#include <drivers/VertexCFD_InitialConditionManager.hpp>
+#include <drivers/VertexCFD_MeshManager.hpp>
+#include <drivers/VertexCFD_PhysicsManager.hpp>
+#include <mesh/VertexCFD_Mesh_Restart.hpp>
+#include <observers/VertexCFD_TempusObserver_UpdateExternalFields.hpp>
+
+#include <parameters/VertexCFD_ParameterDatabase.hpp>
+
+#include <Panzer_STK_SquareQuadMeshFactory.hpp>
+#include <Panzer_Traits.hpp>
+
+#include <Thyra_VectorStdOps.hpp>
+
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// External simulation with constant fields on a 3x5 mesh of [0,1]x[0,2].
+struct Fixture
+{
+    Teuchos::RCP<const Teuchos::MpiComm<int>> comm;
+    std::string file_name;
+    Teuchos::RCP<ExternalFieldsManager<panzer::Traits>> manager;
+    Teuchos::RCP<panzer_stk::STK_Interface> target_mesh;
+
+    const std::vector<std::string> field_names
+        = {"lagrange_pressure", "velocity_0", "velocity_1"};
+    const std::vector<double> field_values = {1.0, 2.0, 3.0};
+
+    Fixture()
+    {
+        comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+            Teuchos::DefaultComm<int>::getComm());
+        file_name = std::string(VERTEXCFD_DRIVER_TEST_DATA_DIR)
+                    + "external_fields_test.xml";
+        manager = Teuchos::rcp(new ExternalFieldsManager<panzer::Traits>(
+            std::integral_constant<int, 2>{}, comm, file_name));
+
+        // Target mesh of the same domain that does not match the external
+        // mesh.
+        auto mesh_factory
+            = Teuchos::rcp(new panzer_stk::SquareQuadMeshFactory());
+        auto mesh_params = Teuchos::parameterList();
+        mesh_params->set("X0", 0.0);
+        mesh_params->set("Y0", 0.0);
+        mesh_params->set("Xf", 1.0);
+        mesh_params->set("Yf", 2.0);
+        mesh_params->set("X Elements", 4);
+        mesh_params->set("Y Elements", 7);
+        mesh_factory->setParameterList(mesh_params);
+        target_mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+        mesh_factory->completeMeshConstruction(*target_mesh, MPI_COMM_WORLD);
+    }
+
+    // Write a restart file of the external simulation with the constant
+    // fields scaled by the given factor. Returns the restart reader
+    // parameters.
+    Teuchos::ParameterList writeRestart(const double scale,
+                                        const int index) const
+    {
+        auto parameter_db
+            = Teuchos::rcp(new Parameter::ParameterDatabase(comm, file_name));
+        auto mesh_manager
+            = Teuchos::rcp(new MeshManager(*parameter_db, comm));
+        auto physics_manager = Teuchos::rcp(new PhysicsManager(
+            std::integral_constant<int, 2>{}, parameter_db, mesh_manager));
+        physics_manager->setupModel();
+
+        InitialConditionManager ic_manager(parameter_db, mesh_manager);
+        Teuchos::RCP<Thyra::VectorBase<double>> x;
+        Teuchos::RCP<Thyra::VectorBase<double>> x_dot;
+        ic_manager.applyInitialConditions(
+            std::integral_constant<int, 2>{}, *physics_manager, x, x_dot);
+        Thyra::scale(scale, x.ptr());
+
+        // The file names include the process id as the tests with different
+        // numbers of threads run concurrently.
+        const std::string prefix = "external_fields_test_"
+                                   + std::to_string(getpid());
+        Teuchos::ParameterList output_params;
+        output_params.set("Restart File Prefix", prefix);
+        Mesh::RestartWriter writer(mesh_manager->mesh(),
+                                   physics_manager->dofManager(),
+                                   output_params,
+                                   true);
+        writer.writeSolution(x, x_dot, index, 0.0);
+
+        Teuchos::ParameterList read_params;
+        read_params.set("Restart Data File Name",
+                        prefix + "_" + std::to_string(index)
+                            + ".restart.data");
+        read_params.set("Restart DOF Map File Name",
+                        prefix + ".restart.dofmap");
+        return read_params;
+    }
+
+    // Check that all gathered and interpolated values are the constant
+    // field values scaled by the given factor.
+    void checkFieldData(const double scale) const
+    {
+        const auto ghosted_data = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), manager->ghostedFieldData());
+        ASSERT_GT(ghosted_data.extent(0), 0u);
+        for (std::size_t i = 0; i < ghosted_data.extent(0); ++i)
+        {
+            const double value = ghosted_data(i) / scale;
+            EXPECT_TRUE(value == 1.0 || value == 2.0 || value == 3.0);
+        }
+
+        if (!manager->isInterpolated())
+            return;
+
+        std::vector<stk::mesh::Entity> elements;
+        target_mesh->getMyElements(elements);
+        ASSERT_FALSE(elements.empty());
+        const auto data = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), manager->interpolatedFieldData());
+        ASSERT_EQ(4u, data.extent(1));
+        for (std::size_t f = 0; f < field_names.size(); ++f)
+        {
+            const int index = manager->interpolatedFieldIndex(field_names[f]);
+            for (const auto& element : elements)
+            {
+                const int cell = target_mesh->elementLocalId(element);
+                for (int basis = 0; basis < 4; ++basis)
+                {
+                    EXPECT_NEAR(scale * field_values[f],
+                                data(cell, basis, index),
+                                1.0e-12);
+                }
+            }
+        }
+    }
+
+    static void removeFiles(const Teuchos::ParameterList& read_params)
+    {
+        Teuchos::DefaultComm<int>::getComm()->barrier();
+        if (Teuchos::DefaultComm<int>::getComm()->getRank() == 0)
+        {
+            std::remove(
+                read_params.get<std::string>("Restart Data File Name").c_str());
+            std::remove(
+                read_params.get<std::string>("Restart DOF Map File Name")
+                    .c_str());
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+TEST(ExternalFieldsManager, interpolate)
+{
+    Fixture fixture;
+    EXPECT_FALSE(fixture.manager->isInterpolated());
+    fixture.checkFieldData(1.0);
+
+    fixture.manager->interpolateToMesh(fixture.target_mesh, 1);
+    EXPECT_TRUE(fixture.manager->isInterpolated());
+    fixture.checkFieldData(1.0);
+
+    EXPECT_THROW(fixture.manager->interpolatedFieldIndex("temperature"),
+                 std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+// A new external state is read in place so that the evaluators holding the
+// device views see it.
+TEST(ExternalFieldsManager, update)
+{
+    Fixture fixture;
+    fixture.manager->interpolateToMesh(fixture.target_mesh, 1);
+    const auto ghosted_data = fixture.manager->ghostedFieldData();
+    const auto interpolated_data = fixture.manager->interpolatedFieldData();
+
+    const auto read_params = fixture.writeRestart(2.0, 1);
+    fixture.manager->update(read_params);
+    fixture.checkFieldData(2.0);
+    EXPECT_EQ(ghosted_data.data(),
+              fixture.manager->ghostedFieldData().data());
+    EXPECT_EQ(interpolated_data.data(),
+              fixture.manager->interpolatedFieldData().data());
+
+    Fixture::removeFiles(read_params);
+}
+
+//---------------------------------------------------------------------------//
+// The observer reads the latest state due at the start of each step.
+TEST(ExternalFieldsManager, update_observer)
+{
+    Fixture fixture;
+    fixture.manager->interpolateToMesh(fixture.target_mesh, 1);
+
+    const auto read_params_1 = fixture.writeRestart(2.0, 1);
+    const auto read_params_2 = fixture.writeRestart(3.0, 2);
+    const auto read_params_3 = fixture.writeRestart(4.0, 3);
+    Teuchos::ParameterList update_params;
+    update_params.sublist("State 3") = read_params_3;
+    update_params.sublist("State 3").set("Time", 1.5);
+    update_params.sublist("State 1") = read_params_1;
+    update_params.sublist("State 1").set("Time", 0.5);
+    update_params.sublist("State 2") = read_params_2;
+    update_params.sublist("State 2").set("Time", 1.0);
+
+    TempusObserver::UpdateExternalFields<double> observer(fixture.manager,
+                                                          update_params);
+    EXPECT_EQ(-1, observer.updateFields(0.25));
+    fixture.checkFieldData(1.0);
+    EXPECT_EQ(0, observer.updateFields(0.5));
+    fixture.checkFieldData(2.0);
+    EXPECT_EQ(0, observer.updateFields(0.75));
+    fixture.checkFieldData(2.0);
+
+    // The second state is skipped.
+    EXPECT_EQ(2, observer.updateFields(1.75));
+    fixture.checkFieldData(4.0);
+
+    Fixture::removeFiles(read_params_1);
+    Fixture::removeFiles(read_params_2);
+    Fixture::removeFiles(read_params_3);
+
+    // Updates need a time.
+    Teuchos::ParameterList no_time_params;
+    no_time_params.sublist("State 1") = read_params_1;
+    EXPECT_THROW(TempusObserver::UpdateExternalFields<double>(
+                     fixture.manager, no_time_params),
+                 std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
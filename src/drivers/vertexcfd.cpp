@@ -7,6 +7,7 @@
 #include "VertexCFD_MeshManager.hpp"
 #include "VertexCFD_PhysicsManager.hpp"
 
+#include "linear_solvers/VertexCFD_LinearSolvers_JacobianFreeModelEvaluator.hpp"
 #include "mesh/VertexCFD_Mesh_ExodusWriter.hpp"
 #include "mesh/VertexCFD_Mesh_Restart.hpp"
 #include "observers/VertexCFD_Compute_ErrorNorms.hpp"
@@ -14,7 +15,10 @@
 #include "observers/VertexCFD_NOXObserver_IterationOutput.hpp"
 #include "observers/VertexCFD_TempusObserver_ErrorNormOutput.hpp"
 #include "observers/VertexCFD_TempusObserver_IterationOutput.hpp"
+#include "observers/VertexCFD_TempusObserver_LocalTimeStepRecording.hpp"
+#include "observers/VertexCFD_TempusObserver_OutputScheduler.hpp"
 #include "observers/VertexCFD_TempusObserver_ResponseOutput.hpp"
+#include "observers/VertexCFD_TempusObserver_UpdateExternalFields.hpp"
 #include "observers/VertexCFD_TempusObserver_WriteMatrix.hpp"
 #include "observers/VertexCFD_TempusObserver_WriteRestart.hpp"
 #include "observers/VertexCFD_TempusObserver_WriteToExodus.hpp"
@@ -23,7 +27,9 @@
 #include "observers/VertexCFD_TempusTimeStepControl_Strategy.hpp"
 #include "parameters/VertexCFD_ParameterDatabase.hpp"
 #include "responses/VertexCFD_ResponseManager.hpp"
+#include "responses/VertexCFD_Response_LocalTimeStepMonitor.hpp"
 #include "responses/VertexCFD_Response_Utils.hpp"
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
 
 #include <Trilinos_version.h>
 
@@ -113,19 +119,41 @@ void run_vertexcfd(
         stacked_timer = Teuchos::rcp(new Teuchos::StackedTimer("VertexCFD"));
         Teuchos::TimeMonitor::setStackedTimer(stacked_timer);
         stacked_timer->start("Physics");
+
+        // Optionally time each evaluator.
+        if (profiling_params->isType<bool>("Evaluator Timers"))
+        {
+            VertexCFD::Utils::EvaluatorProfiler::inst().setEnabled(
+                profiling_params->get<bool>("Evaluator Timers"));
+        }
     }
 
     // Used for template argument deduction in constructors below.
     constexpr auto num_space_dim = std::integral_constant<int, NumSpaceDim>{};
 
     // Create external field evaluator if needed
+    Teuchos::RCP<VertexCFD::ExternalFieldsManager<panzer::Traits>>
+        external_fields_manager;
     if (user_params->isType<std::string>("External Field Parameter File"))
     {
         const std::string ef_filename
             = user_params->get<std::string>("External Field Parameter File");
-        auto external_fields_manager = Teuchos::rcp(
+        external_fields_manager = Teuchos::rcp(
             new VertexCFD::ExternalFieldsManager<panzer::Traits>(
                 num_space_dim, comm, ef_filename));
+
+        // Interpolate the external fields if the meshes do not match.
+        if (user_params->isSublist("External Field Interpolation"))
+        {
+            const auto& interp_params
+                = user_params->sublist("External Field Interpolation");
+            const int basis_order
+                = interp_params.isType<int>("Basis Order")
+                      ? interp_params.get<int>("Basis Order")
+                      : 1;
+            external_fields_manager->interpolateToMesh(mesh_manager->mesh(),
+                                                       basis_order);
+        }
         user_params->set("External Fields Manager", external_fields_manager);
     }
 
@@ -186,26 +214,23 @@ void run_vertexcfd(
                 if (plist.isSublist("Probe "
                                     "Coordinates"))
                 {
+                    // All fields at all probes are evaluated together.
                     const auto probe_list = plist.sublist("Probe Coordinates");
-                    for (int j = 0; j < num_fields; ++j)
+                    const int num_probes = probe_list.numParams();
+                    std::vector<Teuchos::Array<double>> points(num_probes);
+                    for (int i = 0; i < num_probes; ++i)
                     {
-                        for (int i = 0; i < probe_list.numParams(); ++i)
-                        {
-                            const std::string si = std::to_string(i + 1);
-                            const std::string pb_nm = "Probe " + si;
-                            const std::string name_ji = name + " " + si + " - "
-                                                        + field_names[j];
-                            const auto point_i
-                                = probe_list.get<Teuchos::Array<double>>(pb_nm);
-
-                            responses->addProbeResponse(name_ji,
-                                                        field_names[j],
-                                                        point_i,
-                                                        workset_descriptors);
-
-                            response_output_freq.emplace_back(output_freq);
-                        }
+                        const std::string pb_nm = "Probe "
+                                                  + std::to_string(i + 1);
+                        points[i]
+                            = probe_list.get<Teuchos::Array<double>>(pb_nm);
                     }
+
+                    responses->addProbeArrayResponse(
+                        name, field_names, points, workset_descriptors);
+                    response_output_freq.insert(response_output_freq.end(),
+                                                num_fields * num_probes,
+                                                output_freq);
                 }
                 else
                 {
@@ -235,6 +260,18 @@ void run_vertexcfd(
         }
     }
 
+    // Record the minimum local time step size during residual evaluations so
+    // the time step control does not need a separate response evaluation.
+    // The local time step size is then computed in every residual
+    // evaluation, but only recorded within the time steps.
+    if (user_params->isType<bool>("Local Time Step From Residual")
+        && user_params->get<bool>("Local Time Step From Residual"))
+    {
+        user_params->set(
+            "Local Time Step Monitor",
+            Teuchos::rcp(new VertexCFD::Response::LocalTimeStepMonitor(comm)));
+    }
+
     // Setup time step control. This adds a response, so must be built before
     // calling setupModel.
     Teuchos::RCP<VertexCFD::TempusTimeStepControl::Strategy<double>> dt_strategy;
@@ -326,6 +363,18 @@ void run_vertexcfd(
         .set<Teuchos::RCP<NOX::Observer>>("User Defined Pre/Post Operator",
                                           nox_observer_vector);
 
+    // Use Jacobian-free Newton-Krylov if requested. The Jacobian is then
+    // only assembled to build the preconditioner.
+    Teuchos::RCP<Thyra::ModelEvaluator<double>> model = physics;
+    if (user_params->isSublist("Jacobian-Free Newton-Krylov"))
+    {
+        const auto& jfnk_params
+            = user_params->sublist("Jacobian-Free Newton-Krylov");
+        model = Teuchos::rcp(
+            new VertexCFD::LinearSolvers::JacobianFreeModelEvaluator(
+                model, jfnk_params));
+    }
+
     // Setup time integrator -- toggle interface on Trilinos version
 #if TRILINOS_MAJOR_MINOR_VERSION >= 130100
     // Remove Tempus entries that are deprecated in Trilinos 13.2
@@ -337,22 +386,27 @@ void run_vertexcfd(
     tsc_params->remove("Initial Order", false);
     tsc_params->remove("Integrator Step Type", false);
     auto integrator
-        = Tempus::createIntegratorBasic<double>(solver_params, physics);
+        = Tempus::createIntegratorBasic<double>(solver_params, model);
 #else
-    auto integrator = Tempus::integratorBasic<double>(solver_params, physics);
+    auto integrator = Tempus::integratorBasic<double>(solver_params, model);
 #endif
 
     // Build a composite observer containing all of our tempus observers.
     auto integrator_observer
         = Teuchos::rcp(new Tempus::IntegratorObserverComposite<double>());
 
+    // Output schedules of the observers writing output.
+    std::vector<Teuchos::RCP<const VertexCFD::TempusObserver::OutputScheduler>>
+        output_schedulers;
+
     // Setup exodus output observer.
     if (Teuchos::nonnull(output_params))
     {
         auto exodus_observer = Teuchos::rcp(
             new VertexCFD::TempusObserver::WriteToExodus<double>(
-                exodus_writer, *output_params));
+                exodus_writer, *output_params, comm));
         integrator_observer->addObserver(exodus_observer);
+        output_schedulers.push_back(exodus_observer->outputScheduler());
     }
 
     // Error norm response library
@@ -407,6 +461,40 @@ void run_vertexcfd(
         integrator_observer->addObserver(tempus_error_norm_observer);
     }
 
+    // Update the external fields from a time series of external states.
+    if (Teuchos::nonnull(external_fields_manager)
+        && user_params->isSublist("External Field Updates"))
+    {
+        auto external_fields_observer = Teuchos::rcp(
+            new VertexCFD::TempusObserver::UpdateExternalFields<double>(
+                external_fields_manager,
+                user_params->sublist("External Field Updates")));
+        integrator_observer->addObserver(external_fields_observer);
+    }
+
+    // Record the local time step size only during the nonlinear solve of
+    // each time step. The last residual of the solve is then evaluated at
+    // the accepted state only for single stage steppers.
+    if (user_params->isType<
+            Teuchos::RCP<VertexCFD::Response::LocalTimeStepMonitor>>(
+            "Local Time Step Monitor"))
+    {
+        const auto stepper_type = integrator->getStepper()->getStepperType();
+        if (stepper_type != "Backward Euler" && stepper_type != "BDF2")
+        {
+            throw std::runtime_error(
+                "Local Time Step From Residual requires a Backward Euler or "
+                "BDF2 stepper, not "
+                + stepper_type);
+        }
+        auto local_dt_observer = Teuchos::rcp(
+            new VertexCFD::TempusObserver::LocalTimeStepRecording<double>(
+                user_params->get<
+                    Teuchos::RCP<VertexCFD::Response::LocalTimeStepMonitor>>(
+                    "Local Time Step Monitor")));
+        integrator_observer->addObserver(local_dt_observer);
+    }
+
     // Set iteration output observer.
     auto tempus_iteration_observer = Teuchos::rcp(
         new VertexCFD::TempusObserver::IterationOutput<double>(dt_strategy));
@@ -417,8 +505,13 @@ void run_vertexcfd(
     {
         auto tempus_response_observer = Teuchos::rcp(
             new VertexCFD::TempusObserver::ResponseOutput<double>(
-                responses, response_output_freq));
+                responses,
+                response_output_freq,
+                *response_output_params,
+                comm));
         integrator_observer->addObserver(tempus_response_observer);
+        output_schedulers.push_back(
+            tempus_response_observer->outputScheduler());
     }
 
     // Setup restart observer.
@@ -436,8 +529,9 @@ void run_vertexcfd(
                     mesh, dof_manager, *write_restart_params));
             auto restart_observer = Teuchos::rcp(
                 new VertexCFD::TempusObserver::WriteRestart<double>(
-                    restart_writer, *write_restart_params));
+                    restart_writer, *write_restart_params, comm));
             integrator_observer->addObserver(restart_observer);
+            output_schedulers.push_back(restart_observer->outputScheduler());
         }
     }
 
@@ -468,6 +562,10 @@ void run_vertexcfd(
     auto tsc = integrator->getNonConstTimeStepControl();
     tsc->setTimeStepControlStrategy(dt_strategy);
 
+    // Shorten time steps to land exactly on scheduled output times.
+    for (const auto& scheduler : output_schedulers)
+        dt_strategy->addOutputScheduler(scheduler);
+
     // Initialize solution.
     integrator->initializeSolutionHistory(t_init, solution, solution_dot);
 
@@ -499,6 +597,25 @@ void run_vertexcfd(
                 = profiling_params->get<double>("Minimum Cutoff");
         }
         stacked_timer->report(std::cout, comm, options);
+
+        // Output the evaluator timers as a table or a JSON file.
+        const auto& evaluator_profiler
+            = VertexCFD::Utils::EvaluatorProfiler::inst();
+        if (evaluator_profiler.enabled())
+        {
+            const auto raw_comm = Teuchos::getRawMpiComm(*comm);
+            if (profiling_params->isType<std::string>("Evaluator Timers File"))
+            {
+                evaluator_profiler.writeJson(
+                    raw_comm,
+                    profiling_params->get<std::string>(
+                        "Evaluator Timers File"));
+            }
+            else
+            {
+                evaluator_profiler.report(raw_comm, std::cout);
+            }
+        }
     }
 }
 
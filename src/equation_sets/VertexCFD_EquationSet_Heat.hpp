@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_EQUATIONSET_HEAT_HPP
 #define VERTEXCFD_EQUATIONSET_HEAT_HPP
 
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
+
 #include <Panzer_CellData.hpp>
 #include <Panzer_EquationSet_DefaultImpl.hpp>
 #include <Panzer_FieldLibrary.hpp>
@@ -22,7 +24,8 @@ namespace EquationSet
 // Conductive heat equation
 //---------------------------------------------------------------------------//
 template<class EvalType>
-class Heat : public panzer::EquationSet_DefaultImpl<EvalType>
+class Heat
+    : public Utils::ProfiledRegistrar<panzer::EquationSet_DefaultImpl<EvalType>>
 {
   public:
     Heat(const Teuchos::RCP<Teuchos::ParameterList>& params,
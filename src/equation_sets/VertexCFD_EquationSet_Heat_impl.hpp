@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_EQUATIONSET_HEAT_IMPL_HPP
 #define VERTEXCFD_EQUATIONSET_HEAT_IMPL_HPP
 
+#include "responses/VertexCFD_Response_LocalTimeStepMonitor.hpp"
+
 #include <Panzer_BasisIRLayout.hpp>
 #include <Panzer_EvaluatorStyle.hpp>
 #include <Panzer_IntegrationRule.hpp>
@@ -21,11 +23,12 @@ Heat<EvalType>::Heat(const Teuchos::RCP<Teuchos::ParameterList>& params,
                      const panzer::CellData& cell_data,
                      const Teuchos::RCP<panzer::GlobalData>& global_data,
                      const bool build_transient_support)
-    : panzer::EquationSet_DefaultImpl<EvalType>(params,
-                                                default_integration_order,
-                                                cell_data,
-                                                global_data,
-                                                build_transient_support)
+    : Utils::ProfiledRegistrar<panzer::EquationSet_DefaultImpl<EvalType>>(
+        params,
+        default_integration_order,
+        cell_data,
+        global_data,
+        build_transient_support)
     , _dof_name("temperature")
 {
     // This equation set need not always be transient. Could solve Poisson
@@ -71,8 +74,17 @@ template<class EvalType>
 void Heat<EvalType>::buildAndRegisterEquationSetEvaluators(
     PHX::FieldManager<panzer::Traits>& fm,
     const panzer::FieldLibrary&,
-    const Teuchos::ParameterList&) const
+    const Teuchos::ParameterList& user_data) const
 {
+    // The heat equation has no local time step size to record.
+    if (user_data.isType<Teuchos::RCP<Response::LocalTimeStepMonitor>>(
+            "Local Time Step Monitor"))
+    {
+        throw std::runtime_error(
+            "Local Time Step From Residual is not supported by the heat "
+            "equation set");
+    }
+
     const auto ir = this->getIntRuleForDOF(_dof_name);
     const auto basis = this->getBasisIRLayoutForDOF(_dof_name);
 
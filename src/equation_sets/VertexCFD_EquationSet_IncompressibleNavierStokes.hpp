@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_EQUATIONSET_INCOMPRESSIBLE_NAVIERSTOKES_HPP
 #define VERTEXCFD_EQUATIONSET_INCOMPRESSIBLE_NAVIERSTOKES_HPP
 
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
+
 #include <Panzer_CellData.hpp>
 #include <Panzer_EquationSet_DefaultImpl.hpp>
 #include <Panzer_GlobalData.hpp>
@@ -25,7 +27,7 @@ namespace EquationSet
 //---------------------------------------------------------------------------//
 template<class EvalType>
 class IncompressibleNavierStokes
-    : public panzer::EquationSet_DefaultImpl<EvalType>
+    : public Utils::ProfiledRegistrar<panzer::EquationSet_DefaultImpl<EvalType>>
 {
   public:
     IncompressibleNavierStokes(const Teuchos::RCP<Teuchos::ParameterList>& params,
@@ -48,6 +50,7 @@ class IncompressibleNavierStokes
     std::unordered_map<std::string, std::unordered_map<std::string, bool>>
         _equ_source_term;
     bool _build_viscous_flux;
+    bool _fused_residual;
     bool _build_temp_equ;
     bool _build_ind_less_equ;
     bool _build_constant_source;
@@ -58,6 +61,7 @@ class IncompressibleNavierStokes
     bool _build_resistive_flux;
     bool _build_magn_corr;
     bool _build_godunov_powell_source;
+    bool _is_side;
 };
 
 //---------------------------------------------------------------------------//
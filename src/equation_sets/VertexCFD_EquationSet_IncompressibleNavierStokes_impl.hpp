@@ -1,6 +1,11 @@
 #ifndef VERTEXCFD_EQUATIONSET_INCOMPRESSIBLE_NAVIERSTOKES_IMPL_HPP
 #define VERTEXCFD_EQUATIONSET_INCOMPRESSIBLE_NAVIERSTOKES_IMPL_HPP
 
+#include "incompressible_solver/closure_models/VertexCFD_Closure_IncompressibleFusedResidual.hpp"
+#include "incompressible_solver/fluid_properties/VertexCFD_ConstantFluidProperties.hpp"
+#include "responses/VertexCFD_Response_LocalTimeStepMinimum.hpp"
+#include "responses/VertexCFD_Response_LocalTimeStepMonitor.hpp"
+
 #include <Panzer_BasisIRLayout.hpp>
 #include <Panzer_IntegrationRule.hpp>
 
@@ -13,6 +18,8 @@
 #include <Teuchos_RCP.hpp>
 #include <Teuchos_StandardParameterEntryValidators.hpp>
 
+#include <type_traits>
+
 namespace VertexCFD
 {
 namespace EquationSet
@@ -25,11 +32,12 @@ IncompressibleNavierStokes<EvalType>::IncompressibleNavierStokes(
     const panzer::CellData& cell_data,
     const Teuchos::RCP<panzer::GlobalData>& global_data,
     const bool build_transient_support)
-    : panzer::EquationSet_DefaultImpl<EvalType>(params,
-                                                default_integration_order,
-                                                cell_data,
-                                                global_data,
-                                                build_transient_support)
+    : Utils::ProfiledRegistrar<panzer::EquationSet_DefaultImpl<EvalType>>(
+        params,
+        default_integration_order,
+        cell_data,
+        global_data,
+        build_transient_support)
 {
     // This equation set is always transient.
     if (!this->buildTransientSupport())
@@ -38,6 +46,9 @@ IncompressibleNavierStokes<EvalType>::IncompressibleNavierStokes(
             "Transient support is required for solving all equation sets.");
     }
 
+    // Side cell data is used for boundary and side set responses.
+    _is_side = cell_data.isSide();
+
     // Get the number of space dimensions.
     _num_space_dim = cell_data.baseCellDimension();
     if (!(_num_space_dim == 2 || _num_space_dim == 3))
@@ -53,6 +64,10 @@ IncompressibleNavierStokes<EvalType>::IncompressibleNavierStokes(
     valid_parameters.set("Basis Order", 1, "Order of the basis");
     valid_parameters.set("Integration Order", 2, "Order of the integration");
     valid_parameters.set("Build Viscous Flux", true, "Viscous flux boolean");
+    valid_parameters.set("Fused Residual",
+                         false,
+                         "Compute the Navier-Stokes fluxes and integrate the "
+                         "residuals in a single evaluator");
     valid_parameters.set(
         "Build Temperature Equation", false, "Solve temperature equation");
     valid_parameters.set("Build Inductionless MHD Equation",
@@ -111,6 +126,7 @@ IncompressibleNavierStokes<EvalType>::IncompressibleNavierStokes(
         = params->get<int>("Integration Order", basis_order + 1);
     const std::string model_id = params->get<std::string>("Model ID");
     _build_viscous_flux = params->get<bool>("Build Viscous Flux", true);
+    _fused_residual = params->get<bool>("Fused Residual", false);
     _build_temp_equ = params->get<bool>("Build Temperature Equation", false);
     _build_ind_less_equ
         = params->get<bool>("Build Inductionless MHD Equation", false);
@@ -148,6 +164,12 @@ IncompressibleNavierStokes<EvalType>::IncompressibleNavierStokes(
         throw std::runtime_error(msg);
     }
 
+    if (_fused_residual && (_build_ind_less_equ || _build_full_induction_model))
+    {
+        throw std::runtime_error(
+            "Fused Residual is not supported with the MHD equations.");
+    }
+
     // Initialize equation names and variable names for NS equations
     _equ_dof_ns_pair.insert({"continuity", "lagrange_pressure"});
     for (int d = 0; d < _num_space_dim; ++d)
@@ -276,7 +298,7 @@ template<class EvalType>
 void IncompressibleNavierStokes<EvalType>::buildAndRegisterEquationSetEvaluators(
     PHX::FieldManager<panzer::Traits>& fm,
     const panzer::FieldLibrary&,
-    const Teuchos::ParameterList&) const
+    const Teuchos::ParameterList& user_data) const
 {
     // Integration data. The same rule and basis is used for all DOFs in this
     // implementation so use the lagrange pressure field to get this data.
@@ -326,71 +348,125 @@ void IncompressibleNavierStokes<EvalType>::buildAndRegisterEquationSetEvaluators
         op_names.push_back(full_residual);
     };
 
-    // Build total residuals for NS equations
-    for (auto it : _equ_dof_ns_pair)
+    // Build the fused residuals of the NS equations, which compute the time
+    // derivative and fluxes of the constant property closure models.
+    if (_fused_residual)
     {
-        // Define local variables
-        const auto equ_name = it.first;
-        const auto dof_name = it.second;
-        std::vector<std::string> residual_operator_names;
-
-        // Time derivative residual
-        add_basis_time_scalar_residual(
-            equ_name, "DQDT", 1.0, residual_operator_names);
-
-        // Convective flux residual
-        add_grad_basis_time_residual(
-            equ_name, "CONVECTIVE_FLUX", -1.0, residual_operator_names);
-
-        // Viscous flux residual
-        if (_build_viscous_flux)
+        Teuchos::ParameterList fluid_prop_list
+            = user_data.sublist("Fluid Properties");
+        fluid_prop_list.set<bool>("Build Temperature Equation",
+                                  _build_temp_equ);
+        fluid_prop_list.set<bool>("Build Buoyancy Source",
+                                  _build_buoyancy_source);
+        const FluidProperties::ConstantFluidProperties fluid_prop(
+            fluid_prop_list);
+        const bool use_turbulence_model = _turbulence_model
+                                          != "No Turbulence Model";
+
+        Teuchos::RCP<PHX::Evaluator<panzer::Traits>> op;
+        if (_num_space_dim == 2)
         {
-            add_grad_basis_time_residual(
-                equ_name, "VISCOUS_FLUX", 1.0, residual_operator_names);
+            op = Teuchos::rcp(
+                new ClosureModel::
+                    IncompressibleFusedResidual<EvalType, panzer::Traits, 2>(
+                        *ir,
+                        *basis,
+                        fluid_prop,
+                        user_data,
+                        use_turbulence_model,
+                        _build_viscous_flux,
+                        _build_constant_source,
+                        _build_buoyancy_source,
+                        _build_viscous_heat));
         }
-
-        // Constant source residual
-        if (_build_constant_source)
+        else
         {
-            add_basis_time_scalar_residual(
-                equ_name, "CONSTANT_SOURCE", -1.0, residual_operator_names);
+            op = Teuchos::rcp(
+                new ClosureModel::
+                    IncompressibleFusedResidual<EvalType, panzer::Traits, 3>(
+                        *ir,
+                        *basis,
+                        fluid_prop,
+                        user_data,
+                        use_turbulence_model,
+                        _build_viscous_flux,
+                        _build_constant_source,
+                        _build_buoyancy_source,
+                        _build_viscous_heat));
         }
-
-        // Buoyancy source residual
-        if (_build_buoyancy_source)
+        this->template registerEvaluator<EvalType>(fm, op);
+    }
+    else
+    {
+        // Build total residuals for NS equations
+        for (auto it : _equ_dof_ns_pair)
         {
-            add_basis_time_scalar_residual(
-                equ_name, "BUOYANCY_SOURCE", -1.0, residual_operator_names);
-        }
+            // Define local variables
+            const auto equ_name = it.first;
+            const auto dof_name = it.second;
+            std::vector<std::string> residual_operator_names;
 
-        // Viscous heating source residual
-        if (_build_viscous_heat)
-        {
+            // Time derivative residual
             add_basis_time_scalar_residual(
-                equ_name, "VISCOUS_HEAT", -1.0, residual_operator_names);
-        }
+                equ_name, "DQDT", 1.0, residual_operator_names);
 
-        // Lorentz force for momentum equations
-        if (_build_ind_less_equ
-            && std::string::npos != equ_name.find("momentum"))
-        {
-            add_basis_time_scalar_residual(
-                equ_name, "VOLUMETRIC_SOURCE", -1.0, residual_operator_names);
-        }
+            // Convective flux residual
+            add_grad_basis_time_residual(
+                equ_name, "CONVECTIVE_FLUX", -1.0, residual_operator_names);
 
-        // Godunov-Powell source for momentum equations in full induction MHD
-        if (_build_full_induction_model && _build_godunov_powell_source
-            && std::string::npos != equ_name.find("momentum"))
-        {
-            add_basis_time_scalar_residual(equ_name,
-                                           "GODUNOV_POWELL_SOURCE",
-                                           -1.0,
-                                           residual_operator_names);
-        }
+            // Viscous flux residual
+            if (_build_viscous_flux)
+            {
+                add_grad_basis_time_residual(
+                    equ_name, "VISCOUS_FLUX", 1.0, residual_operator_names);
+            }
 
-        // Build and register residuals
-        this->buildAndRegisterResidualSummationEvaluator(
-            fm, dof_name, residual_operator_names, "RESIDUAL_" + equ_name);
+            // Constant source residual
+            if (_build_constant_source)
+            {
+                add_basis_time_scalar_residual(
+                    equ_name, "CONSTANT_SOURCE", -1.0, residual_operator_names);
+            }
+
+            // Buoyancy source residual
+            if (_build_buoyancy_source)
+            {
+                add_basis_time_scalar_residual(
+                    equ_name, "BUOYANCY_SOURCE", -1.0, residual_operator_names);
+            }
+
+            // Viscous heating source residual
+            if (_build_viscous_heat)
+            {
+                add_basis_time_scalar_residual(
+                    equ_name, "VISCOUS_HEAT", -1.0, residual_operator_names);
+            }
+
+            // Lorentz force for momentum equations
+            if (_build_ind_less_equ
+                && std::string::npos != equ_name.find("momentum"))
+            {
+                add_basis_time_scalar_residual(equ_name,
+                                               "VOLUMETRIC_SOURCE",
+                                               -1.0,
+                                               residual_operator_names);
+            }
+
+            // Godunov-Powell source for momentum equations in full induction
+            // MHD
+            if (_build_full_induction_model && _build_godunov_powell_source
+                && std::string::npos != equ_name.find("momentum"))
+            {
+                add_basis_time_scalar_residual(equ_name,
+                                               "GODUNOV_POWELL_SOURCE",
+                                               -1.0,
+                                               residual_operator_names);
+            }
+
+            // Build and register residuals
+            this->buildAndRegisterResidualSummationEvaluator(
+                fm, dof_name, residual_operator_names, "RESIDUAL_" + equ_name);
+        }
     }
 
     // Build total residual for EP equation
@@ -468,6 +544,27 @@ void IncompressibleNavierStokes<EvalType>::buildAndRegisterEquationSetEvaluators
         this->buildAndRegisterResidualSummationEvaluator(
             fm, dof_name, residual_operator_names, "RESIDUAL_" + eq_name);
     }
+
+    // Record the minimum local time step size during residual evaluations
+    // for the time step control. The monitor only records while enabled by
+    // the LocalTimeStepRecording observer, so the evaluations of the
+    // response libraries outside of the time steps are not recorded.
+    if constexpr (std::is_same<EvalType, panzer::Traits::Residual>::value)
+    {
+        using monitor_type = Teuchos::RCP<Response::LocalTimeStepMonitor>;
+        if (!_is_side
+            && user_data.isType<monitor_type>("Local Time Step Monitor"))
+        {
+            const auto monitor
+                = user_data.get<monitor_type>("Local Time Step Monitor");
+            auto op = Teuchos::rcp(
+                new Response::LocalTimeStepMinimum<panzer::Traits>(
+                    *ir, this->getElementBlockId(), monitor));
+            this->template registerEvaluator<EvalType>(fm, op);
+            fm.template requireField<EvalType>(
+                op->_local_dt_minimum.fieldTag());
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_FULLINDUCTIONCONDUCTING_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_FULLINDUCTIONCONDUCTING_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -96,107 +97,102 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void FullInductionConducting<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _boundary_induced_magnetic_field[0].extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 FullInductionConducting<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _boundary_induced_magnetic_field[0].extent(1);
     const int num_grad_dim = _boundary_grad_induced_magnetic_field[0].extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Compute B \cdot n
-            scalar_type B_dot_n = 0.0;
-            Kokkos::Array<scalar_type, num_space_dim> gradB_dot_n = {0};
-            for (int grad_dim = 0; grad_dim < num_grad_dim; ++grad_dim)
-            {
-                B_dot_n += (_induced_magnetic_field[grad_dim](cell, point)
-                            - _bnd_magn_field[grad_dim])
-                           * _normals(cell, point, grad_dim);
-                for (int field_dim = 0; field_dim < num_grad_dim; ++field_dim)
-                {
-                    gradB_dot_n[field_dim]
-                        += _grad_induced_magnetic_field[field_dim](
-                               cell, point, grad_dim)
-                           * _normals(cell, point, grad_dim);
-                }
-            }
+    // Compute B \cdot n
+    scalar_type B_dot_n = 0.0;
+    Kokkos::Array<scalar_type, num_space_dim> gradB_dot_n = {0};
+    for (int grad_dim = 0; grad_dim < num_grad_dim; ++grad_dim)
+    {
+        B_dot_n += (_induced_magnetic_field[grad_dim](cell, point)
+                    - _bnd_magn_field[grad_dim])
+                   * _normals(cell, point, grad_dim);
+        for (int field_dim = 0; field_dim < num_grad_dim; ++field_dim)
+        {
+            gradB_dot_n[field_dim]
+                += _grad_induced_magnetic_field[field_dim](
+                       cell, point, grad_dim)
+                   * _normals(cell, point, grad_dim);
+        }
+    }
 
-            // Compute the boundary induced magnetic field
-            for (int dim = 0; dim < num_space_dim; ++dim)
-            {
-                _boundary_induced_magnetic_field[dim](cell, point)
-                    = _induced_magnetic_field[dim](cell, point);
-                if (dim < num_grad_dim)
-                {
-                    _boundary_induced_magnetic_field[dim](cell, point)
-                        -= B_dot_n * _normals(cell, point, dim);
-                }
-            }
+    // Compute the boundary induced magnetic field
+    for (int dim = 0; dim < num_space_dim; ++dim)
+    {
+        _boundary_induced_magnetic_field[dim](cell, point)
+            = _induced_magnetic_field[dim](cell, point);
+        if (dim < num_grad_dim)
+        {
+            _boundary_induced_magnetic_field[dim](cell, point)
+                -= B_dot_n * _normals(cell, point, dim);
+        }
+    }
 
-            if (_build_magn_corr)
-            {
-                if (_dirichlet_scalar_magn_pot)
-                {
-                    _boundary_scalar_magnetic_potential(cell, point)
-                        = _bnd_scalar_magn_pot;
-                }
-                else
-                {
-                    _boundary_scalar_magnetic_potential(cell, point)
-                        = _scalar_magnetic_potential(cell, point);
-                }
-            }
+    if (_build_magn_corr)
+    {
+        if (_dirichlet_scalar_magn_pot)
+        {
+            _boundary_scalar_magnetic_potential(cell, point)
+                = _bnd_scalar_magn_pot;
+        }
+        else
+        {
+            _boundary_scalar_magnetic_potential(cell, point)
+                = _scalar_magnetic_potential(cell, point);
+        }
+    }
 
-            // include resistive contributions to boundary gradient from moving
-            // wall
-            if (_build_resistive_flux)
+    // include resistive contributions to boundary gradient from moving
+    // wall
+    if (_build_resistive_flux)
+    {
+        const scalar_type inv_eta = _magnetic_permeability
+                                    / _resistivity(cell, point);
+        for (int d = 0; d < num_grad_dim; ++d)
+        {
+            for (int fdim = 0; fdim < num_grad_dim; ++fdim)
             {
-                const scalar_type inv_eta = _magnetic_permeability
-                                            / _resistivity(cell, point);
-                for (int d = 0; d < num_grad_dim; ++d)
-                {
-                    for (int fdim = 0; fdim < num_grad_dim; ++fdim)
-                    {
-                        if (d == fdim)
-                            continue;
-                        gradB_dot_n[fdim]
-                            += _normals(cell, point, d) * inv_eta
-                               * (_boundary_velocity[fdim](cell, point)
-                                      * (_external_magnetic_field[d](cell, point)
-                                         + _bnd_magn_field[d])
-                                  - _boundary_velocity[d](cell, point)
-                                        * (_external_magnetic_field[fdim](
-                                               cell, point)
-                                           + _bnd_magn_field[fdim]));
-                    }
-                }
+                if (d == fdim)
+                    continue;
+                gradB_dot_n[fdim]
+                    += _normals(cell, point, d) * inv_eta
+                       * (_boundary_velocity[fdim](cell, point)
+                              * (_external_magnetic_field[d](cell, point)
+                                 + _bnd_magn_field[d])
+                          - _boundary_velocity[d](cell, point)
+                                * (_external_magnetic_field[fdim](
+                                       cell, point)
+                                   + _bnd_magn_field[fdim]));
             }
+        }
+    }
 
-            // Set gradients
-            for (int d = 0; d < num_grad_dim; ++d)
+    // Set gradients
+    for (int d = 0; d < num_grad_dim; ++d)
+    {
+        for (int fdim = 0; fdim < num_space_dim; ++fdim)
+        {
+            _boundary_grad_induced_magnetic_field[fdim](cell, point, d)
+                = _grad_induced_magnetic_field[fdim](cell, point, d);
+            if (fdim < num_grad_dim)
             {
-                for (int fdim = 0; fdim < num_space_dim; ++fdim)
-                {
-                    _boundary_grad_induced_magnetic_field[fdim](cell, point, d)
-                        = _grad_induced_magnetic_field[fdim](cell, point, d);
-                    if (fdim < num_grad_dim)
-                    {
-                        _boundary_grad_induced_magnetic_field[fdim](
-                            cell, point, d)
-                            -= gradB_dot_n[fdim] * _normals(cell, point, d);
-                    }
-                }
+                _boundary_grad_induced_magnetic_field[fdim](
+                    cell, point, d)
+                    -= gradB_dot_n[fdim] * _normals(cell, point, d);
             }
-        });
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
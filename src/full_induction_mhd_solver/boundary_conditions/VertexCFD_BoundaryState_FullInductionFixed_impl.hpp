@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_FULLINDUCTIONFIXED_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_FULLINDUCTIONFIXED_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -75,56 +76,51 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void FullInductionFixed<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _boundary_induced_magnetic_field[0].extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 FullInductionFixed<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _boundary_induced_magnetic_field[0].extent(1);
     const int num_grad_dim = _boundary_grad_induced_magnetic_field[0].extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Set the fixed boundary values
-            for (int dim = 0; dim < num_space_dim; ++dim)
-            {
-                _boundary_induced_magnetic_field[dim](cell, point)
-                    = _bnd_magn_field[dim];
-            }
-
-            if (_build_magn_corr)
-            {
-                if (_dirichlet_scalar_magn_pot)
-                {
-                    _boundary_scalar_magnetic_potential(cell, point)
-                        = _bnd_scalar_magn_pot;
-                }
-                else
-                {
-                    _boundary_scalar_magnetic_potential(cell, point)
-                        = _scalar_magnetic_potential(cell, point);
-                }
-            }
-
-            // Set gradients
-            for (int d = 0; d < num_grad_dim; ++d)
-            {
-                for (int field_dim = 0; field_dim < num_space_dim; ++field_dim)
-                {
-                    _boundary_grad_induced_magnetic_field[field_dim](
-                        cell, point, d)
-                        = _grad_induced_magnetic_field[field_dim](
-                            cell, point, d);
-                }
-            }
-        });
+    // Set the fixed boundary values
+    for (int dim = 0; dim < num_space_dim; ++dim)
+    {
+        _boundary_induced_magnetic_field[dim](cell, point)
+            = _bnd_magn_field[dim];
+    }
+
+    if (_build_magn_corr)
+    {
+        if (_dirichlet_scalar_magn_pot)
+        {
+            _boundary_scalar_magnetic_potential(cell, point)
+                = _bnd_scalar_magn_pot;
+        }
+        else
+        {
+            _boundary_scalar_magnetic_potential(cell, point)
+                = _scalar_magnetic_potential(cell, point);
+        }
+    }
+
+    // Set gradients
+    for (int d = 0; d < num_grad_dim; ++d)
+    {
+        for (int field_dim = 0; field_dim < num_space_dim; ++field_dim)
+        {
+            _boundary_grad_induced_magnetic_field[field_dim](
+                cell, point, d)
+                = _grad_induced_magnetic_field[field_dim](
+                    cell, point, d);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
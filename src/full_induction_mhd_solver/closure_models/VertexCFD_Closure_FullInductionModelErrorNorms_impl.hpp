@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_FULLINDUCTIONMODELERRORNORMS_IMPL_HPP
 #define VERTEXCFD_CLOSURE_FULLINDUCTIONMODELERRORNORMS_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include "Panzer_GlobalIndexer.hpp"
@@ -52,39 +53,33 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void FullInductionModelErrorNorms<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _induced_magnetic_field[0].extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 FullInductionModelErrorNorms<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _induced_magnetic_field[0].extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            using std::abs;
-            using std::pow;
-
-            // L1/L2 error norms
-            for (int i = 0; i < num_space_dim; ++i)
-            {
-                _L1_error_induced[i](cell, point)
-                    = abs(_induced_magnetic_field[i](cell, point)
-                          - _exact_induced_magnetic_field[i](cell, point));
-                _L2_error_induced[i](cell, point)
-                    = pow(_induced_magnetic_field[i](cell, point)
-                              - _exact_induced_magnetic_field[i](cell, point),
-                          2);
-            }
-
-            _volume(cell, point) = 1.0;
-        });
+    using std::abs;
+    using std::pow;
+
+    // L1/L2 error norms
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        _L1_error_induced[i](cell, point)
+            = abs(_induced_magnetic_field[i](cell, point)
+                  - _exact_induced_magnetic_field[i](cell, point));
+        _L2_error_induced[i](cell, point)
+            = pow(_induced_magnetic_field[i](cell, point)
+                      - _exact_induced_magnetic_field[i](cell, point),
+                  2);
+    }
+
+    _volume(cell, point) = 1.0;
 }
 
 //---------------------------------------------------------------------------//
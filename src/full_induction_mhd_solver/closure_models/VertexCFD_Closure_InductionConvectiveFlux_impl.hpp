@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INDUCTIONCONVECTIVEFLUX_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INDUCTIONCONVECTIVEFLUX_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -64,59 +65,53 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void InductionConvectiveFlux<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _induction_flux[0].extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 InductionConvectiveFlux<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _induction_flux[0].extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            for (int flux_dim = 0; flux_dim < num_space_dim; ++flux_dim)
+    for (int flux_dim = 0; flux_dim < num_space_dim; ++flux_dim)
+    {
+        for (int vec_dim = 0; vec_dim < num_space_dim; ++vec_dim)
+        {
+            _momentum_flux[vec_dim](cell, point, flux_dim)
+                -= _total_magnetic_field[flux_dim](cell, point)
+                   * _total_magnetic_field[vec_dim](cell, point)
+                   / _magnetic_permeability;
+            if (vec_dim != flux_dim)
             {
-                for (int vec_dim = 0; vec_dim < num_space_dim; ++vec_dim)
-                {
-                    _momentum_flux[vec_dim](cell, point, flux_dim)
-                        -= _total_magnetic_field[flux_dim](cell, point)
-                           * _total_magnetic_field[vec_dim](cell, point)
-                           / _magnetic_permeability;
-                    if (vec_dim != flux_dim)
-                    {
-                        // Set the off-diagonal flux terms for the induction
-                        // equation.
-                        _induction_flux[vec_dim](cell, point, flux_dim)
-                            = _velocity[flux_dim](cell, point)
-                                  * _total_magnetic_field[vec_dim](cell, point)
-                              - _total_magnetic_field[flux_dim](cell, point)
-                                    * _velocity[vec_dim](cell, point);
-                    }
-                }
-                // Add the magnetic pressure contribution to momentum flux.
-                _momentum_flux[flux_dim](cell, point, flux_dim)
-                    += _magnetic_pressure(cell, point);
-                // Set diagonal flux terms for the induction equation, which
-                // are nonzero only when using divergence cleaning.
-                if (_solve_magn_corr)
-                {
-                    _induction_flux[flux_dim](cell, point, flux_dim)
-                        = _c_h * _scalar_magnetic_potential(cell, point);
-                    _magnetic_correction_potential_flux(cell, point, flux_dim)
-                        = _c_h * _total_magnetic_field[flux_dim](cell, point);
-                }
-                else
-                {
-                    _induction_flux[flux_dim](cell, point, flux_dim) = 0.0;
-                }
+                // Set the off-diagonal flux terms for the induction
+                // equation.
+                _induction_flux[vec_dim](cell, point, flux_dim)
+                    = _velocity[flux_dim](cell, point)
+                          * _total_magnetic_field[vec_dim](cell, point)
+                      - _total_magnetic_field[flux_dim](cell, point)
+                            * _velocity[vec_dim](cell, point);
             }
-        });
+        }
+        // Add the magnetic pressure contribution to momentum flux.
+        _momentum_flux[flux_dim](cell, point, flux_dim)
+            += _magnetic_pressure(cell, point);
+        // Set diagonal flux terms for the induction equation, which
+        // are nonzero only when using divergence cleaning.
+        if (_solve_magn_corr)
+        {
+            _induction_flux[flux_dim](cell, point, flux_dim)
+                = _c_h * _scalar_magnetic_potential(cell, point);
+            _magnetic_correction_potential_flux(cell, point, flux_dim)
+                = _c_h * _total_magnetic_field[flux_dim](cell, point);
+        }
+        else
+        {
+            _induction_flux[flux_dim](cell, point, flux_dim) = 0.0;
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INDUCTIONRESISTIVEFLUX_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INDUCTIONRESISTIVEFLUX_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -61,90 +62,85 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void InductionResistiveFlux<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _induction_flux[0].extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 InductionResistiveFlux<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _induction_flux[0].extent(1);
     const int num_grad_dim = _induction_flux[0].extent(2);
     const double mu_0_inv = 1.0 / _magnetic_permeability;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // for constant resistivity Div(eta B) = eta*Div(B)
-            scalar_type div_eta_b = 0.0;
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                div_eta_b += _grad_total_magnetic_field[dim](cell, point, dim);
-            }
-            div_eta_b *= _resistivity(cell, point);
+    // for constant resistivity Div(eta B) = eta*Div(B)
+    scalar_type div_eta_b = 0.0;
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        div_eta_b += _grad_total_magnetic_field[dim](cell, point, dim);
+    }
+    div_eta_b *= _resistivity(cell, point);
 
-            // eta * Grad(B) contribution
-            for (int flux_dim = 0; flux_dim < num_grad_dim; ++flux_dim)
-            {
-                for (int vec_dim = 0; vec_dim < num_space_dim; ++vec_dim)
-                {
-                    _induction_flux[vec_dim](cell, point, flux_dim)
-                        = _resistivity(cell, point)
-                          * _grad_total_magnetic_field[vec_dim](
-                              cell, point, flux_dim);
-                }
-            }
+    // eta * Grad(B) contribution
+    for (int flux_dim = 0; flux_dim < num_grad_dim; ++flux_dim)
+    {
+        for (int vec_dim = 0; vec_dim < num_space_dim; ++vec_dim)
+        {
+            _induction_flux[vec_dim](cell, point, flux_dim)
+                = _resistivity(cell, point)
+                  * _grad_total_magnetic_field[vec_dim](
+                      cell, point, flux_dim);
+        }
+    }
 
-            if (_variable_resistivity)
+    if (_variable_resistivity)
+    {
+        // Div(eta B) = eta*Div(B) + grad(eta).B
+        for (int dim = 0; dim < num_grad_dim; ++dim)
+        {
+            div_eta_b += _grad_resistivity(cell, point, dim)
+                         * _total_magnetic_field[dim](cell, point);
+        }
+
+        // B \otimes grad(eta) contribution
+        for (int flux_dim = 0; flux_dim < num_grad_dim; ++flux_dim)
+        {
+            for (int vec_dim = 0; vec_dim < num_grad_dim; ++vec_dim)
             {
-                // Div(eta B) = eta*Div(B) + grad(eta).B
-                for (int dim = 0; dim < num_grad_dim; ++dim)
-                {
-                    div_eta_b += _grad_resistivity(cell, point, dim)
-                                 * _total_magnetic_field[dim](cell, point);
-                }
-
-                // B \otimes grad(eta) contribution
-                for (int flux_dim = 0; flux_dim < num_grad_dim; ++flux_dim)
-                {
-                    for (int vec_dim = 0; vec_dim < num_grad_dim; ++vec_dim)
-                    {
-                        _induction_flux[vec_dim](cell, point, flux_dim)
-                            += _total_magnetic_field[flux_dim](cell, point)
-                               * _grad_resistivity(cell, point, vec_dim);
-                    }
-                }
+                _induction_flux[vec_dim](cell, point, flux_dim)
+                    += _total_magnetic_field[flux_dim](cell, point)
+                       * _grad_resistivity(cell, point, vec_dim);
             }
+        }
+    }
 
-            // -Div(eta B) * I contribution
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                _induction_flux[dim](cell, point, dim) -= div_eta_b;
-            }
+    // -Div(eta B) * I contribution
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        _induction_flux[dim](cell, point, dim) -= div_eta_b;
+    }
 
-            // every term has eta or grad(eta), so can scale once by mu_0 to
-            // recover \hat(eta)
-            for (int flux_dim = 0; flux_dim < num_grad_dim; ++flux_dim)
-            {
-                for (int vec_dim = 0; vec_dim < num_space_dim; ++vec_dim)
-                {
-                    _induction_flux[vec_dim](cell, point, flux_dim) *= mu_0_inv;
-                }
-            }
+    // every term has eta or grad(eta), so can scale once by mu_0 to
+    // recover \hat(eta)
+    for (int flux_dim = 0; flux_dim < num_grad_dim; ++flux_dim)
+    {
+        for (int vec_dim = 0; vec_dim < num_space_dim; ++vec_dim)
+        {
+            _induction_flux[vec_dim](cell, point, flux_dim) *= mu_0_inv;
+        }
+    }
 
-            if (_solve_magn_corr)
-            {
-                for (int flux_dim = 0; flux_dim < num_grad_dim; ++flux_dim)
-                {
-                    _magnetic_correction_potential_flux(cell, point, flux_dim)
-                        = 0.0;
-                }
-            }
-        });
+    if (_solve_magn_corr)
+    {
+        for (int flux_dim = 0; flux_dim < num_grad_dim; ++flux_dim)
+        {
+            _magnetic_correction_potential_flux(cell, point, flux_dim)
+                = 0.0;
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_MHDVORTEXPROBLEMEXACT_IMPL_HPP
 #define VERTEXCFD_CLOSURE_MHDVORTEXPROBLEMEXACT_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
 #include <Panzer_GlobalIndexer.hpp>
@@ -61,51 +62,46 @@ void MHDVortexProblemExact<EvalType, Traits, NumSpaceDim>::evaluateFields(
 {
     _time = workset.time;
     _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 MHDVortexProblemExact<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
     using std::exp;
     const double exp_one = exp(1.0);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Coordinnates
-            const double x = _ip_coords(cell, point, 0);
-            const double y = _ip_coords(cell, point, 1);
-            const double r2 = (x - _time * _vel_0[0] - _xy_0[0])
-                                  * (x - _time * _vel_0[0] - _xy_0[0])
-                              + (y - _time * _vel_0[0] - _xy_0[1])
-                                    * (y - _time * _vel_0[0] - _xy_0[1]);
-
-            // Exact solutions
-            _lagrange_pressure(cell, point)
-                = 1.0 + 0.5 * exp_one * (1.0 - r2 * exp(-r2));
-
-            _induced_magnetic_field[0](cell, point) = exp(0.5 * (1.0 - r2))
-                                                      * (_xy_0[1] - y);
-            _induced_magnetic_field[1](cell, point) = exp(0.5 * (1.0 - r2))
-                                                      * (x - _xy_0[0]);
-
-            _velocity[0](cell, point) = _induced_magnetic_field[0](cell, point)
-                                        + _vel_0[0];
-            _velocity[1](cell, point) = _induced_magnetic_field[1](cell, point);
-
-            if (num_space_dim == 3)
-            {
-                _induced_magnetic_field[2](cell, point) = 0.0;
-                _velocity[2](cell, point) = 0.0;
-            }
-        });
+    // Coordinnates
+    const double x = _ip_coords(cell, point, 0);
+    const double y = _ip_coords(cell, point, 1);
+    const double r2 = (x - _time * _vel_0[0] - _xy_0[0])
+                          * (x - _time * _vel_0[0] - _xy_0[0])
+                      + (y - _time * _vel_0[0] - _xy_0[1])
+                            * (y - _time * _vel_0[0] - _xy_0[1]);
+
+    // Exact solutions
+    _lagrange_pressure(cell, point)
+        = 1.0 + 0.5 * exp_one * (1.0 - r2 * exp(-r2));
+
+    _induced_magnetic_field[0](cell, point) = exp(0.5 * (1.0 - r2))
+                                              * (_xy_0[1] - y);
+    _induced_magnetic_field[1](cell, point) = exp(0.5 * (1.0 - r2))
+                                              * (x - _xy_0[0]);
+
+    _velocity[0](cell, point) = _induced_magnetic_field[0](cell, point)
+                                + _vel_0[0];
+    _velocity[1](cell, point) = _induced_magnetic_field[1](cell, point);
+
+    if (num_space_dim == 3)
+    {
+        _induced_magnetic_field[2](cell, point) = 0.0;
+        _velocity[2](cell, point) = 0.0;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_CLOSURE_MAGNETICCORRECTIONDAMPINGSOURCE_IMPL_HPP
 #define VERTEXCFD_CLOSURE_MAGNETICCORRECTIONDAMPINGSOURCE_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
+
 #include <Panzer_HierarchicParallelism.hpp>
 
 namespace VertexCFD
@@ -31,25 +33,19 @@ template<class EvalType, class Traits>
 void MagneticCorrectionDampingSource<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _scalar_magnetic_potential.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 MagneticCorrectionDampingSource<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _scalar_magnetic_potential.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            _damping_potential_source(cell, point)
-                = -_alpha * _scalar_magnetic_potential(cell, point);
-        });
+    _damping_potential_source(cell, point)
+        = -_alpha * _scalar_magnetic_potential(cell, point);
 }
 
 //---------------------------------------------------------------------------//
@@ -36,8 +36,7 @@ class IncompressibleLSVOFConvectiveFlux
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point, panzer::Dim>
         _continuity_flux;
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLELSVOFCONVECTIVEFLUX_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLELSVOFCONVECTIVEFLUX_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -43,40 +44,34 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleLSVOFConvectiveFlux<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _continuity_flux.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleLSVOFConvectiveFlux<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _continuity_flux.extent(1);
+    for (int dim = 0; dim < num_space_dim; ++dim)
+    {
+        _continuity_flux(cell, point, dim)
+            = _rho(cell, point) * _velocity[dim](cell, point);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            for (int dim = 0; dim < num_space_dim; ++dim)
+        for (int mom_dim = 0; mom_dim < num_space_dim; ++mom_dim)
+        {
+            _momentum_flux[mom_dim](cell, point, dim)
+                = _rho(cell, point) * _velocity[dim](cell, point)
+                  * _velocity[mom_dim](cell, point);
+            if (mom_dim == dim)
             {
-                _continuity_flux(cell, point, dim)
-                    = _rho(cell, point) * _velocity[dim](cell, point);
-
-                for (int mom_dim = 0; mom_dim < num_space_dim; ++mom_dim)
-                {
-                    _momentum_flux[mom_dim](cell, point, dim)
-                        = _rho(cell, point) * _velocity[dim](cell, point)
-                          * _velocity[mom_dim](cell, point);
-                    if (mom_dim == dim)
-                    {
-                        _momentum_flux[mom_dim](cell, point, dim)
-                            += _pressure(cell, point);
-                    }
-                }
+                _momentum_flux[mom_dim](cell, point, dim)
+                    += _pressure(cell, point);
             }
-        });
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -38,8 +38,7 @@ class IncompressibleLSVOFScalarConvectiveFlux
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   private:
     std::string _scalar_name;
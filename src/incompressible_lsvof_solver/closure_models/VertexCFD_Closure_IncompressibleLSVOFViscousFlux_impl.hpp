@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLELSVOFVISCOUSFLUX_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLELSVOFVISCOUSFLUX_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -60,48 +61,42 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleLSVOFViscousFlux<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _continuity_flux.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleLSVOFViscousFlux<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _continuity_flux.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Loop over spatial dimension
-            for (int i = 0; i < num_space_dim; ++i)
-            {
-                // Set stress tensor for EDAC continuity model
-                if (_is_edac)
-                {
-                    _continuity_flux(cell, point, i)
-                        = _mu(cell, point) * _grad_press(cell, point, i)
-                          / _betam;
-                }
-                // Set stress tensor to zero for AC continuity model
-                else
-                {
-                    _continuity_flux(cell, point, i) = 0.0;
-                }
+    // Loop over spatial dimension
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        // Set stress tensor for EDAC continuity model
+        if (_is_edac)
+        {
+            _continuity_flux(cell, point, i)
+                = _mu(cell, point) * _grad_press(cell, point, i)
+                  / _betam;
+        }
+        // Set stress tensor to zero for AC continuity model
+        else
+        {
+            _continuity_flux(cell, point, i) = 0.0;
+        }
 
-                // Loop over velocity/momentum components
-                for (int j = 0; j < num_space_dim; ++j)
-                {
-                    _momentum_flux[j](cell, point, i)
-                        = _mu(cell, point)
-                          * (_grad_velocity[j](cell, point, i)
-                             + _grad_velocity[i](cell, point, j));
-                }
-            }
-        });
+        // Loop over velocity/momentum components
+        for (int j = 0; j < num_space_dim; ++j)
+        {
+            _momentum_flux[j](cell, point, i)
+                = _mu(cell, point)
+                  * (_grad_velocity[j](cell, point, i)
+                     + _grad_velocity[i](cell, point, j));
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
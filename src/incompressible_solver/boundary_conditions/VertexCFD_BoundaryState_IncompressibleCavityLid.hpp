@@ -42,8 +42,7 @@ class IncompressibleCavityLid : public panzer::EvaluatorWithBaseImpl<Traits>,
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   public:
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point>
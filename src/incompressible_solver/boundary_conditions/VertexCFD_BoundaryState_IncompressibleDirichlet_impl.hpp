@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLEDIRICHLET_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLEDIRICHLET_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -97,56 +98,51 @@ void IncompressibleDirichlet<EvalType, Traits, NumSpaceDim>::evaluateFields(
     _time = std::max(workset.time, _time_init);
     _time = std::min(_time, _time_final);
 
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleDirichlet<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
     const int num_grad_dim = _boundary_grad_velocity[0].extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Assign time-dependent boundary values
-            _boundary_lagrange_pressure(cell, point)
-                = _lagrange_pressure(cell, point);
-            for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-            {
-                _boundary_velocity[vel_dim](cell, point)
-                    = _a_vel[vel_dim] * _time + _b_vel[vel_dim];
-            }
-            if (_solve_temp)
-                _boundary_temperature(cell, point) = _T_dirichlet;
-
-            // Set gradients
-            for (int d = 0; d < num_grad_dim; ++d)
-            {
-                if (_is_edac)
-                {
-                    _boundary_grad_lagrange_pressure(cell, point, d)
-                        = _grad_lagrange_pressure(cell, point, d);
-                }
-
-                for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-                {
-                    _boundary_grad_velocity[vel_dim](cell, point, d)
-                        = _grad_velocity[vel_dim](cell, point, d);
-                }
-
-                if (_solve_temp)
-                {
-                    _boundary_grad_temperature(cell, point, d)
-                        = _grad_temperature(cell, point, d);
-                }
-            }
-        });
+    // Assign time-dependent boundary values
+    _boundary_lagrange_pressure(cell, point)
+        = _lagrange_pressure(cell, point);
+    for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+    {
+        _boundary_velocity[vel_dim](cell, point)
+            = _a_vel[vel_dim] * _time + _b_vel[vel_dim];
+    }
+    if (_solve_temp)
+        _boundary_temperature(cell, point) = _T_dirichlet;
+
+    // Set gradients
+    for (int d = 0; d < num_grad_dim; ++d)
+    {
+        if (_is_edac)
+        {
+            _boundary_grad_lagrange_pressure(cell, point, d)
+                = _grad_lagrange_pressure(cell, point, d);
+        }
+
+        for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+        {
+            _boundary_grad_velocity[vel_dim](cell, point, d)
+                = _grad_velocity[vel_dim](cell, point, d);
+        }
+
+        if (_solve_temp)
+        {
+            _boundary_grad_temperature(cell, point, d)
+                = _grad_temperature(cell, point, d);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLELAMINARFLOW_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLELAMINARFLOW_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -103,66 +104,61 @@ void IncompressibleLaminarFlow<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
     _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleLaminarFlow<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
     const int num_grad_dim = _boundary_grad_velocity[0].extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            using std::pow;
-            // Set lagrange pressure
-            _boundary_lagrange_pressure(cell, point)
-                = _lagrange_pressure(cell, point);
+    using std::pow;
+    // Set lagrange pressure
+    _boundary_lagrange_pressure(cell, point)
+        = _lagrange_pressure(cell, point);
 
-            if (_solve_temp)
-                _boundary_temperature(cell, point) = _T_bc;
+    if (_solve_temp)
+        _boundary_temperature(cell, point) = _T_bc;
 
-            // Set velocity and gradients at boundaries.
-            for (int d = 0; d < num_grad_dim; ++d)
+    // Set velocity and gradients at boundaries.
+    for (int d = 0; d < num_grad_dim; ++d)
+    {
+        if (_continuity_model == ContinuityModel::EDAC)
+        {
+            _boundary_grad_lagrange_pressure(cell, point, d)
+                = _grad_lagrange_pressure(cell, point, d);
+        }
+
+        for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+        {
+            // Calculate boundary velocity and gradient.
+            // Negative wall normal is used to show inward direction.
+            _boundary_velocity[vel_dim](cell, point) = 0.0;
+            for (int dim = 0; dim < num_space_dim; ++dim)
             {
-                if (_continuity_model == ContinuityModel::EDAC)
-                {
-                    _boundary_grad_lagrange_pressure(cell, point, d)
-                        = _grad_lagrange_pressure(cell, point, d);
-                }
-
-                for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-                {
-                    // Calculate boundary velocity and gradient.
-                    // Negative wall normal is used to show inward direction.
-                    _boundary_velocity[vel_dim](cell, point) = 0.0;
-                    for (int dim = 0; dim < num_space_dim; ++dim)
-                    {
-                        _boundary_velocity[vel_dim](cell, point)
-                            -= _vel_max * _normals(cell, point, vel_dim)
-                               * (1.0 / num_space_dim
-                                  - pow(_ip_coords(cell, point, dim)
-                                            - _origin_coord[dim],
-                                        2)
-                                        / (_radius * _radius));
-                    }
-
-                    _boundary_grad_velocity[vel_dim](cell, point, d)
-                        = _grad_velocity[vel_dim](cell, point, d);
-                }
-                if (_solve_temp)
-                {
-                    _boundary_grad_temperature(cell, point, d)
-                        = _grad_temperature(cell, point, d);
-                }
+                _boundary_velocity[vel_dim](cell, point)
+                    -= _vel_max * _normals(cell, point, vel_dim)
+                       * (1.0 / num_space_dim
+                          - pow(_ip_coords(cell, point, dim)
+                                    - _origin_coord[dim],
+                                2)
+                                / (_radius * _radius));
             }
-        });
+
+            _boundary_grad_velocity[vel_dim](cell, point, d)
+                = _grad_velocity[vel_dim](cell, point, d);
+        }
+        if (_solve_temp)
+        {
+            _boundary_grad_temperature(cell, point, d)
+                = _grad_temperature(cell, point, d);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
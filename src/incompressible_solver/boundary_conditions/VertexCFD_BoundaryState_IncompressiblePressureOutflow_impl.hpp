@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLEPRESSUREOUTFLOW_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLEPRESSUREOUTFLOW_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
@@ -70,59 +71,54 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressiblePressureOutflow<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _boundary_velocity[0].extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressiblePressureOutflow<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _boundary_velocity[0].extent(1);
     const int num_grad_dim = _boundary_grad_velocity[0].extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Assign velocity boundaries
-            for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-            {
-                _boundary_velocity[vel_dim](cell, point)
-                    = _velocity[vel_dim](cell, point);
-            }
-
-            // Assign boundary conditions for primitive variables
-            _boundary_lagrange_pressure(cell, point) = _p_back;
-
-            // Temperature equation
-            if (_solve_temp)
-                _boundary_temperature(cell, point) = _temperature(cell, point);
-
-            // Set boundary gradients
-            for (int d = 0; d < num_grad_dim; ++d)
-            {
-                if (_is_edac)
-                {
-                    _boundary_grad_lagrange_pressure(cell, point, d)
-                        = _grad_lagrange_pressure(cell, point, d);
-                }
-
-                if (_solve_temp)
-                {
-                    _boundary_grad_temperature(cell, point, d)
-                        = _grad_temperature(cell, point, d);
-                }
-
-                for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-                {
-                    _boundary_grad_velocity[vel_dim](cell, point, d)
-                        = _grad_velocity[vel_dim](cell, point, d);
-                }
-            }
-        });
+    // Assign velocity boundaries
+    for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+    {
+        _boundary_velocity[vel_dim](cell, point)
+            = _velocity[vel_dim](cell, point);
+    }
+
+    // Assign boundary conditions for primitive variables
+    _boundary_lagrange_pressure(cell, point) = _p_back;
+
+    // Temperature equation
+    if (_solve_temp)
+        _boundary_temperature(cell, point) = _temperature(cell, point);
+
+    // Set boundary gradients
+    for (int d = 0; d < num_grad_dim; ++d)
+    {
+        if (_is_edac)
+        {
+            _boundary_grad_lagrange_pressure(cell, point, d)
+                = _grad_lagrange_pressure(cell, point, d);
+        }
+
+        if (_solve_temp)
+        {
+            _boundary_grad_temperature(cell, point, d)
+                = _grad_temperature(cell, point, d);
+        }
+
+        for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+        {
+            _boundary_grad_velocity[vel_dim](cell, point, d)
+                = _grad_velocity[vel_dim](cell, point, d);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
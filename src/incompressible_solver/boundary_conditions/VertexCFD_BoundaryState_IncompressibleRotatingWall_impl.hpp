@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLEROTATINGWALL_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLEROTATINGWALL_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -113,64 +114,59 @@ void IncompressibleRotatingWall<EvalType, Traits, NumSpaceDim>::evaluateFields(
     _angular_velocity = _a_vel * time + _b_vel;
 
     _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleRotatingWall<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
     const int num_grad_dim = _boundary_grad_velocity[0].extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Set lagrange pressure
-            if (_set_lagrange_pressure)
-                _boundary_lagrange_pressure(cell, point) = _lp_wall;
-
-            else
-                _boundary_lagrange_pressure(cell, point)
-                    = _lagrange_pressure(cell, point);
-
-            // Set wall temperature
-            if (_solve_temp)
-                _boundary_temperature(cell, point) = _T_wall;
-
-            // Set boundary values for velocity components
-            Kokkos::Array<double, num_space_dim> vel_bnd{};
-            vel_bnd[0] = -_angular_velocity * _ip_coords(cell, point, 1);
-            vel_bnd[1] = _angular_velocity * _ip_coords(cell, point, 0);
-            for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-                _boundary_velocity[vel_dim](cell, point) = vel_bnd[vel_dim];
-
-            // Set gradients at boundaries.
-            for (int d = 0; d < num_grad_dim; ++d)
-            {
-                if (_is_edac)
-                {
-                    _boundary_grad_lagrange_pressure(cell, point, d)
-                        = _grad_lagrange_pressure(cell, point, d);
-                }
-
-                for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-                {
-                    _boundary_grad_velocity[vel_dim](cell, point, d)
-                        = _grad_velocity[vel_dim](cell, point, d);
-                }
-
-                if (_solve_temp)
-                {
-                    _boundary_grad_temperature(cell, point, d)
-                        = _grad_temperature(cell, point, d);
-                }
-            }
-        });
+    // Set lagrange pressure
+    if (_set_lagrange_pressure)
+        _boundary_lagrange_pressure(cell, point) = _lp_wall;
+
+    else
+        _boundary_lagrange_pressure(cell, point)
+            = _lagrange_pressure(cell, point);
+
+    // Set wall temperature
+    if (_solve_temp)
+        _boundary_temperature(cell, point) = _T_wall;
+
+    // Set boundary values for velocity components
+    Kokkos::Array<double, num_space_dim> vel_bnd{};
+    vel_bnd[0] = -_angular_velocity * _ip_coords(cell, point, 1);
+    vel_bnd[1] = _angular_velocity * _ip_coords(cell, point, 0);
+    for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+        _boundary_velocity[vel_dim](cell, point) = vel_bnd[vel_dim];
+
+    // Set gradients at boundaries.
+    for (int d = 0; d < num_grad_dim; ++d)
+    {
+        if (_is_edac)
+        {
+            _boundary_grad_lagrange_pressure(cell, point, d)
+                = _grad_lagrange_pressure(cell, point, d);
+        }
+
+        for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+        {
+            _boundary_grad_velocity[vel_dim](cell, point, d)
+                = _grad_velocity[vel_dim](cell, point, d);
+        }
+
+        if (_solve_temp)
+        {
+            _boundary_grad_temperature(cell, point, d)
+                = _grad_temperature(cell, point, d);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLESYMMETRY_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLESYMMETRY_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -67,87 +68,82 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleSymmetry<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleSymmetry<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
     const int num_grad_dim = _normals.extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Set boundary Lagrange pressure
-            _boundary_lagrange_pressure(cell, point)
-                = _lagrange_pressure(cell, point);
-
-            // Compute components of flow variables normal to surface
-            scalar_type vel_dot_n = 0.0;
-            scalar_type grad_T_dot_n = 0.0;
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                vel_dot_n += _velocity[dim](cell, point)
-                             * _normals(cell, point, dim);
-
-                if (_solve_temp)
-                {
-                    grad_T_dot_n += _grad_temperature(cell, point, dim)
-                                    * _normals(cell, point, dim);
-                }
-            }
-
-            Kokkos::Array<scalar_type, num_space_dim> grad_vel_dot_n{};
-            for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-            {
-                grad_vel_dot_n[vel_dim] = 0.0;
-
-                for (int dim = 0; dim < num_grad_dim; ++dim)
-                {
-                    grad_vel_dot_n[vel_dim]
-                        += _grad_velocity[vel_dim](cell, point, dim)
-                           * _normals(cell, point, dim);
-                }
-            }
-
-            if (_solve_temp)
-                _boundary_temperature(cell, point) = _temperature(cell, point);
-
-            // Set boundary velocity and boundary gradients
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                if (_is_edac)
-                {
-                    _boundary_grad_lagrange_pressure(cell, point, dim)
-                        = _grad_lagrange_pressure(cell, point, dim);
-                }
-
-                _boundary_velocity[dim](cell, point)
-                    = _velocity[dim](cell, point)
-                      - vel_dot_n * _normals(cell, point, dim);
-
-                for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-                {
-                    _boundary_grad_velocity[vel_dim](cell, point, dim)
-                        = _grad_velocity[vel_dim](cell, point, dim)
-                          - grad_vel_dot_n[vel_dim]
-                                * _normals(cell, point, dim);
-                }
-
-                if (_solve_temp)
-                {
-                    _boundary_grad_temperature(cell, point, dim)
-                        = _grad_temperature(cell, point, dim)
-                          - grad_T_dot_n * _normals(cell, point, dim);
-                }
-            }
-        });
+    // Set boundary Lagrange pressure
+    _boundary_lagrange_pressure(cell, point)
+        = _lagrange_pressure(cell, point);
+
+    // Compute components of flow variables normal to surface
+    scalar_type vel_dot_n = 0.0;
+    scalar_type grad_T_dot_n = 0.0;
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        vel_dot_n += _velocity[dim](cell, point)
+                     * _normals(cell, point, dim);
+
+        if (_solve_temp)
+        {
+            grad_T_dot_n += _grad_temperature(cell, point, dim)
+                            * _normals(cell, point, dim);
+        }
+    }
+
+    Kokkos::Array<scalar_type, num_space_dim> grad_vel_dot_n{};
+    for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+    {
+        grad_vel_dot_n[vel_dim] = 0.0;
+
+        for (int dim = 0; dim < num_grad_dim; ++dim)
+        {
+            grad_vel_dot_n[vel_dim]
+                += _grad_velocity[vel_dim](cell, point, dim)
+                   * _normals(cell, point, dim);
+        }
+    }
+
+    if (_solve_temp)
+        _boundary_temperature(cell, point) = _temperature(cell, point);
+
+    // Set boundary velocity and boundary gradients
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        if (_is_edac)
+        {
+            _boundary_grad_lagrange_pressure(cell, point, dim)
+                = _grad_lagrange_pressure(cell, point, dim);
+        }
+
+        _boundary_velocity[dim](cell, point)
+            = _velocity[dim](cell, point)
+              - vel_dot_n * _normals(cell, point, dim);
+
+        for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+        {
+            _boundary_grad_velocity[vel_dim](cell, point, dim)
+                = _grad_velocity[vel_dim](cell, point, dim)
+                  - grad_vel_dot_n[vel_dim]
+                        * _normals(cell, point, dim);
+        }
+
+        if (_solve_temp)
+        {
+            _boundary_grad_temperature(cell, point, dim)
+                = _grad_temperature(cell, point, dim)
+                  - grad_T_dot_n * _normals(cell, point, dim);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLEWALLFUNCTION_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_INCOMPRESSIBLEWALLFUNCTION_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -77,91 +78,86 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleWallFunction<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleWallFunction<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
     const int num_grad_dim = _normals.extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Set boundary Lagrange pressure
-            _boundary_lagrange_pressure(cell, point)
-                = _lagrange_pressure(cell, point);
+    // Set boundary Lagrange pressure
+    _boundary_lagrange_pressure(cell, point)
+        = _lagrange_pressure(cell, point);
 
-            if (_solve_temp)
+    if (_solve_temp)
+    {
+        _boundary_temperature(cell, point) = _temperature(cell, point);
+    }
+
+    // Set boundary velocity and boundary gradients
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        if (_is_edac)
+        {
+            _boundary_grad_lagrange_pressure(cell, point, dim)
+                = _grad_lagrange_pressure(cell, point, dim);
+        }
+        // Initialize boundary velocity and temperature gradient to
+        // interior fields (modified in subsequent loop)
+        _boundary_velocity[dim](cell, point)
+            = _velocity[dim](cell, point);
+
+        if (_solve_temp)
+        {
+            _boundary_grad_temperature(cell, point, dim)
+                = _grad_temperature(cell, point, dim);
+        }
+
+        // NOTE:this only works for 2D cases with an inward-facing
+        // wall normal in the POSITIVE Y direction
+        for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
+        {
+            // Set du/dy according to wall function formulation
+            if ((dim == 1) && (vel_dim == 0))
+            {
+                _boundary_grad_velocity[vel_dim](cell, point, dim)
+                    = _boundary_u_tau(cell, point)
+                      / _boundary_y_plus(cell, point)
+                      * _velocity[vel_dim](cell, point)
+                      / (_rho * (_nu + _boundary_nu_t(cell, point)));
+            }
+            // Set other components to interior values
+            else
             {
-                _boundary_temperature(cell, point) = _temperature(cell, point);
+                _boundary_grad_velocity[vel_dim](cell, point, dim)
+                    = _grad_velocity[vel_dim](cell, point, dim);
             }
 
-            // Set boundary velocity and boundary gradients
-            for (int dim = 0; dim < num_grad_dim; ++dim)
+            // Subtract normal component from velocity and temperature
+            // gradient fields
+            _boundary_velocity[dim](cell, point)
+                -= _velocity[vel_dim](cell, point)
+                   * _normals(cell, point, vel_dim)
+                   * _normals(cell, point, dim);
+
+            if (_solve_temp)
             {
-                if (_is_edac)
-                {
-                    _boundary_grad_lagrange_pressure(cell, point, dim)
-                        = _grad_lagrange_pressure(cell, point, dim);
-                }
-                // Initialize boundary velocity and temperature gradient to
-                // interior fields (modified in subsequent loop)
-                _boundary_velocity[dim](cell, point)
-                    = _velocity[dim](cell, point);
-
-                if (_solve_temp)
-                {
-                    _boundary_grad_temperature(cell, point, dim)
-                        = _grad_temperature(cell, point, dim);
-                }
-
-                // NOTE:this only works for 2D cases with an inward-facing
-                // wall normal in the POSITIVE Y direction
-                for (int vel_dim = 0; vel_dim < num_space_dim; ++vel_dim)
-                {
-                    // Set du/dy according to wall function formulation
-                    if ((dim == 1) && (vel_dim == 0))
-                    {
-                        _boundary_grad_velocity[vel_dim](cell, point, dim)
-                            = _boundary_u_tau(cell, point)
-                              / _boundary_y_plus(cell, point)
-                              * _velocity[vel_dim](cell, point)
-                              / (_rho * (_nu + _boundary_nu_t(cell, point)));
-                    }
-                    // Set other components to interior values
-                    else
-                    {
-                        _boundary_grad_velocity[vel_dim](cell, point, dim)
-                            = _grad_velocity[vel_dim](cell, point, dim);
-                    }
-
-                    // Subtract normal component from velocity and temperature
-                    // gradient fields
-                    _boundary_velocity[dim](cell, point)
-                        -= _velocity[vel_dim](cell, point)
-                           * _normals(cell, point, vel_dim)
-                           * _normals(cell, point, dim);
-
-                    if (_solve_temp)
-                    {
-                        // TODO: this BC currently assumes an insulated wall.
-                        // A future MR should implement the correct wall
-                        // function for the energy equation.
-                        _boundary_grad_temperature(cell, point, dim)
-                            -= _grad_temperature(cell, point, vel_dim)
-                               * _normals(cell, point, vel_dim)
-                               * _normals(cell, point, dim);
-                    }
-                }
+                // TODO: this BC currently assumes an insulated wall.
+                // A future MR should implement the correct wall
+                // function for the energy equation.
+                _boundary_grad_temperature(cell, point, dim)
+                    -= _grad_temperature(cell, point, vel_dim)
+                       * _normals(cell, point, vel_dim)
+                       * _normals(cell, point, dim);
             }
-        });
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_BUOYANCYSOURCE_IMPL_HPP
 #define VERTEXCFD_CLOSURE_BUOYANCYSOURCE_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -53,32 +54,26 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleBuoyancySource<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _buoyancy_continuity_source.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleBuoyancySource<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _buoyancy_continuity_source.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            _buoyancy_continuity_source(cell, point) = 0.0;
-            _buoyancy_energy_source(cell, point) = 0.0;
+    _buoyancy_continuity_source(cell, point) = 0.0;
+    _buoyancy_energy_source(cell, point) = 0.0;
 
-            for (int mom_dim = 0; mom_dim < num_space_dim; ++mom_dim)
-            {
-                _buoyancy_momentum_source[mom_dim](cell, point)
-                    = -_beta_T * _gravity[mom_dim]
-                      * (_temperature(cell, point) - _T_ref);
-            }
-        });
+    for (int mom_dim = 0; mom_dim < num_space_dim; ++mom_dim)
+    {
+        _buoyancy_momentum_source[mom_dim](cell, point)
+            = -_beta_T * _gravity[mom_dim]
+              * (_temperature(cell, point) - _T_ref);
+    }
 }
 
 //---------------------------------------------------------------------------//
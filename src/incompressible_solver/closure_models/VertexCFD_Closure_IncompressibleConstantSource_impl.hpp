@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_CONSTANTSOURCE_IMPL_HPP
 #define VERTEXCFD_CLOSURE_CONSTANTSOURCE_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -52,30 +53,24 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleConstantSource<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _continuity_source.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleConstantSource<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _continuity_source.extent(1);
+    _continuity_source(cell, point) = 0.0;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            _continuity_source(cell, point) = 0.0;
-
-            for (int mom_dim = 0; mom_dim < num_space_dim; ++mom_dim)
-                _momentum_source[mom_dim](cell, point)
-                    = _mom_input_source[mom_dim];
-            if (_solve_temp)
-                _energy_source(cell, point) = _energy_input_source;
-        });
+    for (int mom_dim = 0; mom_dim < num_space_dim; ++mom_dim)
+        _momentum_source[mom_dim](cell, point)
+            = _mom_input_source[mom_dim];
+    if (_solve_temp)
+        _energy_source(cell, point) = _energy_input_source;
 }
 
 //---------------------------------------------------------------------------//
@@ -34,8 +34,7 @@ class IncompressibleErrorNorms : public panzer::EvaluatorWithBaseImpl<Traits>,
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point> _L1_error_continuity;
     Kokkos::Array<PHX::MDField<scalar_type, panzer::Cell, panzer::Point>,
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEERRORNORMS_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLEERRORNORMS_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include "Panzer_GlobalIndexer.hpp"
@@ -74,61 +75,55 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleErrorNorms<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleErrorNorms<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
+    using std::abs;
+    using std::pow;
+
+    // L1/L2 error norms
+    _L1_error_continuity(cell, point)
+        = abs(_lagrange_pressure(cell, point)
+              - _exact_lagrange_pressure(cell, point));
+
+    if (_use_temp)
+    {
+        _L1_error_energy(cell, point)
+            = abs(_temperature(cell, point)
+                  - _exact_temperature(cell, point));
+    }
+
+    _L2_error_continuity(cell, point)
+        = pow(_lagrange_pressure(cell, point)
+                  - _exact_lagrange_pressure(cell, point),
+              2);
+
+    if (_use_temp)
+    {
+        _L2_error_energy(cell, point) = pow(
+            _temperature(cell, point) - _exact_temperature(cell, point),
+            2);
+    }
+
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        _L1_error_momentum[i](cell, point)
+            = abs(_velocity[i](cell, point)
+                  - _exact_velocity[i](cell, point));
+        _L2_error_momentum[i](cell, point) = pow(
+            _velocity[i](cell, point) - _exact_velocity[i](cell, point),
+            2);
+    }
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            using std::abs;
-            using std::pow;
-
-            // L1/L2 error norms
-            _L1_error_continuity(cell, point)
-                = abs(_lagrange_pressure(cell, point)
-                      - _exact_lagrange_pressure(cell, point));
-
-            if (_use_temp)
-            {
-                _L1_error_energy(cell, point)
-                    = abs(_temperature(cell, point)
-                          - _exact_temperature(cell, point));
-            }
-
-            _L2_error_continuity(cell, point)
-                = pow(_lagrange_pressure(cell, point)
-                          - _exact_lagrange_pressure(cell, point),
-                      2);
-
-            if (_use_temp)
-            {
-                _L2_error_energy(cell, point) = pow(
-                    _temperature(cell, point) - _exact_temperature(cell, point),
-                    2);
-            }
-
-            for (int i = 0; i < num_space_dim; ++i)
-            {
-                _L1_error_momentum[i](cell, point)
-                    = abs(_velocity[i](cell, point)
-                          - _exact_velocity[i](cell, point));
-                _L2_error_momentum[i](cell, point) = pow(
-                    _velocity[i](cell, point) - _exact_velocity[i](cell, point),
-                    2);
-            }
-
-            _volume(cell, point) = 1.0;
-        });
+    _volume(cell, point) = 1.0;
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,7 @@
+#include "utils/VertexCFD_Utils_ExplicitTemplateInstantiation.hpp"
+
+#include "VertexCFD_Closure_IncompressibleFusedResidual.hpp"
+#include "VertexCFD_Closure_IncompressibleFusedResidual_impl.hpp"
+
+VERTEXCFD_INSTANTIATE_TEMPLATE_CLASS_EVAL_TRAITS_NUMSPACEDIM(
+    VertexCFD::ClosureModel::IncompressibleFusedResidual)
@@ -0,0 +1,167 @@
+#ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEFUSEDRESIDUAL_HPP
+#define VERTEXCFD_CLOSURE_INCOMPRESSIBLEFUSEDRESIDUAL_HPP
+
+#include "incompressible_solver/fluid_properties/VertexCFD_ConstantFluidProperties.hpp"
+
+#include <Panzer_BasisIRLayout.hpp>
+#include <Panzer_Dimension.hpp>
+#include <Panzer_Evaluator_WithBaseImpl.hpp>
+#include <Panzer_IntegrationRule.hpp>
+
+#include <Phalanx_Evaluator_Derived.hpp>
+#include <Phalanx_Evaluator_WithBaseImpl.hpp>
+#include <Phalanx_FieldManager.hpp>
+#include <Phalanx_config.hpp>
+
+#include <Teuchos_ParameterList.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+
+namespace VertexCFD
+{
+namespace ClosureModel
+{
+//---------------------------------------------------------------------------//
+// Fused residual of the incompressible Navier-Stokes equations with constant
+// fluid properties. The time derivative, convective flux and viscous flux of
+// the IncompressibleTimeDerivative, IncompressibleConvectiveFlux and
+// IncompressibleViscousFlux closures are computed at each integration point
+// and integrated against the basis directly into the equation residuals,
+// together with the optional source closures, in one kernel per workset.
+// This replaces the flux closures, the integrators of each term and the
+// residual summation.
+//
+// Each team computes the point values and fluxes of its cell once, with
+// the points distributed over the threads, and stores them in team scratch
+// memory. Each thread then integrates the residuals of its basis functions
+// in registers and writes each of them once.
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+class IncompressibleFusedResidual
+    : public panzer::EvaluatorWithBaseImpl<Traits>,
+      public PHX::EvaluatorDerived<EvalType, Traits>
+{
+  public:
+    using scalar_type = typename EvalType::ScalarT;
+    static constexpr int num_space_dim = NumSpaceDim;
+
+    // Equations are ordered as continuity, momentum and energy.
+    static constexpr int num_equation = num_space_dim + 2;
+
+    IncompressibleFusedResidual(
+        const panzer::IntegrationRule& ir,
+        const panzer::BasisIRLayout& basis,
+        const FluidProperties::ConstantFluidProperties& fluid_prop,
+        const Teuchos::ParameterList& user_params,
+        const bool use_turbulence_model,
+        const bool build_viscous_flux,
+        const bool build_constant_source,
+        const bool build_buoyancy_source,
+        const bool build_viscous_heat);
+
+    void postRegistrationSetup(typename Traits::SetupData sd,
+                               PHX::FieldManager<Traits>& fm) override;
+
+    void evaluateFields(typename Traits::EvalData workset) override;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(
+        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+
+  private:
+    using scratch_value_view
+        = Kokkos::View<scalar_type**,
+                       typename PHX::DevLayout<scalar_type>::type,
+                       typename PHX::exec_space::scratch_memory_space,
+                       Kokkos::MemoryUnmanaged>;
+    using scratch_flux_view
+        = Kokkos::View<scalar_type***,
+                       typename PHX::DevLayout<scalar_type>::type,
+                       typename PHX::exec_space::scratch_memory_space,
+                       Kokkos::MemoryUnmanaged>;
+
+    // Compute the values (point,equation) and fluxes (point,equation,dim)
+    // integrated against the basis and its gradient at a point.
+    KOKKOS_INLINE_FUNCTION
+    void pointTerms(const int cell,
+                    const int point,
+                    const scratch_value_view& values,
+                    const scratch_flux_view& fluxes) const;
+
+    // Sum of the sources of an equation at a point.
+    KOKKOS_INLINE_FUNCTION
+    scalar_type
+    source(const int cell, const int point, const int equation) const;
+
+  public:
+    Kokkos::Array<PHX::MDField<scalar_type, panzer::Cell, panzer::BASIS>,
+                  num_equation>
+        _residual;
+
+  private:
+    PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>
+        _lagrange_pressure;
+    PHX::MDField<const scalar_type, panzer::Cell, panzer::Point> _temperature;
+    Kokkos::Array<PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>,
+                  num_space_dim>
+        _velocity;
+
+    PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>
+        _dxdt_lagrange_pressure;
+    PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>
+        _dxdt_temperature;
+    Kokkos::Array<PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>,
+                  num_space_dim>
+        _dxdt_velocity;
+
+    PHX::MDField<const scalar_type, panzer::Cell, panzer::Point, panzer::Dim>
+        _grad_press;
+    PHX::MDField<const scalar_type, panzer::Cell, panzer::Point, panzer::Dim>
+        _grad_temp;
+    Kokkos::Array<
+        PHX::MDField<const scalar_type, panzer::Cell, panzer::Point, panzer::Dim>,
+        num_space_dim>
+        _grad_velocity;
+    PHX::MDField<const scalar_type, panzer::Cell, panzer::Point> _nu_t;
+
+    Kokkos::Array<PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>,
+                  num_equation>
+        _constant_source;
+    Kokkos::Array<PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>,
+                  num_equation>
+        _buoyancy_source;
+    Kokkos::Array<PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>,
+                  num_equation>
+        _viscous_heat;
+
+    PHX::MDField<const double, panzer::Cell, panzer::BASIS, panzer::Point>
+        _basis;
+    PHX::MDField<const double, panzer::Cell, panzer::BASIS, panzer::Point, panzer::Dim>
+        _grad_basis;
+
+    std::string _basis_name;
+    std::size_t _basis_index;
+
+    double _rho;
+    double _nu;
+    double _beta;
+    double _kappa;
+    double _rhoCp;
+    double _Pr_t;
+    bool _solve_temp;
+    bool _is_edac;
+    bool _use_turbulence_model;
+    bool _build_viscous_flux;
+    bool _build_constant_source;
+    bool _build_buoyancy_source;
+    bool _build_viscous_heat;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace ClosureModel
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_CLOSURE_INCOMPRESSIBLEFUSEDRESIDUAL_HPP
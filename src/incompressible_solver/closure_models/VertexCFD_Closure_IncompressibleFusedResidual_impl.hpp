@@ -0,0 +1,330 @@
+#ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEFUSEDRESIDUAL_IMPL_HPP
+#define VERTEXCFD_CLOSURE_INCOMPRESSIBLEFUSEDRESIDUAL_IMPL_HPP
+
+#include <utils/VertexCFD_Utils_VectorField.hpp>
+
+#include <Panzer_HierarchicParallelism.hpp>
+#include <Panzer_Workset_Utilities.hpp>
+
+#include <limits>
+#include <string>
+
+namespace VertexCFD
+{
+namespace ClosureModel
+{
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+IncompressibleFusedResidual<EvalType, Traits, NumSpaceDim>::
+    IncompressibleFusedResidual(
+        const panzer::IntegrationRule& ir,
+        const panzer::BasisIRLayout& basis,
+        const FluidProperties::ConstantFluidProperties& fluid_prop,
+        const Teuchos::ParameterList& user_params,
+        const bool use_turbulence_model,
+        const bool build_viscous_flux,
+        const bool build_constant_source,
+        const bool build_buoyancy_source,
+        const bool build_viscous_heat)
+    : _lagrange_pressure("lagrange_pressure", ir.dl_scalar)
+    , _temperature("temperature", ir.dl_scalar)
+    , _dxdt_lagrange_pressure("DXDT_lagrange_pressure", ir.dl_scalar)
+    , _dxdt_temperature("DXDT_temperature", ir.dl_scalar)
+    , _grad_press("GRAD_lagrange_pressure", ir.dl_vector)
+    , _grad_temp("GRAD_temperature", ir.dl_vector)
+    , _nu_t("turbulent_eddy_viscosity", ir.dl_scalar)
+    , _basis_name(basis.name())
+    , _basis_index(0)
+    , _rho(fluid_prop.constantDensity())
+    , _nu(fluid_prop.constantKinematicViscosity())
+    , _beta(fluid_prop.artificialCompressibility())
+    , _kappa(std::numeric_limits<double>::quiet_NaN())
+    , _rhoCp(fluid_prop.constantHeatCapacity())
+    , _Pr_t(std::numeric_limits<double>::quiet_NaN())
+    , _solve_temp(fluid_prop.solveTemperature())
+    , _is_edac(user_params.isType<std::string>("Continuity Model")
+               && user_params.get<std::string>("Continuity Model") == "EDAC")
+    , _use_turbulence_model(use_turbulence_model)
+    , _build_viscous_flux(build_viscous_flux)
+    , _build_constant_source(build_constant_source)
+    , _build_buoyancy_source(build_buoyancy_source)
+    , _build_viscous_heat(build_viscous_heat)
+{
+    // Equation names in residual order.
+    Kokkos::Array<std::string, num_equation> equ_names;
+    equ_names[0] = "continuity";
+    for (int dim = 0; dim < num_space_dim; ++dim)
+        equ_names[dim + 1] = "momentum_" + std::to_string(dim);
+    equ_names[num_space_dim + 1] = "energy";
+    const int num_solved_equation = _solve_temp ? num_equation
+                                                : num_equation - 1;
+
+    // Evaluated residuals and dependent sources.
+    for (int equ = 0; equ < num_equation; ++equ)
+    {
+        const auto& name = equ_names[equ];
+        _residual[equ] = PHX::MDField<scalar_type, panzer::Cell, panzer::BASIS>(
+            "RESIDUAL_" + name, basis.functional);
+        _constant_source[equ]
+            = PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>(
+                "CONSTANT_SOURCE_" + name, ir.dl_scalar);
+        _buoyancy_source[equ]
+            = PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>(
+                "BUOYANCY_SOURCE_" + name, ir.dl_scalar);
+        _viscous_heat[equ]
+            = PHX::MDField<const scalar_type, panzer::Cell, panzer::Point>(
+                "VISCOUS_HEAT_" + name, ir.dl_scalar);
+        if (equ < num_solved_equation)
+        {
+            this->addEvaluatedField(_residual[equ]);
+            if (_build_constant_source)
+                this->addDependentField(_constant_source[equ]);
+            if (_build_buoyancy_source)
+                this->addDependentField(_buoyancy_source[equ]);
+            if (_build_viscous_heat)
+                this->addDependentField(_viscous_heat[equ]);
+        }
+    }
+
+    // Dependent solution fields.
+    this->addDependentField(_lagrange_pressure);
+    this->addDependentField(_dxdt_lagrange_pressure);
+    Utils::addDependentVectorField(
+        *this, ir.dl_scalar, _velocity, "velocity_");
+    Utils::addDependentVectorField(
+        *this, ir.dl_scalar, _dxdt_velocity, "DXDT_velocity_");
+    if (_solve_temp)
+    {
+        this->addDependentField(_temperature);
+        this->addDependentField(_dxdt_temperature);
+    }
+
+    // Dependent gradients for the viscous fluxes.
+    if (_build_viscous_flux)
+    {
+        Utils::addDependentVectorField(
+            *this, ir.dl_vector, _grad_velocity, "GRAD_velocity_");
+        if (_is_edac)
+            this->addDependentField(_grad_press);
+        if (_solve_temp)
+        {
+            _kappa = fluid_prop.constantThermalConductivity();
+            this->addDependentField(_grad_temp);
+        }
+        if (_use_turbulence_model)
+        {
+            this->addDependentField(_nu_t);
+            if (_solve_temp)
+            {
+                _Pr_t = user_params.isType<double>("Turbulent Prandtl Number")
+                            ? user_params.get<double>("Turbulent Prandtl "
+                                                      "Number")
+                            : 0.85;
+            }
+        }
+    }
+
+    this->setName("Incompressible Fused Residual "
+                  + std::to_string(num_space_dim) + "D");
+}
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+void IncompressibleFusedResidual<EvalType, Traits, NumSpaceDim>::
+    postRegistrationSetup(typename Traits::SetupData sd,
+                          PHX::FieldManager<Traits>&)
+{
+    _basis_index
+        = panzer::getBasisIndex(_basis_name, (*sd.worksets_)[0], this->wda);
+}
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+void IncompressibleFusedResidual<EvalType, Traits, NumSpaceDim>::evaluateFields(
+    typename Traits::EvalData workset)
+{
+    _basis = this->wda(workset).bases[_basis_index]->weighted_basis_scalar;
+    _grad_basis = this->wda(workset).bases[_basis_index]->weighted_grad_basis;
+
+    // Team scratch memory for the point values and fluxes of a cell.
+    const int num_point = _basis.extent(2);
+    const int fad_size = Kokkos::dimension_scalar(_residual[0].get_view());
+    int bytes;
+    if (Sacado::IsADType<scalar_type>::value)
+    {
+        bytes = scratch_value_view::shmem_size(
+                    num_point, num_equation, fad_size)
+                + scratch_flux_view::shmem_size(
+                    num_point, num_equation, num_space_dim, fad_size);
+    }
+    else
+    {
+        bytes = scratch_value_view::shmem_size(num_point, num_equation)
+                + scratch_flux_view::shmem_size(
+                    num_point, num_equation, num_space_dim);
+    }
+
+    auto policy = panzer::HP::inst()
+                      .teamPolicy<scalar_type, PHX::Device>(workset.num_cells)
+                      .set_scratch_size(0, Kokkos::PerTeam(bytes));
+    Kokkos::parallel_for(this->getName(), policy, *this);
+}
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+KOKKOS_INLINE_FUNCTION void
+IncompressibleFusedResidual<EvalType, Traits, NumSpaceDim>::operator()(
+    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+{
+    const int cell = team.league_rank();
+    const int num_point = _basis.extent(2);
+    const int num_basis = _basis.extent(1);
+    const int num_solved_equation = _solve_temp ? num_equation
+                                                : num_equation - 1;
+
+    scratch_value_view values;
+    scratch_flux_view fluxes;
+    if (Sacado::IsADType<scalar_type>::value)
+    {
+        const int fad_size = Kokkos::dimension_scalar(_residual[0].get_view());
+        values = scratch_value_view(
+            team.team_shmem(), num_point, num_equation, fad_size);
+        fluxes = scratch_flux_view(team.team_shmem(),
+                                   num_point,
+                                   num_equation,
+                                   num_space_dim,
+                                   fad_size);
+    }
+    else
+    {
+        values = scratch_value_view(
+            team.team_shmem(), num_point, num_equation);
+        fluxes = scratch_flux_view(
+            team.team_shmem(), num_point, num_equation, num_space_dim);
+    }
+
+    // Compute the values and fluxes of each point once.
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, 0, num_point),
+                         [&](const int point) {
+                             pointTerms(cell, point, values, fluxes);
+                         });
+    team.team_barrier();
+
+    // Integrate the residual of each basis function and write it once.
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, 0, num_basis), [&](const int basis) {
+            for (int equ = 0; equ < num_solved_equation; ++equ)
+            {
+                scalar_type residual = 0.0;
+                for (int point = 0; point < num_point; ++point)
+                {
+                    residual += _basis(cell, basis, point)
+                                * values(point, equ);
+                    for (int dim = 0; dim < num_space_dim; ++dim)
+                    {
+                        residual += _grad_basis(cell, basis, point, dim)
+                                    * fluxes(point, equ, dim);
+                    }
+                }
+                _residual[equ](cell, basis) = residual;
+            }
+        });
+}
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+KOKKOS_INLINE_FUNCTION void
+IncompressibleFusedResidual<EvalType, Traits, NumSpaceDim>::pointTerms(
+    const int cell,
+    const int point,
+    const scratch_value_view& values,
+    const scratch_flux_view& fluxes) const
+{
+    const int energy = num_space_dim + 1;
+
+    scalar_type nu_t = 0.0;
+    if (_build_viscous_flux && _use_turbulence_model)
+        nu_t = _nu_t(cell, point);
+
+    // Continuity equation.
+    values(point, 0) = _dxdt_lagrange_pressure(cell, point) / _beta
+                       - source(cell, point, 0);
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        fluxes(point, 0, i) = -_rho * _velocity[i](cell, point);
+        if (_build_viscous_flux && _is_edac)
+        {
+            fluxes(point, 0, i) += _rho * _nu * _grad_press(cell, point, i)
+                                   / _beta;
+        }
+    }
+
+    // Momentum equations.
+    for (int j = 0; j < num_space_dim; ++j)
+    {
+        values(point, j + 1) = _rho * _dxdt_velocity[j](cell, point)
+                               - source(cell, point, j + 1);
+        for (int i = 0; i < num_space_dim; ++i)
+        {
+            fluxes(point, j + 1, i) = -_rho * _velocity[i](cell, point)
+                                      * _velocity[j](cell, point);
+            if (i == j)
+                fluxes(point, j + 1, i) -= _lagrange_pressure(cell, point);
+            if (_build_viscous_flux)
+            {
+                fluxes(point, j + 1, i)
+                    += _rho * _nu * _grad_velocity[j](cell, point, i);
+                if (_use_turbulence_model)
+                {
+                    fluxes(point, j + 1, i)
+                        += _rho * nu_t * _grad_velocity[j](cell, point, i);
+                }
+            }
+        }
+    }
+
+    // Energy equation.
+    if (_solve_temp)
+    {
+        values(point, energy) = _rhoCp * _dxdt_temperature(cell, point)
+                                - source(cell, point, energy);
+        for (int i = 0; i < num_space_dim; ++i)
+        {
+            fluxes(point, energy, i) = -_rhoCp * _velocity[i](cell, point)
+                                       * _temperature(cell, point);
+            if (_build_viscous_flux)
+            {
+                fluxes(point, energy, i) += _kappa
+                                            * _grad_temp(cell, point, i);
+                if (_use_turbulence_model)
+                {
+                    fluxes(point, energy, i) += nu_t * _rhoCp / _Pr_t
+                                                * _grad_temp(cell, point, i);
+                }
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+template<class EvalType, class Traits, int NumSpaceDim>
+KOKKOS_INLINE_FUNCTION typename EvalType::ScalarT
+IncompressibleFusedResidual<EvalType, Traits, NumSpaceDim>::source(
+    const int cell, const int point, const int equation) const
+{
+    scalar_type total = 0.0;
+    if (_build_constant_source)
+        total += _constant_source[equation](cell, point);
+    if (_build_buoyancy_source)
+        total += _buoyancy_source[equation](cell, point);
+    if (_build_viscous_heat)
+        total += _viscous_heat[equation](cell, point);
+    return total;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace ClosureModel
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_CLOSURE_INCOMPRESSIBLEFUSEDRESIDUAL_IMPL_HPP
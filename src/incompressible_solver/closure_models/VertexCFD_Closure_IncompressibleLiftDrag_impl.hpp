@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLELIFTDRAG_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLELIFTDRAG_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
@@ -51,50 +52,45 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleLiftDrag<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _lagrange_pressure.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleLiftDrag<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _lagrange_pressure.extent(1);
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Calculate wall shear tensor (grad.U + transpose(grad.U))
-            for (int i = 0; i < num_space_dim; ++i)
+    // Calculate wall shear tensor (grad.U + transpose(grad.U))
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        _shear_tensor[i](cell, point) = 0;
+        for (int j = 0; j < num_space_dim; ++j)
+        {
+            _shear_tensor[i](cell, point)
+                += (_grad_velocity[j](cell, point, i)
+                    + _grad_velocity[i](cell, point, j))
+                   * _normals(cell, point, j);
+            // If compressible formula div.U != 0 hence calculate
+            // deviatoric part
+            if (_use_compressible_formula)
             {
-                _shear_tensor[i](cell, point) = 0;
-                for (int j = 0; j < num_space_dim; ++j)
-                {
-                    _shear_tensor[i](cell, point)
-                        += (_grad_velocity[j](cell, point, i)
-                            + _grad_velocity[i](cell, point, j))
-                           * _normals(cell, point, j);
-                    // If compressible formula div.U != 0 hence calculate
-                    // deviatoric part
-                    if (_use_compressible_formula)
-                    {
-                        _shear_tensor[i](cell, point)
-                            -= 2.0 * _grad_velocity[j](cell, point, j)
-                               / num_space_dim * _normals(cell, point, i);
-                    }
-                }
-                _pressure_force[i](cell, point)
-                    = _lagrange_pressure(cell, point)
-                      * _normals(cell, point, i);
-                _viscous_force[i](cell, point)
-                    = -_rho * _nu * _shear_tensor[i](cell, point);
-                _total_force[i](cell, point)
-                    = _viscous_force[i](cell, point)
-                      + _pressure_force[i](cell, point);
+                _shear_tensor[i](cell, point)
+                    -= 2.0 * _grad_velocity[j](cell, point, j)
+                       / num_space_dim * _normals(cell, point, i);
             }
-        });
+        }
+        _pressure_force[i](cell, point)
+            = _lagrange_pressure(cell, point)
+              * _normals(cell, point, i);
+        _viscous_force[i](cell, point)
+            = -_rho * _nu * _shear_tensor[i](cell, point);
+        _total_force[i](cell, point)
+            = _viscous_force[i](cell, point)
+              + _pressure_force[i](cell, point);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -40,8 +40,7 @@ class IncompressiblePlanarPoiseuilleExact
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   public:
     PHX::MDField<double, panzer::Cell, panzer::Point> _temperature;
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEPLANARPOISEUILLEEXACT_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLEPLANARPOISEUILLEEXACT_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include "Panzer_GlobalIndexer.hpp"
@@ -64,50 +65,44 @@ void IncompressiblePlanarPoiseuilleExact<EvalType, Traits, NumSpaceDim>::
     evaluateFields(typename Traits::EvalData workset)
 {
     _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _temperature.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressiblePlanarPoiseuilleExact<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _temperature.extent(1);
-
     using std::pow;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Note: an analytical solution is only available for the velocity
-            // and temperature fields
-            _lagrange_pressure(cell, point) = 0.0;
-
-            // Get geometric and thermal parameters
-            const double H = (_h_max - _h_min) / 2.0;
-            const double y = _ip_coords(cell, point, 1);
-            const double Pr = _cp * _rho * _nu / _k;
-            const double dT = _T_l - _T_u;
-            const double U = _S_u * H * H / 3.0 / _nu;
-            const double E = U * U / _cp / dT;
-
-            // Calculate excess temperature
-            const double T_star = 0.5 * (1.0 - (y / H))
-                                  + 3.0 / 4.0 * Pr * E
-                                        * (1.0 - pow(y / H, 4.0));
-            // Back out exact temperature
-            _temperature(cell, point) = T_star * dT + _T_u;
-
-            // Calculate exact velocity
-            _velocity[0](cell, point) = 3.0 / 2.0 * U * (1.0 - pow(y / H, 2.0));
-            _velocity[1](cell, point) = 0.0;
-
-            if (num_space_dim == 3)
-                _velocity[2](cell, point) = 0.0;
-        });
+    // Note: an analytical solution is only available for the velocity
+    // and temperature fields
+    _lagrange_pressure(cell, point) = 0.0;
+
+    // Get geometric and thermal parameters
+    const double H = (_h_max - _h_min) / 2.0;
+    const double y = _ip_coords(cell, point, 1);
+    const double Pr = _cp * _rho * _nu / _k;
+    const double dT = _T_l - _T_u;
+    const double U = _S_u * H * H / 3.0 / _nu;
+    const double E = U * U / _cp / dT;
+
+    // Calculate excess temperature
+    const double T_star = 0.5 * (1.0 - (y / H))
+                          + 3.0 / 4.0 * Pr * E
+                                * (1.0 - pow(y / H, 4.0));
+    // Back out exact temperature
+    _temperature(cell, point) = T_star * dT + _T_u;
+
+    // Calculate exact velocity
+    _velocity[0](cell, point) = 3.0 / 2.0 * U * (1.0 - pow(y / H, 2.0));
+    _velocity[1](cell, point) = 0.0;
+
+    if (num_space_dim == 3)
+        _velocity[2](cell, point) = 0.0;
 }
 
 //---------------------------------------------------------------------------//
@@ -42,8 +42,7 @@ class IncompressibleRotatingAnnulusExact
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
     PHX::MDField<double, panzer::Cell, panzer::Point> _temperature;
     PHX::MDField<double, panzer::Cell, panzer::Point> _lagrange_pressure;
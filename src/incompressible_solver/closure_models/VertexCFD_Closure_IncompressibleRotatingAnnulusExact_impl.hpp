@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEROTATINGANNULUSEXACT_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLEROTATINGANNULUSEXACT_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include "Panzer_GlobalIndexer.hpp"
@@ -65,56 +66,50 @@ void IncompressibleRotatingAnnulusExact<EvalType, Traits, NumSpaceDim>::
     evaluateFields(typename Traits::EvalData workset)
 {
     _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _temperature.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleRotatingAnnulusExact<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _temperature.extent(1);
-
     using std::log;
     using std::sqrt;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Note: an analytical solution is only available for the velocity
-            // and temperature fields
-            _lagrange_pressure(cell, point) = 0.0;
-
-            // Get radius
-            const double x = _ip_coords(cell, point, 0);
-            const double y = _ip_coords(cell, point, 1);
-            const double r = sqrt(x * x + y * y);
-            const double ksi = r / _ro;
-
-            // Calculate non-dimensional temperature
-            const double theta = (1.0 - log(ksi) / log(_kappa))
-                                 + _N
-                                       * ((1 - 1 / (ksi * ksi))
-                                          - (1 - 1 / (_kappa * _kappa))
-                                                * log(ksi) / log(_kappa));
-
-            // Back out exact temperature
-            _temperature(cell, point) = theta * (_To - _Ti) + _Ti;
-
-            // Tangential velocity
-            const double u_phi = _omega * _ro * _ro / (_ro * _ro - _ri * _ri)
-                                 * (r - (_ri * _ri / r));
-
-            // Exact velocity
-            _velocity[0](cell, point) = -u_phi * y / r;
-            _velocity[1](cell, point) = u_phi * x / r;
-
-            if (num_space_dim == 3)
-                _velocity[2](cell, point) = 0.0;
-        });
+    // Note: an analytical solution is only available for the velocity
+    // and temperature fields
+    _lagrange_pressure(cell, point) = 0.0;
+
+    // Get radius
+    const double x = _ip_coords(cell, point, 0);
+    const double y = _ip_coords(cell, point, 1);
+    const double r = sqrt(x * x + y * y);
+    const double ksi = r / _ro;
+
+    // Calculate non-dimensional temperature
+    const double theta = (1.0 - log(ksi) / log(_kappa))
+                         + _N
+                               * ((1 - 1 / (ksi * ksi))
+                                  - (1 - 1 / (_kappa * _kappa))
+                                        * log(ksi) / log(_kappa));
+
+    // Back out exact temperature
+    _temperature(cell, point) = theta * (_To - _Ti) + _Ti;
+
+    // Tangential velocity
+    const double u_phi = _omega * _ro * _ro / (_ro * _ro - _ri * _ri)
+                         * (r - (_ri * _ri / r));
+
+    // Exact velocity
+    _velocity[0](cell, point) = -u_phi * y / r;
+    _velocity[1](cell, point) = u_phi * x / r;
+
+    if (num_space_dim == 3)
+        _velocity[2](cell, point) = 0.0;
 }
 
 //---------------------------------------------------------------------------//
@@ -38,8 +38,7 @@ class IncompressibleShearVariables
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point> _tau_w;
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point> _u_tau;
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLESHEARVARIABLES_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLESHEARVARIABLES_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
@@ -42,45 +43,40 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleShearVariables<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _u_tau.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleShearVariables<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _u_tau.extent(1);
     const int num_grad_dim = _normals.extent(2);
     using std::pow;
     using std::sqrt;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Wall shear-stress
-            _tau_w(cell, point) = 0.0;
-            for (int i = 0; i < num_space_dim; ++i)
-            {
-                scalar_type sum = 0.0;
-                for (int dim = 0; dim < num_grad_dim; ++dim)
-                {
-                    sum += _normals(cell, point, dim)
-                           * _grad_velocity[i](cell, point, dim);
-                }
-                _tau_w(cell, point) += pow(sum, 2.0);
-            }
-            _tau_w(cell, point)
-                = sqrt(SmoothMath::max(_tau_w(cell, point), 1.0E-10, 0.0));
-            _tau_w(cell, point) *= _nu;
+    // Wall shear-stress
+    _tau_w(cell, point) = 0.0;
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        scalar_type sum = 0.0;
+        for (int dim = 0; dim < num_grad_dim; ++dim)
+        {
+            sum += _normals(cell, point, dim)
+                   * _grad_velocity[i](cell, point, dim);
+        }
+        _tau_w(cell, point) += pow(sum, 2.0);
+    }
+    _tau_w(cell, point)
+        = sqrt(SmoothMath::max(_tau_w(cell, point), 1.0E-10, 0.0));
+    _tau_w(cell, point) *= _nu;
 
-            // Friction velocity
-            _u_tau(cell, point) = sqrt(_tau_w(cell, point));
-            _tau_w(cell, point) *= _rho;
-        });
+    // Friction velocity
+    _u_tau(cell, point) = sqrt(_tau_w(cell, point));
+    _tau_w(cell, point) *= _rho;
 }
 
 //---------------------------------------------------------------------------//
@@ -34,8 +34,7 @@ class IncompressibleTimeDerivative
     void evaluateFields(typename Traits::EvalData d) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   public:
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point> _dqdt_continuity;
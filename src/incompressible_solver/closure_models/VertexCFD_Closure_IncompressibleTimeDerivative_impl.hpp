@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLETIMEDERIVATIVE_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLETIMEDERIVATIVE_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -50,35 +51,29 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleTimeDerivative<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _dqdt_continuity.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleTimeDerivative<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _dqdt_continuity.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            _dqdt_continuity(cell, point)
-                = _dxdt_lagrange_pressure(cell, point) / _beta;
+    _dqdt_continuity(cell, point)
+        = _dxdt_lagrange_pressure(cell, point) / _beta;
 
-            for (int dim = 0; dim < num_space_dim; ++dim)
-                _dqdt_momentum[dim](cell, point)
-                    = _rho * _dxdt_velocity[dim](cell, point);
+    for (int dim = 0; dim < num_space_dim; ++dim)
+        _dqdt_momentum[dim](cell, point)
+            = _rho * _dxdt_velocity[dim](cell, point);
 
-            if (_solve_temp)
-            {
-                _dqdt_energy(cell, point) = _rhoCp
-                                            * _dxdt_temperature(cell, point);
-            }
-        });
+    if (_solve_temp)
+    {
+        _dqdt_energy(cell, point) = _rhoCp
+                                    * _dxdt_temperature(cell, point);
+    }
 }
 
 //---------------------------------------------------------------------------//
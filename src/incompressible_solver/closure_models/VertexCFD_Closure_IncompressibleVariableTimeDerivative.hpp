@@ -32,8 +32,7 @@ class IncompressibleVariableTimeDerivative
     void evaluateFields(typename Traits::EvalData d) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   private:
     std::string _variable_name;
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEVISCOUSFLUX_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLEVISCOUSFLUX_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -79,65 +80,60 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleViscousFlux<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _continuity_flux.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleViscousFlux<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _continuity_flux.extent(1);
     const double ratio_kappa_t_nu_t = _rhoCp / _Pr_t;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Loop over spatial dimension
-            for (int i = 0; i < num_space_dim; ++i)
-            {
-                // Set stress tensor for EDAC continuity model
-                if (_is_edac)
-                {
-                    _continuity_flux(cell, point, i)
-                        = _rho * _nu * _grad_press(cell, point, i) / _beta;
-                }
-                // Set stress tensor to zero for AC continuity model
-                else
-                {
-                    _continuity_flux(cell, point, i) = 0.0;
-                }
+    // Loop over spatial dimension
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        // Set stress tensor for EDAC continuity model
+        if (_is_edac)
+        {
+            _continuity_flux(cell, point, i)
+                = _rho * _nu * _grad_press(cell, point, i) / _beta;
+        }
+        // Set stress tensor to zero for AC continuity model
+        else
+        {
+            _continuity_flux(cell, point, i) = 0.0;
+        }
 
-                // Temperature equation
-                if (_solve_temp)
-                {
-                    _energy_flux(cell, point, i)
-                        = _kappa * _grad_temp(cell, point, i);
-                    if (_use_turbulence_model)
-                    {
-                        _energy_flux(cell, point, i)
-                            += _nu_t(cell, point) * ratio_kappa_t_nu_t
-                               * _grad_temp(cell, point, i);
-                    }
-                }
+        // Temperature equation
+        if (_solve_temp)
+        {
+            _energy_flux(cell, point, i)
+                = _kappa * _grad_temp(cell, point, i);
+            if (_use_turbulence_model)
+            {
+                _energy_flux(cell, point, i)
+                    += _nu_t(cell, point) * ratio_kappa_t_nu_t
+                       * _grad_temp(cell, point, i);
+            }
+        }
 
-                // Loop over velocity/momentum components
-                for (int j = 0; j < num_space_dim; ++j)
-                {
-                    _momentum_flux[j](cell, point, i)
-                        = _rho * _nu * _grad_velocity[j](cell, point, i);
-                    if (_use_turbulence_model)
-                    {
-                        _momentum_flux[j](cell, point, i)
-                            += _rho * _nu_t(cell, point)
-                               * _grad_velocity[j](cell, point, i);
-                    }
-                }
+        // Loop over velocity/momentum components
+        for (int j = 0; j < num_space_dim; ++j)
+        {
+            _momentum_flux[j](cell, point, i)
+                = _rho * _nu * _grad_velocity[j](cell, point, i);
+            if (_use_turbulence_model)
+            {
+                _momentum_flux[j](cell, point, i)
+                    += _rho * _nu_t(cell, point)
+                       * _grad_velocity[j](cell, point, i);
             }
-        });
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
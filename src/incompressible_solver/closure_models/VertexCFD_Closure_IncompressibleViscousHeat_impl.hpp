@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_VISCOUSHEAT_IMPL_HPP
 #define VERTEXCFD_CLOSURE_VISCOUSHEAT_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -47,46 +48,40 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleViscousHeat<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _viscous_heat_continuity_source.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleViscousHeat<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _viscous_heat_continuity_source.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            _viscous_heat_continuity_source(cell, point) = 0.0;
-
-            // Reset energy source to zero
-            _viscous_heat_energy_source(cell, point) = 0.0;
-
-            for (int i = 0; i < num_space_dim; ++i)
-            {
-                for (int j = 0; j < num_space_dim; ++j)
-                {
-                    // Calculate deformation tensor component
-                    const scalar_type e_ij
-                        = 0.5
-                          * (_grad_velocity[j](cell, point, i)
-                             + _grad_velocity[i](cell, point, j));
-
-                    // Add contribution from each dimension to energy source
-                    _viscous_heat_energy_source(cell, point)
-                        += 2.0 * _rho * _nu * e_ij * e_ij;
-                }
-
-                // No momentum contribution for this source term
-                _viscous_heat_momentum_source[i](cell, point) = 0.0;
-            }
-        });
+    _viscous_heat_continuity_source(cell, point) = 0.0;
+
+    // Reset energy source to zero
+    _viscous_heat_energy_source(cell, point) = 0.0;
+
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        for (int j = 0; j < num_space_dim; ++j)
+        {
+            // Calculate deformation tensor component
+            const scalar_type e_ij
+                = 0.5
+                  * (_grad_velocity[j](cell, point, i)
+                     + _grad_velocity[i](cell, point, j));
+
+            // Add contribution from each dimension to energy source
+            _viscous_heat_energy_source(cell, point)
+                += 2.0 * _rho * _nu * e_ij * e_ij;
+        }
+
+        // No momentum contribution for this source term
+        _viscous_heat_momentum_source[i](cell, point) = 0.0;
+    }
 }
 
 //---------------------------------------------------------------------------//
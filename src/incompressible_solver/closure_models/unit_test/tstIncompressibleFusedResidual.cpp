@@ -0,0 +1,348 @@
+#include <VertexCFD_EvaluatorTestHarness.hpp>
+
+#include "incompressible_solver/closure_models/VertexCFD_Closure_IncompressibleConstantSource.hpp"
+#include "incompressible_solver/closure_models/VertexCFD_Closure_IncompressibleConvectiveFlux.hpp"
+#include "incompressible_solver/closure_models/VertexCFD_Closure_IncompressibleFusedResidual.hpp"
+#include "incompressible_solver/closure_models/VertexCFD_Closure_IncompressibleTimeDerivative.hpp"
+#include "incompressible_solver/closure_models/VertexCFD_Closure_IncompressibleViscousFlux.hpp"
+#include "incompressible_solver/fluid_properties/VertexCFD_ConstantFluidProperties.hpp"
+#include "utils/VertexCFD_Utils_VectorField.hpp"
+
+#include <Panzer_Integrator_BasisTimesScalar.hpp>
+#include <Panzer_Integrator_GradBasisDotVector.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Test data dependencies which vary over the integration points.
+template<class EvalType, int NumSpaceDim>
+struct Dependencies : public panzer::EvaluatorWithBaseImpl<panzer::Traits>,
+                      public PHX::EvaluatorDerived<EvalType, panzer::Traits>
+{
+    using scalar_type = typename EvalType::ScalarT;
+    static constexpr int num_space_dim = NumSpaceDim;
+
+    PHX::MDField<scalar_type, panzer::Cell, panzer::Point> lagrange_pressure;
+    PHX::MDField<scalar_type, panzer::Cell, panzer::Point> temperature;
+    PHX::MDField<scalar_type, panzer::Cell, panzer::Point> dxdt_pressure;
+    PHX::MDField<scalar_type, panzer::Cell, panzer::Point> dxdt_temperature;
+    PHX::MDField<scalar_type, panzer::Cell, panzer::Point> nu_t;
+    PHX::MDField<scalar_type, panzer::Cell, panzer::Point, panzer::Dim>
+        grad_pressure;
+    PHX::MDField<scalar_type, panzer::Cell, panzer::Point, panzer::Dim>
+        grad_temperature;
+    Kokkos::Array<PHX::MDField<scalar_type, panzer::Cell, panzer::Point>,
+                  num_space_dim>
+        velocity;
+    Kokkos::Array<PHX::MDField<scalar_type, panzer::Cell, panzer::Point>,
+                  num_space_dim>
+        dxdt_velocity;
+    Kokkos::Array<
+        PHX::MDField<scalar_type, panzer::Cell, panzer::Point, panzer::Dim>,
+        num_space_dim>
+        grad_velocity;
+
+    Dependencies(const panzer::IntegrationRule& ir)
+        : lagrange_pressure("lagrange_pressure", ir.dl_scalar)
+        , temperature("temperature", ir.dl_scalar)
+        , dxdt_pressure("DXDT_lagrange_pressure", ir.dl_scalar)
+        , dxdt_temperature("DXDT_temperature", ir.dl_scalar)
+        , nu_t("turbulent_eddy_viscosity", ir.dl_scalar)
+        , grad_pressure("GRAD_lagrange_pressure", ir.dl_vector)
+        , grad_temperature("GRAD_temperature", ir.dl_vector)
+    {
+        this->addEvaluatedField(lagrange_pressure);
+        this->addEvaluatedField(temperature);
+        this->addEvaluatedField(dxdt_pressure);
+        this->addEvaluatedField(dxdt_temperature);
+        this->addEvaluatedField(nu_t);
+        this->addEvaluatedField(grad_pressure);
+        this->addEvaluatedField(grad_temperature);
+        Utils::addEvaluatedVectorField(
+            *this, ir.dl_scalar, velocity, "velocity_");
+        Utils::addEvaluatedVectorField(
+            *this, ir.dl_scalar, dxdt_velocity, "DXDT_velocity_");
+        Utils::addEvaluatedVectorField(
+            *this, ir.dl_vector, grad_velocity, "GRAD_velocity_");
+
+        this->setName("Incompressible Fused Residual Unit Test Dependencies");
+    }
+
+    void evaluateFields(typename panzer::Traits::EvalData d) override
+    {
+        Kokkos::parallel_for(
+            "fused residual test dependencies",
+            Kokkos::RangePolicy<PHX::exec_space>(0, d.num_cells),
+            *this);
+    }
+
+    KOKKOS_INLINE_FUNCTION void operator()(const int c) const
+    {
+        const int num_point = lagrange_pressure.extent(1);
+        for (int qp = 0; qp < num_point; ++qp)
+        {
+            const double s = 1.0 + 0.25 * qp;
+            lagrange_pressure(c, qp) = 0.5 * s;
+            temperature(c, qp) = 1.5 * s;
+            dxdt_pressure(c, qp) = -0.25 * s;
+            dxdt_temperature(c, qp) = 0.75 * s;
+            nu_t(c, qp) = 0.125 * s;
+            for (int i = 0; i < num_space_dim; ++i)
+            {
+                velocity[i](c, qp) = (i + 1) * 0.5 * s;
+                dxdt_velocity[i](c, qp) = (i - 1) * 0.375 * s;
+                grad_pressure(c, qp, i) = (i + 2) * 0.25 * s;
+                grad_temperature(c, qp, i) = (1 - i) * 0.5 * s;
+                for (int j = 0; j < num_space_dim; ++j)
+                    grad_velocity[i](c, qp, j) = (i - j + 0.5) * s;
+            }
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Register a reference integrator of one residual term.
+template<class EvalType>
+std::string addIntegrator(EvaluatorTestFixture& test_fixture,
+                          const std::string& term_name,
+                          const std::string& equ_name,
+                          const bool grad_basis,
+                          const double multiplier)
+{
+    const std::string field_name = term_name + "_" + equ_name;
+    const std::string residual_name = "RESIDUAL_" + field_name;
+    Teuchos::RCP<PHX::Evaluator<panzer::Traits>> op;
+    if (grad_basis)
+    {
+        op = Teuchos::rcp(
+            new panzer::Integrator_GradBasisDotVector<EvalType, panzer::Traits>(
+                panzer::EvaluatorStyle::EVALUATES,
+                residual_name,
+                field_name,
+                *test_fixture.basis_ir_layout,
+                *test_fixture.ir,
+                multiplier));
+    }
+    else
+    {
+        op = Teuchos::rcp(
+            new panzer::Integrator_BasisTimesScalar<EvalType, panzer::Traits>(
+                panzer::EvaluatorStyle::EVALUATES,
+                residual_name,
+                field_name,
+                *test_fixture.basis_ir_layout,
+                *test_fixture.ir,
+                multiplier));
+    }
+    test_fixture.registerEvaluator<EvalType>(op);
+    return residual_name;
+}
+
+//---------------------------------------------------------------------------//
+// Compare the fused residual to the closure models integrated separately.
+template<class EvalType, int NumSpaceDim>
+void testEval(const bool build_temp_equ,
+              const bool build_viscous_flux,
+              const bool build_turbulence_model,
+              const bool build_constant_source,
+              const bool is_edac)
+{
+    constexpr int num_space_dim = NumSpaceDim;
+    const int integration_order = 2;
+    const int basis_order = 1;
+    EvaluatorTestFixture test_fixture(
+        num_space_dim, integration_order, basis_order);
+    const auto& ir = *test_fixture.ir;
+
+    const auto deps
+        = Teuchos::rcp(new Dependencies<EvalType, num_space_dim>(ir));
+    test_fixture.registerEvaluator<EvalType>(deps);
+
+    Teuchos::ParameterList fluid_prop_list;
+    fluid_prop_list.set("Kinematic viscosity", 0.375);
+    fluid_prop_list.set("Artificial compressibility", 2.0);
+    fluid_prop_list.set("Density", 3.0);
+    fluid_prop_list.set("Build Temperature Equation", build_temp_equ);
+    if (build_temp_equ)
+    {
+        fluid_prop_list.set("Thermal conductivity", 0.5);
+        fluid_prop_list.set("Specific heat capacity", 0.2);
+    }
+    const FluidProperties::ConstantFluidProperties fluid_prop(fluid_prop_list);
+
+    Teuchos::ParameterList user_params;
+    if (is_edac)
+        user_params.set("Continuity Model", "EDAC");
+    if (build_turbulence_model && build_temp_equ)
+        user_params.set("Turbulent Prandtl Number", 0.8);
+    if (build_constant_source)
+    {
+        Teuchos::Array<double> momentum_source(num_space_dim);
+        for (int dim = 0; dim < num_space_dim; ++dim)
+            momentum_source[dim] = 0.5 * (dim + 1);
+        user_params.set("Momentum Source", momentum_source);
+        if (build_temp_equ)
+            user_params.set("Energy Source", 1.25);
+    }
+
+    // Closure models and integrators.
+    test_fixture.registerEvaluator<EvalType>(Teuchos::rcp(
+        new ClosureModel::
+            IncompressibleTimeDerivative<EvalType, panzer::Traits, num_space_dim>(
+                ir, fluid_prop)));
+    test_fixture.registerEvaluator<EvalType>(Teuchos::rcp(
+        new ClosureModel::
+            IncompressibleConvectiveFlux<EvalType, panzer::Traits, num_space_dim>(
+                ir, fluid_prop)));
+    if (build_viscous_flux)
+    {
+        test_fixture.registerEvaluator<EvalType>(Teuchos::rcp(
+            new ClosureModel::IncompressibleViscousFlux<EvalType,
+                                                        panzer::Traits,
+                                                        num_space_dim>(
+                ir, fluid_prop, user_params, build_turbulence_model)));
+    }
+    if (build_constant_source)
+    {
+        test_fixture.registerEvaluator<EvalType>(Teuchos::rcp(
+            new ClosureModel::IncompressibleConstantSource<EvalType,
+                                                           panzer::Traits,
+                                                           num_space_dim>(
+                ir, fluid_prop, user_params)));
+    }
+
+    std::vector<std::string> equ_names = {"continuity"};
+    for (int dim = 0; dim < num_space_dim; ++dim)
+        equ_names.push_back("momentum_" + std::to_string(dim));
+    if (build_temp_equ)
+        equ_names.push_back("energy");
+
+    const int num_equation = equ_names.size();
+    std::vector<std::vector<std::string>> reference_terms(num_equation);
+    for (int equ = 0; equ < num_equation; ++equ)
+    {
+        const auto& name = equ_names[equ];
+        auto& terms = reference_terms[equ];
+        terms.push_back(
+            addIntegrator<EvalType>(test_fixture, "DQDT", name, false, 1.0));
+        terms.push_back(addIntegrator<EvalType>(
+            test_fixture, "CONVECTIVE_FLUX", name, true, -1.0));
+        if (build_viscous_flux)
+        {
+            terms.push_back(addIntegrator<EvalType>(
+                test_fixture, "VISCOUS_FLUX", name, true, 1.0));
+        }
+        if (build_constant_source)
+        {
+            terms.push_back(addIntegrator<EvalType>(
+                test_fixture, "CONSTANT_SOURCE", name, false, -1.0));
+        }
+    }
+
+    // Fused residual.
+    auto eval = Teuchos::rcp(
+        new ClosureModel::
+            IncompressibleFusedResidual<EvalType, panzer::Traits, num_space_dim>(
+                ir,
+                *test_fixture.basis_ir_layout,
+                fluid_prop,
+                user_params,
+                build_turbulence_model,
+                build_viscous_flux,
+                build_constant_source,
+                false,
+                false));
+    test_fixture.registerEvaluator<EvalType>(eval);
+
+    using residual_field
+        = PHX::MDField<typename EvalType::ScalarT, panzer::Cell, panzer::BASIS>;
+    std::vector<std::vector<residual_field>> reference_fields(num_equation);
+    for (int equ = 0; equ < num_equation; ++equ)
+    {
+        test_fixture.registerTestField<EvalType>(eval->_residual[equ]);
+        for (const auto& term : reference_terms[equ])
+        {
+            reference_fields[equ].push_back(residual_field(
+                term, test_fixture.basis_ir_layout->functional));
+            test_fixture.registerTestField<EvalType>(
+                reference_fields[equ].back());
+        }
+    }
+
+    test_fixture.evaluate<EvalType>();
+
+    for (int equ = 0; equ < num_equation; ++equ)
+    {
+        // The reference fields are not held by an evaluator of the test so
+        // bind them to the field manager data.
+        for (auto& field : reference_fields[equ])
+            test_fixture.fm->getFieldData<EvalType>(field);
+
+        const auto fused
+            = test_fixture.getTestFieldData<EvalType>(eval->_residual[equ]);
+        const int num_basis = test_fixture.cardinality();
+        for (int basis = 0; basis < num_basis; ++basis)
+        {
+            double expected = 0.0;
+            for (const auto& field : reference_fields[equ])
+            {
+                const auto term
+                    = test_fixture.getTestFieldData<EvalType>(field);
+                expected += fieldValue(term, 0, basis);
+            }
+            EXPECT_NEAR(expected,
+                        fieldValue(fused, 0, basis),
+                        1.0e-12 * (1.0 + std::abs(expected)))
+                << equ_names[equ] << " basis " << basis;
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(IncompressibleFusedResidual, residual_2d)
+{
+    testEval<panzer::Traits::Residual, 2>(false, true, false, false, false);
+}
+
+//---------------------------------------------------------------------------//
+TEST(IncompressibleFusedResidual, residual_3d)
+{
+    testEval<panzer::Traits::Residual, 3>(false, true, false, false, false);
+}
+
+//---------------------------------------------------------------------------//
+TEST(IncompressibleFusedResidual, inviscid_residual_2d)
+{
+    testEval<panzer::Traits::Residual, 2>(false, false, false, false, false);
+}
+
+//---------------------------------------------------------------------------//
+TEST(IncompressibleFusedResidual, temperature_turbulence_edac_residual_2d)
+{
+    testEval<panzer::Traits::Residual, 2>(true, true, true, true, true);
+}
+
+//---------------------------------------------------------------------------//
+TEST(IncompressibleFusedResidual, temperature_turbulence_edac_residual_3d)
+{
+    testEval<panzer::Traits::Residual, 3>(true, true, true, true, true);
+}
+
+//---------------------------------------------------------------------------//
+TEST(IncompressibleFusedResidual, temperature_turbulence_edac_jacobian_3d)
+{
+    testEval<panzer::Traits::Jacobian, 3>(true, true, true, true, true);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_ELECTRICPOTENTIALFIXED_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_ELECTRICPOTENTIALFIXED_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -61,32 +62,26 @@ void ElectricPotentialFixed<EvalType, Traits>::evaluateFields(
     _time = std::max(workset.time, _time_init);
     _time = std::min(_time, _time_final);
 
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _grad_electric_potential.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 ElectricPotentialFixed<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _grad_electric_potential.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Assign time-dependent boundary values
-            _boundary_electric_potential(cell, point) = _a_sc * _time + _b_sc;
+    // Assign time-dependent boundary values
+    _boundary_electric_potential(cell, point) = _a_sc * _time + _b_sc;
 
-            // Assign gradient.
-            for (int d = 0; d < _num_grad_dim; ++d)
-            {
-                _boundary_grad_electric_potential(cell, point, d)
-                    = _grad_electric_potential(cell, point, d);
-            }
-        });
+    // Assign gradient.
+    for (int d = 0; d < _num_grad_dim; ++d)
+    {
+        _boundary_grad_electric_potential(cell, point, d)
+            = _grad_electric_potential(cell, point, d);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_ELECTRICPOTENTIALINSULATINGWALL_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_ELECTRICPOTENTIALINSULATINGWALL_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
+
 #include <Panzer_HierarchicParallelism.hpp>
 
 namespace VertexCFD
@@ -33,42 +35,37 @@ template<class EvalType, class Traits>
 void ElectricPotentialInsulatingWall<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _electric_potential.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 ElectricPotentialInsulatingWall<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _electric_potential.extent(1);
     const int num_grad_dim = _normals.extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Compute \grad(\phi) \cdot \vec{n}
-            scalar_type grad_phi_dot_n = 0.0;
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                grad_phi_dot_n += _grad_electric_potential(cell, point, dim)
-                                  * _normals(cell, point, dim);
-            }
+    // Compute \grad(\phi) \cdot \vec{n}
+    scalar_type grad_phi_dot_n = 0.0;
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        grad_phi_dot_n += _grad_electric_potential(cell, point, dim)
+                          * _normals(cell, point, dim);
+    }
 
-            _boundary_electric_potential(cell, point)
-                = _electric_potential(cell, point);
+    _boundary_electric_potential(cell, point)
+        = _electric_potential(cell, point);
 
-            // Set and boundary gradients
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                _boundary_grad_electric_potential(cell, point, dim)
-                    = _grad_electric_potential(cell, point, dim)
-                      - grad_phi_dot_n * _normals(cell, point, dim);
-            }
-        });
+    // Set and boundary gradients
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        _boundary_grad_electric_potential(cell, point, dim)
+            = _grad_electric_potential(cell, point, dim)
+              - grad_phi_dot_n * _normals(cell, point, dim);
+    }
 }
 
 //---------------------------------------------------------------------------//
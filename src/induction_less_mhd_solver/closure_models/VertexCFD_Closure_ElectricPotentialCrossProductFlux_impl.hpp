@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_ELECTRICPOTENTIALCROSSPRODUCTFLUX_IMPL_HPP
 #define VERTEXCFD_CLOSURE_ELECTRICPOTENTIALCROSSPRODUCTFLUX_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -42,50 +43,44 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void ElectricPotentialCrossProductFlux<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _electric_potential_flux.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 ElectricPotentialCrossProductFlux<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _electric_potential_flux.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // 2-D case (x- and y-components only)
-            _electric_potential_flux(cell, point, 0)
-                += _sigma * _velocity[1](cell, point)
-                   * _ext_magn_field[2](cell, point);
-            _electric_potential_flux(cell, point, 1)
-                -= _sigma * _velocity[0](cell, point)
-                   * _ext_magn_field[2](cell, point);
+    // 2-D case (x- and y-components only)
+    _electric_potential_flux(cell, point, 0)
+        += _sigma * _velocity[1](cell, point)
+           * _ext_magn_field[2](cell, point);
+    _electric_potential_flux(cell, point, 1)
+        -= _sigma * _velocity[0](cell, point)
+           * _ext_magn_field[2](cell, point);
 
-            // 3-D case
-            if (num_space_dim == 3)
-            {
-                // x-component
-                _electric_potential_flux(cell, point, 0)
-                    -= _sigma * _velocity[2](cell, point)
-                       * _ext_magn_field[1](cell, point);
-                // y-component
-                _electric_potential_flux(cell, point, 1)
-                    += _sigma * _velocity[2](cell, point)
-                       * _ext_magn_field[0](cell, point);
-                // z-component
-                _electric_potential_flux(cell, point, 2)
-                    += _sigma
-                       * (_velocity[0](cell, point)
-                              * _ext_magn_field[1](cell, point)
-                          - _velocity[1](cell, point)
-                                * _ext_magn_field[0](cell, point));
-            }
-        });
+    // 3-D case
+    if (num_space_dim == 3)
+    {
+        // x-component
+        _electric_potential_flux(cell, point, 0)
+            -= _sigma * _velocity[2](cell, point)
+               * _ext_magn_field[1](cell, point);
+        // y-component
+        _electric_potential_flux(cell, point, 1)
+            += _sigma * _velocity[2](cell, point)
+               * _ext_magn_field[0](cell, point);
+        // z-component
+        _electric_potential_flux(cell, point, 2)
+            += _sigma
+               * (_velocity[0](cell, point)
+                      * _ext_magn_field[1](cell, point)
+                  - _velocity[1](cell, point)
+                        * _ext_magn_field[0](cell, point));
+    }
 }
 
 //---------------------------------------------------------------------------//
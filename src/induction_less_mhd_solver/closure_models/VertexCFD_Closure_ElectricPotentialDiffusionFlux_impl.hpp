@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_CLOSURE_ELECTRICPOTENTIALDIFFUSIONFLUX_IMPL_HPP
 #define VERTEXCFD_CLOSURE_ELECTRICPOTENTIALDIFFUSIONFLUX_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
+
 #include <Panzer_HierarchicParallelism.hpp>
 
 #include <string>
@@ -39,28 +41,22 @@ template<class EvalType, class Traits>
 void ElectricPotentialDiffusionFlux<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _electric_potential_flux.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 ElectricPotentialDiffusionFlux<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _electric_potential_flux.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            for (int dim = 0; dim < _num_grad_dim; ++dim)
-            {
-                _electric_potential_flux(cell, point, dim)
-                    = -_sigma * _grad_electric_potential(cell, point, dim);
-            }
-        });
+    for (int dim = 0; dim < _num_grad_dim; ++dim)
+    {
+        _electric_potential_flux(cell, point, dim)
+            = -_sigma * _grad_electric_potential(cell, point, dim);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -41,8 +41,7 @@ class HartmannProblemExact : public panzer::EvaluatorWithBaseImpl<Traits>,
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
     PHX::MDField<scalar_type, panzer::Cell, panzer::Point> _exact_lagrange_pressure;
     Kokkos::Array<PHX::MDField<scalar_type, panzer::Cell, panzer::Point>,
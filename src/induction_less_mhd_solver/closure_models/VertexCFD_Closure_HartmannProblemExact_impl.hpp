@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_HARTMANNPROBLEMEXACT_IMPL_HPP
 #define VERTEXCFD_CLOSURE_HARTMANNPROBLEMEXACT_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include "Panzer_GlobalIndexer.hpp"
@@ -66,34 +67,28 @@ void HartmannProblemExact<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
     _ip_coords = workset.int_rules[_ir_index]->ip_coordinates;
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _exact_elec_pot.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 HartmannProblemExact<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _exact_elec_pot.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Note: an analytical solution is only available for
-            // the velocity and the electric potential.
-            _exact_lagrange_pressure(cell, point) = 0.0;
-            using std::cosh;
-            const double y = _ip_coords(cell, point, 1);
-            _exact_velocity[0](cell, point) = (cosh(_M) - cosh(_M * y / _L))
-                                              / (cosh(_M) - 1.0);
-            _exact_velocity[1](cell, point) = 0.0;
-            if (num_space_dim == 3)
-                _exact_velocity[2](cell, point) = 0.0;
-            _exact_elec_pot(cell, point) = 0.0;
-        });
+    // Note: an analytical solution is only available for
+    // the velocity and the electric potential.
+    _exact_lagrange_pressure(cell, point) = 0.0;
+    using std::cosh;
+    const double y = _ip_coords(cell, point, 1);
+    _exact_velocity[0](cell, point) = (cosh(_M) - cosh(_M * y / _L))
+                                      / (cosh(_M) - 1.0);
+    _exact_velocity[1](cell, point) = 0.0;
+    if (num_space_dim == 3)
+        _exact_velocity[2](cell, point) = 0.0;
+    _exact_elec_pot(cell, point) = 0.0;
 }
 
 //---------------------------------------------------------------------------//
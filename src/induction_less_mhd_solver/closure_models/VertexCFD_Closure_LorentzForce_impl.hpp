@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_LORENTZFORCE_IMPL_HPP
 #define VERTEXCFD_CLOSURE_LORENTZFORCE_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -38,73 +39,68 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void LorentzForce<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _grad_electric_potential.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 LorentzForce<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _grad_electric_potential.extent(1);
     const int num_grad_dim = _grad_electric_potential.extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Cross product term
-            _lorentz_force[0](cell, point)
-                = -_grad_electric_potential(cell, point, 1)
-                  * _ext_magn_field[2](cell, point);
-
-            _lorentz_force[1](cell, point)
-                = _grad_electric_potential(cell, point, 0)
-                  * _ext_magn_field[2](cell, point);
-
-            if (num_grad_dim == 3)
-            {
-                // x-component
-                _lorentz_force[0](cell, point)
-                    += _grad_electric_potential(cell, point, 2)
-                       * _ext_magn_field[1](cell, point);
-                // y-component
-                _lorentz_force[1](cell, point)
-                    -= _grad_electric_potential(cell, point, 2)
-                       * _ext_magn_field[0](cell, point);
-                // z-component
-                _lorentz_force[2](cell, point)
-                    = -_grad_electric_potential(cell, point, 0)
-                          * _ext_magn_field[1](cell, point)
-                      + _grad_electric_potential(cell, point, 1)
-                            * _ext_magn_field[0](cell, point);
-            }
-
-            // Compute B norm and \vec{u} \cdot \vec{B}. NOTE: the external
-            // magnetic field is assumed of the same dimension as the mesh in
-            // this implementation.
-            scalar_type B2 = 0.0;
-            scalar_type B_dot_u = 0.0;
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                B2 += _ext_magn_field[dim](cell, point)
-                      * _ext_magn_field[dim](cell, point);
-                B_dot_u += _ext_magn_field[dim](cell, point)
-                           * _velocity[dim](cell, point);
-            }
-
-            // Adding dot product terms
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                _lorentz_force[dim](cell, point)
-                    += _ext_magn_field[dim](cell, point) * B_dot_u;
-                _lorentz_force[dim](cell, point)
-                    -= B2 * _velocity[dim](cell, point);
-                _lorentz_force[dim](cell, point) *= _sigma;
-            }
-        });
+    // Cross product term
+    _lorentz_force[0](cell, point)
+        = -_grad_electric_potential(cell, point, 1)
+          * _ext_magn_field[2](cell, point);
+
+    _lorentz_force[1](cell, point)
+        = _grad_electric_potential(cell, point, 0)
+          * _ext_magn_field[2](cell, point);
+
+    if (num_grad_dim == 3)
+    {
+        // x-component
+        _lorentz_force[0](cell, point)
+            += _grad_electric_potential(cell, point, 2)
+               * _ext_magn_field[1](cell, point);
+        // y-component
+        _lorentz_force[1](cell, point)
+            -= _grad_electric_potential(cell, point, 2)
+               * _ext_magn_field[0](cell, point);
+        // z-component
+        _lorentz_force[2](cell, point)
+            = -_grad_electric_potential(cell, point, 0)
+                  * _ext_magn_field[1](cell, point)
+              + _grad_electric_potential(cell, point, 1)
+                    * _ext_magn_field[0](cell, point);
+    }
+
+    // Compute B norm and \vec{u} \cdot \vec{B}. NOTE: the external
+    // magnetic field is assumed of the same dimension as the mesh in
+    // this implementation.
+    scalar_type B2 = 0.0;
+    scalar_type B_dot_u = 0.0;
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        B2 += _ext_magn_field[dim](cell, point)
+              * _ext_magn_field[dim](cell, point);
+        B_dot_u += _ext_magn_field[dim](cell, point)
+                   * _velocity[dim](cell, point);
+    }
+
+    // Adding dot product terms
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        _lorentz_force[dim](cell, point)
+            += _ext_magn_field[dim](cell, point) * B_dot_u;
+        _lorentz_force[dim](cell, point)
+            -= B2 * _velocity[dim](cell, point);
+        _lorentz_force[dim](cell, point) *= _sigma;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -12,6 +12,7 @@
 #include "incompressible_solver/initial_conditions/VertexCFD_InitialCondition_IncompressibleLaminarFlow.hpp"
 #include "incompressible_solver/initial_conditions/VertexCFD_InitialCondition_IncompressibleTaylorGreenVortex.hpp"
 #include "incompressible_solver/initial_conditions/VertexCFD_InitialCondition_IncompressibleVortexInBox.hpp"
+#include "utils/VertexCFD_Utils_EvaluatorProfiler.hpp"
 
 #include <Panzer_FieldLibrary.hpp>
 #include <Panzer_PureBasis.hpp>
@@ -265,6 +266,10 @@ Factory<EvalType, NumSpaceDim>::buildClosureModels(
         }
     }
 
+    // Time the initial conditions when evaluator profiling is enabled.
+    for (auto& eval : *evaluators)
+        eval = Utils::profiledEvaluator<EvalType>(eval);
+
     return evaluators;
 }
 
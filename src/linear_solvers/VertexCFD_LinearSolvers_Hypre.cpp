@@ -168,6 +168,7 @@ void Hypre::initialize()
         HYPRE_CHK_ERR(HYPRE_IJMatrixCreate(
             comm, ilower, iupper, ilower, iupper, &hypre_A_));
         HYPRE_CHK_ERR(HYPRE_IJMatrixSetObjectType(hypre_A_, HYPRE_PARCSR));
+        setupHyprePattern();
         HYPRE_CHK_ERR(HYPRE_IJMatrixInitialize(hypre_A_));
 
         // Set hypre matrix with hypredrive
@@ -388,10 +389,9 @@ void Hypre::describe(Teuchos::FancyOStream& os,
 }
 
 //==============================================================================
-int Hypre::copyTpetraToHypre()
+void Hypre::setupHyprePattern()
 {
     using LO = Tpetra::CrsMatrix<>::local_ordinal_type;
-    using GO = Tpetra::CrsMatrix<>::global_ordinal_type;
 
     Teuchos::RCP<const Tpetra::CrsMatrix<>> matrix
         = Teuchos::rcp_dynamic_cast<const Tpetra::CrsMatrix<>>(A_);
@@ -399,28 +399,75 @@ int Hypre::copyTpetraToHypre()
         throw std::runtime_error(
             "Hypre<Tpetra::RowMatrix<double, LocalOrdinal, HYPRE_Int, Node>: "
             "Unsupported matrix configuration: Tpetra::CrsMatrix required");
-
-    std::vector<HYPRE_Int> new_indices(matrix->getLocalMaxNumRowEntries());
-    for (LO i = 0; i < (LO)matrix->getLocalNumRows(); i++)
+    if (!matrix->isFillComplete())
+        throw std::runtime_error(
+            "LinearSolvers::Hypre: The matrix must be fill complete");
+
+    // The local matrix stores the values of each row contiguously so a
+    // single set of row and column indices describes all local entries.
+    const auto local_matrix = matrix->getLocalMatrixHost();
+    const auto& row_map = local_matrix.graph.row_map;
+    const auto& entries = local_matrix.graph.entries;
+    const LO num_rows = local_matrix.numRows();
+
+    hypre_rows_.resize(num_rows);
+    hypre_row_sizes_.resize(num_rows);
+    hypre_cols_.resize(entries.extent(0));
+
+    // Count the entries in the diagonal and off-diagonal blocks of each row
+    // so Hypre can allocate the ParCSR structure up front.
+    const HYPRE_BigInt ilower
+        = globally_contiguous_row_map_->getMinGlobalIndex();
+    const HYPRE_BigInt iupper
+        = globally_contiguous_row_map_->getMaxGlobalIndex();
+    std::vector<HYPRE_Int> diag_sizes(num_rows, 0);
+    std::vector<HYPRE_Int> offd_sizes(num_rows, 0);
+
+    for (LO i = 0; i < num_rows; ++i)
     {
-        typename Tpetra::CrsMatrix<>::values_host_view_type values;
-        typename Tpetra::CrsMatrix<>::local_inds_host_view_type indices;
-        matrix->getLocalRowView(i, indices, values);
-        for (LO j = 0; j < (LO)indices.extent(0); j++)
+        hypre_rows_[i] = globally_contiguous_row_map_->getGlobalElement(i);
+        hypre_row_sizes_[i] = row_map(i + 1) - row_map(i);
+        for (auto k = row_map(i); k < row_map(i + 1); ++k)
         {
-            new_indices[j]
-                = globally_contiguous_col_map_->getGlobalElement(indices(j));
+            hypre_cols_[k]
+                = globally_contiguous_col_map_->getGlobalElement(entries(k));
+            if (hypre_cols_[k] >= ilower && hypre_cols_[k] <= iupper)
+                ++diag_sizes[i];
+            else
+                ++offd_sizes[i];
         }
-        HYPRE_Int GlobalRow[1];
-        HYPRE_Int numEntries = (GO)indices.extent(0);
-        GlobalRow[0] = globally_contiguous_row_map_->getGlobalElement(i);
-        HYPRE_CHK_ERR(HYPRE_IJMatrixSetValues(hypre_A_,
-                                              1,
-                                              &numEntries,
-                                              GlobalRow,
-                                              new_indices.data(),
-                                              values.data()));
     }
+
+    HYPRE_CHK_ERR(HYPRE_IJMatrixSetDiagOffdSizes(
+        hypre_A_, diag_sizes.data(), offd_sizes.data()));
+}
+
+//==============================================================================
+int Hypre::copyTpetraToHypre()
+{
+    Teuchos::RCP<const Tpetra::CrsMatrix<>> matrix
+        = Teuchos::rcp_dynamic_cast<const Tpetra::CrsMatrix<>>(A_);
+    if (matrix.is_null())
+        throw std::runtime_error(
+            "Hypre<Tpetra::RowMatrix<double, LocalOrdinal, HYPRE_Int, Node>: "
+            "Unsupported matrix configuration: Tpetra::CrsMatrix required");
+
+    // The sparsity pattern was fixed in initialize() and the local values are
+    // in the same order as the cached column indices, so the values view is
+    // passed to Hypre directly. Once the matrix has been assembled, setting
+    // the values of existing entries only updates the ParCSR values.
+    const auto values = matrix->getLocalMatrixHost().values;
+    if (values.extent(0) != hypre_cols_.size())
+        throw std::runtime_error(
+            "LinearSolvers::Hypre: The matrix sparsity pattern changed "
+            "after initialize()");
+
+    HYPRE_CHK_ERR(HYPRE_IJMatrixSetValues(hypre_A_,
+                                          hypre_rows_.size(),
+                                          hypre_row_sizes_.data(),
+                                          hypre_rows_.data(),
+                                          hypre_cols_.data(),
+                                          values.data()));
     HYPRE_CHK_ERR(HYPRE_IJMatrixAssemble(hypre_A_));
     return 0;
 }
@@ -28,6 +28,8 @@
 #include <_hypre_IJ_mv.h>
 #include <_hypre_parcsr_mv.h>
 
+#include <vector>
+
 namespace VertexCFD
 {
 namespace LinearSolvers
@@ -177,6 +179,11 @@ class Hypre : public Ifpack2::Preconditioner<>,
     //! Assignment operator (use is syntactically forbidded)
     Hypre& operator=(const Hypre&);
 
+    //! Builds the Hypre row and column indices of the local matrix entries
+    //! and sets the Hypre matrix row sizes. Must be called before the Hypre
+    //! matrix is initialized.
+    void setupHyprePattern();
+
     //! Copies matrix data from Tpetra matrix to Hypre matrix.
     int copyTpetraToHypre();
 
@@ -244,6 +251,15 @@ class Hypre : public Ifpack2::Preconditioner<>,
     Teuchos::RCP<const Tpetra::Map<>> globally_contiguous_row_map_;
     Teuchos::RCP<const Tpetra::Map<>> globally_contiguous_col_map_;
 
+    //! Hypre global row indices of the local rows, the number of entries in
+    //! each row and the Hypre global column index of each local entry in the
+    //! order of the Tpetra local matrix values. The sparsity pattern is fixed
+    //! between calls to initialize() so these are computed once and the
+    //! Tpetra values are passed to Hypre in a single call.
+    std::vector<HYPRE_BigInt> hypre_rows_;
+    std::vector<HYPRE_Int> hypre_row_sizes_;
+    std::vector<HYPRE_BigInt> hypre_cols_;
+
     //! YAML input for HypreDrive
     std::string hypredrive_yaml_;
 
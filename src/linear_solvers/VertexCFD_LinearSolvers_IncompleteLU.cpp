@@ -0,0 +1,692 @@
+#include "VertexCFD_LinearSolvers_IncompleteLU.hpp"
+
+#include <Tpetra_CrsMatrix.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+// Apply a functor to the rows [begin,end) in parallel on the host.
+template<class Functor>
+void parallelRows(const int begin, const int end, const Functor& functor)
+{
+    Kokkos::parallel_for(
+        "VertexCFD::IncompleteLU::rows",
+        Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(begin, end),
+        functor);
+    Kokkos::DefaultHostExecutionSpace().fence();
+}
+
+//---------------------------------------------------------------------------//
+// Group the rows by level given the level of each row.
+void groupLevels(const std::vector<int>& level,
+                 std::vector<int>& level_ptr,
+                 std::vector<int>& level_rows)
+{
+    const int num_levels
+        = level.empty() ? 0 : *std::max_element(level.begin(), level.end()) + 1;
+    level_ptr.assign(num_levels + 1, 0);
+    for (const int l : level)
+        ++level_ptr[l + 1];
+    for (int l = 0; l < num_levels; ++l)
+        level_ptr[l + 1] += level_ptr[l];
+
+    level_rows.resize(level.size());
+    std::vector<int> offset(level_ptr.begin(), level_ptr.end() - 1);
+    for (int row = 0; row < static_cast<int>(level.size()); ++row)
+        level_rows[offset[level[row]]++] = row;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// Constructor
+//---------------------------------------------------------------------------//
+IncompleteLUSolver::IncompleteLUSolver(const Teuchos::ParameterList& params)
+    : _fill_type(FillType::Level)
+    , _fill_level(0)
+    , _drop_tolerance(1.0e-4)
+    , _fill_factor(2.0)
+    , _triangular_solve(TriangularSolve::LevelScheduled)
+    , _num_sweeps(5)
+    , _single_precision(false)
+    , _matrix_set(false)
+    , _initialized(false)
+    , _computed(false)
+    , _pattern_set(false)
+    , _num_rows(0)
+{
+    // Fill strategy: levels of fill or threshold dropping
+    if (params.isType<std::string>("ILU Type"))
+    {
+        const auto type = params.get<std::string>("ILU Type");
+        if (type == "Level")
+        {
+            _fill_type = FillType::Level;
+        }
+        else if (type == "Threshold")
+        {
+            _fill_type = FillType::Threshold;
+        }
+        else
+        {
+            throw std::runtime_error("Unrecognized ILU type " + type
+                                     + ". Choose 'Level' or 'Threshold'.");
+        }
+    }
+
+    // Level of fill for ILU(k)
+    if (params.isType<int>("Fill Level"))
+        _fill_level = params.get<int>("Fill Level");
+
+    // Relative drop tolerance and fill limit for ILUT
+    if (params.isType<double>("Drop Tolerance"))
+        _drop_tolerance = params.get<double>("Drop Tolerance");
+    if (params.isType<double>("Fill Factor"))
+        _fill_factor = params.get<double>("Fill Factor");
+
+    // Triangular solve algorithm
+    if (params.isType<std::string>("Triangular Solve"))
+    {
+        const auto solve = params.get<std::string>("Triangular Solve");
+        if (solve == "Level Scheduled")
+        {
+            _triangular_solve = TriangularSolve::LevelScheduled;
+        }
+        else if (solve == "Jacobi")
+        {
+            _triangular_solve = TriangularSolve::Jacobi;
+        }
+        else
+        {
+            throw std::runtime_error(
+                "Unrecognized triangular solve " + solve
+                + ". Choose 'Level Scheduled' or 'Jacobi'.");
+        }
+    }
+    if (params.isType<int>("Jacobi Sweeps"))
+        _num_sweeps = params.get<int>("Jacobi Sweeps");
+
+    // Precision of the stored factors
+    if (params.isType<std::string>("Factor Precision"))
+    {
+        const auto precision = params.get<std::string>("Factor Precision");
+        if (precision == "Double")
+        {
+            _single_precision = false;
+        }
+        else if (precision == "Single")
+        {
+            _single_precision = true;
+        }
+        else
+        {
+            throw std::runtime_error("Unrecognized factor precision "
+                                     + precision
+                                     + ". Choose 'Double' or 'Single'.");
+        }
+    }
+
+    if (_fill_level < 0 || _drop_tolerance < 0.0 || _fill_factor <= 0.0
+        || _num_sweeps < 0)
+    {
+        throw std::runtime_error("Invalid ILU fill or sweep parameters");
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Change matrix
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::setMatrix(Teuchos::RCP<const Tpetra::RowMatrix<>> A)
+{
+    _A = A;
+
+    // The pattern of the factors is kept as long as the sparsity pattern of
+    // the matrix does not change.
+    if (extractMatrix(*_A))
+    {
+        _initialized = false;
+        _pattern_set = false;
+    }
+
+    _matrix_set = true;
+    _computed = false;
+}
+
+//---------------------------------------------------------------------------//
+// Initialize preconditioner
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::initialize()
+{
+    assert(_matrix_set);
+
+    if (_initialized)
+    {
+        return;
+    }
+
+    // The ILUT pattern depends on the values and is set by the first
+    // factorization.
+    if (_fill_type == FillType::Level)
+    {
+        symbolicLevelFactor();
+        buildLevelSets();
+        _pattern_set = true;
+    }
+
+    _initialized = true;
+}
+
+//---------------------------------------------------------------------------//
+// Compute preconditioner
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::compute()
+{
+    assert(_matrix_set);
+
+    if (!_initialized)
+        initialize();
+
+    if (_pattern_set)
+    {
+        numericFactor();
+    }
+    else
+    {
+        thresholdFactor();
+        buildLevelSets();
+        _pattern_set = true;
+    }
+
+    // Round the factors and release the double precision values. They are
+    // recomputed from the matrix by the next factorization.
+    if (_single_precision)
+    {
+        _lu_values_single.assign(_lu_values.begin(), _lu_values.end());
+        std::vector<double>().swap(_lu_values);
+    }
+
+    _computed = true;
+}
+
+//---------------------------------------------------------------------------//
+// Apply preconditioner
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::solve(const Tpetra::MultiVector<>& b,
+                               Tpetra::MultiVector<>& x)
+{
+    assert(_initialized);
+    assert(_computed);
+
+    _y.resize(_num_rows);
+    _z.resize(_num_rows);
+    _w.resize(_num_rows);
+
+    auto b_view = b.getLocalViewHost(Tpetra::Access::ReadOnly);
+    auto x_view = x.getLocalViewHost(Tpetra::Access::OverwriteAll);
+    for (std::size_t v = 0; v < b.getNumVectors(); ++v)
+    {
+        for (int row = 0; row < _num_rows; ++row)
+            _y[row] = b_view(row, v);
+        if (_single_precision)
+            triangularSolve(_lu_values_single);
+        else
+            triangularSolve(_lu_values);
+        for (int row = 0; row < _num_rows; ++row)
+            x_view(row, v) = _z[row];
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Extract matrix data
+//---------------------------------------------------------------------------//
+bool IncompleteLUSolver::extractMatrix(const Tpetra::RowMatrix<>& A)
+{
+    const int num_rows = A.getLocalNumRows();
+    const std::size_t num_entries = A.getLocalNumEntries();
+
+    std::vector<int> rowptr(num_rows + 1);
+    std::vector<int> colind(num_entries);
+    _A_values.resize(num_entries);
+
+    // The factorization indexes its row work arrays by column, so only the
+    // columns of the local rows are kept.
+    rowptr[0] = 0;
+    const auto crs_matrix = underlyingCrsMatrix(A);
+    if (crs_matrix != nullptr)
+    {
+        // Copy the local CRS arrays of the wrapped matrix, dropping the
+        // columns of the ghosted rows as the filter does.
+        const auto local_matrix = crs_matrix->getLocalMatrixHost();
+        const auto& row_map = local_matrix.graph.row_map;
+        const auto& entries = local_matrix.graph.entries;
+        const auto& values = local_matrix.values;
+        int offset = 0;
+        for (int row = 0; row < num_rows; ++row)
+        {
+            for (auto k = row_map(row); k < row_map(row + 1); ++k)
+            {
+                if (entries(k) < num_rows)
+                {
+                    colind[offset] = entries(k);
+                    _A_values[offset] = values(k);
+                    ++offset;
+                }
+            }
+            rowptr[row + 1] = offset;
+        }
+    }
+    else
+    {
+        const std::size_t max_entries = A.getLocalMaxNumRowEntries();
+        Tpetra::RowMatrix<>::nonconst_local_inds_host_view_type row_inds(
+            "row_indices", max_entries);
+        Tpetra::RowMatrix<>::nonconst_values_host_view_type row_vals(
+            "row_values", max_entries);
+        std::size_t row_entries;
+        for (int row = 0; row < num_rows; ++row)
+        {
+            A.getLocalRowCopy(row, row_inds, row_vals, row_entries);
+            int offset = rowptr[row];
+            for (std::size_t k = 0; k < row_entries; ++k)
+            {
+                if (row_inds(k) < num_rows)
+                {
+                    colind[offset] = row_inds(k);
+                    _A_values[offset] = row_vals(k);
+                    ++offset;
+                }
+            }
+            rowptr[row + 1] = offset;
+        }
+    }
+    colind.resize(rowptr[num_rows]);
+    _A_values.resize(rowptr[num_rows]);
+
+    const bool new_pattern = rowptr != _A_rowptr || colind != _A_colind;
+    if (new_pattern)
+    {
+        _num_rows = num_rows;
+        _A_rowptr = std::move(rowptr);
+        _A_colind = std::move(colind);
+    }
+    return new_pattern;
+}
+
+//---------------------------------------------------------------------------//
+// ILU(k) symbolic factorization
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::symbolicLevelFactor()
+{
+    _lu_rowptr.assign(1, 0);
+    _lu_colind.clear();
+    _lu_diag.resize(_num_rows);
+
+    // Levels of the upper triangular entries of each factored row
+    std::vector<int> upper_levels;
+
+    for (int i = 0; i < _num_rows; ++i)
+    {
+        // Level of each column of the row, starting with the matrix pattern
+        // and the diagonal.
+        std::map<int, int> row;
+        for (int p = _A_rowptr[i]; p < _A_rowptr[i + 1]; ++p)
+            row.emplace(_A_colind[p], 0);
+        row.emplace(i, 0);
+
+        // Fill from the previous rows. New entries are inserted to the
+        // right of the current column and visited later in the loop.
+        for (auto it = row.begin(); it != row.end() && it->first < i; ++it)
+        {
+            const int k = it->first;
+            const int level_ik = it->second;
+            for (int q = _lu_diag[k] + 1; q < _lu_rowptr[k + 1]; ++q)
+            {
+                const int level = level_ik + upper_levels[q] + 1;
+                if (level > _fill_level)
+                    continue;
+                auto entry = row.emplace(_lu_colind[q], level);
+                if (!entry.second)
+                    entry.first->second = std::min(entry.first->second, level);
+            }
+        }
+
+        for (const auto& entry : row)
+        {
+            if (entry.first == i)
+                _lu_diag[i] = _lu_colind.size();
+            _lu_colind.push_back(entry.first);
+            upper_levels.push_back(entry.second);
+        }
+        _lu_rowptr.push_back(_lu_colind.size());
+    }
+
+    _lu_values.resize(_lu_colind.size());
+}
+
+//---------------------------------------------------------------------------//
+// ILUT factorization
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::thresholdFactor()
+{
+    _lu_rowptr.assign(1, 0);
+    _lu_colind.clear();
+    _lu_values.clear();
+    _lu_diag.resize(_num_rows);
+
+    // Dense work row and its nonzero columns
+    std::vector<double> w(_num_rows, 0.0);
+    std::vector<char> in_row(_num_rows, 0);
+    std::vector<int> nonzeros;
+    std::set<int> lower;
+
+    std::vector<std::pair<double, int>> lower_entries;
+    std::vector<std::pair<double, int>> upper_entries;
+
+    for (int i = 0; i < _num_rows; ++i)
+    {
+        // Scatter the matrix row
+        double norm = 0.0;
+        int num_lower = 0;
+        int num_upper = 0;
+        for (int p = _A_rowptr[i]; p < _A_rowptr[i + 1]; ++p)
+        {
+            const int j = _A_colind[p];
+            if (!in_row[j])
+            {
+                in_row[j] = 1;
+                nonzeros.push_back(j);
+            }
+            w[j] += _A_values[p];
+            norm += _A_values[p] * _A_values[p];
+            if (j < i)
+            {
+                lower.insert(j);
+                ++num_lower;
+            }
+            else if (j > i)
+            {
+                ++num_upper;
+            }
+        }
+        if (!in_row[i])
+        {
+            in_row[i] = 1;
+            nonzeros.push_back(i);
+        }
+        const double tolerance = _drop_tolerance * std::sqrt(norm);
+
+        // Eliminate with the previous rows in increasing column order
+        while (!lower.empty())
+        {
+            const int k = *lower.begin();
+            lower.erase(lower.begin());
+
+            w[k] /= _lu_values[_lu_diag[k]];
+            if (std::abs(w[k]) < tolerance)
+            {
+                w[k] = 0.0;
+                continue;
+            }
+            for (int q = _lu_diag[k] + 1; q < _lu_rowptr[k + 1]; ++q)
+            {
+                const int j = _lu_colind[q];
+                if (!in_row[j])
+                {
+                    in_row[j] = 1;
+                    nonzeros.push_back(j);
+                    if (j < i)
+                        lower.insert(j);
+                }
+                w[j] -= w[k] * _lu_values[q];
+            }
+        }
+
+        // Keep the largest entries above the tolerance in each part
+        lower_entries.clear();
+        upper_entries.clear();
+        for (const int j : nonzeros)
+        {
+            if (j != i && std::abs(w[j]) >= tolerance && w[j] != 0.0)
+            {
+                if (j < i)
+                    lower_entries.emplace_back(std::abs(w[j]), j);
+                else
+                    upper_entries.emplace_back(std::abs(w[j]), j);
+            }
+        }
+        const auto keep_largest = [](std::vector<std::pair<double, int>>& v,
+                                     const std::size_t max_size) {
+            if (v.size() > max_size)
+            {
+                std::nth_element(v.begin(),
+                                 v.begin() + max_size,
+                                 v.end(),
+                                 std::greater<std::pair<double, int>>());
+                v.resize(max_size);
+            }
+            std::sort(v.begin(),
+                      v.end(),
+                      [](const auto& a, const auto& b) {
+                          return a.second < b.second;
+                      });
+        };
+        keep_largest(lower_entries,
+                     static_cast<std::size_t>(
+                         std::ceil(_fill_factor * num_lower)));
+        keep_largest(upper_entries,
+                     static_cast<std::size_t>(
+                         std::ceil(_fill_factor * num_upper)));
+
+        // Store the row
+        for (const auto& entry : lower_entries)
+        {
+            _lu_colind.push_back(entry.second);
+            _lu_values.push_back(w[entry.second]);
+        }
+        checkPivot(i, w[i]);
+        _lu_diag[i] = _lu_colind.size();
+        _lu_colind.push_back(i);
+        _lu_values.push_back(w[i]);
+        for (const auto& entry : upper_entries)
+        {
+            _lu_colind.push_back(entry.second);
+            _lu_values.push_back(w[entry.second]);
+        }
+        _lu_rowptr.push_back(_lu_colind.size());
+
+        // Reset the work row
+        for (const int j : nonzeros)
+        {
+            w[j] = 0.0;
+            in_row[j] = 0;
+        }
+        nonzeros.clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Numeric factorization on the existing pattern
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::numericFactor()
+{
+    _lu_values.resize(_lu_colind.size());
+
+    // Position of each column in the current row, or -1
+    std::vector<int> position(_num_rows, -1);
+
+    for (int i = 0; i < _num_rows; ++i)
+    {
+        for (int p = _lu_rowptr[i]; p < _lu_rowptr[i + 1]; ++p)
+        {
+            position[_lu_colind[p]] = p;
+            _lu_values[p] = 0.0;
+        }
+
+        // Matrix entries outside the pattern of the factors are dropped
+        for (int p = _A_rowptr[i]; p < _A_rowptr[i + 1]; ++p)
+        {
+            const int pos = position[_A_colind[p]];
+            if (pos >= 0)
+                _lu_values[pos] += _A_values[p];
+        }
+
+        // IKJ elimination restricted to the pattern
+        for (int p = _lu_rowptr[i]; p < _lu_diag[i]; ++p)
+        {
+            const int k = _lu_colind[p];
+            _lu_values[p] /= _lu_values[_lu_diag[k]];
+            for (int q = _lu_diag[k] + 1; q < _lu_rowptr[k + 1]; ++q)
+            {
+                const int pos = position[_lu_colind[q]];
+                if (pos >= 0)
+                    _lu_values[pos] -= _lu_values[p] * _lu_values[q];
+            }
+        }
+        checkPivot(i, _lu_values[_lu_diag[i]]);
+
+        for (int p = _lu_rowptr[i]; p < _lu_rowptr[i + 1]; ++p)
+            position[_lu_colind[p]] = -1;
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Level sets of the triangular solves
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::buildLevelSets()
+{
+    // A row can be solved once all rows it depends on are solved.
+    std::vector<int> level(_num_rows, 0);
+    for (int i = 0; i < _num_rows; ++i)
+    {
+        for (int p = _lu_rowptr[i]; p < _lu_diag[i]; ++p)
+            level[i] = std::max(level[i], level[_lu_colind[p]] + 1);
+    }
+    groupLevels(level, _lower_level_ptr, _lower_level_rows);
+
+    level.assign(_num_rows, 0);
+    for (int i = _num_rows - 1; i >= 0; --i)
+    {
+        for (int p = _lu_diag[i] + 1; p < _lu_rowptr[i + 1]; ++p)
+            level[i] = std::max(level[i], level[_lu_colind[p]] + 1);
+    }
+    groupLevels(level, _upper_level_ptr, _upper_level_rows);
+}
+
+//---------------------------------------------------------------------------//
+// Triangular solves
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void IncompleteLUSolver::triangularSolve(const std::vector<Scalar>& lu_values)
+{
+    const int* rowptr = _lu_rowptr.data();
+    const int* colind = _lu_colind.data();
+    const int* diag = _lu_diag.data();
+    const Scalar* values = lu_values.data();
+    double* y = _y.data();
+    double* z = _z.data();
+
+    if (_triangular_solve == TriangularSolve::LevelScheduled)
+    {
+        // Forward substitution with unit diagonal L, in place
+        const int* rows = _lower_level_rows.data();
+        for (std::size_t l = 0; l + 1 < _lower_level_ptr.size(); ++l)
+        {
+            parallelRows(
+                _lower_level_ptr[l], _lower_level_ptr[l + 1], [=](const int n) {
+                    const int i = rows[n];
+                    double sum = y[i];
+                    for (int p = rowptr[i]; p < diag[i]; ++p)
+                        sum -= values[p] * y[colind[p]];
+                    y[i] = sum;
+                });
+        }
+
+        // Backward substitution with U
+        rows = _upper_level_rows.data();
+        for (std::size_t l = 0; l + 1 < _upper_level_ptr.size(); ++l)
+        {
+            parallelRows(
+                _upper_level_ptr[l], _upper_level_ptr[l + 1], [=](const int n) {
+                    const int i = rows[n];
+                    double sum = y[i];
+                    for (int p = diag[i] + 1; p < rowptr[i + 1]; ++p)
+                        sum -= values[p] * z[colind[p]];
+                    z[i] = sum / values[diag[i]];
+                });
+        }
+    }
+    else
+    {
+        // Jacobi sweeps for L, starting from y and ending in w
+        double* current = _w.data();
+        double* next = z;
+        std::copy(_y.begin(), _y.end(), current);
+        for (int s = 0; s < _num_sweeps; ++s)
+        {
+            parallelRows(0, _num_rows, [=](const int i) {
+                double sum = y[i];
+                for (int p = rowptr[i]; p < diag[i]; ++p)
+                    sum -= values[p] * current[colind[p]];
+                next[i] = sum;
+            });
+            std::swap(current, next);
+        }
+        if (current != _w.data())
+            std::copy(_z.begin(), _z.end(), _w.begin());
+
+        // Jacobi sweeps for U, starting from the diagonal solve and ending
+        // in z. The right hand side w is preserved and y is used as work
+        // space.
+        const double* w = _w.data();
+        current = z;
+        next = y;
+        parallelRows(0, _num_rows, [=](const int i) {
+            current[i] = w[i] / values[diag[i]];
+        });
+        for (int s = 0; s < _num_sweeps; ++s)
+        {
+            parallelRows(0, _num_rows, [=](const int i) {
+                double sum = w[i];
+                for (int p = diag[i] + 1; p < rowptr[i + 1]; ++p)
+                    sum -= values[p] * current[colind[p]];
+                next[i] = sum / values[diag[i]];
+            });
+            std::swap(current, next);
+        }
+        if (current != z)
+            std::copy(_y.begin(), _y.end(), _z.begin());
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Check pivot
+//---------------------------------------------------------------------------//
+void IncompleteLUSolver::checkPivot(const int row, const double pivot) const
+{
+    if (pivot == 0.0 || !std::isfinite(pivot))
+    {
+        std::stringstream ss;
+        ss << "Incomplete LU factorization failed with pivot " << pivot
+           << " in local row " << row;
+        throw std::runtime_error(ss.str());
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
@@ -0,0 +1,153 @@
+#ifndef VERTEXCFD_LINEARSOLVERS_INCOMPLETELU_HPP
+#define VERTEXCFD_LINEARSOLVERS_INCOMPLETELU_HPP
+
+#include "VertexCFD_LinearSolvers_LocalDirectSolver.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Tpetra_RowMatrix.hpp>
+
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+// Local preconditioner using an incomplete LU factorization on the host.
+//
+// Two fill strategies are available:
+//  - "Level": ILU(k), where the fill pattern is determined symbolically from
+//    the levels of fill in initialize() and only depends on the sparsity
+//    pattern of the matrix.
+//  - "Threshold": ILUT(p,tau), where entries smaller than the drop tolerance
+//    relative to the norm of the row are dropped and at most "Fill Factor"
+//    times the number of entries of the matrix row are kept in each of the L
+//    and U parts of the row. The pattern is determined by the first
+//    factorization.
+// Once the pattern of the factors is known, later calls to compute() redo
+// only the numeric factorization on that pattern.
+//
+// The triangular solves are either level scheduled, where the rows within a
+// level are solved in parallel on the host threads, or performed with a fixed
+// number of Jacobi sweeps, which approximates the exact triangular solves
+// with fully parallel sweeps.
+//
+// With "Factor Precision" set to "Single" the factors are rounded to single
+// precision after each compute() and only the single precision copy is
+// kept, which halves the memory used by the factors and the memory traffic
+// of the triangular solves. The solves still accumulate in double precision.
+//---------------------------------------------------------------------------//
+class IncompleteLUSolver : public LocalDirectSolver
+{
+  private:
+    enum class FillType
+    {
+        Level,
+        Threshold
+    };
+
+    enum class TriangularSolve
+    {
+        LevelScheduled,
+        Jacobi
+    };
+
+    // >>> DATA
+
+    // Matrix
+    Teuchos::RCP<const Tpetra::RowMatrix<>> _A;
+
+    // Host-side matrix data
+    std::vector<int> _A_rowptr;
+    std::vector<int> _A_colind;
+    std::vector<double> _A_values;
+
+    // Factorization parameters
+    FillType _fill_type;
+    int _fill_level;
+    double _drop_tolerance;
+    double _fill_factor;
+
+    // Triangular solve parameters
+    TriangularSolve _triangular_solve;
+    int _num_sweeps;
+
+    // Store the factors in single precision
+    bool _single_precision;
+
+    // Factors stored as L + U - I with sorted column indices in each row and
+    // the position of the diagonal entry of each row
+    std::vector<int> _lu_rowptr;
+    std::vector<int> _lu_colind;
+    std::vector<int> _lu_diag;
+    std::vector<double> _lu_values;
+    std::vector<float> _lu_values_single;
+
+    // Rows of each level of the lower and upper triangular solves
+    std::vector<int> _lower_level_ptr;
+    std::vector<int> _lower_level_rows;
+    std::vector<int> _upper_level_ptr;
+    std::vector<int> _upper_level_rows;
+
+    // Solve work space
+    std::vector<double> _y;
+    std::vector<double> _z;
+    std::vector<double> _w;
+
+    // Status flags
+    bool _matrix_set;
+    bool _initialized;
+    bool _computed;
+    bool _pattern_set;
+
+    int _num_rows;
+
+  public:
+    // Constructor
+    IncompleteLUSolver(const Teuchos::ParameterList& params);
+
+    // Update internal matrix
+    void setMatrix(Teuchos::RCP<const Tpetra::RowMatrix<>> A) override;
+
+    // Inherited interface from LocalDirectSolver
+    void initialize() override;
+    void compute() override;
+
+    // Inherited interface from LocalDirectSolver
+    void
+    solve(const Tpetra::MultiVector<>& b, Tpetra::MultiVector<>& x) override;
+
+  private:
+    // Extract the CRS data of A. Returns true if the sparsity pattern
+    // differs from the one currently stored.
+    bool extractMatrix(const Tpetra::RowMatrix<>& A);
+
+    // Build the ILU(k) pattern of the factors.
+    void symbolicLevelFactor();
+
+    // Compute the ILUT factors and their pattern.
+    void thresholdFactor();
+
+    // Compute the factors on the existing pattern.
+    void numericFactor();
+
+    // Build the level sets of the triangular solves.
+    void buildLevelSets();
+
+    // Solve L U _z = _y for a single vector with the given factor values.
+    // The contents of _y are overwritten.
+    template<class Scalar>
+    void triangularSolve(const std::vector<Scalar>& lu_values);
+
+    // Throw if a pivot is zero.
+    void checkPivot(const int row, const double pivot) const;
+};
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
+
+#endif // VERTEXCFD_LINEARSOLVERS_INCOMPLETELU_HPP
@@ -0,0 +1,148 @@
+#include "VertexCFD_LinearSolvers_JacobianFreeLOWSFactory.hpp"
+#include "VertexCFD_LinearSolvers_JacobianFreeOperator.hpp"
+
+#include <Thyra_DefaultLinearOpSource.hpp>
+
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+JacobianFreeLOWSFactory::JacobianFreeLOWSFactory(
+    const Teuchos::RCP<const Thyra::LinearOpWithSolveFactoryBase<double>>&
+        lows_factory)
+    : _lows_factory(lows_factory)
+    , _prec_version(-1)
+{
+    if (Teuchos::is_null(_lows_factory))
+    {
+        throw std::runtime_error(
+            "Jacobian-free Newton-Krylov requires a linear solver factory");
+    }
+    _prec_factory = _lows_factory->getPreconditionerFactory();
+}
+
+//---------------------------------------------------------------------------//
+bool JacobianFreeLOWSFactory::isCompatible(
+    const Thyra::LinearOpSourceBase<double>& fwd_op_src) const
+{
+    if (Teuchos::nonnull(Teuchos::rcp_dynamic_cast<const JacobianFreeOperator>(
+            fwd_op_src.getOp())))
+    {
+        return true;
+    }
+    return _lows_factory->isCompatible(fwd_op_src);
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<Thyra::LinearOpWithSolveBase<double>>
+JacobianFreeLOWSFactory::createOp() const
+{
+    return _lows_factory->createOp();
+}
+
+//---------------------------------------------------------------------------//
+void JacobianFreeLOWSFactory::initializeOp(
+    const Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>& fwd_op_src,
+    Thyra::LinearOpWithSolveBase<double>* op,
+    const Thyra::ESupportSolveUse support_solve_use) const
+{
+    auto jfnk_op = Teuchos::rcp_dynamic_cast<const JacobianFreeOperator>(
+        fwd_op_src->getOp());
+    if (Teuchos::is_null(jfnk_op) || Teuchos::is_null(_prec_factory))
+    {
+        _lows_factory->initializeOp(fwd_op_src, op, support_solve_use);
+        return;
+    }
+
+    // Only recompute the preconditioner when the assembled Jacobian changed.
+    const auto prec_op = jfnk_op->preconditionerOp();
+    if (Teuchos::is_null(_prec))
+        _prec = _prec_factory->createPrec();
+    if (prec_op != _prec_fwd_op
+        || jfnk_op->preconditionerVersion() != _prec_version)
+    {
+        _prec_factory->initializePrec(Thyra::defaultLinearOpSource(prec_op),
+                                      _prec.get(),
+                                      support_solve_use);
+        _prec_fwd_op = prec_op;
+        _prec_version = jfnk_op->preconditionerVersion();
+    }
+
+    _lows_factory->initializePreconditionedOp(
+        fwd_op_src, _prec, op, support_solve_use);
+}
+
+//---------------------------------------------------------------------------//
+void JacobianFreeLOWSFactory::uninitializeOp(
+    Thyra::LinearOpWithSolveBase<double>* op,
+    Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>* fwd_op_src,
+    Teuchos::RCP<const Thyra::PreconditionerBase<double>>* prec,
+    Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>* approx_fwd_op_src,
+    Thyra::ESupportSolveUse* support_solve_use) const
+{
+    _lows_factory->uninitializeOp(
+        op, fwd_op_src, prec, approx_fwd_op_src, support_solve_use);
+}
+
+//---------------------------------------------------------------------------//
+bool JacobianFreeLOWSFactory::supportsPreconditionerInputType(
+    const Thyra::EPreconditionerInputType prec_op_type) const
+{
+    return _lows_factory->supportsPreconditionerInputType(prec_op_type);
+}
+
+//---------------------------------------------------------------------------//
+void JacobianFreeLOWSFactory::initializePreconditionedOp(
+    const Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>& fwd_op_src,
+    const Teuchos::RCP<const Thyra::PreconditionerBase<double>>& prec,
+    Thyra::LinearOpWithSolveBase<double>* op,
+    const Thyra::ESupportSolveUse support_solve_use) const
+{
+    _lows_factory->initializePreconditionedOp(
+        fwd_op_src, prec, op, support_solve_use);
+}
+
+//---------------------------------------------------------------------------//
+void JacobianFreeLOWSFactory::setParameterList(
+    const Teuchos::RCP<Teuchos::ParameterList>& params)
+{
+    _params = params;
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<Teuchos::ParameterList>
+JacobianFreeLOWSFactory::getNonconstParameterList()
+{
+    return _params;
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<Teuchos::ParameterList>
+JacobianFreeLOWSFactory::unsetParameterList()
+{
+    auto params = _params;
+    _params = Teuchos::null;
+    return params;
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<const Teuchos::ParameterList>
+JacobianFreeLOWSFactory::getParameterList() const
+{
+    return _params;
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<const Teuchos::ParameterList>
+JacobianFreeLOWSFactory::getValidParameters() const
+{
+    return _lows_factory->getValidParameters();
+}
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
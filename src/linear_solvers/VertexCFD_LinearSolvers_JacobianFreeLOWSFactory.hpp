@@ -0,0 +1,94 @@
+#ifndef VERTEXCFD_LINEARSOLVERS_JACOBIANFREELOWSFACTORY_HPP
+#define VERTEXCFD_LINEARSOLVERS_JACOBIANFREELOWSFACTORY_HPP
+
+#include <Thyra_LinearOpWithSolveFactoryBase.hpp>
+#include <Thyra_PreconditionerBase.hpp>
+#include <Thyra_PreconditionerFactoryBase.hpp>
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+// Linear solver factory for Jacobian-free Newton-Krylov. Wraps the Krylov
+// solver factory built from the linear solver parameters.
+//
+// For a JacobianFreeOperator the preconditioner of the underlying factory is
+// built from the assembled Jacobian held by the operator instead of the
+// operator itself, and is only recomputed when that Jacobian was updated.
+// The preconditioner factory is not exposed to the nonlinear solver so that
+// it does not try to build the preconditioner from the matrix-free operator.
+// Other operators are passed through to the underlying factory.
+//---------------------------------------------------------------------------//
+class JacobianFreeLOWSFactory
+    : public Thyra::LinearOpWithSolveFactoryBase<double>
+{
+  public:
+    JacobianFreeLOWSFactory(
+        const Teuchos::RCP<const Thyra::LinearOpWithSolveFactoryBase<double>>&
+            lows_factory);
+
+    // Thyra::LinearOpWithSolveFactoryBase interface.
+    bool isCompatible(
+        const Thyra::LinearOpSourceBase<double>& fwd_op_src) const override;
+
+    Teuchos::RCP<Thyra::LinearOpWithSolveBase<double>>
+    createOp() const override;
+
+    void initializeOp(
+        const Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>& fwd_op_src,
+        Thyra::LinearOpWithSolveBase<double>* op,
+        const Thyra::ESupportSolveUse support_solve_use
+        = Thyra::SUPPORT_SOLVE_UNSPECIFIED) const override;
+
+    void uninitializeOp(
+        Thyra::LinearOpWithSolveBase<double>* op,
+        Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>* fwd_op_src
+        = nullptr,
+        Teuchos::RCP<const Thyra::PreconditionerBase<double>>* prec = nullptr,
+        Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>* approx_fwd_op_src
+        = nullptr,
+        Thyra::ESupportSolveUse* support_solve_use = nullptr) const override;
+
+    bool supportsPreconditionerInputType(
+        const Thyra::EPreconditionerInputType prec_op_type) const override;
+
+    void initializePreconditionedOp(
+        const Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>& fwd_op_src,
+        const Teuchos::RCP<const Thyra::PreconditionerBase<double>>& prec,
+        Thyra::LinearOpWithSolveBase<double>* op,
+        const Thyra::ESupportSolveUse support_solve_use
+        = Thyra::SUPPORT_SOLVE_UNSPECIFIED) const override;
+
+    // Teuchos::ParameterListAcceptor interface.
+    void setParameterList(
+        const Teuchos::RCP<Teuchos::ParameterList>& params) override;
+    Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList() override;
+    Teuchos::RCP<Teuchos::ParameterList> unsetParameterList() override;
+    Teuchos::RCP<const Teuchos::ParameterList>
+    getParameterList() const override;
+    Teuchos::RCP<const Teuchos::ParameterList>
+    getValidParameters() const override;
+
+  private:
+    Teuchos::RCP<const Thyra::LinearOpWithSolveFactoryBase<double>>
+        _lows_factory;
+    Teuchos::RCP<Thyra::PreconditionerFactoryBase<double>> _prec_factory;
+    Teuchos::RCP<Teuchos::ParameterList> _params;
+
+    // Preconditioner built from the assembled Jacobian and the version of
+    // the Jacobian it was computed with.
+    mutable Teuchos::RCP<Thyra::PreconditionerBase<double>> _prec;
+    mutable Teuchos::RCP<const Thyra::LinearOpBase<double>> _prec_fwd_op;
+    mutable int _prec_version;
+};
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
+
+#endif // VERTEXCFD_LINEARSOLVERS_JACOBIANFREELOWSFACTORY_HPP
@@ -0,0 +1,103 @@
+#include "VertexCFD_LinearSolvers_JacobianFreeModelEvaluator.hpp"
+#include "VertexCFD_LinearSolvers_JacobianFreeLOWSFactory.hpp"
+#include "VertexCFD_LinearSolvers_JacobianFreeOperator.hpp"
+
+#include <Thyra_VectorBase.hpp>
+#include <Thyra_VectorSpaceBase.hpp>
+
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+JacobianFreeModelEvaluator::JacobianFreeModelEvaluator(
+    const Teuchos::RCP<Thyra::ModelEvaluator<double>>& model,
+    const Teuchos::ParameterList& params)
+    : Thyra::ModelEvaluatorDelegatorBase<double>(model)
+    , _perturbation(1.0e-6)
+    , _preconditioner_lag(1)
+    , _num_w_evals(0)
+{
+    if (params.isType<double>("Perturbation"))
+        _perturbation = params.get<double>("Perturbation");
+
+    if (params.isType<int>("Preconditioner Lag"))
+        _preconditioner_lag = params.get<int>("Preconditioner Lag");
+
+    if (_preconditioner_lag < 1)
+    {
+        throw std::runtime_error(
+            "Jacobian-free Newton-Krylov preconditioner lag must be at "
+            "least 1");
+    }
+
+    const auto lows_factory = model->get_W_factory();
+    _lows_factory = Teuchos::rcp(new JacobianFreeLOWSFactory(lows_factory));
+    _use_preconditioner
+        = Teuchos::nonnull(lows_factory->getPreconditionerFactory());
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<Thyra::LinearOpBase<double>>
+JacobianFreeModelEvaluator::create_W_op() const
+{
+    const auto model = getUnderlyingModel();
+    return Teuchos::rcp(
+        new JacobianFreeOperator(model, model->create_W_op(), _perturbation));
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<const Thyra::LinearOpWithSolveFactoryBase<double>>
+JacobianFreeModelEvaluator::get_W_factory() const
+{
+    return _lows_factory;
+}
+
+//---------------------------------------------------------------------------//
+void JacobianFreeModelEvaluator::evalModelImpl(
+    const Thyra::ModelEvaluatorBase::InArgs<double>& in_args,
+    const Thyra::ModelEvaluatorBase::OutArgs<double>& out_args) const
+{
+    const auto model = getUnderlyingModel();
+
+    auto jfnk_op = Teuchos::rcp_dynamic_cast<JacobianFreeOperator>(
+        out_args.supports(Thyra::ModelEvaluatorBase::OUT_ARG_W_op)
+            ? out_args.get_W_op()
+            : Teuchos::null);
+    if (Teuchos::is_null(jfnk_op))
+    {
+        model->evalModel(in_args, out_args);
+        return;
+    }
+
+    // The residual at the base point is needed for the finite differences.
+    auto model_out_args = model->createOutArgs();
+    model_out_args.setArgs(out_args, true);
+    auto f = out_args.get_f();
+    if (Teuchos::is_null(f))
+    {
+        f = Thyra::createMember(model->get_f_space());
+        model_out_args.set_f(f);
+    }
+
+    // Assemble the Jacobian for the preconditioner only every lag-th
+    // evaluation of W.
+    const bool assemble = _use_preconditioner
+                          && (_num_w_evals % _preconditioner_lag == 0);
+    ++_num_w_evals;
+    model_out_args.set_W_op(assemble ? jfnk_op->preconditionerOp()
+                                     : Teuchos::null);
+
+    model->evalModel(in_args, model_out_args);
+
+    if (assemble)
+        jfnk_op->preconditionerOpUpdated();
+    jfnk_op->setBase(in_args, *f);
+}
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
@@ -0,0 +1,60 @@
+#ifndef VERTEXCFD_LINEARSOLVERS_JACOBIANFREEMODELEVALUATOR_HPP
+#define VERTEXCFD_LINEARSOLVERS_JACOBIANFREEMODELEVALUATOR_HPP
+
+#include <Thyra_LinearOpWithSolveFactoryBase.hpp>
+#include <Thyra_ModelEvaluatorDelegatorBase.hpp>
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+// Model evaluator decorator for Jacobian-free Newton-Krylov.
+//
+// The Newton operator W is a JacobianFreeOperator applied with finite
+// differences of the residual. The Jacobian of the underlying model is only
+// assembled to build the preconditioner, once every "Preconditioner Lag"
+// evaluations of W. When the linear solver has no preconditioner the
+// Jacobian is never assembled.
+//
+// Parameters:
+//  - "Perturbation": relative finite difference perturbation (default 1e-6).
+//  - "Preconditioner Lag": number of evaluations of W between two assemblies
+//    of the Jacobian (default 1).
+//---------------------------------------------------------------------------//
+class JacobianFreeModelEvaluator
+    : public Thyra::ModelEvaluatorDelegatorBase<double>
+{
+  public:
+    JacobianFreeModelEvaluator(
+        const Teuchos::RCP<Thyra::ModelEvaluator<double>>& model,
+        const Teuchos::ParameterList& params);
+
+    // Thyra::ModelEvaluator interface.
+    Teuchos::RCP<Thyra::LinearOpBase<double>> create_W_op() const override;
+    Teuchos::RCP<const Thyra::LinearOpWithSolveFactoryBase<double>>
+    get_W_factory() const override;
+
+  private:
+    void evalModelImpl(
+        const Thyra::ModelEvaluatorBase::InArgs<double>& in_args,
+        const Thyra::ModelEvaluatorBase::OutArgs<double>& out_args) const override;
+
+  private:
+    double _perturbation;
+    int _preconditioner_lag;
+    Teuchos::RCP<const Thyra::LinearOpWithSolveFactoryBase<double>>
+        _lows_factory;
+    bool _use_preconditioner;
+    mutable int _num_w_evals;
+};
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
+
+#endif // VERTEXCFD_LINEARSOLVERS_JACOBIANFREEMODELEVALUATOR_HPP
@@ -0,0 +1,145 @@
+#include "VertexCFD_LinearSolvers_JacobianFreeOperator.hpp"
+
+#include <Thyra_MultiVectorBase.hpp>
+#include <Thyra_VectorStdOps.hpp>
+
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+JacobianFreeOperator::JacobianFreeOperator(
+    const Teuchos::RCP<const Thyra::ModelEvaluator<double>>& model,
+    const Teuchos::RCP<Thyra::LinearOpBase<double>>& preconditioner_op,
+    const double perturbation)
+    : _model(model)
+    , _preconditioner_op(preconditioner_op)
+    , _perturbation(perturbation)
+    , _preconditioner_version(0)
+    , _x_norm(0.0)
+    , _alpha(0.0)
+    , _beta(1.0)
+{
+    if (_perturbation <= 0.0)
+    {
+        throw std::runtime_error(
+            "Jacobian-free Newton-Krylov perturbation must be positive");
+    }
+}
+
+//---------------------------------------------------------------------------//
+void JacobianFreeOperator::setBase(
+    const Thyra::ModelEvaluatorBase::InArgs<double>& in_args,
+    const Thyra::VectorBase<double>& f)
+{
+    // Copy the state since the solver may reuse the input vectors.
+    _in_args = _model->createInArgs();
+    _in_args.setArgs(in_args, true);
+
+    _x = in_args.get_x()->clone_v();
+    _in_args.set_x(_x);
+    _x_norm = Thyra::norm_2(*_x);
+
+    _x_dot = Teuchos::null;
+    if (_in_args.supports(Thyra::ModelEvaluatorBase::IN_ARG_x_dot)
+        && Teuchos::nonnull(in_args.get_x_dot()))
+    {
+        _x_dot = in_args.get_x_dot()->clone_v();
+        _in_args.set_x_dot(_x_dot);
+    }
+
+    _alpha = _in_args.supports(Thyra::ModelEvaluatorBase::IN_ARG_alpha)
+                 ? in_args.get_alpha()
+                 : 0.0;
+    _beta = _in_args.supports(Thyra::ModelEvaluatorBase::IN_ARG_beta)
+                ? in_args.get_beta()
+                : 1.0;
+
+    _f = f.clone_v();
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<const Thyra::VectorSpaceBase<double>>
+JacobianFreeOperator::range() const
+{
+    return _model->get_f_space();
+}
+
+//---------------------------------------------------------------------------//
+Teuchos::RCP<const Thyra::VectorSpaceBase<double>>
+JacobianFreeOperator::domain() const
+{
+    return _model->get_x_space();
+}
+
+//---------------------------------------------------------------------------//
+bool JacobianFreeOperator::opSupportedImpl(Thyra::EOpTransp M_trans) const
+{
+    return M_trans == Thyra::NOTRANS;
+}
+
+//---------------------------------------------------------------------------//
+void JacobianFreeOperator::applyImpl(
+    const Thyra::EOpTransp M_trans,
+    const Thyra::MultiVectorBase<double>& X,
+    const Teuchos::Ptr<Thyra::MultiVectorBase<double>>& Y,
+    const double alpha,
+    const double beta) const
+{
+    if (M_trans != Thyra::NOTRANS)
+    {
+        throw std::logic_error(
+            "Jacobian-free operator does not support apply with transpose");
+    }
+    if (Teuchos::is_null(_f))
+    {
+        throw std::logic_error(
+            "Jacobian-free operator applied before its base was set");
+    }
+
+    auto in_args = _model->createInArgs();
+    in_args.setArgs(_in_args);
+    auto x = _x->clone_v();
+    in_args.set_x(x);
+    Teuchos::RCP<Thyra::VectorBase<double>> x_dot;
+    if (Teuchos::nonnull(_x_dot))
+    {
+        x_dot = _x_dot->clone_v();
+        in_args.set_x_dot(x_dot);
+    }
+
+    auto f = _f->clone_v();
+    auto out_args = _model->createOutArgs();
+    out_args.set_f(f);
+
+    for (Thyra::Ordinal j = 0; j < X.domain()->dim(); ++j)
+    {
+        const auto v = X.col(j);
+        const auto y = Y->col(j);
+        Thyra::Vt_S(y.ptr(), beta);
+
+        const double v_norm = Thyra::norm_2(*v);
+        if (v_norm == 0.0)
+            continue;
+
+        // Perturb the state along v
+        const double h
+            = _perturbation * (_perturbation + _x_norm / v_norm);
+        Thyra::V_VpStV(x.ptr(), *_x, h * _beta, *v);
+        if (Teuchos::nonnull(x_dot))
+            Thyra::V_VpStV(x_dot.ptr(), *_x_dot, h * _alpha, *v);
+
+        _model->evalModel(in_args, out_args);
+
+        // y = alpha * (f - f_0) / h + beta * y
+        Thyra::Vp_StV(f.ptr(), -1.0, *_f);
+        Thyra::Vp_StV(y.ptr(), alpha / h, *f);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
@@ -0,0 +1,93 @@
+#ifndef VERTEXCFD_LINEARSOLVERS_JACOBIANFREEOPERATOR_HPP
+#define VERTEXCFD_LINEARSOLVERS_JACOBIANFREEOPERATOR_HPP
+
+#include <Thyra_LinearOpDefaultBase.hpp>
+#include <Thyra_ModelEvaluator.hpp>
+#include <Thyra_VectorBase.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+// Matrix-free Newton operator W = alpha * df/dx_dot + beta * df/dx of a
+// model evaluator. The action of W on a vector v is approximated with a
+// forward difference of the residual
+//
+//   W v = (f(x_dot + h alpha v, x + h beta v) - f(x_dot, x)) / h
+//
+// with h = lambda * (lambda + ||x|| / ||v||) for the perturbation lambda.
+//
+// Each product is a full residual evaluation of the model at the perturbed
+// state, including the evaluators with side effects. In particular, when the
+// local time step size is recorded with LocalTimeStepMinimum, every product
+// also records it. The Newton solve evaluates the residual at the updated
+// state after each linear solve, so the minimum left in the monitor at the
+// end of the solve is the one of the converged state.
+//
+// The operator also holds an assembled Jacobian of the model that is only
+// used to build the preconditioner. Its version is incremented each time it
+// is reassembled so that the preconditioner is only rebuilt when needed.
+//---------------------------------------------------------------------------//
+class JacobianFreeOperator : public Thyra::LinearOpDefaultBase<double>
+{
+  public:
+    JacobianFreeOperator(
+        const Teuchos::RCP<const Thyra::ModelEvaluator<double>>& model,
+        const Teuchos::RCP<Thyra::LinearOpBase<double>>& preconditioner_op,
+        const double perturbation);
+
+    // Set the point at which the operator is applied and the residual at
+    // that point.
+    void setBase(const Thyra::ModelEvaluatorBase::InArgs<double>& in_args,
+                 const Thyra::VectorBase<double>& f);
+
+    // Assembled Jacobian used for preconditioning.
+    Teuchos::RCP<Thyra::LinearOpBase<double>> preconditionerOp() const
+    {
+        return _preconditioner_op;
+    }
+
+    // Mark the assembled Jacobian as updated.
+    void preconditionerOpUpdated() { ++_preconditioner_version; }
+
+    // Number of times the assembled Jacobian was updated.
+    int preconditionerVersion() const { return _preconditioner_version; }
+
+    // Thyra::LinearOpBase interface.
+    Teuchos::RCP<const Thyra::VectorSpaceBase<double>> range() const override;
+    Teuchos::RCP<const Thyra::VectorSpaceBase<double>> domain() const override;
+
+  protected:
+    bool opSupportedImpl(Thyra::EOpTransp M_trans) const override;
+
+    void applyImpl(const Thyra::EOpTransp M_trans,
+                   const Thyra::MultiVectorBase<double>& X,
+                   const Teuchos::Ptr<Thyra::MultiVectorBase<double>>& Y,
+                   const double alpha,
+                   const double beta) const override;
+
+  private:
+    Teuchos::RCP<const Thyra::ModelEvaluator<double>> _model;
+    Teuchos::RCP<Thyra::LinearOpBase<double>> _preconditioner_op;
+    double _perturbation;
+    int _preconditioner_version;
+
+    // Base point and residual.
+    Thyra::ModelEvaluatorBase::InArgs<double> _in_args;
+    Teuchos::RCP<Thyra::VectorBase<double>> _x;
+    Teuchos::RCP<Thyra::VectorBase<double>> _x_dot;
+    Teuchos::RCP<Thyra::VectorBase<double>> _f;
+    double _x_norm;
+    double _alpha;
+    double _beta;
+};
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
+
+#endif // VERTEXCFD_LINEARSOLVERS_JACOBIANFREEOPERATOR_HPP
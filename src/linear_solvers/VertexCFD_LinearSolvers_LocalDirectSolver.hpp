@@ -1,8 +1,10 @@
 #ifndef VERTEXCFD_LINEARSOLVERS_LOCALDIRECTSOLVER_HPP
 #define VERTEXCFD_LINEARSOLVERS_LOCALDIRECTSOLVER_HPP
 
+#include <Ifpack2_LocalFilter.hpp>
 #include <Teuchos_FancyOStream.hpp>
 #include <Teuchos_RCP.hpp>
+#include <Tpetra_CrsMatrix.hpp>
 #include <Tpetra_MultiVector.hpp>
 #include <Tpetra_RowMatrix.hpp>
 
@@ -33,6 +35,24 @@ class LocalDirectSolver
     // Given RHS vector b, solve for x
     virtual void solve(const Tpetra::MultiVector<>& b, Tpetra::MultiVector<>& x)
         = 0;
+
+  protected:
+    // Ifpack2 passes the local rows of the global matrix wrapped in an
+    // Ifpack2::LocalFilter, which only keeps the entries of the local
+    // columns below the number of local rows. Returns the CrsMatrix wrapped
+    // by A so that its local CRS arrays can be copied directly, or null if
+    // A is not a LocalFilter over a CrsMatrix.
+    static const Tpetra::CrsMatrix<>*
+    underlyingCrsMatrix(const Tpetra::RowMatrix<>& A)
+    {
+        const auto filter
+            = dynamic_cast<const Ifpack2::LocalFilter<Tpetra::RowMatrix<>>*>(
+                &A);
+        if (filter == nullptr)
+            return nullptr;
+        return dynamic_cast<const Tpetra::CrsMatrix<>*>(
+            filter->getUnderlyingMatrix().get());
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -1,28 +1,56 @@
 
 #include "VertexCFD_LinearSolvers_LocalSolverFactory.hpp"
 
+#include "VertexCFD_LinearSolvers_IncompleteLU.hpp"
+
 #ifdef __CUDACC__
 #include "VertexCFD_LinearSolvers_CusolverGLU.hpp"
 #endif
 #ifdef HAVE_SUPERLUDIST
 #include "VertexCFD_LinearSolvers_SuperLU.hpp"
 #endif
+#ifdef VERTEXCFD_HAVE_TACHO
+#include "VertexCFD_LinearSolvers_Tacho.hpp"
+#endif
 
 namespace VertexCFD
 {
 namespace LinearSolvers
 {
+//---------------------------------------------------------------------------//
+// Default solver name
+//---------------------------------------------------------------------------//
+std::string LocalSolverFactory::defaultSolverName()
+{
+#if defined(__CUDACC__) || !defined(VERTEXCFD_HAVE_TACHO)
+    return "Cusolver GLU";
+#else
+    return "Tacho";
+#endif
+}
+
 //---------------------------------------------------------------------------//
 // Constructor
 //---------------------------------------------------------------------------//
 std::shared_ptr<LocalDirectSolver>
 LocalSolverFactory::buildSolver(const Teuchos::ParameterList& params)
 {
-    // Get solver name, default to Cusolver GLU
-    std::string name = "Cusolver GLU";
+    // Get solver name
+    std::string name = defaultSolverName();
     if (params.isType<std::string>("Local Solver"))
         name = params.get<std::string>("Local Solver");
 
+    // Only the incomplete LU solver can store its factors in single
+    // precision
+    if (name != "ILU" && params.isType<std::string>("Factor Precision")
+        && params.get<std::string>("Factor Precision") != "Double")
+    {
+        throw std::runtime_error(
+            "Local solver " + name
+            + " only supports double precision factors. Use the `ILU` local "
+              "solver for single precision factors.");
+    }
+
     if (name == "Cusolver GLU")
     {
 #ifdef __CUDACC__
@@ -41,6 +69,18 @@ LocalSolverFactory::buildSolver(const Teuchos::ParameterList& params)
             "Solver option `SuperLU` is not available because SUPERLUDIST is"
             "not enabled.");
 #endif
+    else if (name == "Tacho")
+#ifdef VERTEXCFD_HAVE_TACHO
+        return std::make_shared<TachoSolver>(params);
+#else
+        throw std::runtime_error(
+            "Solver option `Tacho` is not available because ShyLU_NodeTacho "
+            "is not enabled.");
+#endif
+    else if (name == "ILU")
+    {
+        return std::make_shared<IncompleteLUSolver>(params);
+    }
     else
     {
         std::string msg = "Unrecognized local solver " + name;
@@ -4,6 +4,7 @@
 #include "VertexCFD_LinearSolvers_LocalDirectSolver.hpp"
 
 #include <memory>
+#include <string>
 
 namespace VertexCFD
 {
@@ -18,6 +19,10 @@ class LocalSolverFactory
     // Prevent construction
     LocalSolverFactory() = delete;
 
+    // Name of the solver built when none is given: Cusolver GLU on the
+    // device and Tacho on the host
+    static std::string defaultSolverName();
+
     // Build solver from solver name
     static std::shared_ptr<LocalDirectSolver>
     buildSolver(const Teuchos::ParameterList& params);
@@ -1,15 +1,112 @@
 #include "VertexCFD_LinearSolvers_PreconditionerFactory.hpp"
+#include "VertexCFD_LinearSolvers_LocalSolverFactory.hpp"
 #include "VertexCFD_LinearSolvers_Preconditioner.hpp"
 
+#include <Ifpack2_Factory.hpp>
 #include <Panzer_GlobalIndexer.hpp>
 #include <Panzer_NodeType.hpp>
 #include <Thyra_DefaultPreconditioner.hpp>
 #include <Thyra_TpetraLinearOp.hpp>
+#include <Thyra_TpetraThyraWrappers.hpp>
+#include <Tpetra_BlockCrsMatrix_Helpers.hpp>
+#include <Tpetra_CrsMatrix.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 namespace VertexCFD
 {
 namespace LinearSolvers
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+// Parameters of the block preconditioners, which are not passed to the
+// additive Schwarz preconditioner.
+const std::vector<std::string> block_parameter_names = {
+    "Block Preconditioner",
+    "Block Size",
+    "Block ILU Fill Level",
+    "Block Jacobi Sweeps",
+    "Block Jacobi Damping Factor",
+};
+
+//---------------------------------------------------------------------------//
+std::string blockPreconditionerType(const Teuchos::ParameterList& params)
+{
+    std::string type = "None";
+    if (params.isType<std::string>("Block Preconditioner"))
+        type = params.get<std::string>("Block Preconditioner");
+    if (type != "None" && type != "Block Jacobi" && type != "Block ILU")
+    {
+        throw std::runtime_error(
+            "Unrecognized block preconditioner " + type
+            + ". Choose 'None', 'Block Jacobi' or 'Block ILU'.");
+    }
+    return type;
+}
+
+//---------------------------------------------------------------------------//
+// Copy the values of a point matrix into a block matrix with the same
+// pattern, where the point index of field i at mesh index n is
+// n * block_size + i.
+void copyBlockValues(const Tpetra::CrsMatrix<>& point_matrix,
+                     Tpetra::BlockCrsMatrix<>& block_matrix,
+                     const int block_size)
+{
+    using GO = Tpetra::CrsMatrix<>::global_ordinal_type;
+
+    const auto point_row_map = point_matrix.getRowMap();
+    const auto point_col_map = point_matrix.getColMap();
+    const auto block_row_map = block_matrix.getRowMap();
+    const auto block_col_map = block_matrix.getColMap();
+    const int block_entries = block_size * block_size;
+
+    // Position of each block column in the current block row, or -1
+    std::vector<int> position(block_col_map->getLocalNumElements(), -1);
+    std::vector<int> block_cols;
+    std::vector<double> block_vals;
+
+    const int num_block_rows = block_row_map->getLocalNumElements();
+    for (int block_row = 0; block_row < num_block_rows; ++block_row)
+    {
+        const GO block_gid = block_row_map->getGlobalElement(block_row);
+        for (int i = 0; i < block_size; ++i)
+        {
+            const int point_row
+                = point_row_map->getLocalElement(block_gid * block_size + i);
+            Tpetra::CrsMatrix<>::local_inds_host_view_type indices;
+            Tpetra::CrsMatrix<>::values_host_view_type values;
+            point_matrix.getLocalRowView(point_row, indices, values);
+            for (std::size_t k = 0; k < indices.extent(0); ++k)
+            {
+                const GO col_gid = point_col_map->getGlobalElement(indices(k));
+                const int block_col
+                    = block_col_map->getLocalElement(col_gid / block_size);
+                if (position[block_col] < 0)
+                {
+                    position[block_col] = block_cols.size();
+                    block_cols.push_back(block_col);
+                    block_vals.resize(block_vals.size() + block_entries, 0.0);
+                }
+                block_vals[position[block_col] * block_entries
+                           + i * block_size + col_gid % block_size]
+                    = values(k);
+            }
+        }
+
+        block_matrix.replaceLocalValues(
+            block_row, block_cols.data(), block_vals.data(), block_cols.size());
+
+        for (const int block_col : block_cols)
+            position[block_col] = -1;
+        block_cols.clear();
+        block_vals.clear();
+    }
+}
+} // namespace
+
 //---------------------------------------------------------------------------//
 // Determine if preconditioner is compatible with specified operator
 //---------------------------------------------------------------------------//
@@ -66,13 +163,23 @@ void PreconditionerFactory::initializePrec(
     auto tpetra_op = thyra_tpetra_op->getConstTpetraOperator();
     auto tpetra_row_mat = Teuchos::rcp_dynamic_cast<const RowMatrix>(tpetra_op);
 
+    // Build a block preconditioner if requested
+    if (blockPreconditionerType(*_params) != "None")
+    {
+        initializeBlockPrec(tpetra_row_mat, prec_op);
+        return;
+    }
+
     // Build Additive Schwarz preconditioner
     if (!_schwarz)
     {
         // Build "outer" preconditiner
         _schwarz = Teuchos::rcp(
             new Ifpack2::AdditiveSchwarz<RowMatrix>(tpetra_row_mat));
-        _schwarz->setParameters(*_params);
+        Teuchos::ParameterList schwarz_params(*_params);
+        for (const auto& name : block_parameter_names)
+            schwarz_params.remove(name, false);
+        _schwarz->setParameters(schwarz_params);
 
         // Build "inner" preconditioner and compute
         auto inner_prec_params = Teuchos::sublist(
@@ -104,6 +211,104 @@ void PreconditionerFactory::initializePrec(
     }
 }
 
+//---------------------------------------------------------------------------//
+// Initialize block preconditioner
+//---------------------------------------------------------------------------//
+void PreconditionerFactory::initializeBlockPrec(
+    const Teuchos::RCP<const Tpetra::RowMatrix<>>& row_matrix,
+    Thyra::PreconditionerBase<double>* prec_op) const
+{
+    auto point_matrix
+        = Teuchos::rcp_dynamic_cast<const Tpetra::CrsMatrix<>>(row_matrix);
+    if (point_matrix.is_null())
+    {
+        throw std::runtime_error(
+            "Block preconditioners require a Tpetra::CrsMatrix");
+    }
+
+    int block_size = 0;
+    if (_params->isType<int>("Block Size"))
+        block_size = _params->get<int>("Block Size");
+    if (block_size <= 0 || point_matrix->getLocalNumRows() % block_size != 0)
+    {
+        throw std::runtime_error(
+            "'Block Size' must be positive and divide the number of local "
+            "rows of the matrix");
+    }
+
+    if (_block_matrix.is_null())
+    {
+        // Build the block matrix and the preconditioner
+        _block_matrix = Tpetra::convertToBlockCrsMatrix(*point_matrix,
+                                                        block_size);
+
+        Teuchos::ParameterList ifpack2_params;
+        std::string name;
+        if (blockPreconditionerType(*_params) == "Block ILU")
+        {
+            name = "RBILUK";
+            ifpack2_params.set(
+                "fact: iluk level-of-fill",
+                _params->isType<int>("Block ILU Fill Level")
+                    ? _params->get<int>("Block ILU Fill Level")
+                    : 0);
+        }
+        else
+        {
+            name = "RELAXATION";
+            ifpack2_params.set("relaxation: type", "Jacobi");
+            ifpack2_params.set(
+                "relaxation: sweeps",
+                _params->isType<int>("Block Jacobi Sweeps")
+                    ? _params->get<int>("Block Jacobi Sweeps")
+                    : 1);
+            ifpack2_params.set(
+                "relaxation: damping factor",
+                _params->isType<double>("Block Jacobi Damping Factor")
+                    ? _params->get<double>("Block Jacobi Damping Factor")
+                    : 1.0);
+        }
+
+        _block_prec = Ifpack2::Factory::create<Tpetra::RowMatrix<>>(
+            name,
+            Teuchos::rcp_implicit_cast<const Tpetra::RowMatrix<>>(
+                _block_matrix));
+        _block_prec->setParameters(ifpack2_params);
+        _block_prec->initialize();
+        _block_prec->compute();
+
+        // Wrap the block preconditioner into a Thyra::Preconditioner on the
+        // spaces of the point matrix
+        auto range_space = Thyra::createVectorSpace<double,
+                                                    int,
+                                                    panzer::GlobalOrdinal,
+                                                    panzer::TpetraNodeType>(
+            point_matrix->getRangeMap());
+        auto domain_space = Thyra::createVectorSpace<double,
+                                                     int,
+                                                     panzer::GlobalOrdinal,
+                                                     panzer::TpetraNodeType>(
+            point_matrix->getDomainMap());
+        auto thyra_prec = Thyra::createLinearOp<double,
+                                                int,
+                                                panzer::GlobalOrdinal,
+                                                panzer::TpetraNodeType>(
+            Teuchos::rcp_implicit_cast<Tpetra::Operator<>>(_block_prec),
+            range_space,
+            domain_space);
+
+        auto* default_prec
+            = dynamic_cast<Thyra::DefaultPreconditioner<double>*>(prec_op);
+        default_prec->initializeUnspecified(thyra_prec);
+    }
+    else
+    {
+        // Only the values of the matrix change
+        copyBlockValues(*point_matrix, *_block_matrix, block_size);
+        _block_prec->compute();
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Uninitialize preconditioner
 //---------------------------------------------------------------------------//
@@ -165,9 +370,17 @@ PreconditionerFactory::getValidParameters() const
     // Add VertexCFD preconditioner parameters for inner solver
     auto inner_params
         = Teuchos::sublist(params, "schwarz: inner preconditioner parameters");
-    inner_params->set("Local Solver", "Cusolver GLU");
+    inner_params->set("Local Solver", LocalSolverFactory::defaultSolverName());
     inner_params->set("Reorder", 1);
     inner_params->set("Pivot Threshold", 1.0e-2);
+    inner_params->set("Factor Precision", "Double");
+
+    // Add block preconditioner parameters
+    params->set("Block Preconditioner", "None");
+    params->set("Block Size", 1);
+    params->set("Block ILU Fill Level", 0);
+    params->set("Block Jacobi Sweeps", 1);
+    params->set("Block Jacobi Damping Factor", 1.0);
 
     return params;
 }
@@ -2,8 +2,10 @@
 #define VERTEXCFD_LINEARSOLVERS_PRECONDITIONERFACTORY_HPP
 
 #include <Ifpack2_AdditiveSchwarz.hpp>
+#include <Ifpack2_Preconditioner.hpp>
 #include <Thyra_LinearOpWithSolveFactoryBase.hpp>
 #include <Thyra_PreconditionerFactoryBase.hpp>
+#include <Tpetra_BlockCrsMatrix.hpp>
 
 #include <memory>
 
@@ -15,6 +17,15 @@ namespace LinearSolvers
 // Build a VertexCFD Preconditioner.
 // This class allows for the construction of "custom" preconditioners that
 // aren't supported through Trilinos.
+//
+// By default an additive Schwarz preconditioner with a VertexCFD local
+// solver is built. If "Block Preconditioner" is set to "Block Jacobi" or
+// "Block ILU", the matrix is instead converted to a Tpetra::BlockCrsMatrix
+// with dense blocks of "Block Size" rows, which requires the degrees of
+// freedom of each mesh node to be numbered contiguously, and an Ifpack2 block
+// relaxation or block ILU(k) preconditioner is built on the block matrix.
+// The block sparsity pattern is built once and only the values are copied
+// when the matrix changes.
 //---------------------------------------------------------------------------//
 class PreconditionerFactory : public Thyra::PreconditionerFactoryBase<double>
 {
@@ -53,6 +64,14 @@ class PreconditionerFactory : public Thyra::PreconditionerFactoryBase<double>
     Teuchos::RCP<Teuchos::ParameterList> _params;
 
     mutable Teuchos::RCP<Ifpack2::AdditiveSchwarz<Tpetra::RowMatrix<>>> _schwarz;
+
+    mutable Teuchos::RCP<Tpetra::BlockCrsMatrix<>> _block_matrix;
+    mutable Teuchos::RCP<Ifpack2::Preconditioner<>> _block_prec;
+
+    // Initialize a preconditioner on the block form of the matrix.
+    void initializeBlockPrec(
+        const Teuchos::RCP<const Tpetra::RowMatrix<>>& row_matrix,
+        Thyra::PreconditionerBase<double>* prec_op) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -2,8 +2,10 @@
 
 #include <Tpetra_Vector.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <sstream>
+#include <utility>
 
 namespace VertexCFD
 {
@@ -51,8 +53,11 @@ SuperLUSolver::~SuperLUSolver()
     Destroy_CompRowLoc_Matrix_dist(&_A);
     dDestroy_LU(_num_rows, &_grid, &_LUstruct);
 
-    dScalePermstructFree(&_ScalePermstruct);
-    dLUstructFree(&_LUstruct);
+    if (_initialized)
+    {
+        dScalePermstructFree(&_ScalePermstruct);
+        dLUstructFree(&_LUstruct);
+    }
     if (_options.SolveInitialized)
     {
         dSolveFinalize(&_options, &_SOLVEstruct);
@@ -66,47 +71,65 @@ SuperLUSolver::~SuperLUSolver()
 //---------------------------------------------------------------------------//
 void SuperLUSolver::setMatrix(Teuchos::RCP<const Tpetra::RowMatrix<>> A)
 {
+    // Ifpack2 passes a new local matrix on every setup, so the pattern of
+    // the extracted data is compared with the stored one. If it is the same,
+    // the host arrays, the permutations and the symbolic factorization are
+    // reused and only the numerical factorization is redone. The values are
+    // extracted directly into the SuperLU host array when they fit.
+    const bool same_size
+        = _matrix_set && _colind.size() == A->getNodeNumEntries();
+    if (!same_size)
+        _values.resize(A->getNodeNumEntries());
+    const bool new_pattern
+        = extractMatrix(*A, same_size ? _A_values_host : _values.data());
+    if (_matrix_set && !new_pattern)
+    {
+        copyMatrixPattern();
+        if (_factored)
+            _options.Fact = SamePattern_SameRowPerm;
+        _factored = false;
+        return;
+    }
+
     if (_matrix_set)
     {
+        // Keep the values extracted into the array freed below.
+        if (same_size)
+            _values.assign(_A_values_host, _A_values_host + _colind.size());
+
         // WARNING:
         // destroying _A also destroys the vectors _A_rowptr_host,
         // _A_colind_host and _A_values_host!
         Destroy_CompRowLoc_Matrix_dist(&_A);
         dDestroy_LU(_num_rows, &_grid, &_LUstruct);
+        if (_options.SolveInitialized)
+        {
+            dSolveFinalize(&_options, &_SOLVEstruct);
+        }
+
+        // The permutations and the LU structure are sized with the number
+        // of rows of the previous matrix.
+        if (_initialized)
+        {
+            dScalePermstructFree(&_ScalePermstruct);
+            dLUstructFree(&_LUstruct);
+            _initialized = false;
+        }
     }
 
-    _num_rows = A->getNodeNumRows();
+    _num_rows = _rowptr.size() - 1;
 
     // Host-side allocation for CRS data
     // Since SuperLU will free these arrays when destroying matrix using its
     // own wrappers, let's use SuperLU wrappers to allocate that memory to
     // ensure consistency
-    int nnz_loc = A->getNodeNumEntries();
+    int nnz_loc = _colind.size();
     _A_rowptr_host = (int*)SUPERLU_MALLOC((_num_rows + 1) * sizeof(int));
     _A_colind_host = (int*)SUPERLU_MALLOC(nnz_loc * sizeof(int));
     _A_values_host = (double*)SUPERLU_MALLOC(nnz_loc * sizeof(double));
 
-    // Extract matrix data from A
-    std::size_t num_entries;
-    Teuchos::Array<int> row_inds;
-    Teuchos::Array<double> row_vals;
-    _A_rowptr_host[0] = 0;
-    int offset = 0;
-    for (int row = 0; row < _num_rows; ++row)
-    {
-        num_entries = A->getNumEntriesInLocalRow(row);
-        row_inds.resize(num_entries);
-        row_vals.resize(num_entries);
-        A->getLocalRowCopy(row, row_inds, row_vals, num_entries);
-        memcpy(_A_colind_host + offset,
-               row_inds.data(),
-               num_entries * sizeof(int));
-        memcpy(_A_values_host + offset,
-               row_vals.data(),
-               num_entries * sizeof(double));
-        _A_rowptr_host[1 + row] = _A_rowptr_host[row] + num_entries;
-        offset += num_entries;
-    }
+    copyMatrixPattern();
+    std::copy(_values.begin(), _values.end(), _A_values_host);
 
     // create SuperLU matrix
     dCreate_CompRowLoc_Matrix_dist(&_A,
@@ -122,16 +145,90 @@ void SuperLUSolver::setMatrix(Teuchos::RCP<const Tpetra::RowMatrix<>> A)
                                    SLU_D,
                                    SLU_GE);
 
-    if (_factored)
-        _options.Fact = SamePattern; // tell SuperLU new matrix has same nnz
-                                     // pattern
-    else
-        _options.Fact = DOFACT;
+    // The sparsity pattern is new, so the permutations and the symbolic
+    // factorization are computed again.
+    _options.Fact = DOFACT;
 
     _matrix_set = true;
     _factored = false;
 }
 
+//---------------------------------------------------------------------------//
+// Extract matrix data
+//---------------------------------------------------------------------------//
+bool SuperLUSolver::extractMatrix(const Tpetra::RowMatrix<>& A,
+                                  double* values)
+{
+    const int num_rows = A.getNodeNumRows();
+    const int num_entries = A.getNodeNumEntries();
+    std::vector<int> rowptr(num_rows + 1);
+    std::vector<int> colind(num_entries);
+
+    rowptr[0] = 0;
+    const auto crs_matrix = underlyingCrsMatrix(A);
+    if (crs_matrix != nullptr)
+    {
+        // Copy the local CRS arrays of the wrapped matrix, dropping the
+        // columns of the ghosted rows as the filter does.
+        const auto local_matrix = crs_matrix->getLocalMatrixHost();
+        const auto& row_map = local_matrix.graph.row_map;
+        const auto& entries = local_matrix.graph.entries;
+        const auto& matrix_values = local_matrix.values;
+        int offset = 0;
+        for (int row = 0; row < num_rows; ++row)
+        {
+            for (auto k = row_map(row); k < row_map(row + 1); ++k)
+            {
+                if (entries(k) < num_rows)
+                {
+                    colind[offset] = entries(k);
+                    values[offset] = matrix_values(k);
+                    ++offset;
+                }
+            }
+            rowptr[row + 1] = offset;
+        }
+    }
+    else
+    {
+        std::size_t row_entries;
+        Teuchos::Array<int> row_inds;
+        Teuchos::Array<double> row_vals;
+        for (int row = 0; row < num_rows; ++row)
+        {
+            row_entries = A.getNumEntriesInLocalRow(row);
+            row_inds.resize(row_entries);
+            row_vals.resize(row_entries);
+            A.getLocalRowCopy(row, row_inds, row_vals, row_entries);
+            const int offset = rowptr[row];
+            std::copy(
+                row_inds.begin(), row_inds.end(), colind.begin() + offset);
+            std::copy(row_vals.begin(), row_vals.end(), values + offset);
+            rowptr[row + 1] = offset + row_entries;
+        }
+    }
+
+    // Compare with the stored pattern
+    const bool new_pattern = rowptr != _rowptr || colind != _colind;
+    if (new_pattern)
+    {
+        _rowptr = std::move(rowptr);
+        _colind = std::move(colind);
+    }
+    return new_pattern;
+}
+
+//---------------------------------------------------------------------------//
+// Copy matrix pattern
+//---------------------------------------------------------------------------//
+void SuperLUSolver::copyMatrixPattern()
+{
+    // SuperLU applies the column permutation to the column indices in place
+    // so the column indices are copied on each call.
+    std::copy(_rowptr.begin(), _rowptr.end(), _A_rowptr_host);
+    std::copy(_colind.begin(), _colind.end(), _A_colind_host);
+}
+
 //---------------------------------------------------------------------------//
 // Initialize preconditioner
 //---------------------------------------------------------------------------//
@@ -3,6 +3,8 @@
 
 #include "VertexCFD_LinearSolvers_LocalDirectSolver.hpp"
 
+#include <vector>
+
 // superlu_ddefs.h includes C macro that conflicts with some
 // cuda libraries include files. So let's include it after
 // everything else
@@ -27,6 +29,13 @@ class SuperLUSolver : public LocalDirectSolver
     // Matrix
     SuperMatrix _A;
 
+    // Local CRS pattern of the last matrix, kept unpermuted to detect a
+    // matrix with the same sparsity pattern, and the values of a matrix with
+    // a new pattern.
+    std::vector<int> _rowptr;
+    std::vector<int> _colind;
+    std::vector<double> _values;
+
     // Host-side matrix data
     int* _A_rowptr_host;
     int* _A_colind_host;
@@ -47,6 +56,14 @@ class SuperLUSolver : public LocalDirectSolver
 
     int _num_rows;
 
+    // Extract the CRS data of A with the values written to the given array.
+    // Returns true if the sparsity pattern differs from the one currently
+    // stored.
+    bool extractMatrix(const Tpetra::RowMatrix<>& A, double* values);
+
+    // Copy the extracted pattern into the SuperLU host arrays.
+    void copyMatrixPattern();
+
   public:
     // Constructor
     SuperLUSolver();
@@ -0,0 +1,226 @@
+#include "VertexCFD_LinearSolvers_Tacho.hpp"
+
+#include <Tpetra_CrsMatrix.hpp>
+
+#include <cassert>
+#include <sstream>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+// Constructor
+//---------------------------------------------------------------------------//
+TachoSolver::TachoSolver(const Teuchos::ParameterList& params)
+    : _matrix_set(false)
+    , _initialized(false)
+    , _computed(false)
+    , _num_rows(0)
+{
+    // Symmetric pattern LU factorization
+    _solver.setSolutionMethod(3);
+
+    // Problems smaller than this are factored with a serial dense solver
+    int small_problem_threshold = 1024;
+    if (params.isType<int>("Small Problem Threshold"))
+    {
+        small_problem_threshold = params.get<int>("Small Problem Threshold");
+    }
+    _solver.setSmallProblemThresholdsize(small_problem_threshold);
+}
+
+TachoSolver::~TachoSolver()
+{
+    if (_initialized)
+        _solver.release();
+}
+
+//---------------------------------------------------------------------------//
+// Change matrix
+//---------------------------------------------------------------------------//
+void TachoSolver::setMatrix(Teuchos::RCP<const Tpetra::RowMatrix<>> A)
+{
+    _A = A;
+
+    // Ifpack2 passes a new local matrix on every setup, so the symbolic
+    // analysis is only redone if the sparsity pattern itself has changed.
+    const bool new_pattern = extractMatrix(*_A);
+    if (new_pattern && _initialized)
+    {
+        check_status(_solver.release(), "Tacho release");
+        _initialized = false;
+    }
+
+    _matrix_set = true;
+    _computed = false;
+}
+
+//---------------------------------------------------------------------------//
+// Initialize preconditioner
+//---------------------------------------------------------------------------//
+void TachoSolver::initialize()
+{
+    assert(_matrix_set);
+
+    if (_initialized)
+    {
+        return;
+    }
+
+    // Ordering and symbolic factorization
+    check_status(_solver.analyze(_num_rows, _A_rowptr, _A_colind),
+                 "Tacho analysis");
+    check_status(_solver.initialize(), "Tacho initialization");
+
+    _initialized = true;
+}
+
+//---------------------------------------------------------------------------//
+// Compute preconditioner
+//---------------------------------------------------------------------------//
+void TachoSolver::compute()
+{
+    assert(_matrix_set);
+
+    if (!_initialized)
+        initialize();
+
+    // Numeric factorization on the existing symbolic structure
+    check_status(_solver.factorize(_A_values), "Tacho factorization");
+
+    _computed = true;
+}
+
+//---------------------------------------------------------------------------//
+// Apply preconditioner
+//---------------------------------------------------------------------------//
+void TachoSolver::solve(const Tpetra::MultiVector<>& b,
+                        Tpetra::MultiVector<>& x)
+{
+    assert(_initialized);
+    assert(_computed);
+
+    const int num_vectors = b.getNumVectors();
+    if (static_cast<int>(_b.extent(1)) != num_vectors
+        || static_cast<int>(_b.extent(0)) != _num_rows)
+    {
+        _b = typename solver_type::value_type_matrix(
+            "tacho_b", _num_rows, num_vectors);
+        _x = typename solver_type::value_type_matrix(
+            "tacho_x", _num_rows, num_vectors);
+        _t = typename solver_type::value_type_matrix(
+            "tacho_t", _num_rows, num_vectors);
+    }
+
+    // Get Kokkos Views
+    auto b_view = b.getLocalViewHost(Tpetra::Access::ReadOnly);
+    Kokkos::deep_copy(_b, b_view);
+
+    check_status(_solver.solve(_x, _b, _t), "Tacho solve");
+
+    auto x_view = x.getLocalViewHost(Tpetra::Access::OverwriteAll);
+    Kokkos::deep_copy(x_view, _x);
+}
+
+//---------------------------------------------------------------------------//
+// Extract matrix data
+//---------------------------------------------------------------------------//
+bool TachoSolver::extractMatrix(const Tpetra::RowMatrix<>& A)
+{
+    const int num_rows = A.getLocalNumRows();
+    const std::size_t num_entries = A.getLocalNumEntries();
+
+    typename solver_type::size_type_array_host rowptr(
+        Kokkos::ViewAllocateWithoutInitializing("tacho_rowptr"),
+        num_rows + 1);
+    typename solver_type::ordinal_type_array_host colind(
+        Kokkos::ViewAllocateWithoutInitializing("tacho_colind"),
+        num_entries);
+    if (_A_values.extent(0) != num_entries)
+    {
+        _A_values = typename solver_type::value_type_array(
+            Kokkos::ViewAllocateWithoutInitializing("tacho_values"),
+            num_entries);
+    }
+
+    rowptr(0) = 0;
+    const auto crs_matrix = underlyingCrsMatrix(A);
+    if (crs_matrix != nullptr)
+    {
+        // Copy the local CRS arrays of the wrapped matrix, dropping the
+        // columns of the ghosted rows as the filter does.
+        const auto local_matrix = crs_matrix->getLocalMatrixHost();
+        const auto& row_map = local_matrix.graph.row_map;
+        const auto& entries = local_matrix.graph.entries;
+        const auto& values = local_matrix.values;
+        std::size_t offset = 0;
+        for (int row = 0; row < num_rows; ++row)
+        {
+            for (auto k = row_map(row); k < row_map(row + 1); ++k)
+            {
+                if (entries(k) < num_rows)
+                {
+                    colind(offset) = entries(k);
+                    _A_values(offset) = values(k);
+                    ++offset;
+                }
+            }
+            rowptr(row + 1) = offset;
+        }
+    }
+    else
+    {
+        const std::size_t max_entries = A.getLocalMaxNumRowEntries();
+        Tpetra::RowMatrix<>::nonconst_local_inds_host_view_type row_inds(
+            "row_indices", max_entries);
+        Tpetra::RowMatrix<>::nonconst_values_host_view_type row_vals(
+            "row_values", max_entries);
+        std::size_t row_entries;
+        for (int row = 0; row < num_rows; ++row)
+        {
+            A.getLocalRowCopy(row, row_inds, row_vals, row_entries);
+            const std::size_t offset = rowptr(row);
+            for (std::size_t k = 0; k < row_entries; ++k)
+            {
+                colind(offset + k) = row_inds(k);
+                _A_values(offset + k) = row_vals(k);
+            }
+            rowptr(row + 1) = offset + row_entries;
+        }
+    }
+
+    // Compare with the stored pattern
+    bool new_pattern = rowptr.extent(0) != _A_rowptr.extent(0)
+                       || colind.extent(0) != _A_colind.extent(0);
+    for (int row = 0; !new_pattern && row <= num_rows; ++row)
+        new_pattern = rowptr(row) != _A_rowptr(row);
+    for (std::size_t k = 0; !new_pattern && k < num_entries; ++k)
+        new_pattern = colind(k) != _A_colind(k);
+
+    if (new_pattern)
+    {
+        _num_rows = num_rows;
+        _A_rowptr = rowptr;
+        _A_colind = colind;
+    }
+    return new_pattern;
+}
+
+//---------------------------------------------------------------------------//
+// Check status of Tacho call
+//---------------------------------------------------------------------------//
+void TachoSolver::check_status(const int stat, const std::string& msg) const
+{
+    if (stat != 0)
+    {
+        std::stringstream ss;
+        ss << msg << " failed with status " << stat;
+        throw std::runtime_error(ss.str());
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
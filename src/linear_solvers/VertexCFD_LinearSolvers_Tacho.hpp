@@ -0,0 +1,92 @@
+#ifndef VERTEXCFD_LINEARSOLVERS_TACHO_HPP
+#define VERTEXCFD_LINEARSOLVERS_TACHO_HPP
+
+#include "VertexCFD_LinearSolvers_LocalDirectSolver.hpp"
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+#include <Tpetra_RowMatrix.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <Tacho.hpp>
+#include <Tacho_Solver.hpp>
+
+namespace VertexCFD
+{
+namespace LinearSolvers
+{
+//---------------------------------------------------------------------------//
+// Local preconditioner/solver using the ShyLU Tacho multifrontal solver on
+// the host. The factorization is parallelized over the threads of the
+// default host execution space, which makes this the local solver of choice
+// for CPU-only builds. The symbolic analysis is performed once and reused as
+// long as the sparsity pattern of the local matrix does not change; each call
+// to compute() only redoes the numeric factorization. Tacho's LU
+// factorization requires a structurally symmetric matrix, which is the case
+// for the local blocks of the finite element Jacobians used here.
+//---------------------------------------------------------------------------//
+class TachoSolver : public LocalDirectSolver
+{
+  private:
+    using device_type = Kokkos::Device<Kokkos::DefaultHostExecutionSpace,
+                                       Kokkos::HostSpace>;
+    using solver_type = Tacho::Solver<double, device_type>;
+
+    // >>> DATA
+
+    // Matrix
+    Teuchos::RCP<const Tpetra::RowMatrix<>> _A;
+
+    // Host-side matrix data
+    typename solver_type::size_type_array_host _A_rowptr;
+    typename solver_type::ordinal_type_array_host _A_colind;
+    typename solver_type::value_type_array _A_values;
+
+    // Solve work space
+    typename solver_type::value_type_matrix _b;
+    typename solver_type::value_type_matrix _x;
+    typename solver_type::value_type_matrix _t;
+
+    // Persistent Tacho info
+    solver_type _solver;
+
+    // Status flags
+    bool _matrix_set;
+    bool _initialized;
+    bool _computed;
+
+    int _num_rows;
+
+  public:
+    // Constructor
+    TachoSolver(const Teuchos::ParameterList& params);
+
+    ~TachoSolver();
+
+    // Update internal matrix
+    void setMatrix(Teuchos::RCP<const Tpetra::RowMatrix<>> A) override;
+
+    // Inherited interface from LocalDirectSolver
+    void initialize() override;
+    void compute() override;
+
+    // Inherited interface from LocalDirectSolver
+    void
+    solve(const Tpetra::MultiVector<>& b, Tpetra::MultiVector<>& x) override;
+
+  private:
+    // Extract the CRS data of A. Returns true if the sparsity pattern
+    // differs from the one currently stored.
+    bool extractMatrix(const Tpetra::RowMatrix<>& A);
+
+    // Check status condition and throw exception if failed
+    void check_status(const int stat, const std::string& identifier) const;
+};
+
+//---------------------------------------------------------------------------//
+
+} // namespace LinearSolvers
+} // namespace VertexCFD
+
+#endif // VERTEXCFD_LINEARSOLVERS_TACHO_HPP
@@ -128,6 +128,32 @@ TEST_F(PreconditionerTester, solve_test)
                 2.0 * _ref_soln[local_row] + 6.0, y_data[local_row], tol);
         }
     }
+
+    // Recompute with new matrix values on the same sparsity pattern.
+    _matrix->resumeFill();
+    _matrix->scale(2.0);
+    _matrix->fillComplete();
+    prec.compute();
+    EXPECT_TRUE(prec.isInitialized());
+    EXPECT_TRUE(prec.isComputed());
+    EXPECT_EQ(1, prec.getNumInitialize());
+    EXPECT_EQ(2, prec.getNumCompute());
+    EXPECT_EQ(3, prec.getNumApply());
+
+    _x->putScalar(1.0);
+    _y->putScalar(2.0);
+    prec.apply(*_x, *_y, Teuchos::NO_TRANS, 1.0, 0.0);
+    EXPECT_EQ(4, prec.getNumApply());
+
+    {
+        auto y_data = _y->getData(0);
+        int num_local_rows = y_data.size();
+        double tol = 1e-14;
+        for (int local_row = 0; local_row < num_local_rows; ++local_row)
+        {
+            EXPECT_NEAR(0.5 * _ref_soln[local_row], y_data[local_row], tol);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,184 @@
+#include <VertexCFD_EvaluatorTestHarness.hpp>
+#include <VertexCFD_SolverTester.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_IncompleteLU.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_LocalSolverFactory.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_Preconditioner.hpp>
+
+#include <Teuchos_DefaultMpiComm.hpp>
+#include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Map.hpp>
+
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+class IncompleteLUTester : public SolverTester
+{
+  protected:
+    // Apply the preconditioner built with the given parameters to a vector
+    // of ones. The preconditioner is then recomputed with twice the matrix
+    // and applied again.
+    void apply(Teuchos::ParameterList params,
+               std::vector<double>& y,
+               std::vector<double>& y_scaled)
+    {
+        params.set("Local Solver", "ILU");
+        LinearSolvers::Preconditioner prec;
+        prec.setParameters(params);
+        prec.setMatrix(_matrix);
+        prec.initialize();
+        prec.compute();
+
+        _x->putScalar(1.0);
+        prec.apply(*_x, *_y, Teuchos::NO_TRANS, 1.0, 0.0);
+        auto y_data = _y->getData(0);
+        y.assign(y_data.begin(), y_data.end());
+
+        _matrix->resumeFill();
+        _matrix->scale(2.0);
+        _matrix->fillComplete();
+        prec.setMatrix(_matrix);
+        prec.initialize();
+        prec.compute();
+
+        prec.apply(*_x, *_y, Teuchos::NO_TRANS, 1.0, 0.0);
+        auto y_scaled_data = _y->getData(0);
+        y_scaled.assign(y_scaled_data.begin(), y_scaled_data.end());
+
+        _matrix->resumeFill();
+        _matrix->scale(0.5);
+        _matrix->fillComplete();
+    }
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(IncompleteLUTester, build_test)
+{
+    Teuchos::ParameterList params;
+    params.set("Local Solver", "ILU");
+    auto solver = LinearSolvers::LocalSolverFactory::buildSolver(params);
+    auto ilu
+        = std::dynamic_pointer_cast<LinearSolvers::IncompleteLUSolver>(solver);
+    EXPECT_TRUE(ilu != nullptr);
+
+    // Invalid options
+    params.set("ILU Type", "Foo");
+    EXPECT_THROW(LinearSolvers::LocalSolverFactory::buildSolver(params),
+                 std::runtime_error);
+    params.set("ILU Type", "Threshold");
+    params.set("Triangular Solve", "Foo");
+    EXPECT_THROW(LinearSolvers::LocalSolverFactory::buildSolver(params),
+                 std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(IncompleteLUTester, level_fill_test)
+{
+    // With enough levels of fill the factorization is exact.
+    Teuchos::ParameterList params;
+    params.set("ILU Type", "Level");
+    params.set("Fill Level", 100);
+    std::vector<double> y;
+    std::vector<double> y_scaled;
+    apply(params, y, y_scaled);
+
+    const int num_local_rows = y.size();
+    const double tol = 1e-12;
+    for (int local_row = 0; local_row < num_local_rows; ++local_row)
+    {
+        EXPECT_NEAR(_ref_soln[local_row], y[local_row], tol);
+        EXPECT_NEAR(0.5 * _ref_soln[local_row], y_scaled[local_row], tol);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(IncompleteLUTester, threshold_test)
+{
+    // Without dropping the factorization is exact.
+    Teuchos::ParameterList params;
+    params.set("ILU Type", "Threshold");
+    params.set("Drop Tolerance", 0.0);
+    params.set("Fill Factor", 100.0);
+    std::vector<double> y;
+    std::vector<double> y_scaled;
+    apply(params, y, y_scaled);
+
+    const int num_local_rows = y.size();
+    const double tol = 1e-12;
+    for (int local_row = 0; local_row < num_local_rows; ++local_row)
+    {
+        EXPECT_NEAR(_ref_soln[local_row], y[local_row], tol);
+        EXPECT_NEAR(0.5 * _ref_soln[local_row], y_scaled[local_row], tol);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(IncompleteLUTester, jacobi_test)
+{
+    // ILU(0) with the level scheduled solve.
+    Teuchos::ParameterList params;
+    std::vector<double> y;
+    std::vector<double> y_scaled;
+    apply(params, y, y_scaled);
+
+    // Enough Jacobi sweeps reproduce the exact triangular solves.
+    params.set("Triangular Solve", "Jacobi");
+    params.set("Jacobi Sweeps", 50);
+    std::vector<double> y_jacobi;
+    std::vector<double> y_jacobi_scaled;
+    apply(params, y_jacobi, y_jacobi_scaled);
+
+    const int num_local_rows = y.size();
+    const double tol = 1e-12;
+    for (int local_row = 0; local_row < num_local_rows; ++local_row)
+    {
+        EXPECT_NEAR(y[local_row], y_jacobi[local_row], tol);
+        EXPECT_NEAR(0.5 * y[local_row], y_scaled[local_row], tol);
+        EXPECT_NEAR(0.5 * y[local_row], y_jacobi_scaled[local_row], tol);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(IncompleteLUTester, single_precision_test)
+{
+    // Exact factorization in double precision.
+    Teuchos::ParameterList params;
+    params.set("Fill Level", 100);
+    std::vector<double> y;
+    std::vector<double> y_scaled;
+    apply(params, y, y_scaled);
+
+    // Same factorization rounded to single precision.
+    params.set("Factor Precision", "Single");
+    std::vector<double> y_single;
+    std::vector<double> y_single_scaled;
+    apply(params, y_single, y_single_scaled);
+
+    const int num_local_rows = y.size();
+    const double tol = 1e-5;
+    for (int local_row = 0; local_row < num_local_rows; ++local_row)
+    {
+        EXPECT_NEAR(y[local_row], y_single[local_row], tol);
+        EXPECT_NEAR(y_scaled[local_row], y_single_scaled[local_row], tol);
+    }
+
+    // Invalid precision and unsupported local solver
+    params.set("Factor Precision", "Half");
+    EXPECT_THROW(LinearSolvers::LocalSolverFactory::buildSolver(params),
+                 std::runtime_error);
+    params.set("Factor Precision", "Single");
+    params.set("Local Solver", "SuperLU");
+    EXPECT_THROW(LinearSolvers::LocalSolverFactory::buildSolver(params),
+                 std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
@@ -0,0 +1,285 @@
+#include <VertexCFD_LinearSolverUnitTestConfig.hpp>
+
+#include <drivers/VertexCFD_InitialConditionManager.hpp>
+#include <drivers/VertexCFD_MeshManager.hpp>
+#include <drivers/VertexCFD_PhysicsManager.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_JacobianFreeLOWSFactory.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_JacobianFreeModelEvaluator.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_JacobianFreeOperator.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_LOWSFactoryBuilder.hpp>
+#include <parameters/VertexCFD_ParameterDatabase.hpp>
+
+#include <Thyra_DefaultIdentityLinearOp.hpp>
+#include <Thyra_DefaultLinearOpSource.hpp>
+#include <Thyra_DefaultPreconditioner.hpp>
+#include <Thyra_PreconditionerFactoryBase.hpp>
+#include <Thyra_VectorStdOps.hpp>
+
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Preconditioner factory counting the preconditioner computations. The
+// preconditioner is the identity.
+class CountingPreconditionerFactory
+    : public Thyra::PreconditionerFactoryBase<double>
+{
+  public:
+    mutable int num_initialize = 0;
+
+    bool isCompatible(const Thyra::LinearOpSourceBase<double>&) const override
+    {
+        return true;
+    }
+
+    Teuchos::RCP<Thyra::PreconditionerBase<double>> createPrec() const override
+    {
+        return Teuchos::rcp(new Thyra::DefaultPreconditioner<double>());
+    }
+
+    void initializePrec(
+        const Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>& fwd_op_src,
+        Thyra::PreconditionerBase<double>* prec,
+        const Thyra::ESupportSolveUse) const override
+    {
+        auto default_prec
+            = dynamic_cast<Thyra::DefaultPreconditioner<double>*>(prec);
+        default_prec->initializeUnspecified(
+            Thyra::identity(fwd_op_src->getOp()->domain()));
+        ++num_initialize;
+    }
+
+    void uninitializePrec(
+        Thyra::PreconditionerBase<double>*,
+        Teuchos::RCP<const Thyra::LinearOpSourceBase<double>>*,
+        Thyra::ESupportSolveUse*) const override
+    {
+    }
+
+    void setParameterList(
+        const Teuchos::RCP<Teuchos::ParameterList>& params) override
+    {
+        _params = params;
+    }
+
+    Teuchos::RCP<Teuchos::ParameterList> getNonconstParameterList() override
+    {
+        return _params;
+    }
+
+    Teuchos::RCP<Teuchos::ParameterList> unsetParameterList() override
+    {
+        auto params = _params;
+        _params = Teuchos::null;
+        return params;
+    }
+
+  private:
+    Teuchos::RCP<Teuchos::ParameterList> _params;
+};
+
+//---------------------------------------------------------------------------//
+// Incompressible Navier-Stokes model with a nonlinear convective flux, and a
+// perturbed initial state.
+struct Fixture
+{
+    Teuchos::RCP<Parameter::ParameterDatabase> parameter_db;
+    Teuchos::RCP<PhysicsManager> physics_manager;
+    Teuchos::RCP<Thyra::ModelEvaluator<double>> model;
+    Thyra::ModelEvaluatorBase::InArgs<double> in_args;
+
+    Fixture(const std::string& preconditioner_type = "Ifpack2")
+    {
+        auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+            Teuchos::DefaultComm<int>::getComm());
+
+        const std::string location = VERTEXCFD_LINEARSOLVER_TEST_DATA_DIR;
+        parameter_db = Teuchos::rcp(new Parameter::ParameterDatabase(
+            comm, location + "jacobian_free_test.xml"));
+        parameter_db->linearSolverParameters()->set("Preconditioner Type",
+                                                    preconditioner_type);
+
+        auto mesh_manager
+            = Teuchos::rcp(new MeshManager(*parameter_db, comm));
+        physics_manager = Teuchos::rcp(new PhysicsManager(
+            std::integral_constant<int, 2>{}, parameter_db, mesh_manager));
+        physics_manager->setupModel();
+        model = physics_manager->modelEvaluator();
+
+        InitialConditionManager ic_manager(parameter_db, mesh_manager);
+        Teuchos::RCP<Thyra::VectorBase<double>> x;
+        Teuchos::RCP<Thyra::VectorBase<double>> x_dot;
+        ic_manager.applyInitialConditions(
+            std::integral_constant<int, 2>{}, *physics_manager, x, x_dot);
+
+        Thyra::seed_randomize<double>(12345);
+        auto perturbation = Thyra::createMember(x->space());
+        Thyra::randomize(-0.5, 0.5, perturbation.ptr());
+        Thyra::Vp_V(x.ptr(), *perturbation);
+        Thyra::randomize(-1.0, 1.0, x_dot.ptr());
+
+        in_args = model->createInArgs();
+        in_args.set_x(x);
+        in_args.set_x_dot(x_dot);
+        in_args.set_t(0.0);
+    }
+};
+
+//---------------------------------------------------------------------------//
+// The finite difference product matches the product with the assembled AD
+// Jacobian W = alpha * df/dx_dot + beta * df/dx, including the scaling of
+// the result by the apply coefficients.
+TEST(JacobianFree, apply)
+{
+    Fixture fixture;
+    const auto& model = fixture.model;
+    auto& in_args = fixture.in_args;
+
+    Teuchos::ParameterList jfnk_params;
+    const auto jfnk_model = Teuchos::rcp(
+        new LinearSolvers::JacobianFreeModelEvaluator(model, jfnk_params));
+
+    auto v = Thyra::createMember(model->get_x_space());
+    Thyra::randomize(-1.0, 1.0, v.ptr());
+    auto y_0 = Thyra::createMember(model->get_f_space());
+    Thyra::randomize(-1.0, 1.0, y_0.ptr());
+
+    // Without and with the time derivative term.
+    for (const double alpha : {0.0, 2.0})
+    {
+        in_args.set_alpha(alpha);
+        in_args.set_beta(0.5);
+
+        // Jacobian-free product.
+        auto jfnk_op = jfnk_model->create_W_op();
+        auto jfnk_out_args = jfnk_model->createOutArgs();
+        jfnk_out_args.set_f(Thyra::createMember(model->get_f_space()));
+        jfnk_out_args.set_W_op(jfnk_op);
+        jfnk_model->evalModel(in_args, jfnk_out_args);
+
+        auto y_jfnk = y_0->clone_v();
+        jfnk_op->apply(Thyra::NOTRANS, *v, y_jfnk.ptr(), 1.5, -0.25);
+
+        // Assembled product.
+        auto jacobian = model->create_W_op();
+        auto out_args = model->createOutArgs();
+        out_args.set_W_op(jacobian);
+        model->evalModel(in_args, out_args);
+
+        auto y = y_0->clone_v();
+        jacobian->apply(Thyra::NOTRANS, *v, y.ptr(), 1.5, -0.25);
+
+        Thyra::Vp_StV(y_jfnk.ptr(), -1.0, *y);
+        EXPECT_LT(Thyra::norm_2(*y_jfnk), 1.0e-5 * Thyra::norm_2(*y));
+    }
+}
+
+//---------------------------------------------------------------------------//
+// The Jacobian is only assembled every lag-th evaluation of W, and never
+// without a preconditioner.
+TEST(JacobianFree, preconditioner_lag)
+{
+    for (const std::string preconditioner_type : {"Ifpack2", "None"})
+    {
+        Fixture fixture(preconditioner_type);
+        auto& in_args = fixture.in_args;
+        in_args.set_alpha(1.0);
+        in_args.set_beta(1.0);
+
+        Teuchos::ParameterList jfnk_params;
+        jfnk_params.set("Preconditioner Lag", 3);
+        const auto jfnk_model
+            = Teuchos::rcp(new LinearSolvers::JacobianFreeModelEvaluator(
+                fixture.model, jfnk_params));
+
+        auto jfnk_op = Teuchos::rcp_dynamic_cast<
+            LinearSolvers::JacobianFreeOperator>(jfnk_model->create_W_op(),
+                                                 true);
+        auto out_args = jfnk_model->createOutArgs();
+        out_args.set_W_op(jfnk_op);
+
+        // Evaluations 1, 4 and 7 assemble the Jacobian.
+        const int expected_version[7] = {1, 1, 1, 2, 2, 2, 3};
+        for (int i = 0; i < 7; ++i)
+        {
+            jfnk_model->evalModel(in_args, out_args);
+            EXPECT_EQ(
+                preconditioner_type == "None" ? 0 : expected_version[i],
+                jfnk_op->preconditionerVersion());
+        }
+    }
+
+    Fixture fixture;
+    Teuchos::ParameterList jfnk_params;
+    jfnk_params.set("Preconditioner Lag", 0);
+    EXPECT_THROW(
+        LinearSolvers::JacobianFreeModelEvaluator(fixture.model, jfnk_params),
+        std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+// The solver factory only recomputes the preconditioner when the assembled
+// Jacobian was updated.
+TEST(JacobianFree, lows_factory)
+{
+    Fixture fixture;
+    const auto& model = fixture.model;
+    auto& in_args = fixture.in_args;
+    in_args.set_alpha(1.0);
+    in_args.set_beta(1.0);
+
+    auto solver_params = Teuchos::rcp(new Teuchos::ParameterList(
+        *fixture.parameter_db->linearSolverParameters()));
+    solver_params->set("Preconditioner Type", "None");
+    auto lows_factory
+        = LinearSolvers::LOWSFactoryBuilder::buildLOWS(solver_params);
+    auto prec_factory = Teuchos::rcp(new CountingPreconditionerFactory());
+    lows_factory->setPreconditionerFactory(prec_factory, "Counting");
+    const LinearSolvers::JacobianFreeLOWSFactory jfnk_factory(lows_factory);
+
+    auto jfnk_op = Teuchos::rcp(new LinearSolvers::JacobianFreeOperator(
+        model, model->create_W_op(), 1.0e-6));
+    auto f = Thyra::createMember(model->get_f_space());
+    auto out_args = model->createOutArgs();
+    out_args.set_f(f);
+    out_args.set_W_op(jfnk_op->preconditionerOp());
+    model->evalModel(in_args, out_args);
+    jfnk_op->setBase(in_args, *f);
+    jfnk_op->preconditionerOpUpdated();
+
+    const auto fwd_op_src = Thyra::defaultLinearOpSource<double>(jfnk_op);
+    EXPECT_TRUE(jfnk_factory.isCompatible(*fwd_op_src));
+
+    auto lows = jfnk_factory.createOp();
+    jfnk_factory.initializeOp(fwd_op_src, lows.get());
+    EXPECT_EQ(1, prec_factory->num_initialize);
+
+    // Same Jacobian.
+    jfnk_factory.initializeOp(fwd_op_src, lows.get());
+    EXPECT_EQ(1, prec_factory->num_initialize);
+
+    // Updated Jacobian.
+    jfnk_op->preconditionerOpUpdated();
+    jfnk_factory.initializeOp(fwd_op_src, lows.get());
+    EXPECT_EQ(2, prec_factory->num_initialize);
+    jfnk_factory.initializeOp(fwd_op_src, lows.get());
+    EXPECT_EQ(2, prec_factory->num_initialize);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
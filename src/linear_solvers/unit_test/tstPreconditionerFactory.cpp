@@ -20,6 +20,9 @@ class PreconditionerFactoryTester : public SolverTester
 };
 
 //---------------------------------------------------------------------------//
+// The build test uses the default local solver, which is the Cusolver GLU
+// direct solver only on CUDA builds.
+#ifdef __CUDACC__
 TEST_F(PreconditionerFactoryTester, build_test)
 {
     using panzer::GlobalOrdinal;
@@ -74,6 +77,67 @@ TEST_F(PreconditionerFactoryTester, build_test)
         EXPECT_NEAR(_ref_soln[local_row], y_data[local_row], tol);
     }
 }
+#endif
+
+//---------------------------------------------------------------------------//
+// The block ILU does not use a local solver and runs on all device types.
+TEST_F(PreconditionerFactoryTester, block_ilu_test)
+{
+    using panzer::GlobalOrdinal;
+    using panzer::TpetraNodeType;
+
+    // Wrap matrix into Thyra operator
+    auto thyra_op
+        = Thyra::createLinearOp<double, int, GlobalOrdinal, TpetraNodeType>(
+            _matrix);
+    auto thyra_op_src
+        = Teuchos::rcp(new Thyra::DefaultLinearOpSource<double>(thyra_op));
+
+    // Create factory for a block ILU with enough fill to be exact
+    VertexCFD::LinearSolvers::PreconditionerFactory factory;
+    auto params = Teuchos::rcp(new Teuchos::ParameterList());
+    params->set("Block Preconditioner", "Block ILU");
+    params->set("Block Size", 2);
+    params->set("Block ILU Fill Level", 100);
+    factory.setParameterList(params);
+
+    auto prec = factory.createPrec();
+    factory.initializePrec(thyra_op_src, prec.get());
+
+    auto thyra_tpetra_prec = Teuchos::rcp_dynamic_cast<
+        const Thyra::TpetraLinearOp<double, int, GlobalOrdinal, TpetraNodeType>>(
+        prec->getUnspecifiedPrecOp());
+    EXPECT_TRUE(thyra_tpetra_prec != Teuchos::null);
+    auto tpetra_prec = thyra_tpetra_prec->getConstTpetraOperator();
+
+    tpetra_prec->apply(*_x, *_y, Teuchos::NO_TRANS, 1.0, 0.0);
+    {
+        auto y_data = _y->getData(0);
+        int num_local_rows = y_data.size();
+        double tol = 1e-12;
+        for (int local_row = 0; local_row < num_local_rows; ++local_row)
+        {
+            EXPECT_NEAR(_ref_soln[local_row], y_data[local_row], tol);
+        }
+    }
+
+    // Update the matrix values and recompute
+    _matrix->resumeFill();
+    _matrix->scale(2.0);
+    _matrix->fillComplete();
+    factory.initializePrec(thyra_op_src, prec.get());
+
+    tpetra_prec->apply(*_x, *_y, Teuchos::NO_TRANS, 1.0, 0.0);
+    {
+        auto y_data = _y->getData(0);
+        int num_local_rows = y_data.size();
+        double tol = 1e-12;
+        for (int local_row = 0; local_row < num_local_rows; ++local_row)
+        {
+            EXPECT_NEAR(0.5 * _ref_soln[local_row], y_data[local_row], tol);
+        }
+    }
+}
 
 //---------------------------------------------------------------------------//
 
@@ -0,0 +1,109 @@
+#include <VertexCFD_EvaluatorTestHarness.hpp>
+#include <VertexCFD_SolverTester.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_LocalSolverFactory.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_Preconditioner.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_SuperLU.hpp>
+
+#include <Teuchos_DefaultMpiComm.hpp>
+#include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Map.hpp>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+class SuperLUTester : public SolverTester
+{
+  protected:
+    // Apply the preconditioner to a vector of ones and compare with a
+    // multiple of the reference solution.
+    void checkSolution(VertexCFD::LinearSolvers::Preconditioner& prec,
+                       const std::vector<double>& ref_soln,
+                       const double scale)
+    {
+        _x->putScalar(1.0);
+        _y->putScalar(2.0);
+        prec.apply(*_x, *_y, Teuchos::NO_TRANS, 1.0, 0.0);
+
+        auto y_data = _y->getData(0);
+        int num_local_rows = y_data.size();
+        double tol = 1e-12;
+        for (int local_row = 0; local_row < num_local_rows; ++local_row)
+        {
+            EXPECT_NEAR(scale * ref_soln[local_row], y_data[local_row], tol);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(SuperLUTester, build_test)
+{
+    Teuchos::ParameterList params;
+    params.set("Local Solver", "SuperLU");
+    auto solver
+        = VertexCFD::LinearSolvers::LocalSolverFactory::buildSolver(params);
+    auto superlu
+        = std::dynamic_pointer_cast<VertexCFD::LinearSolvers::SuperLUSolver>(
+            solver);
+    EXPECT_TRUE(superlu != nullptr);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(SuperLUTester, solve_test)
+{
+    Teuchos::ParameterList params;
+    params.set("Local Solver", "SuperLU");
+    VertexCFD::LinearSolvers::Preconditioner prec;
+    prec.setParameters(params);
+    prec.setMatrix(_matrix);
+    prec.initialize();
+    prec.compute();
+    checkSolution(prec, _ref_soln, 1.0);
+
+    // Refactor with new values in the same matrix.
+    _matrix->resumeFill();
+    _matrix->scale(2.0);
+    _matrix->fillComplete();
+    prec.setMatrix(_matrix);
+    prec.initialize();
+    prec.compute();
+    checkSolution(prec, _ref_soln, 0.5);
+
+    // Refactor with a new matrix object with the same sparsity pattern, as
+    // passed by Ifpack2 on every setup.
+    auto same_pattern
+        = Teuchos::rcp(new Tpetra::CrsMatrix<>(*_matrix, Teuchos::Copy));
+    same_pattern->resumeFill();
+    same_pattern->scale(0.25);
+    same_pattern->fillComplete();
+    prec.setMatrix(same_pattern);
+    prec.initialize();
+    prec.compute();
+    checkSolution(prec, _ref_soln, 2.0);
+
+    // Refactor with a new sparsity pattern.
+    auto diagonal = Teuchos::rcp(new Tpetra::CrsMatrix<>(_map, 1));
+    const int num_local_rows = _ref_soln.size();
+    for (int local_row = 0; local_row < num_local_rows; ++local_row)
+    {
+        const auto global_row = _map->getGlobalElement(local_row);
+        diagonal->insertGlobalValues(global_row,
+                                     Teuchos::tuple(global_row),
+                                     Teuchos::tuple(4.0));
+    }
+    diagonal->fillComplete();
+    prec.setMatrix(diagonal);
+    prec.initialize();
+    prec.compute();
+    checkSolution(prec, std::vector<double>(num_local_rows, 1.0), 0.25);
+    EXPECT_EQ(4, prec.getNumCompute());
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
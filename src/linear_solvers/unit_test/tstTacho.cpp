@@ -0,0 +1,88 @@
+#include <VertexCFD_EvaluatorTestHarness.hpp>
+#include <VertexCFD_SolverTester.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_LocalSolverFactory.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_Preconditioner.hpp>
+#include <linear_solvers/VertexCFD_LinearSolvers_Tacho.hpp>
+
+#include <Teuchos_DefaultMpiComm.hpp>
+#include <Tpetra_CrsMatrix.hpp>
+#include <Tpetra_Map.hpp>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+class TachoTester : public SolverTester
+{
+};
+
+//---------------------------------------------------------------------------//
+TEST_F(TachoTester, build_test)
+{
+    Teuchos::ParameterList params;
+    params.set("Local Solver", "Tacho");
+    auto solver
+        = VertexCFD::LinearSolvers::LocalSolverFactory::buildSolver(params);
+    auto tacho
+        = std::dynamic_pointer_cast<VertexCFD::LinearSolvers::TachoSolver>(
+            solver);
+    EXPECT_TRUE(tacho != nullptr);
+}
+
+//---------------------------------------------------------------------------//
+TEST_F(TachoTester, solve_test)
+{
+    Teuchos::ParameterList params;
+    params.set("Local Solver", "Tacho");
+    VertexCFD::LinearSolvers::Preconditioner prec;
+    prec.setParameters(params);
+    prec.setMatrix(_matrix);
+    prec.initialize();
+    prec.compute();
+
+    _x->putScalar(1.0);
+    _y->putScalar(2.0);
+    prec.apply(*_x, *_y, Teuchos::NO_TRANS, 1.0, 0.0);
+
+    {
+        auto y_data = _y->getData(0);
+        int num_local_rows = y_data.size();
+        double tol = 1e-14;
+        for (int local_row = 0; local_row < num_local_rows; ++local_row)
+        {
+            EXPECT_NEAR(_ref_soln[local_row], y_data[local_row], tol);
+        }
+    }
+
+    // Refactor with new values on the same sparsity pattern.
+    _matrix->resumeFill();
+    _matrix->scale(2.0);
+    _matrix->fillComplete();
+    prec.setMatrix(_matrix);
+    prec.initialize();
+    prec.compute();
+
+    _x->putScalar(1.0);
+    _y->putScalar(2.0);
+    prec.apply(*_x, *_y, Teuchos::NO_TRANS, 1.0, 0.0);
+    EXPECT_EQ(2, prec.getNumCompute());
+
+    {
+        auto y_data = _y->getData(0);
+        int num_local_rows = y_data.size();
+        double tol = 1e-14;
+        for (int local_row = 0; local_row < num_local_rows; ++local_row)
+        {
+            EXPECT_NEAR(0.5 * _ref_soln[local_row], y_data[local_row], tol);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
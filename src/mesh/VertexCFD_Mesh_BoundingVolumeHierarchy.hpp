@@ -0,0 +1,366 @@
+#ifndef VERTEXCFD_MESH_BOUNDINGVOLUMEHIERARCHY_HPP
+#define VERTEXCFD_MESH_BOUNDINGVOLUMEHIERARCHY_HPP
+
+#include <Phalanx_KokkosDeviceTypes.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+namespace Topology
+{
+//---------------------------------------------------------------------------//
+// Bounding volume hierarchy over a set of sides given as coordinates
+// (side,node,dim). The tree is built on the host by recursively splitting the
+// sides at the median centroid along the longest axis and is then copied to
+// the given memory space. Nearest-side queries traverse the tree closest
+// child first and prune every subtree whose bounding box lies farther away
+// than the current minimum distance. Containment queries visit the sides
+// whose bounding box contains a point.
+//---------------------------------------------------------------------------//
+template<class MemorySpace = PHX::mem_space>
+class BoundingVolumeHierarchy
+{
+  public:
+    // Maximum number of sides stored in a leaf node.
+    static constexpr int max_leaf_size = 4;
+
+    // Size of the traversal stack. Median splits bound the tree depth by
+    // log2(num_side) so this is never reached in practice.
+    static constexpr int max_depth = 64;
+
+    BoundingVolumeHierarchy() = default;
+
+    template<class SideView>
+    BoundingVolumeHierarchy(const SideView& sides, const int num_space_dim)
+    {
+        auto sides_host
+            = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sides);
+        const int num_side = sides_host.extent(0);
+        const int nodes_per_side = sides_host.extent(1);
+
+        // Compute the bounding box and centroid of each side. Unused
+        // dimensions are left at zero so 2D sides can be queried with 3D
+        // points.
+        std::vector<std::array<double, 3>> side_lower(num_side, {0, 0, 0});
+        std::vector<std::array<double, 3>> side_upper(num_side, {0, 0, 0});
+        std::vector<std::array<double, 3>> centroid(num_side, {0, 0, 0});
+        double scene_size = 1.0;
+        for (int s = 0; s < num_side; ++s)
+        {
+            for (int dim = 0; dim < num_space_dim; ++dim)
+            {
+                side_lower[s][dim] = sides_host(s, 0, dim);
+                side_upper[s][dim] = sides_host(s, 0, dim);
+                for (int n = 1; n < nodes_per_side; ++n)
+                {
+                    side_lower[s][dim]
+                        = std::min(side_lower[s][dim], sides_host(s, n, dim));
+                    side_upper[s][dim]
+                        = std::max(side_upper[s][dim], sides_host(s, n, dim));
+                }
+                centroid[s][dim]
+                    = 0.5 * (side_lower[s][dim] + side_upper[s][dim]);
+                scene_size = std::max(scene_size,
+                                      std::abs(side_lower[s][dim]));
+                scene_size = std::max(scene_size,
+                                      std::abs(side_upper[s][dim]));
+            }
+        }
+
+        // Pad the side boxes so that round-off in the distance primitives
+        // can never cause a side at exactly the box distance to be pruned.
+        const double pad = 1.0e-10 * scene_size;
+        for (int s = 0; s < num_side; ++s)
+        {
+            for (int dim = 0; dim < num_space_dim; ++dim)
+            {
+                side_lower[s][dim] -= pad;
+                side_upper[s][dim] += pad;
+            }
+        }
+
+        // Build the tree breadth-first from an explicit work list.
+        std::vector<int> side_ids(num_side);
+        std::iota(side_ids.begin(), side_ids.end(), 0);
+
+        std::vector<std::array<double, 3>> lower;
+        std::vector<std::array<double, 3>> upper;
+        std::vector<int> left;
+        std::vector<int> right;
+        std::vector<int> begin;
+        std::vector<int> end;
+        std::vector<int> depth;
+
+        auto add_node = [&](const int b, const int e, const int d) {
+            lower.push_back({0, 0, 0});
+            upper.push_back({0, 0, 0});
+            left.push_back(-1);
+            right.push_back(-1);
+            begin.push_back(b);
+            end.push_back(e);
+            depth.push_back(d);
+            return static_cast<int>(left.size()) - 1;
+        };
+
+        if (num_side > 0)
+            add_node(0, num_side, 1);
+
+        for (std::size_t node = 0; node < left.size(); ++node)
+        {
+            const int b = begin[node];
+            const int e = end[node];
+
+            // Node bounding box and centroid bounding box.
+            std::array<double, 3> c_lower = centroid[side_ids[b]];
+            std::array<double, 3> c_upper = centroid[side_ids[b]];
+            lower[node] = side_lower[side_ids[b]];
+            upper[node] = side_upper[side_ids[b]];
+            for (int i = b + 1; i < e; ++i)
+            {
+                const int s = side_ids[i];
+                for (int dim = 0; dim < num_space_dim; ++dim)
+                {
+                    lower[node][dim]
+                        = std::min(lower[node][dim], side_lower[s][dim]);
+                    upper[node][dim]
+                        = std::max(upper[node][dim], side_upper[s][dim]);
+                    c_lower[dim] = std::min(c_lower[dim], centroid[s][dim]);
+                    c_upper[dim] = std::max(c_upper[dim], centroid[s][dim]);
+                }
+            }
+
+            if (e - b <= max_leaf_size)
+                continue;
+
+            if (depth[node] >= max_depth)
+            {
+                throw std::runtime_error(
+                    "Bounding volume hierarchy exceeds maximum depth");
+            }
+
+            // Split at the median centroid along the longest axis.
+            int axis = 0;
+            for (int dim = 1; dim < num_space_dim; ++dim)
+            {
+                if (c_upper[dim] - c_lower[dim]
+                    > c_upper[axis] - c_lower[axis])
+                {
+                    axis = dim;
+                }
+            }
+            const int mid = b + (e - b) / 2;
+            std::nth_element(side_ids.begin() + b,
+                             side_ids.begin() + mid,
+                             side_ids.begin() + e,
+                             [&](const int s1, const int s2) {
+                                 return centroid[s1][axis]
+                                        < centroid[s2][axis];
+                             });
+
+            const int l = add_node(b, mid, depth[node] + 1);
+            const int r = add_node(mid, e, depth[node] + 1);
+            left[node] = l;
+            right[node] = r;
+        }
+
+        // Copy the tree to the device.
+        const int num_node = left.size();
+        _lower = Kokkos::View<double* [3], MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing("bvh lower"), num_node);
+        _upper = Kokkos::View<double* [3], MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing("bvh upper"), num_node);
+        _left = Kokkos::View<int*, MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing("bvh left"), num_node);
+        _right = Kokkos::View<int*, MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing("bvh right"), num_node);
+        _begin = Kokkos::View<int*, MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing("bvh begin"), num_node);
+        _end = Kokkos::View<int*, MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing("bvh end"), num_node);
+        _side_ids = Kokkos::View<int*, MemorySpace>(
+            Kokkos::ViewAllocateWithoutInitializing("bvh side ids"),
+            num_side);
+
+        auto lower_host = Kokkos::create_mirror_view(_lower);
+        auto upper_host = Kokkos::create_mirror_view(_upper);
+        auto left_host = Kokkos::create_mirror_view(_left);
+        auto right_host = Kokkos::create_mirror_view(_right);
+        auto begin_host = Kokkos::create_mirror_view(_begin);
+        auto end_host = Kokkos::create_mirror_view(_end);
+        auto side_ids_host = Kokkos::create_mirror_view(_side_ids);
+        for (int node = 0; node < num_node; ++node)
+        {
+            for (int dim = 0; dim < 3; ++dim)
+            {
+                lower_host(node, dim) = lower[node][dim];
+                upper_host(node, dim) = upper[node][dim];
+            }
+            left_host(node) = left[node];
+            right_host(node) = right[node];
+            begin_host(node) = begin[node];
+            end_host(node) = end[node];
+        }
+        for (int i = 0; i < num_side; ++i)
+            side_ids_host(i) = side_ids[i];
+
+        Kokkos::deep_copy(_lower, lower_host);
+        Kokkos::deep_copy(_upper, upper_host);
+        Kokkos::deep_copy(_left, left_host);
+        Kokkos::deep_copy(_right, right_host);
+        Kokkos::deep_copy(_begin, begin_host);
+        Kokkos::deep_copy(_end, end_host);
+        Kokkos::deep_copy(_side_ids, side_ids_host);
+    }
+
+    // Number of nodes in the tree.
+    KOKKOS_INLINE_FUNCTION
+    int numNodes() const { return _left.extent(0); }
+
+    // Distance from a point to the bounding box of a tree node. Zero if the
+    // point lies inside the box.
+    KOKKOS_INLINE_FUNCTION
+    double boxDistance(const int node, const double p[3]) const
+    {
+        double distance = 0.0;
+        for (int dim = 0; dim < 3; ++dim)
+        {
+            double d = 0.0;
+            if (p[dim] < _lower(node, dim))
+                d = _lower(node, dim) - p[dim];
+            else if (p[dim] > _upper(node, dim))
+                d = p[dim] - _upper(node, dim);
+            distance += d * d;
+        }
+        return Kokkos::sqrt(distance);
+    }
+
+    // Minimum distance from a point to the sides in the tree. The functor
+    // returns the distance from the point to a given side and is only called
+    // for sides whose bounding box is closer than the current minimum. The
+    // initial value of the minimum is given by max_distance.
+    template<class SideDistance>
+    KOKKOS_INLINE_FUNCTION double nearest(const double p[3],
+                                          const SideDistance& side_distance,
+                                          double max_distance) const
+    {
+        if (numNodes() == 0)
+            return max_distance;
+
+        int stack[max_depth + 1];
+        int top = 0;
+        stack[top++] = 0;
+
+        while (top > 0)
+        {
+            const int node = stack[--top];
+            if (boxDistance(node, p) >= max_distance)
+                continue;
+
+            if (_left(node) < 0)
+            {
+                for (int i = _begin(node); i < _end(node); ++i)
+                {
+                    const double d = side_distance(_side_ids(i));
+                    if (d < max_distance)
+                        max_distance = d;
+                }
+            }
+            else
+            {
+                // Push the farther child first so the closer one is visited
+                // next and tightens the minimum as early as possible.
+                int near_child = _left(node);
+                int far_child = _right(node);
+                double near_d = boxDistance(near_child, p);
+                double far_d = boxDistance(far_child, p);
+                if (far_d < near_d)
+                {
+                    const int swap_child = near_child;
+                    near_child = far_child;
+                    far_child = swap_child;
+                    const double swap_d = near_d;
+                    near_d = far_d;
+                    far_d = swap_d;
+                }
+                if (far_d < max_distance)
+                    stack[top++] = far_child;
+                if (near_d < max_distance)
+                    stack[top++] = near_child;
+            }
+        }
+
+        return max_distance;
+    }
+
+    // Call the functor for each side whose bounding box contains the point
+    // until it returns true. Returns whether the functor returned true.
+    template<class SideVisitor>
+    KOKKOS_INLINE_FUNCTION bool visitContaining(const double p[3],
+                                                const SideVisitor& visit) const
+    {
+        if (numNodes() == 0)
+            return false;
+
+        int stack[max_depth + 1];
+        int top = 0;
+        stack[top++] = 0;
+
+        while (top > 0)
+        {
+            const int node = stack[--top];
+            if (boxDistance(node, p) > 0.0)
+                continue;
+
+            if (_left(node) < 0)
+            {
+                for (int i = _begin(node); i < _end(node); ++i)
+                {
+                    if (visit(_side_ids(i)))
+                        return true;
+                }
+            }
+            else
+            {
+                stack[top++] = _right(node);
+                stack[top++] = _left(node);
+            }
+        }
+
+        return false;
+    }
+
+  private:
+    // Node bounding boxes.
+    Kokkos::View<double* [3], MemorySpace> _lower;
+    Kokkos::View<double* [3], MemorySpace> _upper;
+
+    // Child node indices. Leaves have no children and store negative
+    // indices.
+    Kokkos::View<int*, MemorySpace> _left;
+    Kokkos::View<int*, MemorySpace> _right;
+
+    // Range of each node in the side id permutation.
+    Kokkos::View<int*, MemorySpace> _begin;
+    Kokkos::View<int*, MemorySpace> _end;
+
+    // Side ids ordered so that each node covers a contiguous range.
+    Kokkos::View<int*, MemorySpace> _side_ids;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Topology
+} // end namespace Mesh
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_MESH_BOUNDINGVOLUMEHIERARCHY_HPP
@@ -0,0 +1,518 @@
+#include "VertexCFD_Mesh_EikonalWallDistance.hpp"
+
+#include <Shards_CellTopology.hpp>
+
+#include <Teuchos_DefaultMpiComm.hpp>
+
+#include <stk_mesh/base/BulkData.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+namespace Topology
+{
+namespace Impl
+{
+//---------------------------------------------------------------------------//
+// Maximum number of edge neighbors of a vertex within one element.
+constexpr int max_neighbor = 3;
+
+// Distance of nodes that have not been reached by the front yet.
+constexpr double far_distance = 1.0e300;
+
+//---------------------------------------------------------------------------//
+// Distance at a vertex computed from the simplex formed with k of its
+// neighbors. With the edge vectors e_i = x_i - x and the Gram matrix
+// G = E E^T the distance solves (d - d_i)^T G^{-1} (d - d_i) = 1. The update
+// is only valid if the characteristic enters through the simplex, which
+// requires G^{-1} (d - d_i) >= 0.
+KOKKOS_INLINE_FUNCTION
+double simplexUpdate(const double e[max_neighbor][3],
+                     const double d[max_neighbor],
+                     const int k)
+{
+    double g[max_neighbor][max_neighbor];
+    double scale = 0.0;
+    for (int i = 0; i < k; ++i)
+    {
+        for (int j = 0; j < k; ++j)
+        {
+            g[i][j] = e[i][0] * e[j][0] + e[i][1] * e[j][1]
+                      + e[i][2] * e[j][2];
+        }
+        scale = Kokkos::fmax(scale, g[i][i]);
+    }
+
+    // Solve G a = 1 and G b = d. G is symmetric positive definite for
+    // non-degenerate simplices so no pivoting is needed.
+    double a[max_neighbor];
+    double b[max_neighbor];
+    for (int i = 0; i < k; ++i)
+    {
+        a[i] = 1.0;
+        b[i] = d[i];
+    }
+    for (int col = 0; col < k; ++col)
+    {
+        if (!(g[col][col] > 1.0e-14 * scale))
+            return far_distance;
+        for (int row = col + 1; row < k; ++row)
+        {
+            const double f = g[row][col] / g[col][col];
+            for (int j = col; j < k; ++j)
+                g[row][j] -= f * g[col][j];
+            a[row] -= f * a[col];
+            b[row] -= f * b[col];
+        }
+    }
+    for (int row = k - 1; row >= 0; --row)
+    {
+        for (int j = row + 1; j < k; ++j)
+        {
+            a[row] -= g[row][j] * a[j];
+            b[row] -= g[row][j] * b[j];
+        }
+        a[row] /= g[row][row];
+        b[row] /= g[row][row];
+    }
+
+    // Take the larger root of A d^2 - 2 B d + C = 0.
+    double qa = 0.0;
+    double qb = 0.0;
+    double qc = -1.0;
+    for (int i = 0; i < k; ++i)
+    {
+        qa += a[i];
+        qb += b[i];
+        qc += d[i] * b[i];
+    }
+    const double disc = qb * qb - qa * qc;
+    if (disc < 0.0)
+        return far_distance;
+    const double distance = (qb + Kokkos::sqrt(disc)) / qa;
+
+    // Check causality.
+    for (int i = 0; i < k; ++i)
+    {
+        const double lambda = distance * a[i] - b[i];
+        const double lambda_scale
+            = Kokkos::fabs(distance * a[i]) + Kokkos::fabs(b[i]);
+        if (lambda < -1.0e-12 * lambda_scale)
+            return far_distance;
+    }
+
+    return distance;
+}
+
+//---------------------------------------------------------------------------//
+// Relax all element vertices once and return the number of decreased node
+// distances.
+int relax(const Kokkos::View<int**, PHX::Device>& elem_nodes,
+          const Kokkos::View<int**, PHX::Device>& neighbors,
+          const Kokkos::View<int*, PHX::Device>& num_neighbors,
+          const Kokkos::View<double* [3], PHX::Device>& coords,
+          const Kokkos::View<double*, PHX::Device>& distance,
+          const double tolerance)
+{
+    const int vertices_per_elem = elem_nodes.extent(1);
+    int num_changed = 0;
+    Kokkos::parallel_reduce(
+        "VertexCFD::EikonalWallDistance::relax",
+        Kokkos::RangePolicy<PHX::exec_space>(0, elem_nodes.extent(0)),
+        KOKKOS_LAMBDA(const int elem, int& changed) {
+            for (int v = 0; v < vertices_per_elem; ++v)
+            {
+                const int node = elem_nodes(elem, v);
+                const int num_n = num_neighbors(v);
+
+                double e[max_neighbor][3];
+                double d[max_neighbor];
+                for (int i = 0; i < num_n; ++i)
+                {
+                    const int neighbor = elem_nodes(elem, neighbors(v, i));
+                    for (int dim = 0; dim < 3; ++dim)
+                        e[i][dim] = coords(neighbor, dim) - coords(node, dim);
+                    d[i] = distance(neighbor);
+                }
+
+                // Take the smallest update over the edges, faces and the
+                // full simplex formed with the reached neighbors.
+                double best = far_distance;
+                for (int mask = 1; mask < (1 << num_n); ++mask)
+                {
+                    double es[max_neighbor][3];
+                    double ds[max_neighbor];
+                    int k = 0;
+                    bool reached = true;
+                    for (int i = 0; i < num_n; ++i)
+                    {
+                        if (mask & (1 << i))
+                        {
+                            reached = reached && d[i] < far_distance;
+                            for (int dim = 0; dim < 3; ++dim)
+                                es[k][dim] = e[i][dim];
+                            ds[k] = d[i];
+                            ++k;
+                        }
+                    }
+                    if (reached)
+                        best = Kokkos::fmin(best, simplexUpdate(es, ds, k));
+                }
+
+                if (best < (1.0 - tolerance) * distance(node))
+                {
+                    Kokkos::atomic_min(&distance(node), best);
+                    ++changed;
+                }
+            }
+        },
+        num_changed);
+    return num_changed;
+}
+
+//---------------------------------------------------------------------------//
+// Scatter the node distances to the element vertices.
+void fillElementNodeDistance(
+    const Kokkos::View<int**, PHX::Device>& elem_nodes,
+    const Kokkos::View<int*, PHX::Device>& elem_lids,
+    const Kokkos::View<double*, PHX::Device>& distance,
+    const Kokkos::View<double**, PHX::Device>& element_node_distance)
+{
+    const int vertices_per_elem = elem_nodes.extent(1);
+    Kokkos::parallel_for(
+        "VertexCFD::EikonalWallDistance::fill",
+        Kokkos::RangePolicy<PHX::exec_space>(0, elem_nodes.extent(0)),
+        KOKKOS_LAMBDA(const int elem) {
+            for (int v = 0; v < vertices_per_elem; ++v)
+            {
+                element_node_distance(elem_lids(elem), v)
+                    = distance(elem_nodes(elem, v));
+            }
+        });
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Impl
+
+//---------------------------------------------------------------------------//
+EikonalWallDistance::EikonalWallDistance(
+    const Teuchos::RCP<panzer_stk::STK_Interface>& mesh,
+    const std::vector<std::string>& walls,
+    const double tolerance,
+    const int max_iterations)
+    : _num_iterations(0)
+{
+    auto comm = mesh->getComm();
+    MPI_Comm mpi_comm = Teuchos::getRawMpiComm(*comm);
+    auto bulk = mesh->getBulkData();
+
+    // All element blocks must share a topology.
+    std::vector<std::string> e_block_names;
+    mesh->getElementBlockNames(e_block_names);
+    const auto topology = mesh->getCellTopology(e_block_names[0]);
+    for (const auto& block : e_block_names)
+    {
+        if (mesh->getCellTopology(block)->getKey() != topology->getKey())
+        {
+            throw std::runtime_error(
+                "Eikonal wall distance requires a single element topology");
+        }
+    }
+    const int num_space_dim = topology->getDimension();
+    const int vertices_per_elem = topology->getVertexCount();
+
+    // Build the vertex neighbor table from the element edges.
+    Kokkos::View<int**, PHX::Device> neighbors(
+        "neighbors", vertices_per_elem, Impl::max_neighbor);
+    Kokkos::View<int*, PHX::Device> num_neighbors("num_neighbors",
+                                                  vertices_per_elem);
+    auto neighbors_host = Kokkos::create_mirror_view(neighbors);
+    auto num_neighbors_host = Kokkos::create_mirror_view(num_neighbors);
+    auto add_neighbor = [&](const int vertex, const int neighbor) {
+        if (num_neighbors_host(vertex) == Impl::max_neighbor)
+        {
+            throw std::runtime_error(
+                "Eikonal wall distance: unsupported element topology");
+        }
+        neighbors_host(vertex, num_neighbors_host(vertex)++) = neighbor;
+    };
+    for (unsigned edge = 0; edge < topology->getEdgeCount(); ++edge)
+    {
+        const int n0 = topology->getNodeMap(1, edge, 0);
+        const int n1 = topology->getNodeMap(1, edge, 1);
+        add_neighbor(n0, n1);
+        add_neighbor(n1, n0);
+    }
+    Kokkos::deep_copy(neighbors, neighbors_host);
+    Kokkos::deep_copy(num_neighbors, num_neighbors_host);
+
+    // Number the vertices of the locally owned elements.
+    std::vector<stk::mesh::Entity> elements;
+    mesh->getMyElements(elements);
+    const int num_elem = elements.size();
+
+    std::unordered_map<stk::mesh::EntityId, int> node_lids;
+    std::vector<stk::mesh::Entity> nodes;
+    Kokkos::View<int**, PHX::Device> elem_nodes(
+        "elem_nodes", num_elem, vertices_per_elem);
+    Kokkos::View<int*, PHX::Device> elem_lids("elem_lids", num_elem);
+    auto elem_nodes_host = Kokkos::create_mirror_view(elem_nodes);
+    auto elem_lids_host = Kokkos::create_mirror_view(elem_lids);
+    int num_lid = 0;
+    for (int elem = 0; elem < num_elem; ++elem)
+    {
+        const stk::mesh::Entity* elem_entity_nodes
+            = bulk->begin_nodes(elements[elem]);
+        for (int v = 0; v < vertices_per_elem; ++v)
+        {
+            const auto node = elem_entity_nodes[v];
+            const auto inserted
+                = node_lids.emplace(bulk->identifier(node), nodes.size());
+            if (inserted.second)
+                nodes.push_back(node);
+            elem_nodes_host(elem, v) = inserted.first->second;
+        }
+        elem_lids_host(elem) = mesh->elementLocalId(elements[elem]);
+        num_lid = std::max(num_lid, elem_lids_host(elem) + 1);
+    }
+    Kokkos::deep_copy(elem_nodes, elem_nodes_host);
+    Kokkos::deep_copy(elem_lids, elem_lids_host);
+    const int num_node = nodes.size();
+
+    Kokkos::View<double* [3], PHX::Device> coords("coords", num_node);
+    auto coords_host = Kokkos::create_mirror_view(coords);
+    for (int node = 0; node < num_node; ++node)
+    {
+        const double* x = mesh->getNodeCoordinates(nodes[node]);
+        for (int dim = 0; dim < num_space_dim; ++dim)
+            coords_host(node, dim) = x[dim];
+    }
+    Kokkos::deep_copy(coords, coords_host);
+
+    // Initialize the distance to zero on the wall nodes.
+    Kokkos::View<double*, PHX::Device> distance(
+        Kokkos::ViewAllocateWithoutInitializing("distance"), num_node);
+    auto distance_host = Kokkos::create_mirror_view(distance);
+    Kokkos::deep_copy(distance_host, Impl::far_distance);
+
+    std::vector<std::string> sideset_names;
+    mesh->getSidesetNames(sideset_names);
+    for (const auto& wall : walls)
+    {
+        if (std::find(sideset_names.begin(), sideset_names.end(), wall)
+            == sideset_names.end())
+        {
+            continue;
+        }
+        std::vector<stk::mesh::Entity> sides;
+        mesh->getAllSides(wall, sides);
+        for (const auto& side : sides)
+        {
+            const stk::mesh::Entity* side_nodes = bulk->begin_nodes(side);
+            for (unsigned n = 0; n < bulk->num_nodes(side); ++n)
+            {
+                const auto lid
+                    = node_lids.find(bulk->identifier(side_nodes[n]));
+                if (lid != node_lids.end())
+                    distance_host(lid->second) = 0.0;
+            }
+        }
+    }
+    Kokkos::deep_copy(distance, distance_host);
+
+    // Find the nodes shared with each neighbor rank. Both sides order the
+    // shared nodes by global id so only values need to be exchanged.
+    std::map<int, std::vector<std::pair<stk::mesh::EntityId, int>>> shared;
+    std::vector<int> procs;
+    for (int node = 0; node < num_node; ++node)
+    {
+        if (bulk->in_shared(nodes[node]))
+        {
+            bulk->comm_shared_procs(bulk->entity_key(nodes[node]), procs);
+            for (const int p : procs)
+                shared[p].emplace_back(bulk->identifier(nodes[node]), node);
+        }
+    }
+
+    std::vector<int> peers;
+    std::vector<std::vector<std::uint64_t>> send_ids;
+    for (auto& s : shared)
+    {
+        std::sort(s.second.begin(), s.second.end());
+        peers.push_back(s.first);
+        send_ids.emplace_back();
+        for (const auto& id : s.second)
+            send_ids.back().push_back(id.first);
+    }
+    const int num_peer = peers.size();
+
+    std::vector<int> send_counts(num_peer);
+    std::vector<int> receive_counts(num_peer);
+    std::vector<MPI_Request> requests(2 * num_peer);
+    for (int p = 0; p < num_peer; ++p)
+    {
+        send_counts[p] = send_ids[p].size();
+        MPI_Irecv(&receive_counts[p],
+                  1,
+                  MPI_INT,
+                  peers[p],
+                  0,
+                  mpi_comm,
+                  &requests[p]);
+        MPI_Isend(&send_counts[p],
+                  1,
+                  MPI_INT,
+                  peers[p],
+                  0,
+                  mpi_comm,
+                  &requests[num_peer + p]);
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    std::vector<std::vector<std::uint64_t>> receive_ids(num_peer);
+    for (int p = 0; p < num_peer; ++p)
+    {
+        receive_ids[p].resize(receive_counts[p]);
+        MPI_Irecv(receive_ids[p].data(),
+                  receive_counts[p],
+                  MPI_UINT64_T,
+                  peers[p],
+                  1,
+                  mpi_comm,
+                  &requests[p]);
+        MPI_Isend(send_ids[p].data(),
+                  send_counts[p],
+                  MPI_UINT64_T,
+                  peers[p],
+                  1,
+                  mpi_comm,
+                  &requests[num_peer + p]);
+    }
+    MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+    // Keep the nodes known to both ranks.
+    std::vector<std::vector<int>> exchange_nodes(num_peer);
+    for (int p = 0; p < num_peer; ++p)
+    {
+        const auto& own = shared[peers[p]];
+        std::size_t i = 0;
+        std::size_t j = 0;
+        while (i < own.size() && j < receive_ids[p].size())
+        {
+            if (own[i].first < receive_ids[p][j])
+            {
+                ++i;
+            }
+            else if (receive_ids[p][j] < own[i].first)
+            {
+                ++j;
+            }
+            else
+            {
+                exchange_nodes[p].push_back(own[i].second);
+                ++i;
+                ++j;
+            }
+        }
+    }
+
+    // Relax locally until converged, then take the minimum over shared
+    // nodes and repeat until no rank changes. Each round has its own budget
+    // of sweeps.
+    std::vector<std::vector<double>> send_values(num_peer);
+    std::vector<std::vector<double>> receive_values(num_peer);
+    int global_changed = 1;
+    int num_rounds = 0;
+    while (global_changed > 0 && num_rounds < max_iterations)
+    {
+        ++num_rounds;
+        int local_changed = 1;
+        for (int sweep = 0; sweep < max_iterations && local_changed > 0;
+             ++sweep)
+        {
+            ++_num_iterations;
+            local_changed = Impl::relax(elem_nodes,
+                                        neighbors,
+                                        num_neighbors,
+                                        coords,
+                                        distance,
+                                        tolerance);
+        }
+
+        Kokkos::deep_copy(distance_host, distance);
+        for (int p = 0; p < num_peer; ++p)
+        {
+            const int count = exchange_nodes[p].size();
+            send_values[p].resize(count);
+            receive_values[p].resize(count);
+            for (int i = 0; i < count; ++i)
+                send_values[p][i] = distance_host(exchange_nodes[p][i]);
+            MPI_Irecv(receive_values[p].data(),
+                      count,
+                      MPI_DOUBLE,
+                      peers[p],
+                      2,
+                      mpi_comm,
+                      &requests[p]);
+            MPI_Isend(send_values[p].data(),
+                      count,
+                      MPI_DOUBLE,
+                      peers[p],
+                      2,
+                      mpi_comm,
+                      &requests[num_peer + p]);
+        }
+        MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+        // A local relaxation that did not converge also needs another round.
+        local_changed = local_changed > 0 ? 1 : 0;
+        for (int p = 0; p < num_peer; ++p)
+        {
+            for (std::size_t i = 0; i < exchange_nodes[p].size(); ++i)
+            {
+                const int node = exchange_nodes[p][i];
+                if (receive_values[p][i]
+                    < (1.0 - tolerance) * distance_host(node))
+                {
+                    distance_host(node) = receive_values[p][i];
+                    local_changed = 1;
+                }
+            }
+        }
+        Kokkos::deep_copy(distance, distance_host);
+
+        MPI_Allreduce(
+            &local_changed, &global_changed, 1, MPI_INT, MPI_MAX, mpi_comm);
+    }
+
+    if (global_changed > 0)
+    {
+        throw std::runtime_error(
+            "Eikonal wall distance did not converge after "
+            + std::to_string(num_rounds) + " rounds");
+    }
+
+    // Store the distance at the element vertices.
+    _element_node_distance = Kokkos::View<double**, PHX::Device>(
+        "element_node_distance", num_lid, vertices_per_elem);
+    Impl::fillElementNodeDistance(
+        elem_nodes, elem_lids, distance, _element_node_distance);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Topology
+} // end namespace Mesh
+} // end namespace VertexCFD
@@ -0,0 +1,68 @@
+#ifndef VERTEXCFD_MESH_EIKONALWALLDISTANCE_HPP
+#define VERTEXCFD_MESH_EIKONALWALLDISTANCE_HPP
+
+#include <Panzer_STK_Interface.hpp>
+
+#include <Phalanx_KokkosDeviceTypes.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+namespace Topology
+{
+//---------------------------------------------------------------------------//
+// Wall distance at the mesh nodes computed as the solution of the Eikonal
+// equation |grad(d)| = 1 with d = 0 on the wall sidesets. Each element
+// updates its nodes from the simplices formed by a node and its edge
+// neighbors in the element. The updates are relaxed in parallel until no
+// node distance decreases, and nodes shared between ranks are reduced with
+// their neighbors after each local relaxation.
+//
+// Each sweep costs O(N) for N local mesh nodes and is independent of the
+// number of wall sides. A sweep advances the front by at least one element
+// layer, so the number of sweeps grows with the number of elements between
+// the walls and the farthest node, i.e. with the mesh diameter in elements,
+// and the total cost is O(N x sweeps). The front also needs one exchange
+// round per rank boundary it crosses. The number of sweeps is reported by
+// numIterations(). Both the number of sweeps of each round and the number of
+// rounds are limited by max_iterations, and the construction throws if the
+// distance has not converged by then.
+//---------------------------------------------------------------------------//
+class EikonalWallDistance
+{
+  public:
+    EikonalWallDistance(const Teuchos::RCP<panzer_stk::STK_Interface>& mesh,
+                        const std::vector<std::string>& walls,
+                        const double tolerance = 1.0e-12,
+                        const int max_iterations = 100000);
+
+    // Wall distance at the vertices of the locally owned elements given as
+    // (element local id, vertex).
+    Kokkos::View<double**, PHX::Device> elementNodeDistance() const
+    {
+        return _element_node_distance;
+    }
+
+    // Number of local relaxation sweeps performed.
+    int numIterations() const { return _num_iterations; }
+
+  private:
+    Kokkos::View<double**, PHX::Device> _element_node_distance;
+    int _num_iterations;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Topology
+} // end namespace Mesh
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_MESH_EIKONALWALLDISTANCE_HPP
@@ -0,0 +1,842 @@
+#include "VertexCFD_Mesh_FieldInterpolation.hpp"
+#include "VertexCFD_Mesh_BoundingVolumeHierarchy.hpp"
+
+#include <Panzer_DOFManager.hpp>
+#include <Panzer_Intrepid2FieldPattern.hpp>
+
+#include <Intrepid2_CellTools.hpp>
+
+#include <Shards_BasicTopologies.hpp>
+#include <Shards_CellTopology.hpp>
+
+#include <Teuchos_DefaultMpiComm.hpp>
+
+#include <Kokkos_DynRankView.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+bool insideReferenceCell(const shards::CellTopology& topology,
+                         const std::array<double, 3>& xi,
+                         const int num_space_dim,
+                         const double tolerance)
+{
+    const auto key = topology.getBaseKey();
+    if (key == shards::Line<>::key || key == shards::Quadrilateral<>::key
+        || key == shards::Hexahedron<>::key)
+    {
+        for (int dim = 0; dim < num_space_dim; ++dim)
+        {
+            if (std::abs(xi[dim]) > 1.0 + tolerance)
+                return false;
+        }
+        return true;
+    }
+    else if (key == shards::Triangle<>::key
+             || key == shards::Tetrahedron<>::key)
+    {
+        double sum = 0.0;
+        for (int dim = 0; dim < num_space_dim; ++dim)
+        {
+            if (xi[dim] < -tolerance)
+                return false;
+            sum += xi[dim];
+        }
+        return sum <= 1.0 + tolerance;
+    }
+
+    throw std::runtime_error(
+        "Field interpolation does not support element topology "
+        + std::string(topology.getName()));
+}
+
+//---------------------------------------------------------------------------//
+// Closest point of the reference element to the given reference
+// coordinates. Simplices are projected by clipping the negative coordinates
+// and scaling the others down to the diagonal face.
+std::array<double, 3>
+projectToReferenceCell(const shards::CellTopology& topology,
+                       const std::array<double, 3>& xi,
+                       const int num_space_dim)
+{
+    std::array<double, 3> projected = xi;
+    const auto key = topology.getBaseKey();
+    if (key == shards::Triangle<>::key || key == shards::Tetrahedron<>::key)
+    {
+        double sum = 0.0;
+        for (int dim = 0; dim < num_space_dim; ++dim)
+        {
+            projected[dim] = std::max(projected[dim], 0.0);
+            sum += projected[dim];
+        }
+        if (sum > 1.0)
+        {
+            for (int dim = 0; dim < num_space_dim; ++dim)
+                projected[dim] /= sum;
+        }
+    }
+    else
+    {
+        for (int dim = 0; dim < num_space_dim; ++dim)
+            projected[dim] = std::min(std::max(projected[dim], -1.0), 1.0);
+    }
+    return projected;
+}
+
+//---------------------------------------------------------------------------//
+std::vector<int> displacements(const std::vector<int>& counts)
+{
+    std::vector<int> displs(counts.size() + 1, 0);
+    for (std::size_t r = 0; r < counts.size(); ++r)
+        displs[r + 1] = displs[r] + counts[r];
+    return displs;
+}
+
+//---------------------------------------------------------------------------//
+// Send data to all ranks given the number of values sent to and received
+// from each rank.
+template<class T>
+std::vector<T> exchange(MPI_Comm comm,
+                        const std::vector<T>& send_data,
+                        const std::vector<int>& send_counts,
+                        const std::vector<int>& recv_counts,
+                        MPI_Datatype type)
+{
+    const auto send_displs = displacements(send_counts);
+    const auto recv_displs = displacements(recv_counts);
+    std::vector<T> recv_data(recv_displs.back());
+    MPI_Alltoallv(send_data.data(),
+                  send_counts.data(),
+                  send_displs.data(),
+                  type,
+                  recv_data.data(),
+                  recv_counts.data(),
+                  recv_displs.data(),
+                  type,
+                  comm);
+    return recv_data;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+FieldInterpolation::FieldInterpolation(
+    const Teuchos::RCP<const panzer_stk::STK_Interface>& source_mesh,
+    const Teuchos::RCP<const panzer::GlobalIndexer>& source_dof_manager,
+    const std::vector<std::string>& field_names,
+    const Kokkos::View<const double**, Kokkos::HostSpace>& target_points,
+    const std::vector<std::string>& element_blocks,
+    const double reference_tolerance,
+    const bool closest_cell_fallback)
+    : _num_points(target_points.extent(0))
+    , _num_fields(field_names.size())
+{
+    // Get the MPI communicator.
+    auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+        source_dof_manager->getComm());
+    _comm = Teuchos::getRawMpiComm(*comm);
+    int comm_rank;
+    int comm_size;
+    MPI_Comm_rank(_comm, &comm_rank);
+    MPI_Comm_size(_comm, &comm_size);
+
+    // The field patterns are needed to evaluate the basis at the points.
+    auto dof_pattern_manager
+        = Teuchos::rcp_dynamic_cast<const panzer::DOFManager>(
+            source_dof_manager);
+    if (Teuchos::is_null(dof_pattern_manager))
+    {
+        throw std::runtime_error(
+            "Field interpolation requires a panzer::DOFManager");
+    }
+
+    const int num_space_dim = source_mesh->getDimension();
+    if (_num_points > 0
+        && static_cast<int>(target_points.extent(1)) != num_space_dim)
+    {
+        throw std::runtime_error(
+            "Field interpolation target points have "
+            + std::to_string(target_points.extent(1))
+            + " coordinates in a mesh of dimension "
+            + std::to_string(num_space_dim));
+    }
+
+    // Owned elements of the source mesh in each searched block.
+    using vertices_type = Kokkos::DynRankView<double, PHX::Device>;
+    using host_vertices_type
+        = decltype(Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), std::declval<vertices_type>()));
+    std::vector<std::string> blocks = element_blocks;
+    if (blocks.empty())
+        source_mesh->getElementBlockNames(blocks);
+    const int num_blocks = blocks.size();
+    std::vector<std::vector<stk::mesh::Entity>> block_elements(num_blocks);
+    std::vector<host_vertices_type> block_vertices(num_blocks);
+    using bvh_type = Topology::BoundingVolumeHierarchy<Kokkos::HostSpace>;
+    std::vector<bvh_type> block_bvh(num_blocks);
+
+    // Bounding box of the owned elements, stored as the lower corner
+    // followed by the upper corner.
+    std::array<double, 6> box;
+    for (int dim = 0; dim < 3; ++dim)
+    {
+        box[dim] = std::numeric_limits<double>::max();
+        box[dim + 3] = std::numeric_limits<double>::lowest();
+    }
+    for (int b = 0; b < num_blocks; ++b)
+    {
+        source_mesh->getMyElements(blocks[b], block_elements[b]);
+        if (block_elements[b].empty())
+            continue;
+
+        vertices_type vertices;
+        source_mesh->getElementVertices(
+            block_elements[b], blocks[b], vertices);
+        block_vertices[b] = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), vertices);
+        block_bvh[b] = bvh_type(block_vertices[b], num_space_dim);
+
+        const auto& v = block_vertices[b];
+        for (std::size_t e = 0; e < v.extent(0); ++e)
+        {
+            for (std::size_t n = 0; n < v.extent(1); ++n)
+            {
+                for (int dim = 0; dim < num_space_dim; ++dim)
+                {
+                    box[dim] = std::min(box[dim], v(e, n, dim));
+                    box[dim + 3] = std::max(box[dim + 3], v(e, n, dim));
+                }
+            }
+        }
+    }
+    if (box[0] <= box[3])
+    {
+        double scene_size = 1.0;
+        for (int dim = 0; dim < num_space_dim; ++dim)
+        {
+            scene_size = std::max(scene_size, std::abs(box[dim]));
+            scene_size = std::max(scene_size, std::abs(box[dim + 3]));
+        }
+        const double pad = 1.0e-8 * scene_size;
+        for (int dim = 0; dim < 3; ++dim)
+        {
+            box[dim] = dim < num_space_dim ? box[dim] - pad : 0.0;
+            box[dim + 3] = dim < num_space_dim ? box[dim + 3] + pad : 0.0;
+        }
+    }
+    std::vector<double> boxes(6 * comm_size);
+    MPI_Allgather(
+        box.data(), 6, MPI_DOUBLE, boxes.data(), 6, MPI_DOUBLE, _comm);
+
+    // Send the target points in the given per-rank lists to these ranks and
+    // receive the coordinates of the points sent to this rank.
+    auto send_points = [&](const std::vector<std::vector<int>>& points,
+                           std::vector<int>& send_counts,
+                           std::vector<int>& recv_counts) {
+        send_counts.assign(comm_size, 0);
+        std::vector<double> send_coords;
+        for (int r = 0; r < comm_size; ++r)
+        {
+            send_counts[r] = points[r].size();
+            for (const int p : points[r])
+            {
+                for (int dim = 0; dim < 3; ++dim)
+                {
+                    send_coords.push_back(
+                        dim < num_space_dim ? target_points(p, dim) : 0.0);
+                }
+            }
+        }
+        recv_counts.assign(comm_size, 0);
+        MPI_Alltoall(send_counts.data(),
+                     1,
+                     MPI_INT,
+                     recv_counts.data(),
+                     1,
+                     MPI_INT,
+                     _comm);
+
+        std::vector<int> coord_send_counts(comm_size);
+        std::vector<int> coord_recv_counts(comm_size);
+        for (int r = 0; r < comm_size; ++r)
+        {
+            coord_send_counts[r] = 3 * send_counts[r];
+            coord_recv_counts[r] = 3 * recv_counts[r];
+        }
+        return exchange(_comm,
+                        send_coords,
+                        coord_send_counts,
+                        coord_recv_counts,
+                        MPI_DOUBLE);
+    };
+
+    // Map received points to the reference element of the given owned
+    // elements of a block. All pairs of a block are mapped at once.
+    auto map_to_reference = [&](const int b,
+                                const std::vector<double>& coords,
+                                const std::vector<int>& pair_points,
+                                const std::vector<int>& pair_elements) {
+        const int num_pairs = pair_points.size();
+        const auto& vertices = block_vertices[b];
+        const int num_nodes = vertices.extent(1);
+        Kokkos::DynRankView<double, PHX::Device> cell_nodes(
+            "cell_nodes", num_pairs, num_nodes, num_space_dim);
+        Kokkos::DynRankView<double, PHX::Device> phys_points(
+            "phys_points", num_pairs, 1, num_space_dim);
+        Kokkos::DynRankView<double, PHX::Device> ref_points(
+            "ref_points", num_pairs, 1, num_space_dim);
+        auto cell_nodes_host = Kokkos::create_mirror_view(cell_nodes);
+        auto phys_points_host = Kokkos::create_mirror_view(phys_points);
+        for (int k = 0; k < num_pairs; ++k)
+        {
+            for (int dim = 0; dim < num_space_dim; ++dim)
+            {
+                for (int node = 0; node < num_nodes; ++node)
+                {
+                    cell_nodes_host(k, node, dim)
+                        = vertices(pair_elements[k], node, dim);
+                }
+                phys_points_host(k, 0, dim) = coords[3 * pair_points[k] + dim];
+            }
+        }
+        Kokkos::deep_copy(cell_nodes, cell_nodes_host);
+        Kokkos::deep_copy(phys_points, phys_points_host);
+
+        Intrepid2::CellTools<PHX::Device>::mapToReferenceFrame(
+            ref_points,
+            phys_points,
+            cell_nodes,
+            *source_mesh->getCellTopology(blocks[b]));
+        auto ref_points_host = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), ref_points);
+
+        std::vector<std::array<double, 3>> xi(num_pairs, {0.0, 0.0, 0.0});
+        for (int k = 0; k < num_pairs; ++k)
+        {
+            for (int dim = 0; dim < num_space_dim; ++dim)
+                xi[k][dim] = ref_points_host(k, 0, dim);
+        }
+        return xi;
+    };
+
+    // Send each target point to the ranks whose box contains it.
+    std::vector<std::vector<int>> rank_points(comm_size);
+    for (int p = 0; p < _num_points; ++p)
+    {
+        double x[3] = {0.0, 0.0, 0.0};
+        for (int dim = 0; dim < num_space_dim; ++dim)
+            x[dim] = target_points(p, dim);
+        for (int r = 0; r < comm_size; ++r)
+        {
+            bool inside = true;
+            for (int dim = 0; dim < 3; ++dim)
+            {
+                inside = inside && x[dim] >= boxes[6 * r + dim]
+                         && x[dim] <= boxes[6 * r + dim + 3];
+            }
+            if (inside)
+                rank_points[r].push_back(p);
+        }
+    }
+    std::vector<int> point_send_counts;
+    std::vector<int> point_recv_counts;
+    const auto recv_coords
+        = send_points(rank_points, point_send_counts, point_recv_counts);
+    const int num_recv = recv_coords.size() / 3;
+
+    // Locate the received points in the owned elements, accepting points
+    // within the reference coordinate tolerance of an element.
+    std::vector<int> found_block(num_recv, -1);
+    std::vector<int> found_element(num_recv, -1);
+    std::vector<std::array<double, 3>> found_ref_point(num_recv);
+    for (int b = 0; b < num_blocks; ++b)
+    {
+        if (block_elements[b].empty())
+            continue;
+
+        std::vector<int> pair_points;
+        std::vector<int> pair_elements;
+        for (int i = 0; i < num_recv; ++i)
+        {
+            if (found_block[i] >= 0)
+                continue;
+            block_bvh[b].visitContaining(&recv_coords[3 * i], [&](const int e) {
+                pair_points.push_back(i);
+                pair_elements.push_back(e);
+                return false;
+            });
+        }
+        if (pair_points.empty())
+            continue;
+
+        const auto xi = map_to_reference(
+            b, recv_coords, pair_points, pair_elements);
+        const auto topology = source_mesh->getCellTopology(blocks[b]);
+        for (std::size_t k = 0; k < pair_points.size(); ++k)
+        {
+            const int i = pair_points[k];
+            if (found_block[i] < 0
+                && insideReferenceCell(
+                    *topology, xi[k], num_space_dim, reference_tolerance))
+            {
+                found_block[i] = b;
+                found_element[i] = pair_elements[k];
+                found_ref_point[i] = xi[k];
+            }
+        }
+    }
+
+    // Return the search results and assign each point to the lowest rank
+    // that found it.
+    std::vector<int> found(num_recv);
+    for (int i = 0; i < num_recv; ++i)
+        found[i] = found_block[i] >= 0;
+    const auto point_found = exchange(
+        _comm, found, point_recv_counts, point_send_counts, MPI_INT);
+
+    std::vector<int> owner(_num_points, comm_size);
+    for (int r = 0, i = 0; r < comm_size; ++r)
+    {
+        for (const int p : rank_points[r])
+        {
+            if (point_found[i++])
+                owner[p] = std::min(owner[p], r);
+        }
+    }
+    std::vector<int> inside_point(_num_points);
+    for (int p = 0; p < _num_points; ++p)
+        inside_point[p] = owner[p] < comm_size;
+    int num_missing = std::count(owner.begin(), owner.end(), comm_size);
+    MPI_Allreduce(MPI_IN_PLACE, &num_missing, 1, MPI_INT, MPI_SUM, _comm);
+
+    // Points outside of all elements are assigned to the closest element,
+    // where their reference coordinates are projected on the reference
+    // element. The closest element of a rank is at most as far as the
+    // farthest corner of the rank box, so each point is only sent to the
+    // ranks whose box is closer than the nearest of these corners. The
+    // distance to an element is the distance to its bounding box.
+    std::vector<std::vector<int>> closest_rank_points(comm_size);
+    std::vector<int> closest_send_counts(comm_size, 0);
+    std::vector<int> closest_recv_counts(comm_size, 0);
+    std::vector<int> closest_block;
+    std::vector<int> closest_element;
+    std::vector<std::array<double, 3>> closest_ref_point;
+    if (num_missing > 0 && !closest_cell_fallback)
+    {
+        throw std::runtime_error(
+            std::to_string(num_missing)
+            + " field interpolation target points are not inside the source "
+              "mesh");
+    }
+    else if (num_missing > 0)
+    {
+        for (int p = 0; p < _num_points; ++p)
+        {
+            if (inside_point[p])
+                continue;
+
+            std::vector<double> near(comm_size);
+            double far_min = std::numeric_limits<double>::max();
+            for (int r = 0; r < comm_size; ++r)
+            {
+                const double* lower = &boxes[6 * r];
+                const double* upper = &boxes[6 * r + 3];
+                if (lower[0] > upper[0])
+                    continue;
+                double near_squared = 0.0;
+                double far_squared = 0.0;
+                for (int dim = 0; dim < num_space_dim; ++dim)
+                {
+                    const double x = target_points(p, dim);
+                    const double d = std::max(
+                        {lower[dim] - x, x - upper[dim], 0.0});
+                    const double f
+                        = std::max(std::abs(x - lower[dim]),
+                                   std::abs(x - upper[dim]));
+                    near_squared += d * d;
+                    far_squared += f * f;
+                }
+                near[r] = std::sqrt(near_squared);
+                far_min = std::min(far_min, std::sqrt(far_squared));
+            }
+            for (int r = 0; r < comm_size; ++r)
+            {
+                if (boxes[6 * r] <= boxes[6 * r + 3] && near[r] <= far_min)
+                    closest_rank_points[r].push_back(p);
+            }
+        }
+        const auto closest_coords = send_points(
+            closest_rank_points, closest_send_counts, closest_recv_counts);
+        const int num_closest = closest_coords.size() / 3;
+
+        closest_block.assign(num_closest, -1);
+        closest_element.assign(num_closest, -1);
+        closest_ref_point.resize(num_closest);
+        std::vector<double> distance(num_closest,
+                                     std::numeric_limits<double>::max());
+        for (int i = 0; i < num_closest; ++i)
+        {
+            const double* x = &closest_coords[3 * i];
+            for (int b = 0; b < num_blocks; ++b)
+            {
+                const auto& vertices = block_vertices[b];
+                block_bvh[b].nearest(
+                    x,
+                    [&](const int e) {
+                        double d_squared = 0.0;
+                        for (int dim = 0; dim < num_space_dim; ++dim)
+                        {
+                            double lower = vertices(e, 0, dim);
+                            double upper = vertices(e, 0, dim);
+                            for (std::size_t n = 1; n < vertices.extent(1);
+                                 ++n)
+                            {
+                                lower = std::min(lower, vertices(e, n, dim));
+                                upper = std::max(upper, vertices(e, n, dim));
+                            }
+                            const double d = std::max(
+                                {lower - x[dim], x[dim] - upper, 0.0});
+                            d_squared += d * d;
+                        }
+                        const double d = std::sqrt(d_squared);
+                        if (d < distance[i])
+                        {
+                            distance[i] = d;
+                            closest_block[i] = b;
+                            closest_element[i] = e;
+                        }
+                        return d;
+                    },
+                    distance[i]);
+            }
+        }
+
+        for (int b = 0; b < num_blocks; ++b)
+        {
+            std::vector<int> pair_points;
+            std::vector<int> pair_elements;
+            for (int i = 0; i < num_closest; ++i)
+            {
+                if (closest_block[i] == b)
+                {
+                    pair_points.push_back(i);
+                    pair_elements.push_back(closest_element[i]);
+                }
+            }
+            if (pair_points.empty())
+                continue;
+
+            const auto xi = map_to_reference(
+                b, closest_coords, pair_points, pair_elements);
+            const auto topology = source_mesh->getCellTopology(blocks[b]);
+            for (std::size_t k = 0; k < pair_points.size(); ++k)
+            {
+                closest_ref_point[pair_points[k]] = projectToReferenceCell(
+                    *topology, xi[k], num_space_dim);
+            }
+        }
+
+        // Assign each point to the closest rank, or the lowest of the
+        // closest ranks.
+        const auto point_distance = exchange(_comm,
+                                             distance,
+                                             closest_recv_counts,
+                                             closest_send_counts,
+                                             MPI_DOUBLE);
+        std::vector<double> owner_distance(
+            _num_points, std::numeric_limits<double>::max());
+        for (int r = 0, i = 0; r < comm_size; ++r)
+        {
+            for (const int p : closest_rank_points[r])
+            {
+                if (point_distance[i] < owner_distance[p])
+                {
+                    owner_distance[p] = point_distance[i];
+                    owner[p] = r;
+                }
+                ++i;
+            }
+        }
+        num_missing = std::count(owner.begin(), owner.end(), comm_size);
+        MPI_Allreduce(MPI_IN_PLACE, &num_missing, 1, MPI_INT, MPI_SUM, _comm);
+        if (num_missing > 0)
+        {
+            throw std::runtime_error(
+                std::to_string(num_missing)
+                + " field interpolation target points have no closest "
+                  "source element");
+        }
+    }
+
+    // Tell each rank which of its located points it keeps, first the points
+    // inside its elements and then the points assigned to its closest
+    // elements.
+    std::vector<int> accept;
+    std::vector<int> closest_accept;
+    _recv_counts.assign(comm_size, 0);
+    for (int r = 0, i = 0; r < comm_size; ++r)
+    {
+        for (const int p : rank_points[r])
+        {
+            const bool found_here = point_found[i++];
+            accept.push_back(owner[p] == r && found_here);
+            if (accept.back())
+            {
+                _recv_points.push_back(p);
+                _recv_counts[r] += _num_fields;
+            }
+        }
+        for (const int p : closest_rank_points[r])
+        {
+            closest_accept.push_back(owner[p] == r && !inside_point[p]);
+            if (closest_accept.back())
+            {
+                _recv_points.push_back(p);
+                _recv_counts[r] += _num_fields;
+            }
+        }
+    }
+    const auto point_accepted = exchange(
+        _comm, accept, point_send_counts, point_recv_counts, MPI_INT);
+    const auto closest_accepted = exchange(_comm,
+                                           closest_accept,
+                                           closest_send_counts,
+                                           closest_recv_counts,
+                                           MPI_INT);
+
+    // Points located on this rank, in the order of the target ranks.
+    std::vector<int> kept_block;
+    std::vector<int> kept_element;
+    std::vector<std::array<double, 3>> kept_ref_point;
+    _send_counts.assign(comm_size, 0);
+    for (int r = 0, i = 0, j = 0; r < comm_size; ++r)
+    {
+        for (int k = 0; k < point_recv_counts[r]; ++k, ++i)
+        {
+            if (point_accepted[i])
+            {
+                kept_block.push_back(found_block[i]);
+                kept_element.push_back(found_element[i]);
+                kept_ref_point.push_back(found_ref_point[i]);
+                _send_counts[r] += _num_fields;
+            }
+        }
+        for (int k = 0; k < closest_recv_counts[r]; ++k, ++j)
+        {
+            if (closest_accepted[j])
+            {
+                kept_block.push_back(closest_block[j]);
+                kept_element.push_back(closest_element[j]);
+                kept_ref_point.push_back(closest_ref_point[j]);
+                _send_counts[r] += _num_fields;
+            }
+        }
+    }
+    _send_displacements = displacements(_send_counts);
+    _recv_displacements = displacements(_recv_counts);
+
+    // Number of weights of each value.
+    std::vector<int> field_nums(_num_fields);
+    for (int f = 0; f < _num_fields; ++f)
+        field_nums[f] = source_dof_manager->getFieldNum(field_names[f]);
+
+    // The first field missing from the block of a located point is reduced
+    // over all ranks so that every rank throws.
+    const int num_kept = kept_block.size();
+    const int num_rows = num_kept * _num_fields;
+    std::vector<int> offsets(num_rows + 1, 0);
+    int missing_field = _num_fields;
+    for (int k = 0; k < num_kept; ++k)
+    {
+        const auto& block = blocks[kept_block[k]];
+        for (int f = 0; f < _num_fields; ++f)
+        {
+            if (!dof_pattern_manager->fieldInBlock(field_names[f], block))
+            {
+                missing_field = std::min(missing_field, f);
+                continue;
+            }
+            offsets[k * _num_fields + f + 1]
+                = source_dof_manager->getGIDFieldOffsets(block, field_nums[f])
+                      .size();
+        }
+    }
+    MPI_Allreduce(MPI_IN_PLACE, &missing_field, 1, MPI_INT, MPI_MIN, _comm);
+    if (missing_field < _num_fields)
+    {
+        throw std::runtime_error("Interpolated field '"
+                                 + field_names[missing_field]
+                                 + "' is not defined in the element block "
+                                   "containing a target point");
+    }
+    for (int row = 0; row < num_rows; ++row)
+        offsets[row + 1] += offsets[row];
+
+    // Local index of each source degree of freedom in the owned and ghosted
+    // ordering.
+    std::vector<panzer::GlobalOrdinal> ghosted_gids;
+    source_dof_manager->getOwnedAndGhostedIndices(ghosted_gids);
+    std::unordered_map<panzer::GlobalOrdinal, int> global_to_local;
+    for (std::size_t i = 0; i < ghosted_gids.size(); ++i)
+        global_to_local.insert({ghosted_gids[i], i});
+
+    // Evaluate the basis of each field at all points of a block at once.
+    std::vector<int> lids(offsets.back());
+    std::vector<double> weights(offsets.back());
+    std::vector<panzer::GlobalOrdinal> element_gids;
+    for (int b = 0; b < num_blocks; ++b)
+    {
+        std::vector<int> block_points;
+        for (int k = 0; k < num_kept; ++k)
+        {
+            if (kept_block[k] == b)
+                block_points.push_back(k);
+        }
+        const int num_block_points = block_points.size();
+        if (num_block_points == 0)
+            continue;
+
+        Kokkos::DynRankView<double, PHX::Device> ref_points(
+            "ref_points", num_block_points, num_space_dim);
+        auto ref_points_host = Kokkos::create_mirror_view(ref_points);
+        for (int j = 0; j < num_block_points; ++j)
+        {
+            for (int dim = 0; dim < num_space_dim; ++dim)
+            {
+                ref_points_host(j, dim) = kept_ref_point[block_points[j]][dim];
+            }
+        }
+        Kokkos::deep_copy(ref_points, ref_points_host);
+
+        for (int f = 0; f < _num_fields; ++f)
+        {
+            using pattern_type = panzer::Intrepid2FieldPattern;
+            const auto pattern = Teuchos::rcp_dynamic_cast<const pattern_type>(
+                dof_pattern_manager->getFieldPattern(blocks[b],
+                                                     field_names[f]),
+                true);
+            const auto basis = pattern->getIntrepidBasis();
+            Kokkos::DynRankView<double, PHX::Device> basis_values(
+                "basis_values", basis->getCardinality(), num_block_points);
+            basis->getValues(
+                basis_values, ref_points, Intrepid2::OPERATOR_VALUE);
+            auto basis_values_host = Kokkos::create_mirror_view_and_copy(
+                Kokkos::HostSpace(), basis_values);
+
+            const auto& field_offsets = source_dof_manager->getGIDFieldOffsets(
+                blocks[b], field_nums[f]);
+            for (int j = 0; j < num_block_points; ++j)
+            {
+                const int k = block_points[j];
+                const auto element = block_elements[b][kept_element[k]];
+                source_dof_manager->getElementGIDs(
+                    source_mesh->elementLocalId(element),
+                    element_gids,
+                    blocks[b]);
+                const int row = k * _num_fields + f;
+                for (std::size_t n = 0; n < field_offsets.size(); ++n)
+                {
+                    const auto itr
+                        = global_to_local.find(element_gids[field_offsets[n]]);
+                    if (itr == global_to_local.end())
+                    {
+                        throw std::logic_error(
+                            "Field interpolation degree of freedom is not "
+                            "in the ghosted indices");
+                    }
+                    lids[offsets[row] + n] = itr->second;
+                    weights[offsets[row] + n] = basis_values_host(n, j);
+                }
+            }
+        }
+    }
+
+    // Copy the weights to the device.
+    _value_offsets = Kokkos::View<int*, PHX::Device>(
+        "field_interpolation_offsets", offsets.size());
+    _lids = Kokkos::View<int*, PHX::Device>("field_interpolation_lids",
+                                            lids.size());
+    _weights = Kokkos::View<double*, PHX::Device>(
+        "field_interpolation_weights", weights.size());
+    Kokkos::deep_copy(
+        _value_offsets,
+        Kokkos::View<const int*, Kokkos::HostSpace>(offsets.data(),
+                                                    offsets.size()));
+    Kokkos::deep_copy(
+        _lids,
+        Kokkos::View<const int*, Kokkos::HostSpace>(lids.data(), lids.size()));
+    Kokkos::deep_copy(_weights,
+                      Kokkos::View<const double*, Kokkos::HostSpace>(
+                          weights.data(), weights.size()));
+}
+
+//---------------------------------------------------------------------------//
+void FieldInterpolation::interpolate(
+    const Kokkos::View<const double*, PHX::Device>& source_data,
+    const Kokkos::View<double**, PHX::Device>& target_values) const
+{
+    if (static_cast<int>(target_values.extent(0)) != _num_points
+        || static_cast<int>(target_values.extent(1)) != _num_fields)
+    {
+        throw std::logic_error(
+            "Field interpolation target values have the wrong size");
+    }
+
+    // Evaluate the values of the points located on this rank.
+    const int num_rows = _value_offsets.extent(0) - 1;
+    Kokkos::View<double*, PHX::Device> send_values(
+        Kokkos::ViewAllocateWithoutInitializing("send_values"), num_rows);
+    auto offsets = _value_offsets;
+    auto lids = _lids;
+    auto weights = _weights;
+    Kokkos::parallel_for(
+        "VertexCFD::Mesh::FieldInterpolation::interpolate",
+        Kokkos::RangePolicy<PHX::exec_space>(0, num_rows),
+        KOKKOS_LAMBDA(const int row) {
+            double value = 0.0;
+            for (int i = offsets(row); i < offsets(row + 1); ++i)
+                value += weights(i) * source_data(lids(i));
+            send_values(row) = value;
+        });
+    auto send_values_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), send_values);
+
+    // Return the values to the ranks of the target points.
+    std::vector<double> recv_values(_recv_displacements.back());
+    MPI_Alltoallv(send_values_host.data(),
+                  _send_counts.data(),
+                  _send_displacements.data(),
+                  MPI_DOUBLE,
+                  recv_values.data(),
+                  _recv_counts.data(),
+                  _recv_displacements.data(),
+                  MPI_DOUBLE,
+                  _comm);
+
+    auto target_values_host = Kokkos::create_mirror_view(target_values);
+    for (std::size_t k = 0; k < _recv_points.size(); ++k)
+    {
+        for (int f = 0; f < _num_fields; ++f)
+        {
+            target_values_host(_recv_points[k], f)
+                = recv_values[k * _num_fields + f];
+        }
+    }
+    Kokkos::deep_copy(target_values, target_values_host);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Mesh
+} // end namespace VertexCFD
@@ -0,0 +1,99 @@
+#ifndef VERTEXCFD_MESH_FIELDINTERPOLATION_HPP
+#define VERTEXCFD_MESH_FIELDINTERPOLATION_HPP
+
+#include <Panzer_GlobalIndexer.hpp>
+#include <Panzer_STK_Interface.hpp>
+
+#include <Phalanx_KokkosDeviceTypes.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+//---------------------------------------------------------------------------//
+// Interpolation of fields defined on a source mesh at a set of target points
+// given by each rank, where the source and target meshes and their
+// decompositions do not need to match.
+//
+// The target points are located once at construction. Each point is sent to
+// the ranks whose locally owned source elements have a bounding box
+// containing it, where it is located with a bounding volume hierarchy over
+// these elements and mapped to the reference element. A point is inside an
+// element if its reference coordinates are within a tolerance of the
+// reference element. Each point is assigned to the lowest rank that found
+// it, which stores the basis weights of the source degrees of freedom of
+// the element containing the point. Points outside of all elements, such as
+// points beyond a curved or coarser source boundary, can instead be
+// assigned to the closest source element, where their reference
+// coordinates are projected on the reference element.
+//
+// Interpolation evaluates the weighted sums on the device and returns the
+// values to the ranks of the target points with a single exchange, so the
+// source data can be refreshed without locating the points again.
+//---------------------------------------------------------------------------//
+class FieldInterpolation
+{
+  public:
+    // Locate the target points (point,dim) in the given element blocks of
+    // the source mesh, or all element blocks if none are given. Points
+    // outside of all elements use the closest element if the fallback is
+    // enabled. Throws on all ranks if a point is not located or if a field
+    // is not defined in the block containing a point. Collective.
+    FieldInterpolation(
+        const Teuchos::RCP<const panzer_stk::STK_Interface>& source_mesh,
+        const Teuchos::RCP<const panzer::GlobalIndexer>& source_dof_manager,
+        const std::vector<std::string>& field_names,
+        const Kokkos::View<const double**, Kokkos::HostSpace>& target_points,
+        const std::vector<std::string>& element_blocks = {},
+        const double reference_tolerance = 1.0e-8,
+        const bool closest_cell_fallback = true);
+
+    int numPoints() const { return _num_points; }
+    int numFields() const { return _num_fields; }
+
+    // Interpolate the fields at the target points. The source data is stored
+    // in the owned and ghosted ordering of the source DOF manager and the
+    // target values are (point,field). Collective.
+    void interpolate(
+        const Kokkos::View<const double*, PHX::Device>& source_data,
+        const Kokkos::View<double**, PHX::Device>& target_values) const;
+
+  private:
+    MPI_Comm _comm;
+    int _num_points;
+    int _num_fields;
+
+    // Source data local indices and basis weights of the values of the
+    // points located on this rank, in compressed row storage ordered by
+    // (point,field).
+    Kokkos::View<int*, PHX::Device> _value_offsets;
+    Kokkos::View<int*, PHX::Device> _lids;
+    Kokkos::View<double*, PHX::Device> _weights;
+
+    // Number of points located on this rank for each target rank and number
+    // of points of this rank located on each source rank, with their
+    // displacements, in values.
+    std::vector<int> _send_counts;
+    std::vector<int> _send_displacements;
+    std::vector<int> _recv_counts;
+    std::vector<int> _recv_displacements;
+
+    // Target point of each received point.
+    std::vector<int> _recv_points;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Mesh
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_MESH_FIELDINTERPOLATION_HPP
@@ -16,7 +16,9 @@
 
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
 #include <functional>
+#include <limits>
 #include <type_traits>
 #include <vector>
 
@@ -32,9 +34,13 @@ namespace Topology
 class SidesetGeometry
 {
   public:
-    // Constructor
+    // Constructor. By default every wall side is replicated on every
+    // rank. In distributed mode each rank only keeps its own sides and the
+    // sides of the ranks whose wall bounding box may contain the nearest
+    // wall of a locally owned element.
     SidesetGeometry(const Teuchos::RCP<panzer_stk::STK_Interface>& mesh,
-                    std::vector<std::string> walls)
+                    std::vector<std::string> walls,
+                    const bool distributed = false)
     {
         // Get names of sidesets. Return on empty input.
         std::vector<std::string> sideset_block_names;
@@ -90,6 +96,16 @@ class SidesetGeometry
         int nodes_per_side = _topology->getVertexCount(num_space_dim - 1, 0);
         int side_data_count = nodes_per_side * num_space_dim;
 
+        if (distributed)
+        {
+            distributeSides(mesh,
+                            local_sides,
+                            mpi_comm,
+                            nodes_per_side,
+                            num_space_dim);
+            return;
+        }
+
         // Compose gather communication pattern.
         std::vector<int> global_counts(comm->getSize(), 0);
         int receive_counts;
@@ -152,6 +168,252 @@ class SidesetGeometry
     }
 
   private:
+    // Gather the local sides plus the sides of all ranks that may hold the
+    // nearest wall of a locally owned element. Each rank publishes the
+    // bounding box of its wall sides and of its elements. The largest
+    // distance between the local element box and any non-empty wall box is
+    // an upper bound on every local wall distance, so only ranks whose wall
+    // box is closer than this bound need to send their sides.
+    void
+    distributeSides(const Teuchos::RCP<panzer_stk::STK_Interface>& mesh,
+                    const Kokkos::DynRankView<double, PHX::Device>& local_sides,
+                    MPI_Comm mpi_comm,
+                    const int nodes_per_side,
+                    const int num_space_dim)
+    {
+        int comm_rank;
+        int comm_size;
+        MPI_Comm_rank(mpi_comm, &comm_rank);
+        MPI_Comm_size(mpi_comm, &comm_size);
+
+        auto local_sides_host = Kokkos::create_mirror_view(local_sides);
+        Kokkos::deep_copy(local_sides_host, local_sides);
+        const int num_local_side = local_sides_host.extent(0);
+        const int side_data_count = nodes_per_side * num_space_dim;
+
+        // Local box data: wall box (lower, upper), element box (lower,
+        // upper) and the number of local sides. Empty boxes have
+        // lower > upper.
+        const int box_data_count = 4 * num_space_dim + 1;
+        const double max = std::numeric_limits<double>::max();
+        std::vector<double> box_data(box_data_count);
+        for (int dim = 0; dim < num_space_dim; ++dim)
+        {
+            box_data[dim] = max;
+            box_data[num_space_dim + dim] = -max;
+            box_data[2 * num_space_dim + dim] = max;
+            box_data[3 * num_space_dim + dim] = -max;
+        }
+        box_data[4 * num_space_dim] = num_local_side;
+
+        for (int side = 0; side < num_local_side; ++side)
+        {
+            for (int node = 0; node < nodes_per_side; ++node)
+            {
+                for (int dim = 0; dim < num_space_dim; ++dim)
+                {
+                    const double x = local_sides_host(side, node, dim);
+                    box_data[dim] = std::min(box_data[dim], x);
+                    box_data[num_space_dim + dim]
+                        = std::max(box_data[num_space_dim + dim], x);
+                }
+            }
+        }
+
+        std::vector<stk::mesh::Entity> local_elements;
+        mesh->getMyElements(local_elements);
+        Kokkos::DynRankView<double, PHX::Device> local_vertices;
+        mesh->getElementVertices(local_elements, local_vertices);
+        auto local_vertices_host = Kokkos::create_mirror_view(local_vertices);
+        Kokkos::deep_copy(local_vertices_host, local_vertices);
+        for (std::size_t elem = 0; elem < local_vertices_host.extent(0);
+             ++elem)
+        {
+            for (std::size_t node = 0; node < local_vertices_host.extent(1);
+                 ++node)
+            {
+                for (int dim = 0; dim < num_space_dim; ++dim)
+                {
+                    const double x = local_vertices_host(elem, node, dim);
+                    box_data[2 * num_space_dim + dim]
+                        = std::min(box_data[2 * num_space_dim + dim], x);
+                    box_data[3 * num_space_dim + dim]
+                        = std::max(box_data[3 * num_space_dim + dim], x);
+                }
+            }
+        }
+
+        // Exchange the coarse spatial index.
+        std::vector<double> global_box_data(box_data_count * comm_size);
+        MPI_Allgather(box_data.data(),
+                      box_data_count,
+                      MPI_DOUBLE,
+                      global_box_data.data(),
+                      box_data_count,
+                      MPI_DOUBLE,
+                      mpi_comm);
+
+        auto wall_lower = [&](const int rank, const int dim) {
+            return global_box_data[rank * box_data_count + dim];
+        };
+        auto wall_upper = [&](const int rank, const int dim) {
+            return global_box_data[rank * box_data_count + num_space_dim
+                                   + dim];
+        };
+        auto num_side = [&](const int rank) {
+            return static_cast<int>(
+                global_box_data[rank * box_data_count + 4 * num_space_dim]);
+        };
+        const double* elem_lower = box_data.data() + 2 * num_space_dim;
+        const double* elem_upper = box_data.data() + 3 * num_space_dim;
+        const bool has_elements = !local_elements.empty();
+
+        // Smallest and largest distance between the local element box and
+        // the wall box of a given rank.
+        auto min_box_distance = [&](const int rank) {
+            double distance = 0.0;
+            for (int dim = 0; dim < num_space_dim; ++dim)
+            {
+                const double d = std::max(
+                    {0.0,
+                     wall_lower(rank, dim) - elem_upper[dim],
+                     elem_lower[dim] - wall_upper(rank, dim)});
+                distance += d * d;
+            }
+            return std::sqrt(distance);
+        };
+        auto max_box_distance = [&](const int rank) {
+            double distance = 0.0;
+            for (int dim = 0; dim < num_space_dim; ++dim)
+            {
+                const double d
+                    = std::max(wall_upper(rank, dim) - elem_lower[dim],
+                               elem_upper[dim] - wall_lower(rank, dim));
+                distance += d * d;
+            }
+            return std::sqrt(distance);
+        };
+
+        // Find the ranks this rank needs sides from.
+        double bound = max;
+        if (has_elements)
+        {
+            for (int rank = 0; rank < comm_size; ++rank)
+            {
+                if (num_side(rank) > 0)
+                    bound = std::min(bound, max_box_distance(rank));
+            }
+        }
+        std::vector<int> requests(comm_size, 0);
+        for (int rank = 0; rank < comm_size; ++rank)
+        {
+            if (has_elements && rank != comm_rank && num_side(rank) > 0
+                && min_box_distance(rank) <= bound)
+            {
+                requests[rank] = 1;
+            }
+        }
+
+        // Tell each rank whether its sides are needed here.
+        std::vector<int> requested_by(comm_size, 0);
+        MPI_Alltoall(requests.data(),
+                     1,
+                     MPI_INT,
+                     requested_by.data(),
+                     1,
+                     MPI_INT,
+                     mpi_comm);
+
+        // Size the sides with the local sides first, followed by the sides
+        // received from each requested rank in rank order.
+        int total_num_side = num_local_side;
+        std::vector<int> offsets(comm_size, 0);
+        for (int rank = 0; rank < comm_size; ++rank)
+        {
+            if (requests[rank])
+            {
+                offsets[rank] = total_num_side * side_data_count;
+                total_num_side += num_side(rank);
+            }
+        }
+
+        _global_sides = Kokkos::View<double***, PHX::Device>(
+            Kokkos::ViewAllocateWithoutInitializing("Global side Nodes"),
+            total_num_side,
+            nodes_per_side,
+            num_space_dim);
+        auto global_sides_host = Kokkos::create_mirror_view(_global_sides);
+
+        // Copy the local sides to the front of the global sides and pack
+        // them contiguously for sending.
+        std::vector<double> send_buffer(num_local_side * side_data_count);
+        for (int side = 0; side < num_local_side; ++side)
+        {
+            for (int node = 0; node < nodes_per_side; ++node)
+            {
+                for (int dim = 0; dim < num_space_dim; ++dim)
+                {
+                    const double x = local_sides_host(side, node, dim);
+                    global_sides_host(side, node, dim) = x;
+                    send_buffer[(side * nodes_per_side + node) * num_space_dim
+                                + dim]
+                        = x;
+                }
+            }
+        }
+
+        std::vector<double> receive_buffer(
+            (total_num_side - num_local_side) * side_data_count);
+        std::vector<MPI_Request> mpi_requests;
+        for (int rank = 0; rank < comm_size; ++rank)
+        {
+            if (requests[rank])
+            {
+                mpi_requests.emplace_back();
+                MPI_Irecv(receive_buffer.data() + offsets[rank]
+                              - num_local_side * side_data_count,
+                          num_side(rank) * side_data_count,
+                          MPI_DOUBLE,
+                          rank,
+                          0,
+                          mpi_comm,
+                          &mpi_requests.back());
+            }
+        }
+        for (int rank = 0; rank < comm_size; ++rank)
+        {
+            if (requested_by[rank])
+            {
+                mpi_requests.emplace_back();
+                MPI_Isend(send_buffer.data(),
+                          send_buffer.size(),
+                          MPI_DOUBLE,
+                          rank,
+                          0,
+                          mpi_comm,
+                          &mpi_requests.back());
+            }
+        }
+        MPI_Waitall(
+            mpi_requests.size(), mpi_requests.data(), MPI_STATUSES_IGNORE);
+
+        // Unpack the received sides.
+        for (int side = num_local_side; side < total_num_side; ++side)
+        {
+            const int offset = (side - num_local_side) * side_data_count;
+            for (int node = 0; node < nodes_per_side; ++node)
+            {
+                for (int dim = 0; dim < num_space_dim; ++dim)
+                {
+                    global_sides_host(side, node, dim)
+                        = receive_buffer[offset + node * num_space_dim + dim];
+                }
+            }
+        }
+
+        Kokkos::deep_copy(_global_sides, global_sides_host);
+    }
+
     // Side topology.
     Teuchos::RCP<const shards::CellTopology> _topology;
 
@@ -1,4 +1,5 @@
 #include "VertexCFD_Mesh_Restart.hpp"
+#include "VertexCFD_Mesh_RestartCompression.hpp"
 
 #include <Epetra_Vector.h>
 #include <Panzer_NodeType.hpp>
@@ -8,21 +9,76 @@
 #include <Thyra_TpetraVector.hpp>
 #include <Tpetra_MultiVector.hpp>
 
+#include <Teuchos_StandardParameterEntryValidators.hpp>
+
 #include <Phalanx_config.hpp>
 
 #include <mpi.h>
 
 #include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <numeric>
 #include <sstream>
+#include <stdexcept>
 #include <unordered_map>
 
 namespace VertexCFD
 {
 namespace Mesh
 {
+namespace
+{
+// Identifier and version of the compressed restart data file. Raw files
+// start with the time and have no identifier.
+constexpr uint64_t compressed_magic = 0x3254535244464356;
+constexpr uint64_t compressed_version = 1;
+
+// Number of 64-bit entries in the fixed part of the compressed file header.
+constexpr int fixed_header_length = 9;
+
+// Number of consecutive DOF ids stored in each compressed chunk.
+constexpr uint64_t chunk_size = 65536;
+
+// Size of a chunk table entry holding the file offset, the encoded size,
+// and the checksum and encoding of a chunk.
+constexpr uint64_t chunk_entry_size = 3 * sizeof(uint64_t);
+
+//---------------------------------------------------------------------------//
+// Chunks are distributed over the ranks in contiguous blocks.
+uint64_t chunkBegin(const int rank, const int comm_size, const uint64_t n)
+{
+    return rank * n / comm_size;
+}
+
+int chunkOwner(const uint64_t chunk, const int comm_size, const uint64_t n)
+{
+    return ((chunk + 1) * comm_size - 1) / n;
+}
+
+//---------------------------------------------------------------------------//
+template<class T>
+void appendValue(std::vector<unsigned char>& buffer, const T& value)
+{
+    const auto bytes = reinterpret_cast<const unsigned char*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+template<class T>
+T extractValue(const std::vector<unsigned char>& buffer, std::size_t& pos)
+{
+    if (pos + sizeof(T) > buffer.size())
+        throw std::runtime_error("Restart file header is corrupt");
+    T value;
+    std::memcpy(&value, buffer.data() + pos, sizeof(T));
+    pos += sizeof(T);
+    return value;
+}
+
+} // namespace
+
 //---------------------------------------------------------------------------//
 // Base
 //---------------------------------------------------------------------------//
@@ -37,8 +93,6 @@ MPI_Datatype Restart::setupDofMapData(
     auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
         dof_manager->getComm());
     MPI_Comm mpi_comm = Teuchos::getRawMpiComm(*comm);
-    const int comm_rank = comm->getRank();
-    const int comm_size = comm->getSize();
 
     // Compute the maximum number of dofs per element.
     std::vector<std::string> block_ids;
@@ -62,100 +116,240 @@ MPI_Datatype Restart::setupDofMapData(
     }
     std::sort(owned_element_gids.begin(), owned_element_gids.end());
 
-    // On rank zero determine how many elements each rank owns.
-    std::vector<int> elems_per_rank;
+    // Determine the position of each owned element in the global sorted
+    // element order.
+    const uint64_t global_num_elem
+        = mesh->getEntityCounts(stk::topology::ELEM_RANK);
+    const auto sorted_elem_positions
+        = sortedGlobalPositions(mpi_comm, owned_element_gids);
+
+    // Create the local element ids in the sorted order and the displacments.
+    owned_element_lids.resize(local_num_own_elem);
+    std::vector<int> displacements(local_num_own_elem);
+    for (int i = 0; i < local_num_own_elem; ++i)
+    {
+        owned_element_lids[i] = mesh->elementLocalId(owned_element_gids[i]);
+        displacements[i] = dofmap_offset * sorted_elem_positions[i];
+    }
+
+    // Create the MPI datatype for the dof map.
+    // Make indexed data types into which we will write the local data.
+    MPI_Datatype indexed;
+    MPI_Type_create_indexed_block(displacements.size(),
+                                  dofmap_offset,
+                                  displacements.data(),
+                                  MPI_UINT64_T,
+                                  &indexed);
+
+    // Update the extent of the datatype. This new data type will need to be
+    // committed.
+    MPI_Aint extent = global_num_elem * dofmap_offset * sizeof(uint64_t);
+    MPI_Datatype dofmap_type;
+    MPI_Type_create_resized(indexed, 0, extent, &dofmap_type);
+    MPI_Type_free(&indexed);
+    return dofmap_type;
+}
+
+//---------------------------------------------------------------------------//
+// The positions are computed with a distributed sample sort. Rank zero only
+// receives a bounded number of samples from each rank to select the
+// splitters. The global ids are then redistributed so that each rank sorts a
+// contiguous range and the positions follow from a prefix sum of the range
+// sizes. No rank holds the full list of global ids.
+std::vector<uint64_t>
+Restart::sortedGlobalPositions(MPI_Comm mpi_comm,
+                               const std::vector<uint64_t>& sorted_gids)
+{
+    int comm_rank;
+    int comm_size;
+    MPI_Comm_rank(mpi_comm, &comm_rank);
+    MPI_Comm_size(mpi_comm, &comm_size);
+    const int local_num_own_elem = sorted_gids.size();
+
+    // Select regularly spaced samples of the local global ids. Regular
+    // sampling with one sample per rank bounds the range sizes to about twice
+    // the average. The number of samples is capped to bound the memory on
+    // rank zero.
+    constexpr int max_samples_per_rank = 128;
+    const int num_samples = std::min(
+        {comm_size - 1, max_samples_per_rank, local_num_own_elem});
+    std::vector<uint64_t> samples(num_samples);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        samples[i] = sorted_gids[(i + 1) * static_cast<uint64_t>(
+                                              local_num_own_elem)
+                                 / (num_samples + 1)];
+    }
+
+    // Gather the samples to rank zero.
+    std::vector<int> samples_per_rank;
     if (0 == comm_rank)
     {
-        elems_per_rank.resize(comm_size);
+        samples_per_rank.resize(comm_size);
     }
-    MPI_Gather(&local_num_own_elem,
+    MPI_Gather(&num_samples,
                1,
                MPI_INT,
-               elems_per_rank.data(),
+               samples_per_rank.data(),
                1,
                MPI_INT,
                0,
                mpi_comm);
 
-    // Gather the global ids to rank zero.
-    const uint64_t global_num_elem
-        = mesh->getEntityCounts(stk::topology::ELEM_RANK);
-    std::vector<uint64_t> all_element_ids;
-    std::vector<int> rank_displacements;
+    std::vector<uint64_t> all_samples;
+    std::vector<int> sample_displacements;
     if (0 == comm_rank)
     {
-        all_element_ids.resize(global_num_elem);
-        rank_displacements.resize(comm_size);
-        rank_displacements[0] = 0;
-        std::partial_sum(elems_per_rank.begin(),
-                         elems_per_rank.end() - 1,
-                         rank_displacements.begin() + 1);
+        sample_displacements.resize(comm_size);
+        sample_displacements[0] = 0;
+        std::partial_sum(samples_per_rank.begin(),
+                         samples_per_rank.end() - 1,
+                         sample_displacements.begin() + 1);
+        all_samples.resize(sample_displacements.back()
+                           + samples_per_rank.back());
     }
-    MPI_Gatherv(owned_element_gids.data(),
-                owned_element_gids.size(),
+    MPI_Gatherv(samples.data(),
+                num_samples,
                 MPI_UINT64_T,
-                all_element_ids.data(),
-                elems_per_rank.data(),
-                rank_displacements.data(),
+                all_samples.data(),
+                samples_per_rank.data(),
+                sample_displacements.data(),
                 MPI_UINT64_T,
                 0,
                 mpi_comm);
 
-    // Sort the list of global ids on rank zero and determine the sorted
-    // offset of each element into the global dof map.
-    if (0 == comm_rank)
+    // Select the splitters between the ranges of each rank on rank zero and
+    // broadcast them.
+    std::vector<uint64_t> splitters(comm_size - 1,
+                                    std::numeric_limits<uint64_t>::max());
+    if (0 == comm_rank && !all_samples.empty())
     {
-        std::vector<uint64_t> sorted_index(global_num_elem);
-        std::iota(sorted_index.begin(), sorted_index.end(), 0);
-        std::sort(sorted_index.begin(),
-                  sorted_index.end(),
-                  [&](uint64_t i, uint64_t j) {
-                      return all_element_ids[i] < all_element_ids[j];
-                  });
-        for (uint64_t i = 0; i < global_num_elem; ++i)
+        std::sort(all_samples.begin(), all_samples.end());
+        const uint64_t total_samples = all_samples.size();
+        for (int r = 0; r < comm_size - 1; ++r)
         {
-            all_element_ids[sorted_index[i]] = i;
+            splitters[r] = all_samples[(r + 1) * total_samples / comm_size];
         }
     }
+    MPI_Bcast(splitters.data(), comm_size - 1, MPI_UINT64_T, 0, mpi_comm);
 
-    // Scatter the sorted gids back to the owners so they know how to write to
-    // their part of the dofmap.
-    std::vector<uint64_t> sorted_elem_positions(local_num_own_elem);
-    MPI_Scatterv(all_element_ids.data(),
-                 elems_per_rank.data(),
-                 rank_displacements.data(),
-                 MPI_UINT64_T,
-                 sorted_elem_positions.data(),
-                 sorted_elem_positions.size(),
-                 MPI_UINT64_T,
-                 0,
+    // Count the global ids sent to each rank. The local ids are sorted so
+    // the ids sent to each rank are contiguous.
+    std::vector<int> send_counts(comm_size, 0);
+    {
+        int r = 0;
+        for (const auto gid : sorted_gids)
+        {
+            while (r < comm_size - 1 && gid >= splitters[r])
+                ++r;
+            ++send_counts[r];
+        }
+    }
+    std::vector<int> receive_counts(comm_size);
+    MPI_Alltoall(send_counts.data(),
+                 1,
+                 MPI_INT,
+                 receive_counts.data(),
+                 1,
+                 MPI_INT,
                  mpi_comm);
 
-    // Create the local element ids in the sorted order and the displacments.
-    owned_element_lids.resize(local_num_own_elem);
-    std::vector<int> displacements(local_num_own_elem);
-    for (int i = 0; i < local_num_own_elem; ++i)
+    std::vector<int> send_displacements(comm_size, 0);
+    std::vector<int> receive_displacements(comm_size, 0);
+    std::partial_sum(send_counts.begin(),
+                     send_counts.end() - 1,
+                     send_displacements.begin() + 1);
+    std::partial_sum(receive_counts.begin(),
+                     receive_counts.end() - 1,
+                     receive_displacements.begin() + 1);
+    const int num_received = receive_displacements.back()
+                             + receive_counts.back();
+
+    // Redistribute the global ids.
+    std::vector<uint64_t> range_gids(num_received);
+    MPI_Alltoallv(sorted_gids.data(),
+                  send_counts.data(),
+                  send_displacements.data(),
+                  MPI_UINT64_T,
+                  range_gids.data(),
+                  receive_counts.data(),
+                  receive_displacements.data(),
+                  MPI_UINT64_T,
+                  mpi_comm);
+
+    // Sort the local range and offset it by the number of global ids on the
+    // lower ranks.
+    std::vector<int> sorted_index(num_received);
+    std::iota(sorted_index.begin(), sorted_index.end(), 0);
+    std::sort(sorted_index.begin(),
+              sorted_index.end(),
+              [&](const int i, const int j) {
+                  return range_gids[i] < range_gids[j];
+              });
+
+    uint64_t range_size = num_received;
+    uint64_t range_offset = 0;
+    MPI_Exscan(
+        &range_size, &range_offset, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+    if (0 == comm_rank)
     {
-        owned_element_lids[i] = mesh->elementLocalId(owned_element_gids[i]);
-        displacements[i] = dofmap_offset * sorted_elem_positions[i];
+        range_offset = 0;
     }
 
-    // Create the MPI datatype for the dof map.
-    // Make indexed data types into which we will write the local data.
-    MPI_Datatype indexed;
-    MPI_Type_create_indexed_block(displacements.size(),
-                                  dofmap_offset,
-                                  displacements.data(),
-                                  MPI_UINT64_T,
-                                  &indexed);
+    std::vector<uint64_t> range_positions(num_received);
+    for (int i = 0; i < num_received; ++i)
+    {
+        range_positions[sorted_index[i]] = range_offset + i;
+    }
 
-    // Update the extent of the datatype. This new data type will need to be
-    // committed.
-    MPI_Aint extent = global_num_elem * dofmap_offset * sizeof(uint64_t);
-    MPI_Datatype dofmap_type;
-    MPI_Type_create_resized(indexed, 0, extent, &dofmap_type);
-    MPI_Type_free(&indexed);
-    return dofmap_type;
+    // Return the positions to the owners of the global ids.
+    std::vector<uint64_t> sorted_positions(local_num_own_elem);
+    MPI_Alltoallv(range_positions.data(),
+                  receive_counts.data(),
+                  receive_displacements.data(),
+                  MPI_UINT64_T,
+                  sorted_positions.data(),
+                  send_counts.data(),
+                  send_displacements.data(),
+                  MPI_UINT64_T,
+                  mpi_comm);
+    return sorted_positions;
+}
+
+//---------------------------------------------------------------------------//
+std::vector<int> Restart::ownedFieldNumbers(
+    const panzer::GlobalIndexer& dof_manager,
+    const std::vector<panzer::GlobalOrdinal>& owned_gids)
+{
+    std::unordered_map<panzer::GlobalOrdinal, int> global_to_local;
+    for (std::size_t i = 0; i < owned_gids.size(); ++i)
+        global_to_local.insert({owned_gids[i], i});
+
+    std::vector<int> field_numbers(owned_gids.size(), -1);
+    std::vector<std::string> block_ids;
+    dof_manager.getElementBlockIds(block_ids);
+    std::vector<panzer::GlobalOrdinal> element_dofs;
+    for (const auto& block : block_ids)
+    {
+        const auto& elements = dof_manager.getElementBlock(block);
+        const auto& fields = dof_manager.getBlockFieldNumbers(block);
+        for (const int element : elements)
+        {
+            dof_manager.getElementGIDs(element, element_dofs);
+            for (const int field : fields)
+            {
+                const auto& offsets
+                    = dof_manager.getGIDFieldOffsets(block, field);
+                for (const int offset : offsets)
+                {
+                    auto itr = global_to_local.find(element_dofs[offset]);
+                    if (itr != global_to_local.end())
+                        field_numbers[itr->second] = field;
+                }
+            }
+        }
+    }
+    return field_numbers;
 }
 
 //---------------------------------------------------------------------------//
@@ -170,7 +364,39 @@ RestartWriter::RestartWriter(
     const bool allow_dofmap_overwrite)
     : _dof_manager(dof_manager)
     , _file_prefix(output_params.get<std::string>("Restart File Prefix"))
+    , _format(Format::raw)
+    , _asynchronous(false)
+    , _max_pending_writes(1)
 {
+    // Get the data file format.
+    if (output_params.isType<std::string>("Restart File Format"))
+    {
+        const auto format_validator = Teuchos::rcp(
+            new Teuchos::StringToIntegralParameterEntryValidator<Format>(
+                Teuchos::tuple<std::string>("Raw", "Compressed"),
+                Teuchos::tuple<Format>(Format::raw, Format::compressed),
+                "Raw"));
+        _format = format_validator->getIntegralValue(
+            output_params.get<std::string>("Restart File Format"));
+    }
+
+    // Get the asynchronous write options.
+    if (output_params.isType<bool>("Asynchronous Restart Write"))
+    {
+        _asynchronous
+            = output_params.get<bool>("Asynchronous Restart Write");
+    }
+    if (output_params.isType<int>("Restart Writes In Flight"))
+    {
+        _max_pending_writes
+            = output_params.get<int>("Restart Writes In Flight");
+        if (_max_pending_writes < 1)
+        {
+            throw std::runtime_error(
+                "'Restart Writes In Flight' must be at least 1");
+        }
+    }
+
     // Get the MPI communicator.
     auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
         dof_manager->getComm());
@@ -285,6 +511,9 @@ RestartWriter::RestartWriter(
     for (int i = 0; i < _dof_manager->getNumOwned(); ++i)
         _global_to_local.insert({gids[i], i});
 
+    // Get the field of each owned dof for the field checksums.
+    _field_numbers = ownedFieldNumbers(*_dof_manager, gids);
+
     // Sort displacements
     std::sort(_displacements.begin(), _displacements.end());
     MPI_Datatype indexed;
@@ -304,6 +533,7 @@ RestartWriter::RestartWriter(
 //---------------------------------------------------------------------------//
 RestartWriter::~RestartWriter()
 {
+    this->finishWrites();
     MPI_Type_free(&_dof_type);
 }
 
@@ -318,7 +548,6 @@ void RestartWriter::writeSolution(
     auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
         _dof_manager->getComm());
     MPI_Comm mpi_comm = Teuchos::getRawMpiComm(*comm);
-    const int comm_rank = comm->getRank();
 
     // SpmdVectorBase is a common base class of either Epetra or Tpetra
     // implementations that has a concept of local vs. global portions
@@ -339,78 +568,395 @@ void RestartWriter::writeSolution(
             "match");
     }
 
-    // Open a binary data file.
+    // Reorder the state vector and its time derivative to correspond to the
+    // increasing order displacements.
+    auto x_view = x_spmd->getLocalSubVector();
+    auto x_dot_view = x_dot_spmd->getLocalSubVector();
+    std::vector<double> x_copy(local_size);
+    std::vector<double> x_dot_copy(local_size);
+    for (int i = 0; i < local_size; ++i)
+    {
+        const int local_index = _global_to_local[_displacements[i]];
+        x_copy[i] = x_view(local_index);
+        x_dot_copy[i] = x_dot_view(local_index);
+    }
+
     std::stringstream file_name;
     file_name << _file_prefix << "_" << index;
     std::string restart_file_name = file_name.str() + ".restart.data";
-    MPI_File restart_file;
+
+    // Start the data file write.
+    PendingWrite write;
+    if (_format == Format::compressed)
+    {
+        this->writeCompressedSolution(mpi_comm,
+                                      restart_file_name,
+                                      x_copy,
+                                      x_dot_copy,
+                                      global_size,
+                                      time,
+                                      write);
+    }
+    else
+    {
+        this->writeRawSolution(mpi_comm,
+                               restart_file_name,
+                               x_copy,
+                               x_dot_copy,
+                               global_size,
+                               time,
+                               write);
+    }
+
+    // Complete the write now or keep it in flight, waiting for the oldest
+    // writes when too many are pending.
+    if (!_asynchronous)
+    {
+        this->completeWrite(write);
+        return;
+    }
+    _pending_writes.push_back(std::move(write));
+    while (static_cast<int>(_pending_writes.size()) > _max_pending_writes)
+    {
+        this->completeWrite(_pending_writes.front());
+        _pending_writes.pop_front();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void RestartWriter::finishWrites()
+{
+    while (!_pending_writes.empty())
+    {
+        this->completeWrite(_pending_writes.front());
+        _pending_writes.pop_front();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void RestartWriter::completeWrite(PendingWrite& write) const
+{
+    MPI_Wait(&write.request, MPI_STATUS_IGNORE);
+    MPI_File_close(&write.file);
+}
+
+//---------------------------------------------------------------------------//
+// The raw file consists of a header with the time, the number of fields and
+// the number of DOFs followed by the state vector and its time derivative
+// ordered by DOF id.
+void RestartWriter::writeRawSolution(MPI_Comm mpi_comm,
+                                     const std::string& restart_file_name,
+                                     std::vector<double>& x_copy,
+                                     std::vector<double>& x_dot_copy,
+                                     const int global_size,
+                                     const double time,
+                                     PendingWrite& write) const
+{
+    int comm_rank;
+    MPI_Comm_rank(mpi_comm, &comm_rank);
+
+    // Open a binary data file.
     MPI_File_open(mpi_comm,
                   restart_file_name.c_str(),
                   MPI_MODE_WRONLY | MPI_MODE_CREATE,
                   MPI_INFO_NULL,
-                  &restart_file);
+                  &write.file);
 
     // Write the time into the header on rank 0.
     const int num_fields = _dof_manager->getNumFields();
     MPI_File_set_view(
-        restart_file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+        write.file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
     MPI_Offset header_size;
     if (0 == comm_rank)
     {
-        MPI_File_write(restart_file, &time, 1, MPI_DOUBLE, MPI_STATUS_IGNORE);
+        MPI_File_write(write.file, &time, 1, MPI_DOUBLE, MPI_STATUS_IGNORE);
+        MPI_File_write(write.file, &num_fields, 1, MPI_INT, MPI_STATUS_IGNORE);
         MPI_File_write(
-            restart_file, &num_fields, 1, MPI_INT, MPI_STATUS_IGNORE);
-        MPI_File_write(
-            restart_file, &global_size, 1, MPI_INT, MPI_STATUS_IGNORE);
-        MPI_File_get_position(restart_file, &header_size);
-        MPI_File_get_byte_offset(restart_file, header_size, &header_size);
+            write.file, &global_size, 1, MPI_INT, MPI_STATUS_IGNORE);
+        MPI_File_get_position(write.file, &header_size);
+        MPI_File_get_byte_offset(write.file, header_size, &header_size);
     }
 
     // Broadcast the header size.
     MPI_Bcast(&header_size, 1, MPI_OFFSET, 0, mpi_comm);
 
-    // Reorder the state vector to correspond to the increasing order
-    // displacements.
-    auto x_view = x_spmd->getLocalSubVector();
-    std::vector<double> x_copy(local_size);
-    for (int i = 0; i < local_size; ++i)
-    {
-        const int local_index = _global_to_local[_displacements[i]];
-        x_copy[i] = x_view(local_index);
-    }
-
-    // Write state vector.
-    MPI_File_set_view(restart_file,
+    // Write the state vector followed by its time derivative. The file view
+    // repeats after the global size, so writing both vectors from a single
+    // buffer places the time derivative after the state vector.
+    write.values = std::move(x_copy);
+    write.values.insert(
+        write.values.end(), x_dot_copy.begin(), x_dot_copy.end());
+    MPI_File_set_view(write.file,
                       header_size,
                       MPI_DOUBLE,
                       _dof_type,
                       "native",
                       MPI_INFO_NULL);
-    MPI_File_write_all(restart_file,
-                       x_copy.data(),
-                       x_copy.size(),
-                       MPI_DOUBLE,
-                       MPI_STATUS_IGNORE);
+    MPI_File_iwrite_all(write.file,
+                        write.values.data(),
+                        write.values.size(),
+                        MPI_DOUBLE,
+                        &write.request);
+}
 
-    // Reorder the state vector time derivative to correspond to the
-    // increasing order displacements.
-    auto x_dot_view = x_dot_spmd->getLocalSubVector();
-    std::vector<double> x_dot_copy(local_size);
+//---------------------------------------------------------------------------//
+// The compressed file consists of a header followed by the encoded chunks.
+// The header holds the fixed entries (identifier, version, header size,
+// header checksum, time, number of DOFs, chunk size, number of chunks and
+// number of fields), the name, DOF count and checksums of each field, and a
+// table with the offset, size, checksum and encoding of each chunk of the
+// state vector and its time derivative. The DOF ids of the local data are
+// sent to the ranks that own the chunks containing them, which encode their
+// chunks and write them to consecutive locations in the file.
+void RestartWriter::writeCompressedSolution(
+    MPI_Comm mpi_comm,
+    const std::string& restart_file_name,
+    const std::vector<double>& x_copy,
+    const std::vector<double>& x_dot_copy,
+    const uint64_t global_size,
+    const double time,
+    PendingWrite& write) const
+{
+    int comm_rank;
+    int comm_size;
+    MPI_Comm_rank(mpi_comm, &comm_rank);
+    MPI_Comm_size(mpi_comm, &comm_size);
+    const int local_size = x_copy.size();
+
+    // Compute the DOF count and checksums of each field.
+    const int num_fields = _dof_manager->getNumFields();
+    std::vector<uint64_t> field_data(3 * num_fields, 0);
     for (int i = 0; i < local_size; ++i)
     {
-        const int local_index = _global_to_local[_displacements[i]];
-        x_dot_copy[i] = x_dot_view(local_index);
+        const int field = _field_numbers[_global_to_local.at(
+            _displacements[i])];
+        field_data[3 * field] += 1;
+        field_data[3 * field + 1]
+            += RestartCompression::dofChecksum(_displacements[i], x_copy[i]);
+        field_data[3 * field + 2] += RestartCompression::dofChecksum(
+            _displacements[i], x_dot_copy[i]);
     }
+    MPI_Allreduce(MPI_IN_PLACE,
+                  field_data.data(),
+                  field_data.size(),
+                  MPI_UINT64_T,
+                  MPI_SUM,
+                  mpi_comm);
+
+    // Compute the header size. It only depends on data known to all ranks.
+    const uint64_t num_chunks = (global_size + chunk_size - 1) / chunk_size;
+    uint64_t header_size = fixed_header_length * sizeof(uint64_t);
+    for (int f = 0; f < num_fields; ++f)
+    {
+        header_size += 4 * sizeof(uint64_t)
+                       + _dof_manager->getFieldString(f).size();
+    }
+    header_size += 2 * num_chunks * chunk_entry_size;
 
-    // Write state vector time derivative.
-    MPI_File_write_all(restart_file,
-                       x_dot_copy.data(),
-                       x_dot_copy.size(),
-                       MPI_DOUBLE,
-                       MPI_STATUS_IGNORE);
+    // Send the local data to the owners of the chunks. The displacements are
+    // sorted so the data sent to each rank is contiguous.
+    std::vector<int> send_counts(comm_size, 0);
+    for (int i = 0; i < local_size; ++i)
+    {
+        ++send_counts[chunkOwner(
+            _displacements[i] / chunk_size, comm_size, num_chunks)];
+    }
+    std::vector<int> receive_counts(comm_size);
+    MPI_Alltoall(send_counts.data(),
+                 1,
+                 MPI_INT,
+                 receive_counts.data(),
+                 1,
+                 MPI_INT,
+                 mpi_comm);
+    std::vector<int> send_displacements(comm_size, 0);
+    std::vector<int> receive_displacements(comm_size, 0);
+    std::partial_sum(send_counts.begin(),
+                     send_counts.end() - 1,
+                     send_displacements.begin() + 1);
+    std::partial_sum(receive_counts.begin(),
+                     receive_counts.end() - 1,
+                     receive_displacements.begin() + 1);
+    const int num_received = receive_displacements.back()
+                             + receive_counts.back();
+
+    std::vector<uint64_t> send_gids(_displacements.begin(),
+                                    _displacements.end());
+    std::vector<uint64_t> receive_gids(num_received);
+    MPI_Alltoallv(send_gids.data(),
+                  send_counts.data(),
+                  send_displacements.data(),
+                  MPI_UINT64_T,
+                  receive_gids.data(),
+                  receive_counts.data(),
+                  receive_displacements.data(),
+                  MPI_UINT64_T,
+                  mpi_comm);
+
+    std::vector<double> send_values(2 * local_size);
+    for (int i = 0; i < local_size; ++i)
+    {
+        send_values[2 * i] = x_copy[i];
+        send_values[2 * i + 1] = x_dot_copy[i];
+    }
+    for (int r = 0; r < comm_size; ++r)
+    {
+        send_counts[r] *= 2;
+        send_displacements[r] *= 2;
+        receive_counts[r] *= 2;
+        receive_displacements[r] *= 2;
+    }
+    std::vector<double> receive_values(2 * num_received);
+    MPI_Alltoallv(send_values.data(),
+                  send_counts.data(),
+                  send_displacements.data(),
+                  MPI_DOUBLE,
+                  receive_values.data(),
+                  receive_counts.data(),
+                  receive_displacements.data(),
+                  MPI_DOUBLE,
+                  mpi_comm);
+
+    // Assemble the local chunks. Every DOF id in the range of the local
+    // chunks must have been received.
+    const uint64_t begin_chunk = chunkBegin(comm_rank, comm_size, num_chunks);
+    const uint64_t end_chunk
+        = chunkBegin(comm_rank + 1, comm_size, num_chunks);
+    const uint64_t begin_gid = begin_chunk * chunk_size;
+    const uint64_t end_gid = std::min(end_chunk * chunk_size, global_size);
+    const uint64_t num_local_gids = end_gid - begin_gid;
+    if (static_cast<uint64_t>(num_received) != num_local_gids)
+    {
+        throw std::logic_error("Restart DOF ids are not contiguous");
+    }
+    std::vector<double> chunk_values[2];
+    chunk_values[0].resize(num_local_gids);
+    chunk_values[1].resize(num_local_gids);
+    for (int i = 0; i < num_received; ++i)
+    {
+        chunk_values[0][receive_gids[i] - begin_gid] = receive_values[2 * i];
+        chunk_values[1][receive_gids[i] - begin_gid]
+            = receive_values[2 * i + 1];
+    }
 
-    // Cleanup.
-    MPI_File_close(&restart_file);
+    // Encode the local chunks.
+    std::vector<unsigned char> local_data;
+    std::vector<uint64_t> local_table;
+    std::vector<unsigned char> chunk_data;
+    for (uint64_t c = begin_chunk; c < end_chunk; ++c)
+    {
+        const uint64_t offset = (c - begin_chunk) * chunk_size;
+        const uint64_t count
+            = std::min(chunk_size, num_local_gids - offset);
+        for (int v = 0; v < 2; ++v)
+        {
+            const double* values = chunk_values[v].data() + offset;
+            const auto encoding
+                = RestartCompression::encode(values, count, chunk_data);
+            const uint64_t crc
+                = RestartCompression::crc32(values, count * sizeof(double));
+            local_table.push_back(local_data.size());
+            local_table.push_back(chunk_data.size());
+            local_table.push_back(
+                crc | (static_cast<uint64_t>(encoding) << 32));
+            local_data.insert(
+                local_data.end(), chunk_data.begin(), chunk_data.end());
+        }
+    }
+
+    // Compute the file offsets of the local chunks.
+    uint64_t local_data_size = local_data.size();
+    uint64_t data_offset = 0;
+    MPI_Exscan(
+        &local_data_size, &data_offset, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+    if (0 == comm_rank)
+    {
+        data_offset = 0;
+    }
+    data_offset += header_size;
+    for (std::size_t i = 0; i < local_table.size(); i += 3)
+        local_table[i] += data_offset;
+
+    // Gather the chunk table on rank 0.
+    std::vector<uint64_t> table;
+    std::vector<int> table_counts;
+    std::vector<int> table_displacements;
+    if (0 == comm_rank)
+    {
+        table.resize(6 * num_chunks);
+        table_counts.resize(comm_size);
+        table_displacements.resize(comm_size);
+        for (int r = 0; r < comm_size; ++r)
+        {
+            const uint64_t b = chunkBegin(r, comm_size, num_chunks);
+            const uint64_t e = chunkBegin(r + 1, comm_size, num_chunks);
+            table_counts[r] = 6 * (e - b);
+            table_displacements[r] = 6 * b;
+        }
+    }
+    MPI_Gatherv(local_table.data(),
+                local_table.size(),
+                MPI_UINT64_T,
+                table.data(),
+                table_counts.data(),
+                table_displacements.data(),
+                MPI_UINT64_T,
+                0,
+                mpi_comm);
+
+    // Open the data file and discard any previous contents.
+    MPI_File_open(mpi_comm,
+                  restart_file_name.c_str(),
+                  MPI_MODE_WRONLY | MPI_MODE_CREATE,
+                  MPI_INFO_NULL,
+                  &write.file);
+    MPI_File_set_size(write.file, 0);
+
+    // Write the header on rank 0.
+    if (0 == comm_rank)
+    {
+        std::vector<unsigned char> header_body;
+        for (int f = 0; f < num_fields; ++f)
+        {
+            const std::string& name = _dof_manager->getFieldString(f);
+            appendValue(header_body, static_cast<uint64_t>(name.size()));
+            header_body.insert(header_body.end(), name.begin(), name.end());
+            for (int k = 0; k < 3; ++k)
+                appendValue(header_body, field_data[3 * f + k]);
+        }
+        for (const auto entry : table)
+            appendValue(header_body, entry);
+
+        std::vector<unsigned char> header;
+        appendValue(header, compressed_magic);
+        appendValue(header, compressed_version);
+        appendValue(header, header_size);
+        appendValue(header,
+                    static_cast<uint64_t>(RestartCompression::crc32(
+                        header_body.data(), header_body.size())));
+        appendValue(header, time);
+        appendValue(header, global_size);
+        appendValue(header, chunk_size);
+        appendValue(header, num_chunks);
+        appendValue(header, static_cast<uint64_t>(num_fields));
+        header.insert(header.end(), header_body.begin(), header_body.end());
+
+        MPI_File_write_at(write.file,
+                          0,
+                          header.data(),
+                          header.size(),
+                          MPI_BYTE,
+                          MPI_STATUS_IGNORE);
+    }
+
+    // Write the local chunks.
+    write.data = std::move(local_data);
+    MPI_File_iwrite_at_all(write.file,
+                           data_offset,
+                           write.data.data(),
+                           write.data.size(),
+                           MPI_BYTE,
+                           &write.request);
 }
 
 //---------------------------------------------------------------------------//
@@ -441,10 +987,31 @@ RestartReader::RestartReader(const Teuchos::RCP<const Teuchos::Comm<int>>& comm,
         throw std::logic_error(msg);
     }
 
-    // Get the initial state time.
+    // Detect the file format and get the initial state time. Raw files
+    // start with the time.
+    uint64_t header[fixed_header_length] = {};
     MPI_File_set_view(
         restart_file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
-    MPI_File_read_all(restart_file, &_t_init, 1, MPI_DOUBLE, MPI_STATUS_IGNORE);
+    MPI_File_read_all(restart_file,
+                      header,
+                      fixed_header_length,
+                      MPI_UINT64_T,
+                      MPI_STATUS_IGNORE);
+    if (header[0] == compressed_magic)
+    {
+        if (header[1] != compressed_version)
+        {
+            throw std::runtime_error("Unsupported restart file version in "
+                                     + _restart_file_name);
+        }
+        _format = Format::compressed;
+        std::memcpy(&_t_init, &header[4], sizeof(double));
+    }
+    else
+    {
+        _format = Format::raw;
+        std::memcpy(&_t_init, &header[0], sizeof(double));
+    }
 
     // Cleanup.
     MPI_File_close(&restart_file);
@@ -564,6 +1131,13 @@ void RestartReader::readSolution(
         }
     }
 
+    if (_format == Format::compressed)
+    {
+        this->readCompressedSolution(
+            mpi_comm, *dof_manager, mapped_gids, x, x_dot);
+        return;
+    }
+
     // Open the restart file.
     MPI_File restart_file;
     MPI_File_open(mpi_comm,
@@ -679,6 +1253,300 @@ void RestartReader::readSolution(
     MPI_Type_free(&dof_type);
 }
 
+//---------------------------------------------------------------------------//
+// The chunks are distributed over the ranks of the reading communicator in
+// contiguous blocks independent of the decomposition used to write the file.
+// Each rank decodes and verifies its chunks and then serves the values
+// requested by the owners of the DOFs in the current decomposition.
+void RestartReader::readCompressedSolution(
+    MPI_Comm mpi_comm,
+    const panzer::GlobalIndexer& dof_manager,
+    const std::unordered_map<panzer::GlobalOrdinal, int>& mapped_gids,
+    const Teuchos::RCP<Thyra::VectorBase<double>>& x,
+    const Teuchos::RCP<Thyra::VectorBase<double>>& x_dot) const
+{
+    int comm_rank;
+    int comm_size;
+    MPI_Comm_rank(mpi_comm, &comm_rank);
+    MPI_Comm_size(mpi_comm, &comm_size);
+
+    // Open the restart file.
+    MPI_File restart_file;
+    MPI_File_open(mpi_comm,
+                  _restart_file_name.c_str(),
+                  MPI_MODE_RDONLY,
+                  MPI_INFO_NULL,
+                  &restart_file);
+
+    // Read and verify the header.
+    uint64_t fixed_header[fixed_header_length] = {};
+    MPI_File_set_view(
+        restart_file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+    MPI_File_read_at_all(restart_file,
+                         0,
+                         fixed_header,
+                         fixed_header_length,
+                         MPI_UINT64_T,
+                         MPI_STATUS_IGNORE);
+    const uint64_t fixed_header_size = fixed_header_length * sizeof(uint64_t);
+    const uint64_t header_size = fixed_header[2];
+    if (header_size < fixed_header_size)
+    {
+        throw std::runtime_error("Restart file header is corrupt");
+    }
+    std::vector<unsigned char> header_body(header_size - fixed_header_size);
+    MPI_File_read_at_all(restart_file,
+                         fixed_header_size,
+                         header_body.data(),
+                         header_body.size(),
+                         MPI_BYTE,
+                         MPI_STATUS_IGNORE);
+    if (RestartCompression::crc32(header_body.data(), header_body.size())
+        != fixed_header[3])
+    {
+        throw std::runtime_error("Restart file header is corrupt");
+    }
+
+    const uint64_t global_num_dof = fixed_header[5];
+    const uint64_t file_chunk_size = fixed_header[6];
+    const uint64_t num_chunks = fixed_header[7];
+    const int num_fields = fixed_header[8];
+    if (num_fields != dof_manager.getNumFields())
+    {
+        throw std::logic_error("Restart number of fields do not match");
+    }
+
+    std::size_t pos = 0;
+    std::unordered_map<std::string, int> field_index;
+    std::vector<std::string> field_names(num_fields);
+    std::vector<uint64_t> field_data(3 * num_fields);
+    for (int f = 0; f < num_fields; ++f)
+    {
+        const auto name_size = extractValue<uint64_t>(header_body, pos);
+        if (pos + name_size > header_body.size())
+        {
+            throw std::runtime_error("Restart file header is corrupt");
+        }
+        field_names[f].assign(
+            reinterpret_cast<const char*>(header_body.data()) + pos,
+            name_size);
+        pos += name_size;
+        field_index.emplace(field_names[f], f);
+        for (int k = 0; k < 3; ++k)
+            field_data[3 * f + k] = extractValue<uint64_t>(header_body, pos);
+    }
+    std::vector<uint64_t> table(6 * num_chunks);
+    for (auto& entry : table)
+        entry = extractValue<uint64_t>(header_body, pos);
+
+    // Map the field numbers of the DOF manager to the fields in the file.
+    std::vector<int> file_field(num_fields);
+    for (int f = 0; f < num_fields; ++f)
+    {
+        const auto itr = field_index.find(dof_manager.getFieldString(f));
+        if (itr == field_index.end())
+        {
+            throw std::logic_error("Restart field "
+                                   + dof_manager.getFieldString(f)
+                                   + " not found in " + _restart_file_name);
+        }
+        file_field[f] = itr->second;
+    }
+
+    // Request the values of the owned DOFs from the ranks that read the
+    // chunks containing them.
+    std::vector<panzer::GlobalOrdinal> owned_gids;
+    dof_manager.getOwnedIndices(owned_gids);
+    const int local_size = owned_gids.size();
+    uint64_t global_size = local_size;
+    MPI_Allreduce(
+        MPI_IN_PLACE, &global_size, 1, MPI_UINT64_T, MPI_SUM, mpi_comm);
+    if (global_size != global_num_dof)
+    {
+        throw std::logic_error("Restart global number of DOFs do not match");
+    }
+
+    std::vector<uint64_t> file_gids(local_size);
+    for (int i = 0; i < local_size; ++i)
+        file_gids[i] = mapped_gids.find(owned_gids[i])->second;
+    std::vector<int> request_index(local_size);
+    std::iota(request_index.begin(), request_index.end(), 0);
+    std::sort(request_index.begin(),
+              request_index.end(),
+              [&](const int i, const int j) {
+                  return file_gids[i] < file_gids[j];
+              });
+
+    std::vector<uint64_t> send_gids(local_size);
+    std::vector<int> send_counts(comm_size, 0);
+    for (int i = 0; i < local_size; ++i)
+    {
+        send_gids[i] = file_gids[request_index[i]];
+        ++send_counts[chunkOwner(
+            send_gids[i] / file_chunk_size, comm_size, num_chunks)];
+    }
+    std::vector<int> receive_counts(comm_size);
+    MPI_Alltoall(send_counts.data(),
+                 1,
+                 MPI_INT,
+                 receive_counts.data(),
+                 1,
+                 MPI_INT,
+                 mpi_comm);
+    std::vector<int> send_displacements(comm_size, 0);
+    std::vector<int> receive_displacements(comm_size, 0);
+    std::partial_sum(send_counts.begin(),
+                     send_counts.end() - 1,
+                     send_displacements.begin() + 1);
+    std::partial_sum(receive_counts.begin(),
+                     receive_counts.end() - 1,
+                     receive_displacements.begin() + 1);
+    const int num_received = receive_displacements.back()
+                             + receive_counts.back();
+    std::vector<uint64_t> receive_gids(num_received);
+    MPI_Alltoallv(send_gids.data(),
+                  send_counts.data(),
+                  send_displacements.data(),
+                  MPI_UINT64_T,
+                  receive_gids.data(),
+                  receive_counts.data(),
+                  receive_displacements.data(),
+                  MPI_UINT64_T,
+                  mpi_comm);
+
+    // Read, decode and verify the local chunks.
+    const uint64_t begin_chunk = chunkBegin(comm_rank, comm_size, num_chunks);
+    const uint64_t end_chunk
+        = chunkBegin(comm_rank + 1, comm_size, num_chunks);
+    const uint64_t begin_gid = begin_chunk * file_chunk_size;
+    const uint64_t end_gid
+        = std::min(end_chunk * file_chunk_size, global_num_dof);
+    std::vector<double> chunk_values[2];
+    chunk_values[0].resize(end_gid - begin_gid);
+    chunk_values[1].resize(end_gid - begin_gid);
+    std::vector<unsigned char> chunk_data;
+    long long corrupt_chunk = -1;
+    for (uint64_t c = begin_chunk; c < end_chunk; ++c)
+    {
+        const uint64_t offset = (c - begin_chunk) * file_chunk_size;
+        const uint64_t count = std::min(file_chunk_size,
+                                        end_gid - begin_gid - offset);
+        for (int v = 0; v < 2; ++v)
+        {
+            const uint64_t* entry = &table[6 * c + 3 * v];
+            chunk_data.resize(entry[1]);
+            MPI_File_read_at(restart_file,
+                             entry[0],
+                             chunk_data.data(),
+                             chunk_data.size(),
+                             MPI_BYTE,
+                             MPI_STATUS_IGNORE);
+
+            // Record corrupt chunks so that all ranks throw together.
+            double* values = chunk_values[v].data() + offset;
+            const auto encoding = static_cast<RestartCompression::Encoding>(
+                entry[2] >> 32);
+            try
+            {
+                RestartCompression::decode(chunk_data.data(),
+                                           chunk_data.size(),
+                                           encoding,
+                                           values,
+                                           count);
+                if (RestartCompression::crc32(values, count * sizeof(double))
+                    != (entry[2] & 0xffffffff))
+                {
+                    corrupt_chunk = c;
+                }
+            }
+            catch (const std::runtime_error&)
+            {
+                corrupt_chunk = c;
+            }
+        }
+    }
+    MPI_File_close(&restart_file);
+
+    MPI_Allreduce(
+        MPI_IN_PLACE, &corrupt_chunk, 1, MPI_LONG_LONG, MPI_MAX, mpi_comm);
+    if (corrupt_chunk >= 0)
+    {
+        throw std::runtime_error("Restart data chunk "
+                                 + std::to_string(corrupt_chunk) + " in "
+                                 + _restart_file_name + " is corrupt");
+    }
+
+    // Return the requested values.
+    std::vector<double> reply_values(2 * num_received);
+    for (int i = 0; i < num_received; ++i)
+    {
+        reply_values[2 * i] = chunk_values[0][receive_gids[i] - begin_gid];
+        reply_values[2 * i + 1]
+            = chunk_values[1][receive_gids[i] - begin_gid];
+    }
+    for (int r = 0; r < comm_size; ++r)
+    {
+        send_counts[r] *= 2;
+        send_displacements[r] *= 2;
+        receive_counts[r] *= 2;
+        receive_displacements[r] *= 2;
+    }
+    std::vector<double> values(2 * local_size);
+    MPI_Alltoallv(reply_values.data(),
+                  receive_counts.data(),
+                  receive_displacements.data(),
+                  MPI_DOUBLE,
+                  values.data(),
+                  send_counts.data(),
+                  send_displacements.data(),
+                  MPI_DOUBLE,
+                  mpi_comm);
+
+    std::vector<double> x_data(local_size);
+    std::vector<double> x_dot_data(local_size);
+    for (int i = 0; i < local_size; ++i)
+    {
+        x_data[request_index[i]] = values[2 * i];
+        x_dot_data[request_index[i]] = values[2 * i + 1];
+    }
+
+    // Verify the DOF count and checksums of each field.
+    const auto field_numbers = ownedFieldNumbers(dof_manager, owned_gids);
+    std::vector<uint64_t> local_field_data(3 * num_fields, 0);
+    for (int i = 0; i < local_size; ++i)
+    {
+        const int f = file_field[field_numbers[i]];
+        local_field_data[3 * f] += 1;
+        local_field_data[3 * f + 1]
+            += RestartCompression::dofChecksum(file_gids[i], x_data[i]);
+        local_field_data[3 * f + 2]
+            += RestartCompression::dofChecksum(file_gids[i], x_dot_data[i]);
+    }
+    MPI_Allreduce(MPI_IN_PLACE,
+                  local_field_data.data(),
+                  local_field_data.size(),
+                  MPI_UINT64_T,
+                  MPI_SUM,
+                  mpi_comm);
+    for (int f = 0; f < num_fields; ++f)
+    {
+        if (local_field_data[3 * f] != field_data[3 * f])
+        {
+            throw std::logic_error("Restart number of DOFs for field "
+                                   + field_names[f] + " do not match");
+        }
+        if (local_field_data[3 * f + 1] != field_data[3 * f + 1]
+            || local_field_data[3 * f + 2] != field_data[3 * f + 2])
+        {
+            throw std::runtime_error("Restart checksum mismatch for field "
+                                     + field_names[f]);
+        }
+    }
+
+    this->update_vector(x, x_data);
+    this->update_vector(x_dot, x_dot_data);
+}
+
 //---------------------------------------------------------------------------//
 void RestartReader::update_vector(
     const Teuchos::RCP<Thyra::VectorBase<double>>& vec,
@@ -10,8 +10,12 @@
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 
+#include <mpi.h>
+
 #include <cstdint>
+#include <deque>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace VertexCFD
@@ -22,6 +26,18 @@ namespace Mesh
 class Restart
 {
   public:
+    // Layout of the restart data file. The raw layout stores the solution
+    // as uncompressed values ordered by DOF id. The compressed layout splits
+    // the values into chunks of consecutive DOF ids that are compressed
+    // independently and stores a header with the time, the field names and
+    // DOF counts, and checksums of each chunk and field. The raw layout is
+    // the default so that existing tools can read the files.
+    enum Format
+    {
+        raw,
+        compressed
+    };
+
     ~Restart() = default;
 
     MPI_Datatype
@@ -30,6 +46,20 @@ class Restart
                     int& dofmap_offset,
                     int& local_num_own_elem,
                     std::vector<int>& owned_element_lids);
+
+    // Position of each element in the global sorted order of all element
+    // global ids on the communicator. The local global ids must be sorted.
+    // The positions are independent of the number of ranks and are used to
+    // lay out element data in files that survive repartitioning.
+    static std::vector<uint64_t>
+    sortedGlobalPositions(MPI_Comm mpi_comm,
+                          const std::vector<uint64_t>& sorted_gids);
+
+  protected:
+    // Field number of each owned DOF in the order of the owned DOF ids.
+    static std::vector<int>
+    ownedFieldNumbers(const panzer::GlobalIndexer& dof_manager,
+                      const std::vector<panzer::GlobalOrdinal>& owned_gids);
 };
 
 //---------------------------------------------------------------------------//
@@ -45,18 +75,58 @@ class RestartWriter : public Restart
 
     ~RestartWriter();
 
+    // In asynchronous mode the solution is copied into a host buffer and the
+    // data file is written with non-blocking collective I/O that overlaps
+    // the following time steps. At most the given number of writes are in
+    // flight; older writes are completed before their buffers are reused.
     void
     writeSolution(const Teuchos::RCP<const Thyra::VectorBase<double>>& x,
                   const Teuchos::RCP<const Thyra::VectorBase<double>>& x_dot,
                   const int index,
                   const double time = 0.0);
 
+    // Complete all pending asynchronous writes. Collective.
+    void finishWrites();
+
   private:
+    // Data file write that has been started but not completed. The buffers
+    // must not be modified or freed until the write request completes.
+    struct PendingWrite
+    {
+        MPI_File file;
+        MPI_Request request;
+        std::vector<double> values;
+        std::vector<unsigned char> data;
+    };
+
     Teuchos::RCP<const panzer::GlobalIndexer> _dof_manager;
     std::string _file_prefix;
+    Format _format;
+    bool _asynchronous;
+    int _max_pending_writes;
     std::vector<int> _displacements;
     std::unordered_map<panzer::GlobalOrdinal, int> _global_to_local;
+    std::vector<int> _field_numbers;
     MPI_Datatype _dof_type;
+    std::deque<PendingWrite> _pending_writes;
+
+    void writeRawSolution(MPI_Comm mpi_comm,
+                          const std::string& restart_file_name,
+                          std::vector<double>& x_copy,
+                          std::vector<double>& x_dot_copy,
+                          const int global_size,
+                          const double time,
+                          PendingWrite& write) const;
+
+    void writeCompressedSolution(MPI_Comm mpi_comm,
+                                 const std::string& restart_file_name,
+                                 const std::vector<double>& x_copy,
+                                 const std::vector<double>& x_dot_copy,
+                                 const uint64_t global_size,
+                                 const double time,
+                                 PendingWrite& write) const;
+
+    void completeWrite(PendingWrite& write) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -74,10 +144,20 @@ class RestartReader : public Restart
 
     double initialStateTime() const { return _t_init; }
 
+    Format format() const { return _format; }
+
   private:
     std::string _restart_file_name;
     std::string _dofmap_file_name;
     double _t_init;
+    Format _format;
+
+    void readCompressedSolution(
+        MPI_Comm mpi_comm,
+        const panzer::GlobalIndexer& dof_manager,
+        const std::unordered_map<panzer::GlobalOrdinal, int>& mapped_gids,
+        const Teuchos::RCP<Thyra::VectorBase<double>>& x,
+        const Teuchos::RCP<Thyra::VectorBase<double>>& x_dot) const;
 
     void update_vector(const Teuchos::RCP<Thyra::VectorBase<double>>& vec,
                        const std::vector<double>& data) const;
@@ -0,0 +1,283 @@
+#include "VertexCFD_Mesh_RestartCompression.hpp"
+
+#include <array>
+#include <cstring>
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+namespace RestartCompression
+{
+namespace
+{
+// Minimum match length of the LZ coder.
+constexpr std::size_t min_match = 4;
+
+// The last bytes of a chunk are always stored as literals so that matches
+// never read past the end of the input.
+constexpr std::size_t end_literals = 5;
+
+// Maximum distance of a match.
+constexpr std::size_t max_offset = 65535;
+
+// Number of bits of the match finder hash table.
+constexpr int hash_bits = 14;
+
+//---------------------------------------------------------------------------//
+std::uint32_t read32(const unsigned char* p)
+{
+    std::uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+//---------------------------------------------------------------------------//
+// Write a length in the LZ4 form of a 4-bit token value followed by bytes of
+// 255 and a final remainder byte.
+void writeLength(std::size_t length, std::vector<unsigned char>& out)
+{
+    while (length >= 255)
+    {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<unsigned char>(length));
+}
+
+//---------------------------------------------------------------------------//
+std::size_t readLength(const unsigned char* data,
+                       const std::size_t size,
+                       std::size_t& pos)
+{
+    std::size_t length = 0;
+    unsigned char byte;
+    do
+    {
+        if (pos >= size)
+            throw std::runtime_error("Corrupt restart data chunk");
+        byte = data[pos++];
+        length += byte;
+    } while (byte == 255);
+    return length;
+}
+
+//---------------------------------------------------------------------------//
+void writeSequence(const unsigned char* literals,
+                   const std::size_t num_literals,
+                   const std::size_t offset,
+                   const std::size_t match_length,
+                   std::vector<unsigned char>& out)
+{
+    const std::size_t match_code = match_length - min_match;
+    const unsigned char token = static_cast<unsigned char>(
+        ((num_literals < 15 ? num_literals : 15) << 4)
+        | (match_code < 15 ? match_code : 15));
+    out.push_back(token);
+    if (num_literals >= 15)
+        writeLength(num_literals - 15, out);
+    out.insert(out.end(), literals, literals + num_literals);
+    out.push_back(static_cast<unsigned char>(offset & 0xff));
+    out.push_back(static_cast<unsigned char>(offset >> 8));
+    if (match_code >= 15)
+        writeLength(match_code - 15, out);
+}
+
+//---------------------------------------------------------------------------//
+void compress(const unsigned char* in,
+              const std::size_t size,
+              std::vector<unsigned char>& out)
+{
+    out.clear();
+    out.reserve(size + size / 255 + 16);
+
+    std::vector<std::int64_t> table(std::size_t(1) << hash_bits, -1);
+    std::size_t anchor = 0;
+    std::size_t pos = 0;
+    while (size >= end_literals + min_match
+           && pos + min_match <= size - end_literals)
+    {
+        const std::uint32_t sequence = read32(in + pos);
+        const std::uint32_t hash = (sequence * 2654435761u)
+                                   >> (32 - hash_bits);
+        const std::int64_t candidate = table[hash];
+        table[hash] = pos;
+
+        if (candidate >= 0 && pos - candidate <= max_offset
+            && read32(in + candidate) == sequence)
+        {
+            std::size_t length = min_match;
+            while (pos + length < size - end_literals
+                   && in[candidate + length] == in[pos + length])
+            {
+                ++length;
+            }
+            writeSequence(
+                in + anchor, pos - anchor, pos - candidate, length, out);
+            pos += length;
+            anchor = pos;
+        }
+        else
+        {
+            ++pos;
+        }
+    }
+
+    // The last sequence only contains literals.
+    const std::size_t num_literals = size - anchor;
+    out.push_back(static_cast<unsigned char>(
+        (num_literals < 15 ? num_literals : 15) << 4));
+    if (num_literals >= 15)
+        writeLength(num_literals - 15, out);
+    out.insert(out.end(), in + anchor, in + size);
+}
+
+//---------------------------------------------------------------------------//
+void decompress(const unsigned char* in,
+                const std::size_t size,
+                unsigned char* out,
+                const std::size_t out_size)
+{
+    std::size_t pos = 0;
+    std::size_t out_pos = 0;
+    while (pos < size)
+    {
+        const unsigned char token = in[pos++];
+
+        std::size_t num_literals = token >> 4;
+        if (num_literals == 15)
+            num_literals += readLength(in, size, pos);
+        if (num_literals > size - pos || num_literals > out_size - out_pos)
+            throw std::runtime_error("Corrupt restart data chunk");
+        std::memcpy(out + out_pos, in + pos, num_literals);
+        pos += num_literals;
+        out_pos += num_literals;
+
+        // The last sequence has no match.
+        if (pos == size)
+            break;
+
+        if (pos + 2 > size)
+            throw std::runtime_error("Corrupt restart data chunk");
+        const std::size_t offset = in[pos] | (in[pos + 1] << 8);
+        pos += 2;
+        std::size_t length = token & 15;
+        if (length == 15)
+            length += readLength(in, size, pos);
+        length += min_match;
+        if (offset == 0 || offset > out_pos || length > out_size - out_pos)
+            throw std::runtime_error("Corrupt restart data chunk");
+
+        // Matches may overlap the output so copy byte by byte.
+        for (std::size_t i = 0; i < length; ++i, ++out_pos)
+            out[out_pos] = out[out_pos - offset];
+    }
+
+    if (out_pos != out_size)
+        throw std::runtime_error("Corrupt restart data chunk");
+}
+
+//---------------------------------------------------------------------------//
+std::array<std::uint32_t, 256> crcTable()
+{
+    std::array<std::uint32_t, 256> table;
+    for (std::uint32_t i = 0; i < 256; ++i)
+    {
+        std::uint32_t c = i;
+        for (int k = 0; k < 8; ++k)
+            c = (c & 1) ? 0xedb88320u ^ (c >> 1) : c >> 1;
+        table[i] = c;
+    }
+    return table;
+}
+
+} // namespace
+
+//---------------------------------------------------------------------------//
+Encoding encode(const double* values,
+                const std::size_t count,
+                std::vector<unsigned char>& data)
+{
+    constexpr std::size_t width = sizeof(double);
+    const std::size_t size = count * width;
+
+    // Shuffle the bytes so that byte b of every value is contiguous.
+    const auto bytes = reinterpret_cast<const unsigned char*>(values);
+    std::vector<unsigned char> shuffled(size);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        for (std::size_t b = 0; b < width; ++b)
+            shuffled[b * count + i] = bytes[i * width + b];
+    }
+
+    compress(shuffled.data(), size, data);
+    if (data.size() < size)
+        return Encoding::shuffle_lz;
+
+    data.assign(bytes, bytes + size);
+    return Encoding::raw;
+}
+
+//---------------------------------------------------------------------------//
+void decode(const unsigned char* data,
+            const std::size_t size,
+            const Encoding encoding,
+            double* values,
+            const std::size_t count)
+{
+    constexpr std::size_t width = sizeof(double);
+    const std::size_t out_size = count * width;
+    auto bytes = reinterpret_cast<unsigned char*>(values);
+
+    if (encoding == Encoding::raw)
+    {
+        if (size != out_size)
+            throw std::runtime_error("Corrupt restart data chunk");
+        std::memcpy(bytes, data, size);
+    }
+    else if (encoding == Encoding::shuffle_lz)
+    {
+        std::vector<unsigned char> shuffled(out_size);
+        decompress(data, size, shuffled.data(), out_size);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            for (std::size_t b = 0; b < width; ++b)
+                bytes[i * width + b] = shuffled[b * count + i];
+        }
+    }
+    else
+    {
+        throw std::runtime_error("Unknown restart data chunk encoding");
+    }
+}
+
+//---------------------------------------------------------------------------//
+std::uint32_t crc32(const void* data, const std::size_t size)
+{
+    static const auto table = crcTable();
+    const auto bytes = static_cast<const unsigned char*>(data);
+    std::uint32_t crc = 0xffffffffu;
+    for (std::size_t i = 0; i < size; ++i)
+        crc = table[(crc ^ bytes[i]) & 0xff] ^ (crc >> 8);
+    return crc ^ 0xffffffffu;
+}
+
+//---------------------------------------------------------------------------//
+std::uint64_t dofChecksum(const std::uint64_t gid, const double value)
+{
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    // splitmix64 finalizer of the combined id and value bits.
+    std::uint64_t hash = bits ^ (gid * 0x9e3779b97f4a7c15);
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+    return hash ^ (hash >> 31);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace RestartCompression
+} // end namespace Mesh
+} // end namespace VertexCFD
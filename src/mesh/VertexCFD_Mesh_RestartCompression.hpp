@@ -0,0 +1,54 @@
+#ifndef VERTEXCFD_MESH_RESTARTCOMPRESSION_HPP
+#define VERTEXCFD_MESH_RESTARTCOMPRESSION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+namespace RestartCompression
+{
+//---------------------------------------------------------------------------//
+// Lossless compression of chunks of restart data. The bytes of the values are
+// shuffled so that bytes of equal significance are contiguous, which exposes
+// the repeated sign and exponent bytes of smooth fields, and the result is
+// compressed with a byte-oriented LZ77 coder using the LZ4 block layout.
+// Chunks that do not compress are stored unchanged.
+//---------------------------------------------------------------------------//
+enum class Encoding : std::uint32_t
+{
+    raw = 0,
+    shuffle_lz = 1
+};
+
+// Encode a chunk of values and return the encoding used.
+Encoding encode(const double* values,
+                const std::size_t count,
+                std::vector<unsigned char>& data);
+
+// Decode a chunk of values. Throws if the data is malformed or does not
+// decode to the given number of values.
+void decode(const unsigned char* data,
+            const std::size_t size,
+            const Encoding encoding,
+            double* values,
+            const std::size_t count);
+
+// CRC-32 (IEEE 802.3) checksum of a byte sequence.
+std::uint32_t crc32(const void* data, const std::size_t size);
+
+// Order independent checksum contribution of a single degree of freedom.
+// Contributions are summed so the checksum of a field does not depend on
+// the partitioning of the mesh.
+std::uint64_t dofChecksum(const std::uint64_t gid, const double value);
+
+//---------------------------------------------------------------------------//
+
+} // end namespace RestartCompression
+} // end namespace Mesh
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_MESH_RESTARTCOMPRESSION_HPP
@@ -0,0 +1,294 @@
+#include "VertexCFD_Mesh_WallDistanceCache.hpp"
+#include "VertexCFD_Mesh_Restart.hpp"
+
+#include <Teuchos_DefaultMpiComm.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+namespace
+{
+// File identifier and format version stored at the start of the header.
+constexpr std::uint64_t cache_magic = 0x5644434643445743;
+constexpr std::uint64_t cache_version = 1;
+
+// Number of 64-bit entries in the header.
+constexpr int header_length = 5;
+} // namespace
+
+//---------------------------------------------------------------------------//
+WallDistanceCache::WallDistanceCache(
+    const Teuchos::RCP<const panzer_stk::STK_Interface>& mesh,
+    const std::string& file_name,
+    const std::vector<int>& element_lids,
+    const int values_per_element,
+    const std::uint64_t parameter_hash)
+    : _file_name(file_name)
+    , _values_per_element(values_per_element)
+{
+    // Get the MPI communicator.
+    auto comm = mesh->getComm();
+    _mpi_comm = Teuchos::getRawMpiComm(*comm);
+
+    // Order the local elements by global id.
+    const int num_elem = element_lids.size();
+    const auto elements = mesh->getElementsOrderedByLID();
+    std::vector<std::uint64_t> gids(num_elem);
+    for (int i = 0; i < num_elem; ++i)
+        gids[i] = mesh->elementGlobalId((*elements)[element_lids[i]]);
+
+    _sorted_index.resize(num_elem);
+    std::iota(_sorted_index.begin(), _sorted_index.end(), 0);
+    std::sort(_sorted_index.begin(),
+              _sorted_index.end(),
+              [&](const int i, const int j) { return gids[i] < gids[j]; });
+    std::vector<std::uint64_t> sorted_gids(num_elem);
+    for (int i = 0; i < num_elem; ++i)
+        sorted_gids[i] = gids[_sorted_index[i]];
+
+    // Get the position of the local elements in the file.
+    const auto positions
+        = Restart::sortedGlobalPositions(_mpi_comm, sorted_gids);
+    _global_num_elem = num_elem;
+    MPI_Allreduce(MPI_IN_PLACE,
+                  &_global_num_elem,
+                  1,
+                  MPI_UINT64_T,
+                  MPI_SUM,
+                  _mpi_comm);
+
+    // Create the file view of the local data. The displacements are in bytes
+    // and 64-bit so that they do not overflow on large meshes.
+    std::vector<MPI_Aint> displacements(num_elem);
+    for (int i = 0; i < num_elem; ++i)
+    {
+        displacements[i] = static_cast<MPI_Aint>(positions[i])
+                           * _values_per_element * sizeof(double);
+    }
+    MPI_Datatype indexed;
+    MPI_Type_create_hindexed_block(displacements.size(),
+                                   _values_per_element,
+                                   displacements.data(),
+                                   MPI_DOUBLE,
+                                   &indexed);
+    MPI_Aint extent = static_cast<MPI_Aint>(_global_num_elem)
+                      * _values_per_element * sizeof(double);
+    MPI_Type_create_resized(indexed, 0, extent, &_data_type);
+    MPI_Type_free(&indexed);
+    MPI_Type_commit(&_data_type);
+
+    // Hash the global id and vertex coordinates of each element. The element
+    // hashes are summed so the result does not depend on the element order
+    // or on the partitioning of the mesh.
+    auto bulk = mesh->getBulkData();
+    const int num_space_dim = mesh->getDimension();
+    std::uint64_t geometry_hash = 0;
+    for (int i = 0; i < num_elem; ++i)
+    {
+        const auto element = (*elements)[element_lids[i]];
+        std::uint64_t element_hash = hashValue(gids[i], 0);
+        const stk::mesh::Entity* nodes = bulk->begin_nodes(element);
+        const int num_nodes = bulk->num_nodes(element);
+        for (int n = 0; n < num_nodes; ++n)
+        {
+            const double* x = mesh->getNodeCoordinates(nodes[n]);
+            for (int dim = 0; dim < num_space_dim; ++dim)
+            {
+                std::uint64_t bits;
+                std::memcpy(&bits, &x[dim], sizeof(bits));
+                element_hash = hashValue(bits, element_hash);
+            }
+        }
+        geometry_hash += element_hash;
+    }
+    MPI_Allreduce(
+        MPI_IN_PLACE, &geometry_hash, 1, MPI_UINT64_T, MPI_SUM, _mpi_comm);
+
+    _hash = hashValue(geometry_hash, parameter_hash);
+    _hash = hashValue(_global_num_elem, _hash);
+}
+
+//---------------------------------------------------------------------------//
+WallDistanceCache::~WallDistanceCache()
+{
+    MPI_Type_free(&_data_type);
+}
+
+//---------------------------------------------------------------------------//
+bool WallDistanceCache::read(std::vector<double>& values) const
+{
+    // Open the cache file. A missing file is not an error.
+    MPI_File cache_file;
+    const int error_code = MPI_File_open(_mpi_comm,
+                                         _file_name.c_str(),
+                                         MPI_MODE_RDONLY,
+                                         MPI_INFO_NULL,
+                                         &cache_file);
+    if (MPI_SUCCESS != error_code)
+        return false;
+
+    // Check the header and the file size against the current mesh and
+    // parameters.
+    std::uint64_t header[header_length] = {};
+    MPI_File_set_view(
+        cache_file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+    MPI_File_read_all(
+        cache_file, header, header_length, MPI_UINT64_T, MPI_STATUS_IGNORE);
+    MPI_Offset file_size;
+    MPI_File_get_size(cache_file, &file_size);
+    const MPI_Offset header_size = header_length * sizeof(std::uint64_t);
+    const MPI_Offset expected_size
+        = header_size
+          + _global_num_elem * _values_per_element * sizeof(double);
+    if (header[0] != cache_magic || header[1] != cache_version
+        || header[2] != _hash || header[3] != _global_num_elem
+        || header[4] != static_cast<std::uint64_t>(_values_per_element)
+        || file_size != expected_size)
+    {
+        MPI_File_close(&cache_file);
+        return false;
+    }
+
+    // Read the local data in global id order.
+    const int num_elem = _sorted_index.size();
+    std::vector<double> sorted_values(num_elem * _values_per_element);
+    MPI_File_set_view(cache_file,
+                      header_size,
+                      MPI_DOUBLE,
+                      _data_type,
+                      "native",
+                      MPI_INFO_NULL);
+    MPI_File_read_all(cache_file,
+                      sorted_values.data(),
+                      sorted_values.size(),
+                      MPI_DOUBLE,
+                      MPI_STATUS_IGNORE);
+    MPI_File_close(&cache_file);
+
+    // Reorder to the local element order.
+    values.resize(sorted_values.size());
+    for (int i = 0; i < num_elem; ++i)
+    {
+        for (int v = 0; v < _values_per_element; ++v)
+        {
+            values[_sorted_index[i] * _values_per_element + v]
+                = sorted_values[i * _values_per_element + v];
+        }
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void WallDistanceCache::write(const std::vector<double>& values) const
+{
+    const int num_elem = _sorted_index.size();
+    if (values.size() != static_cast<std::size_t>(num_elem)
+                             * _values_per_element)
+    {
+        throw std::logic_error(
+            "Wall distance cache values do not match the number of "
+            "elements");
+    }
+
+    // Open the cache file and discard any previous contents.
+    MPI_File cache_file;
+    const int error_code = MPI_File_open(_mpi_comm,
+                                         _file_name.c_str(),
+                                         MPI_MODE_WRONLY | MPI_MODE_CREATE,
+                                         MPI_INFO_NULL,
+                                         &cache_file);
+    if (MPI_SUCCESS != error_code)
+    {
+        char error_string[MPI_MAX_ERROR_STRING + 1]{};
+        int error_string_len = 0;
+        MPI_Error_string(error_code, error_string, &error_string_len);
+        error_string[error_string_len] = 0;
+
+        std::string msg{"Error creating wall distance cache file `"
+                        + _file_name + "' : "};
+        msg += error_string;
+
+        throw std::runtime_error(msg);
+    }
+    MPI_File_set_size(cache_file, 0);
+
+    // Write the header on rank 0.
+    int comm_rank;
+    MPI_Comm_rank(_mpi_comm, &comm_rank);
+    MPI_File_set_view(
+        cache_file, 0, MPI_BYTE, MPI_BYTE, "native", MPI_INFO_NULL);
+    if (0 == comm_rank)
+    {
+        const std::uint64_t header[header_length]
+            = {cache_magic,
+               cache_version,
+               _hash,
+               _global_num_elem,
+               static_cast<std::uint64_t>(_values_per_element)};
+        MPI_File_write_at(cache_file,
+                          0,
+                          header,
+                          header_length,
+                          MPI_UINT64_T,
+                          MPI_STATUS_IGNORE);
+    }
+
+    // Write the local data in global id order.
+    std::vector<double> sorted_values(values.size());
+    for (int i = 0; i < num_elem; ++i)
+    {
+        for (int v = 0; v < _values_per_element; ++v)
+        {
+            sorted_values[i * _values_per_element + v]
+                = values[_sorted_index[i] * _values_per_element + v];
+        }
+    }
+    const MPI_Offset header_size = header_length * sizeof(std::uint64_t);
+    MPI_File_set_view(cache_file,
+                      header_size,
+                      MPI_DOUBLE,
+                      _data_type,
+                      "native",
+                      MPI_INFO_NULL);
+    MPI_File_write_all(cache_file,
+                       sorted_values.data(),
+                       sorted_values.size(),
+                       MPI_DOUBLE,
+                       MPI_STATUS_IGNORE);
+
+    // Cleanup.
+    MPI_File_close(&cache_file);
+}
+
+//---------------------------------------------------------------------------//
+std::uint64_t WallDistanceCache::hashString(const std::string& value,
+                                            const std::uint64_t seed)
+{
+    std::uint64_t hash = hashValue(value.size(), seed);
+    for (const char c : value)
+        hash = hashValue(static_cast<unsigned char>(c), hash);
+    return hash;
+}
+
+//---------------------------------------------------------------------------//
+std::uint64_t WallDistanceCache::hashValue(const std::uint64_t value,
+                                           const std::uint64_t seed)
+{
+    // Combine with the seed and apply the splitmix64 finalizer.
+    std::uint64_t hash = seed ^ (value + 0x9e3779b97f4a7c15 + (seed << 6)
+                                 + (seed >> 2));
+    hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+    hash = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+    return hash ^ (hash >> 31);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Mesh
+} // end namespace VertexCFD
@@ -0,0 +1,77 @@
+#ifndef VERTEXCFD_MESH_WALLDISTANCECACHE_HPP
+#define VERTEXCFD_MESH_WALLDISTANCECACHE_HPP
+
+#include <Panzer_STK_Interface.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <mpi.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Mesh
+{
+//---------------------------------------------------------------------------//
+// Binary file storing a fixed number of wall distance values per element.
+// The elements are laid out in increasing global id order so the file can be
+// read back with any number of ranks and any partitioning of the mesh. The
+// file header stores a hash of the element coordinates and of the wall
+// distance parameters and the data is only read back if both match.
+//---------------------------------------------------------------------------//
+class WallDistanceCache
+{
+  public:
+    // The element local ids are the elements whose data is read or written
+    // by this rank and must be locally owned.
+    WallDistanceCache(const Teuchos::RCP<const panzer_stk::STK_Interface>& mesh,
+                      const std::string& file_name,
+                      const std::vector<int>& element_lids,
+                      const int values_per_element,
+                      const std::uint64_t parameter_hash);
+
+    ~WallDistanceCache();
+
+    // Read the values ordered as (element, value) in the order of the
+    // element local ids. Returns false if the file does not exist or was
+    // written for a different mesh or set of parameters.
+    bool read(std::vector<double>& values) const;
+
+    // Write the values ordered as (element, value) in the order of the
+    // element local ids.
+    void write(const std::vector<double>& values) const;
+
+    // Hash of the element coordinates and parameters stored in the header.
+    std::uint64_t hash() const { return _hash; }
+
+    // Hash a string into a running hash value.
+    static std::uint64_t hashString(const std::string& value,
+                                    const std::uint64_t seed);
+
+    // Hash a 64-bit value into a running hash value.
+    static std::uint64_t hashValue(const std::uint64_t value,
+                                   const std::uint64_t seed);
+
+  private:
+    MPI_Comm _mpi_comm;
+    std::string _file_name;
+    int _values_per_element;
+    std::uint64_t _global_num_elem;
+    std::uint64_t _hash;
+
+    // Local element index of each entry in global id order.
+    std::vector<int> _sorted_index;
+
+    // File view of the local data.
+    MPI_Datatype _data_type;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Mesh
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_MESH_WALLDISTANCECACHE_HPP
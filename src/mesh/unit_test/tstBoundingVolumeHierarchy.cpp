@@ -0,0 +1,256 @@
+#include <VertexCFD_EvaluatorTestHarness.hpp>
+
+#include <mesh/VertexCFD_Mesh_BoundingVolumeHierarchy.hpp>
+#include <mesh/VertexCFD_Mesh_GeometryPrimitives.hpp>
+
+#include <Phalanx_KokkosDeviceTypes.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Compare the nearest edge distance found with the tree to a brute force
+// search over all edges of a closed polygon.
+TEST(BoundingVolumeHierarchy, edges_2d)
+{
+    const int num_side = 97;
+    const int num_query = 21;
+    const double pi = std::acos(-1.0);
+
+    Kokkos::View<double***, PHX::Device> sides("sides", num_side, 2, 2);
+    auto sides_host = Kokkos::create_mirror_view(sides);
+    for (int s = 0; s < num_side; ++s)
+    {
+        for (int n = 0; n < 2; ++n)
+        {
+            const double theta = 2.0 * pi * (s + n) / num_side;
+            const double radius = 1.0 + 0.2 * std::sin(5.0 * theta);
+            sides_host(s, n, 0) = radius * std::cos(theta);
+            sides_host(s, n, 1) = radius * std::sin(theta);
+        }
+    }
+    Kokkos::deep_copy(sides, sides_host);
+
+    Kokkos::View<double***, PHX::Device> points(
+        "points", 1, num_query * num_query, 2);
+    auto points_host = Kokkos::create_mirror_view(points);
+    for (int i = 0; i < num_query; ++i)
+    {
+        for (int j = 0; j < num_query; ++j)
+        {
+            points_host(0, i * num_query + j, 0) = -2.0 + 4.0 * i / num_query;
+            points_host(0, i * num_query + j, 1) = -2.0 + 4.0 * j / num_query;
+        }
+    }
+    Kokkos::deep_copy(points, points_host);
+
+    const Mesh::Topology::BoundingVolumeHierarchy<> bvh(sides, 2);
+    EXPECT_GT(bvh.numNodes(), 1);
+
+    Kokkos::View<double**, PHX::Device> result(
+        "result", num_query * num_query, 2);
+    Kokkos::parallel_for(
+        "edgeSearchTest",
+        Kokkos::RangePolicy<PHX::exec_space>(0, num_query * num_query),
+        KOKKOS_LAMBDA(const int point) {
+            int index[2] = {0, 1};
+            auto side_distance = [&](const int side) {
+                return GeometryPrimitives::distanceToLinearEdge(
+                    sides, side, points, 0, point, 2, index);
+            };
+
+            double brute_force = 1e8;
+            for (int side = 0; side < num_side; ++side)
+                brute_force = Kokkos::fmin(brute_force, side_distance(side));
+            result(point, 0) = brute_force;
+
+            const double p[3] = {points(0, point, 0), points(0, point, 1), 0.0};
+            result(point, 1) = bvh.nearest(p, side_distance, 1e8);
+        });
+
+    auto result_host
+        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result);
+    for (int point = 0; point < num_query * num_query; ++point)
+        EXPECT_EQ(result_host(point, 0), result_host(point, 1));
+}
+
+//---------------------------------------------------------------------------//
+// Compare the nearest triangle distance found with the tree to a brute force
+// search over all triangles of a wavy surface.
+TEST(BoundingVolumeHierarchy, triangles_3d)
+{
+    const int num_cell = 12;
+    const int num_side = 2 * num_cell * num_cell;
+    const int num_query = 9;
+
+    Kokkos::View<double***, PHX::Device> sides("sides", num_side, 3, 3);
+    auto sides_host = Kokkos::create_mirror_view(sides);
+    auto height = [](const double x, const double y) {
+        return 0.1 * std::sin(3.0 * x) * std::cos(2.0 * y);
+    };
+    const double h = 1.0 / num_cell;
+    for (int i = 0; i < num_cell; ++i)
+    {
+        for (int j = 0; j < num_cell; ++j)
+        {
+            const double x[4] = {i * h, (i + 1) * h, (i + 1) * h, i * h};
+            const double y[4] = {j * h, j * h, (j + 1) * h, (j + 1) * h};
+            const int nodes[2][3] = {{0, 1, 2}, {0, 2, 3}};
+            for (int t = 0; t < 2; ++t)
+            {
+                const int s = 2 * (i * num_cell + j) + t;
+                for (int n = 0; n < 3; ++n)
+                {
+                    sides_host(s, n, 0) = x[nodes[t][n]];
+                    sides_host(s, n, 1) = y[nodes[t][n]];
+                    sides_host(s, n, 2)
+                        = height(x[nodes[t][n]], y[nodes[t][n]]);
+                }
+            }
+        }
+    }
+    Kokkos::deep_copy(sides, sides_host);
+
+    const int num_point = num_query * num_query * num_query;
+    Kokkos::View<double***, PHX::Device> points("points", 1, num_point, 3);
+    auto points_host = Kokkos::create_mirror_view(points);
+    for (int i = 0; i < num_query; ++i)
+    {
+        for (int j = 0; j < num_query; ++j)
+        {
+            for (int k = 0; k < num_query; ++k)
+            {
+                const int p = (i * num_query + j) * num_query + k;
+                points_host(0, p, 0) = -0.5 + 2.0 * i / num_query;
+                points_host(0, p, 1) = -0.5 + 2.0 * j / num_query;
+                points_host(0, p, 2) = -1.0 + 2.0 * k / num_query;
+            }
+        }
+    }
+    Kokkos::deep_copy(points, points_host);
+
+    const Mesh::Topology::BoundingVolumeHierarchy<> bvh(sides, 3);
+    EXPECT_GT(bvh.numNodes(), 1);
+
+    Kokkos::View<double**, PHX::Device> normals("normals", num_side, 3);
+    Kokkos::View<double**, PHX::Device> result("result", num_point, 2);
+    Kokkos::parallel_for(
+        "triangleSearchTest",
+        Kokkos::RangePolicy<PHX::exec_space>(0, num_point),
+        KOKKOS_LAMBDA(const int point) {
+            int index[3] = {0, 1, 2};
+            auto side_distance = [&](const int side) {
+                return GeometryPrimitives::distanceToTriangleFace(
+                    sides, normals, side, points, 0, point, index);
+            };
+
+            double brute_force = 1e8;
+            for (int side = 0; side < num_side; ++side)
+                brute_force = Kokkos::fmin(brute_force, side_distance(side));
+            result(point, 0) = brute_force;
+
+            const double p[3] = {points(0, point, 0),
+                                 points(0, point, 1),
+                                 points(0, point, 2)};
+            result(point, 1) = bvh.nearest(p, side_distance, 1e8);
+        });
+
+    auto result_host
+        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result);
+    for (int point = 0; point < num_point; ++point)
+        EXPECT_EQ(result_host(point, 0), result_host(point, 1));
+}
+
+//---------------------------------------------------------------------------//
+// Compare the squares found to contain a point with a host tree to a brute
+// force search over a grid of overlapping squares.
+TEST(BoundingVolumeHierarchy, containing_2d)
+{
+    const int num_cell = 9;
+    const int num_side = num_cell * num_cell;
+    const double h = 1.0 / num_cell;
+
+    Kokkos::View<double***, Kokkos::HostSpace> sides("sides", num_side, 2, 2);
+    for (int i = 0; i < num_cell; ++i)
+    {
+        for (int j = 0; j < num_cell; ++j)
+        {
+            const int s = i * num_cell + j;
+            sides(s, 0, 0) = (i - 0.25) * h;
+            sides(s, 0, 1) = (j - 0.25) * h;
+            sides(s, 1, 0) = (i + 1.25) * h;
+            sides(s, 1, 1) = (j + 1.25) * h;
+        }
+    }
+
+    const Mesh::Topology::BoundingVolumeHierarchy<Kokkos::HostSpace> bvh(
+        sides, 2);
+
+    auto contains = [&](const int s, const double p[3]) {
+        return p[0] >= sides(s, 0, 0) && p[0] <= sides(s, 1, 0)
+               && p[1] >= sides(s, 0, 1) && p[1] <= sides(s, 1, 1);
+    };
+
+    for (int q = 0; q < 50; ++q)
+    {
+        const double p[3] = {0.0193 * q, 1.0 - 0.0171 * q, 0.0};
+
+        int brute_force = 0;
+        for (int s = 0; s < num_side; ++s)
+            brute_force += contains(s, p);
+
+        int visited = 0;
+        const bool found = bvh.visitContaining(p, [&](const int s) {
+            visited += contains(s, p);
+            return false;
+        });
+        EXPECT_FALSE(found);
+        EXPECT_EQ(brute_force, visited);
+
+        // Stop at the first containing square.
+        int first = -1;
+        EXPECT_EQ(brute_force > 0, bvh.visitContaining(p, [&](const int s) {
+            if (!contains(s, p))
+                return false;
+            first = s;
+            return true;
+        }));
+        if (brute_force > 0)
+            EXPECT_TRUE(contains(first, p));
+    }
+}
+
+//---------------------------------------------------------------------------//
+// An empty tree returns the initial distance.
+TEST(BoundingVolumeHierarchy, empty)
+{
+    Kokkos::View<double***, PHX::Device> sides("sides", 0, 2, 2);
+    const Mesh::Topology::BoundingVolumeHierarchy<> bvh(sides, 2);
+    EXPECT_EQ(0, bvh.numNodes());
+
+    Kokkos::View<double*, PHX::Device> result("result", 1);
+    Kokkos::parallel_for(
+        "emptySearchTest",
+        Kokkos::RangePolicy<PHX::exec_space>(0, 1),
+        KOKKOS_LAMBDA(const int) {
+            const double p[3] = {0.0, 0.0, 0.0};
+            result(0) = bvh.nearest(
+                p, [](const int) { return 0.0; }, 1e8);
+        });
+    auto result_host
+        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), result);
+    EXPECT_EQ(1e8, result_host(0));
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
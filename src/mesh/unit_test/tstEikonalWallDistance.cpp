@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <mesh/VertexCFD_Mesh_EikonalWallDistance.hpp>
+
+#include <Panzer_STK_CubeHexMeshFactory.hpp>
+#include <Panzer_STK_SquareQuadMeshFactory.hpp>
+#include <Panzer_STK_SquareTriMeshFactory.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Build a channel with walls at y = -1 and y = 1 and check the nodal
+// distance against the exact distance 1 - |y|. Planar fronts are reproduced
+// exactly by the simplex updates.
+template<class MeshFactory>
+void testChannel(const int num_space_dim)
+{
+    auto mesh_factory = Teuchos::rcp(new MeshFactory());
+    auto mesh_params = Teuchos::parameterList();
+    mesh_params->set("X0", 0.0);
+    mesh_params->set("Xf", 1.0);
+    mesh_params->set("X Elements", 6);
+    mesh_params->set("Y0", -1.0);
+    mesh_params->set("Yf", 1.0);
+    mesh_params->set("Y Elements", 8);
+    if (num_space_dim == 3)
+    {
+        mesh_params->set("Z0", 0.0);
+        mesh_params->set("Zf", 1.0);
+        mesh_params->set("Z Elements", 3);
+    }
+    mesh_factory->setParameterList(mesh_params);
+    auto mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+    mesh_factory->completeMeshConstruction(*mesh, MPI_COMM_WORLD);
+
+    const std::vector<std::string> walls = {"top", "bottom"};
+    const Mesh::Topology::EikonalWallDistance eikonal(mesh, walls);
+    EXPECT_GT(eikonal.numIterations(), 0);
+
+    auto distance = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), eikonal.elementNodeDistance());
+
+    std::vector<stk::mesh::Entity> elements;
+    mesh->getMyElements(elements);
+    auto bulk = mesh->getBulkData();
+    for (const auto& element : elements)
+    {
+        const int lid = mesh->elementLocalId(element);
+        const stk::mesh::Entity* nodes = bulk->begin_nodes(element);
+        for (std::size_t v = 0; v < distance.extent(1); ++v)
+        {
+            const double* x = mesh->getNodeCoordinates(nodes[v]);
+            EXPECT_NEAR(1.0 - std::abs(x[1]), distance(lid, v), 1.0e-10);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// Build a box with walls at x = 0 and y = 0 and check the nodal distance
+// against the exact distance min(x, y). The two fronts meet along the
+// diagonal, where the first order updates underestimate the distance by a
+// fraction of the mesh size. Check the error bound on two meshes.
+template<class MeshFactory>
+void testCorner(const int num_space_dim)
+{
+    for (const int num_elem : {4, 8})
+    {
+        auto mesh_factory = Teuchos::rcp(new MeshFactory());
+        auto mesh_params = Teuchos::parameterList();
+        mesh_params->set("X0", 0.0);
+        mesh_params->set("Xf", 1.0);
+        mesh_params->set("X Elements", num_elem);
+        mesh_params->set("Y0", 0.0);
+        mesh_params->set("Yf", 1.0);
+        mesh_params->set("Y Elements", num_elem);
+        if (num_space_dim == 3)
+        {
+            mesh_params->set("Z0", 0.0);
+            mesh_params->set("Zf", 1.0);
+            mesh_params->set("Z Elements", 2);
+        }
+        mesh_factory->setParameterList(mesh_params);
+        auto mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+        mesh_factory->completeMeshConstruction(*mesh, MPI_COMM_WORLD);
+
+        const std::vector<std::string> walls = {"left", "bottom"};
+        const Mesh::Topology::EikonalWallDistance eikonal(mesh, walls);
+
+        auto distance = Kokkos::create_mirror_view_and_copy(
+            Kokkos::HostSpace(), eikonal.elementNodeDistance());
+
+        const double h = 1.0 / num_elem;
+        std::vector<stk::mesh::Entity> elements;
+        mesh->getMyElements(elements);
+        auto bulk = mesh->getBulkData();
+        for (const auto& element : elements)
+        {
+            const int lid = mesh->elementLocalId(element);
+            const stk::mesh::Entity* nodes = bulk->begin_nodes(element);
+            for (std::size_t v = 0; v < distance.extent(1); ++v)
+            {
+                const double* x = mesh->getNodeCoordinates(nodes[v]);
+                const double exact = std::fmin(x[0], x[1]);
+                if (exact == 0.0)
+                    EXPECT_EQ(0.0, distance(lid, v));
+                else
+                    EXPECT_NEAR(exact, distance(lid, v), h);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(EikonalWallDistance, quad4)
+{
+    testChannel<panzer_stk::SquareQuadMeshFactory>(2);
+}
+
+//---------------------------------------------------------------------------//
+TEST(EikonalWallDistance, tri3)
+{
+    testChannel<panzer_stk::SquareTriMeshFactory>(2);
+}
+
+//---------------------------------------------------------------------------//
+TEST(EikonalWallDistance, hex8)
+{
+    testChannel<panzer_stk::CubeHexMeshFactory>(3);
+}
+
+//---------------------------------------------------------------------------//
+TEST(EikonalWallDistance, corner_quad4)
+{
+    testCorner<panzer_stk::SquareQuadMeshFactory>(2);
+}
+
+//---------------------------------------------------------------------------//
+TEST(EikonalWallDistance, corner_tri3)
+{
+    testCorner<panzer_stk::SquareTriMeshFactory>(2);
+}
+
+//---------------------------------------------------------------------------//
+TEST(EikonalWallDistance, corner_hex8)
+{
+    testCorner<panzer_stk::CubeHexMeshFactory>(3);
+}
+
+//---------------------------------------------------------------------------//
+// A single sweep cannot reach the nodes away from the walls.
+TEST(EikonalWallDistance, not_converged)
+{
+    auto mesh_factory = Teuchos::rcp(new panzer_stk::SquareQuadMeshFactory());
+    auto mesh_params = Teuchos::parameterList();
+    mesh_params->set("X Elements", 8);
+    mesh_params->set("Y Elements", 8);
+    mesh_factory->setParameterList(mesh_params);
+    auto mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+    mesh_factory->completeMeshConstruction(*mesh, MPI_COMM_WORLD);
+
+    const std::vector<std::string> walls = {"left", "bottom"};
+    EXPECT_THROW(Mesh::Topology::EikonalWallDistance(mesh, walls, 1.0e-12, 1),
+                 std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
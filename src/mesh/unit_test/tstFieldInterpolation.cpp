@@ -0,0 +1,208 @@
+#include <gtest/gtest.h>
+
+#include <mesh/VertexCFD_Mesh_FieldInterpolation.hpp>
+
+#include <Panzer_DOFManager.hpp>
+#include <Panzer_Intrepid2FieldPattern.hpp>
+#include <Panzer_IntrepidBasisFactory.hpp>
+#include <Panzer_STKConnManager.hpp>
+#include <Panzer_STK_SquareQuadMeshFactory.hpp>
+
+#include <Shards_CellTopology.hpp>
+
+#include <Teuchos_DefaultMpiComm.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Linear field which is reproduced exactly by the bilinear basis.
+double testField(const double x, const double y)
+{
+    return 1.0 + 2.0 * x - 3.0 * y;
+}
+
+//---------------------------------------------------------------------------//
+struct Fixture
+{
+    Teuchos::RCP<panzer_stk::STK_Interface> _mesh;
+    Teuchos::RCP<panzer::DOFManager> _dof_manager;
+    Kokkos::View<double*, PHX::Device> _source_data;
+
+    Fixture()
+    {
+        // Create the source mesh.
+        auto mesh_factory
+            = Teuchos::rcp(new panzer_stk::SquareQuadMeshFactory());
+        auto mesh_params = Teuchos::parameterList();
+        mesh_params->set("X Procs", -1);
+        mesh_params->set("Y Procs", -1);
+        mesh_params->set("X0", 0.0);
+        mesh_params->set("Y0", 0.0);
+        mesh_params->set("Xf", 1.0);
+        mesh_params->set("Yf", 1.0);
+        mesh_params->set("X Elements", 13);
+        mesh_params->set("Y Elements", 11);
+        mesh_factory->setParameterList(mesh_params);
+        _mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+        mesh_factory->completeMeshConstruction(*_mesh, MPI_COMM_WORLD);
+
+        // Create dof manager with a bilinear field.
+        auto conn_manager = Teuchos::rcp(new panzer_stk::STKConnManager(_mesh));
+        _dof_manager = Teuchos::rcp(
+            new panzer::DOFManager(conn_manager, MPI_COMM_WORLD));
+        shards::CellTopology cell_topo(
+            shards::getCellTopologyData<shards::Quadrilateral<4>>());
+        auto basis = panzer::createIntrepid2Basis<PHX::Device, double, double>(
+            "HGrad", 1, cell_topo);
+        auto field_pattern
+            = Teuchos::rcp(new panzer::Intrepid2FieldPattern(basis));
+        _dof_manager->addField("eblock-0_0", "test_field", field_pattern);
+        _dof_manager->buildGlobalUnknowns();
+
+        // Evaluate the field at the nodes of the local elements.
+        std::unordered_map<panzer::GlobalOrdinal, double> gid_values;
+        const auto& coord_field = _mesh->getCoordinatesField();
+        const auto& local_elems = *(_mesh->getElementsOrderedByLID());
+        std::vector<panzer::GlobalOrdinal> elem_dofs;
+        for (std::size_t i = 0; i < local_elems.size(); ++i)
+        {
+            _dof_manager->getElementGIDs(i, elem_dofs);
+            const stk::mesh::Entity* elem_nodes
+                = _mesh->getBulkData()->begin_nodes(local_elems[i]);
+            for (std::size_t d = 0; d < elem_dofs.size(); ++d)
+            {
+                const double* node_coords
+                    = stk::mesh::field_data(coord_field, elem_nodes[d]);
+                gid_values[elem_dofs[d]]
+                    = testField(node_coords[0], node_coords[1]);
+            }
+        }
+
+        // Store the values in the owned and ghosted ordering.
+        std::vector<panzer::GlobalOrdinal> ghosted_gids;
+        _dof_manager->getOwnedAndGhostedIndices(ghosted_gids);
+        _source_data = Kokkos::View<double*, PHX::Device>(
+            "source_data", ghosted_gids.size());
+        auto source_data_host = Kokkos::create_mirror_view(_source_data);
+        for (std::size_t i = 0; i < ghosted_gids.size(); ++i)
+            source_data_host(i) = gid_values.at(ghosted_gids[i]);
+        Kokkos::deep_copy(_source_data, source_data_host);
+    }
+};
+
+//---------------------------------------------------------------------------//
+TEST(FieldInterpolation, linear_field)
+{
+    Fixture fix;
+
+    int comm_rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    // Target points that do not match the source mesh or its decomposition,
+    // including points on the boundary and at source nodes.
+    const int num_side = 9;
+    Kokkos::View<double**, Kokkos::HostSpace> points(
+        "points", num_side * num_side, 2);
+    for (int i = 0; i < num_side; ++i)
+    {
+        for (int j = 0; j < num_side; ++j)
+        {
+            const int p = i * num_side + j;
+            points(p, 0) = static_cast<double>(i) / (num_side - 1);
+            points(p, 1) = static_cast<double>((j + comm_rank) % num_side)
+                           / (num_side - 1);
+        }
+    }
+    points(0, 0) = 5.0 / 13.0;
+    points(0, 1) = 4.0 / 11.0;
+
+    const Mesh::FieldInterpolation interpolation(
+        fix._mesh, fix._dof_manager, {"test_field"}, points);
+    EXPECT_EQ(num_side * num_side, interpolation.numPoints());
+    EXPECT_EQ(1, interpolation.numFields());
+
+    Kokkos::View<double**, PHX::Device> values(
+        "values", num_side * num_side, 1);
+    interpolation.interpolate(fix._source_data, values);
+    auto values_host
+        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+    for (int p = 0; p < num_side * num_side; ++p)
+    {
+        EXPECT_NEAR(
+            testField(points(p, 0), points(p, 1)), values_host(p, 0), 1.0e-12);
+    }
+
+    // Refresh the source data.
+    Kokkos::View<double*, PHX::Device> scaled_data(
+        "scaled_data", fix._source_data.extent(0));
+    auto source_data = fix._source_data;
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<PHX::exec_space>(0, scaled_data.extent(0)),
+        KOKKOS_LAMBDA(const int i) { scaled_data(i) = 2.0 * source_data(i); });
+    interpolation.interpolate(scaled_data, values);
+    Kokkos::deep_copy(values_host, values);
+    for (int p = 0; p < num_side * num_side; ++p)
+    {
+        EXPECT_NEAR(2.0 * testField(points(p, 0), points(p, 1)),
+                    values_host(p, 0),
+                    1.0e-12);
+    }
+
+    // Points outside of the source mesh take the value at the closest point
+    // of the closest element, unless the fallback is disabled.
+    points(0, 0) = 1.5;
+    points(1, 0) = -0.25;
+    const Mesh::FieldInterpolation closest_interpolation(
+        fix._mesh, fix._dof_manager, {"test_field"}, points);
+    closest_interpolation.interpolate(fix._source_data, values);
+    Kokkos::deep_copy(values_host, values);
+    EXPECT_NEAR(testField(1.0, points(0, 1)), values_host(0, 0), 1.0e-12);
+    EXPECT_NEAR(testField(0.0, points(1, 1)), values_host(1, 0), 1.0e-12);
+    for (int p = 2; p < num_side * num_side; ++p)
+    {
+        EXPECT_NEAR(
+            testField(points(p, 0), points(p, 1)), values_host(p, 0), 1.0e-12);
+    }
+
+    EXPECT_THROW(Mesh::FieldInterpolation(fix._mesh,
+                                          fix._dof_manager,
+                                          {"test_field"},
+                                          points,
+                                          {},
+                                          1.0e-8,
+                                          false),
+                 std::runtime_error);
+
+    // Points within the reference coordinate tolerance are inside.
+    points(0, 0) = 1.0 + 1.0e-10;
+    points(1, 0) = -1.0e-10;
+    EXPECT_NO_THROW(Mesh::FieldInterpolation(fix._mesh,
+                                             fix._dof_manager,
+                                             {"test_field"},
+                                             points,
+                                             {},
+                                             1.0e-8,
+                                             false));
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
@@ -22,6 +22,7 @@
 #include <mpi.h>
 
 #include <algorithm>
+#include <fstream>
 #include <limits>
 #include <stdexcept>
 #include <string>
@@ -266,7 +267,9 @@ void testReadOnly(const std::string& lin_alg_type, const bool with_periodic_bc)
 }
 
 //---------------------------------------------------------------------------//
-void testWriteRead(const std::string& lin_alg_type, const bool with_periodic_bc)
+void testWriteRead(const std::string& lin_alg_type,
+                   const bool with_periodic_bc,
+                   const std::string& format = "Compressed")
 {
     // Create test fixture.
     Fixture fix(lin_alg_type, with_periodic_bc);
@@ -282,6 +285,7 @@ void testWriteRead(const std::string& lin_alg_type, const bool with_periodic_bc)
         output_params.set("Restart File Prefix", "restart_test");
     else
         output_params.set("Restart File Prefix", "restart_test_periodic");
+    output_params.set("Restart File Format", format);
     Mesh::RestartWriter writer(
         fix._mesh, fix._dof_manager, output_params, allow_dofmap_overwrite);
     writer.writeSolution(fix._x, fix._x_dot, 12, 1.49);
@@ -309,6 +313,9 @@ void testWriteRead(const std::string& lin_alg_type, const bool with_periodic_bc)
     }
     Mesh::RestartReader reader(fix._comm, input_params);
     EXPECT_EQ(1.49, reader.initialStateTime());
+    EXPECT_EQ(format == "Compressed" ? Mesh::Restart::Format::compressed
+                                     : Mesh::Restart::Format::raw,
+              reader.format());
     reader.readSolution(fix._mesh, fix._dof_manager, new_x, new_x_dot);
 
     // Check the results.
@@ -321,6 +328,101 @@ void testWriteRead(const std::string& lin_alg_type, const bool with_periodic_bc)
     EXPECT_EQ(x_dot_norm, 0.0);
 }
 
+//---------------------------------------------------------------------------//
+void testAsyncWriteRead(const std::string& lin_alg_type,
+                        const std::string& format)
+{
+    // Create test fixture.
+    Fixture fix(lin_alg_type, false);
+    constexpr bool allow_dofmap_overwrite = true;
+
+    // Write several files with two writes in flight, modifying the solution
+    // after each write has started.
+    Teuchos::ParameterList output_params;
+    output_params.set("Restart File Prefix", "restart_test_async");
+    output_params.set("Restart File Format", format);
+    output_params.set("Asynchronous Restart Write", true);
+    output_params.set("Restart Writes In Flight", 2);
+    Mesh::RestartWriter writer(
+        fix._mesh, fix._dof_manager, output_params, allow_dofmap_overwrite);
+    auto x = fix._x->clone_v();
+    auto x_dot = fix._x_dot->clone_v();
+    for (int index = 1; index <= 3; ++index)
+    {
+        writer.writeSolution(x, x_dot, index, 0.1 * index);
+        Thyra::Vt_S(x.ptr(), 2.0);
+        Thyra::Vt_S(x_dot.ptr(), 3.0);
+    }
+    writer.finishWrites();
+
+    // Each file holds the solution at the time the write was started.
+    Thyra::assign(x.ptr(), *(fix._x));
+    Thyra::assign(x_dot.ptr(), *(fix._x_dot));
+    for (int index = 1; index <= 3; ++index)
+    {
+        auto new_x = fix._x->clone_v();
+        auto new_x_dot = fix._x_dot->clone_v();
+        Thyra::assign(new_x.ptr(), -1394932.39);
+        Thyra::assign(new_x_dot.ptr(), 432.3);
+        Teuchos::ParameterList input_params;
+        input_params.set("Restart Data File Name",
+                         "restart_test_async_" + std::to_string(index)
+                             + ".restart.data");
+        input_params.set("Restart DOF Map File Name",
+                         "restart_test_async.restart.dofmap");
+        Mesh::RestartReader reader(fix._comm, input_params);
+        EXPECT_EQ(0.1 * index, reader.initialStateTime());
+        reader.readSolution(fix._mesh, fix._dof_manager, new_x, new_x_dot);
+
+        Thyra::Vp_V(new_x.ptr(), *x, -1.0);
+        EXPECT_EQ(Thyra::norm_2(*new_x), 0.0);
+        Thyra::Vp_V(new_x_dot.ptr(), *x_dot, -1.0);
+        EXPECT_EQ(Thyra::norm_2(*new_x_dot), 0.0);
+
+        Thyra::Vt_S(x.ptr(), 2.0);
+        Thyra::Vt_S(x_dot.ptr(), 3.0);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void testCorruptRead(const std::string& lin_alg_type)
+{
+    // Create test fixture.
+    Fixture fix(lin_alg_type, false);
+    constexpr bool allow_dofmap_overwrite = true;
+
+    // Write the file and flip a bit in the last data chunk.
+    Teuchos::ParameterList output_params;
+    output_params.set("Restart File Prefix", "restart_test_corrupt");
+    Mesh::RestartWriter writer(
+        fix._mesh, fix._dof_manager, output_params, allow_dofmap_overwrite);
+    writer.writeSolution(fix._x, fix._x_dot, 3, 0.5);
+    if (0 == fix._comm->getRank())
+    {
+        std::fstream file("restart_test_corrupt_3.restart.data",
+                          std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(-8, std::ios::end);
+        char byte;
+        file.get(byte);
+        file.seekp(-8, std::ios::end);
+        file.put(static_cast<char>(byte ^ 1));
+    }
+    fix._comm->barrier();
+
+    // Reading must fail on all ranks.
+    Teuchos::ParameterList input_params;
+    input_params.set("Restart Data File Name",
+                     "restart_test_corrupt_3.restart.data");
+    input_params.set("Restart DOF Map File Name",
+                     "restart_test_corrupt.restart.dofmap");
+    Mesh::RestartReader reader(fix._comm, input_params);
+    auto new_x = fix._x->clone_v();
+    auto new_x_dot = fix._x_dot->clone_v();
+    EXPECT_THROW(
+        reader.readSolution(fix._mesh, fix._dof_manager, new_x, new_x_dot),
+        std::runtime_error);
+}
+
 //---------------------------------------------------------------------------//
 TEST(RestartReaderEpetra, restart_read_only_test)
 {
@@ -369,6 +471,74 @@ TEST(RestartWriterTpetra, periodic_restart_write_read_test)
     testWriteRead("Tpetra", true);
 }
 
+//---------------------------------------------------------------------------//
+TEST(RestartWriterEpetra, raw_restart_write_read_test)
+{
+    testWriteRead("Epetra", false, "Raw");
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartWriterTpetra, raw_restart_write_read_test)
+{
+    testWriteRead("Tpetra", false, "Raw");
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartWriterEpetra, async_restart_write_read_test)
+{
+    testAsyncWriteRead("Epetra", "Compressed");
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartWriterTpetra, async_restart_write_read_test)
+{
+    testAsyncWriteRead("Tpetra", "Compressed");
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartWriterTpetra, async_raw_restart_write_read_test)
+{
+    testAsyncWriteRead("Tpetra", "Raw");
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartReaderTpetra, corrupt_restart_read_test)
+{
+    testCorruptRead("Tpetra");
+}
+
+//---------------------------------------------------------------------------//
+// Distribute strided global ids unevenly over the ranks and check that the
+// positions match a serial sort of all ids.
+TEST(Restart, sorted_global_positions)
+{
+    int comm_rank;
+    int comm_size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    const uint64_t num_gids = 1000;
+    std::vector<uint64_t> all_gids(num_gids);
+    std::vector<uint64_t> local_gids;
+    for (uint64_t i = 0; i < num_gids; ++i)
+    {
+        all_gids[i] = 37 * ((i * 7919) % num_gids) + 5;
+        if (static_cast<int>((i * i) % (comm_size + 1)) % comm_size
+            == comm_rank)
+        {
+            local_gids.push_back(all_gids[i]);
+        }
+    }
+    std::sort(all_gids.begin(), all_gids.end());
+    std::sort(local_gids.begin(), local_gids.end());
+
+    const auto positions = Mesh::Restart::sortedGlobalPositions(
+        MPI_COMM_WORLD, local_gids);
+    ASSERT_EQ(local_gids.size(), positions.size());
+    for (std::size_t i = 0; i < local_gids.size(); ++i)
+        EXPECT_EQ(all_gids[positions[i]], local_gids[i]);
+}
+
 //---------------------------------------------------------------------------//
 
 } // end namespace Test
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <mesh/VertexCFD_Mesh_RestartCompression.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+using namespace Mesh::RestartCompression;
+
+//---------------------------------------------------------------------------//
+void testRoundTrip(const std::vector<double>& values,
+                   const Encoding expected_encoding)
+{
+    std::vector<unsigned char> data;
+    const auto encoding = encode(values.data(), values.size(), data);
+    EXPECT_EQ(expected_encoding, encoding);
+    if (encoding == Encoding::raw)
+        EXPECT_EQ(values.size() * sizeof(double), data.size());
+    else
+        EXPECT_LT(data.size(), values.size() * sizeof(double));
+
+    std::vector<double> decoded(values.size());
+    decode(data.data(), data.size(), encoding, decoded.data(), values.size());
+    EXPECT_EQ(0,
+              std::memcmp(values.data(),
+                          decoded.data(),
+                          values.size() * sizeof(double)));
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartCompression, constant)
+{
+    std::vector<double> values(10000, 101325.0);
+    testRoundTrip(values, Encoding::shuffle_lz);
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartCompression, smooth)
+{
+    std::vector<double> values(20000);
+    for (std::size_t i = 0; i < values.size(); ++i)
+        values[i] = 1.0 + 0.1 * std::sin(0.001 * i);
+    testRoundTrip(values, Encoding::shuffle_lz);
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartCompression, random)
+{
+    // Random bits do not compress and are stored unchanged.
+    std::mt19937_64 generator(3);
+    std::vector<double> values(5000);
+    for (auto& v : values)
+    {
+        const std::uint64_t bits = generator() >> 2;
+        std::memcpy(&v, &bits, sizeof(v));
+    }
+    testRoundTrip(values, Encoding::raw);
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartCompression, short_chunks)
+{
+    for (std::size_t n = 0; n < 5; ++n)
+    {
+        std::vector<double> values(n, 2.0);
+        std::vector<unsigned char> data;
+        const auto encoding = encode(values.data(), n, data);
+        std::vector<double> decoded(n);
+        decode(data.data(), data.size(), encoding, decoded.data(), n);
+        EXPECT_EQ(values, decoded);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartCompression, corrupt)
+{
+    std::vector<double> values(1000, 3.0);
+    std::vector<unsigned char> data;
+    const auto encoding = encode(values.data(), values.size(), data);
+    ASSERT_EQ(Encoding::shuffle_lz, encoding);
+
+    // Truncated data does not decode to the expected size.
+    std::vector<double> decoded(values.size());
+    EXPECT_THROW(decode(data.data(),
+                        data.size() - 1,
+                        encoding,
+                        decoded.data(),
+                        values.size()),
+                 std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+TEST(RestartCompression, crc32)
+{
+    const std::string check = "123456789";
+    EXPECT_EQ(0xcbf43926u, crc32(check.data(), check.size()));
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
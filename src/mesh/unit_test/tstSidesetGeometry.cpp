@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <mesh/VertexCFD_Mesh_GeometryData.hpp>
+#include <mesh/VertexCFD_Mesh_GeometryPrimitives.hpp>
+
+#include <Panzer_STK_SquareQuadMeshFactory.hpp>
+#include <Panzer_STK_SquareTriMeshFactory.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <cmath>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Nearest distance from a point to a set of wall edges.
+template<class SideViewType>
+double nearestEdgeDistance(const SideViewType& sides, const double x[2])
+{
+    Kokkos::View<double***, Kokkos::HostSpace> point("point", 1, 1, 2);
+    point(0, 0, 0) = x[0];
+    point(0, 0, 1) = x[1];
+
+    int index[2] = {0, 1};
+    double distance = 1e8;
+    for (std::size_t side = 0; side < sides.extent(0); ++side)
+    {
+        distance = std::fmin(distance,
+                             GeometryPrimitives::distanceToLinearEdge(
+                                 sides, side, point, 0, 0, 2, index));
+    }
+    return distance;
+}
+
+//---------------------------------------------------------------------------//
+// Build a 2D mesh with walls on three sides and check that the sides kept by
+// each rank in distributed mode give the same nearest wall distance at every
+// locally owned node as the replicated sides. On more than one rank this
+// exercises the exchange of the sides between the ranks.
+template<class MeshFactory>
+void testDistributed()
+{
+    auto mesh_factory = Teuchos::rcp(new MeshFactory());
+    auto mesh_params = Teuchos::parameterList();
+    mesh_params->set("X0", 0.0);
+    mesh_params->set("Xf", 2.0);
+    mesh_params->set("X Elements", 12);
+    mesh_params->set("Y0", -1.0);
+    mesh_params->set("Yf", 1.0);
+    mesh_params->set("Y Elements", 10);
+    mesh_factory->setParameterList(mesh_params);
+    auto mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+    mesh_factory->completeMeshConstruction(*mesh, MPI_COMM_WORLD);
+
+    const std::vector<std::string> walls = {"top", "bottom", "left"};
+    const Mesh::Topology::SidesetGeometry replicated(mesh, walls);
+    const Mesh::Topology::SidesetGeometry distributed(mesh, walls, true);
+
+    // Each wall has 10 or 12 edges.
+    const auto replicated_sides = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), replicated.sides());
+    const auto distributed_sides = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), distributed.sides());
+    EXPECT_EQ(34u, replicated_sides.extent(0));
+    EXPECT_LE(distributed_sides.extent(0), replicated_sides.extent(0));
+
+    std::vector<stk::mesh::Entity> elements;
+    mesh->getMyElements(elements);
+    auto bulk = mesh->getBulkData();
+    for (const auto& element : elements)
+    {
+        const int num_node = bulk->num_nodes(element);
+        const stk::mesh::Entity* nodes = bulk->begin_nodes(element);
+        for (int n = 0; n < num_node; ++n)
+        {
+            const double* x = mesh->getNodeCoordinates(nodes[n]);
+            const double exact = std::fmin(x[0], 1.0 - std::abs(x[1]));
+            EXPECT_NEAR(
+                exact, nearestEdgeDistance(replicated_sides, x), 1.0e-14);
+            EXPECT_EQ(nearestEdgeDistance(replicated_sides, x),
+                      nearestEdgeDistance(distributed_sides, x));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(SidesetGeometry, distributed_quad4)
+{
+    testDistributed<panzer_stk::SquareQuadMeshFactory>();
+}
+
+//---------------------------------------------------------------------------//
+TEST(SidesetGeometry, distributed_tri3)
+{
+    testDistributed<panzer_stk::SquareTriMeshFactory>();
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
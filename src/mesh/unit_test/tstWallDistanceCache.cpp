@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <mesh/VertexCFD_Mesh_WallDistanceCache.hpp>
+
+#include <Panzer_STK_SquareQuadMeshFactory.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+Teuchos::RCP<panzer_stk::STK_Interface> buildMesh(const double xf)
+{
+    auto mesh_factory = Teuchos::rcp(new panzer_stk::SquareQuadMeshFactory());
+    auto mesh_params = Teuchos::parameterList();
+    mesh_params->set("X0", 0.0);
+    mesh_params->set("Xf", xf);
+    mesh_params->set("X Elements", 5);
+    mesh_params->set("Y0", 0.0);
+    mesh_params->set("Yf", 1.0);
+    mesh_params->set("Y Elements", 4);
+    mesh_factory->setParameterList(mesh_params);
+    auto mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+    mesh_factory->completeMeshConstruction(*mesh, MPI_COMM_WORLD);
+    return mesh;
+}
+
+//---------------------------------------------------------------------------//
+// Write values tagged with the element global id, then read them back in a
+// different local element order.
+TEST(WallDistanceCache, read_write)
+{
+    const std::string file_name = "wall_distance_cache_test.bin";
+    const int num_value = 3;
+    const std::uint64_t parameter_hash = 17;
+    auto mesh = buildMesh(1.0);
+
+    std::vector<stk::mesh::Entity> elements;
+    mesh->getMyElements(elements);
+    std::vector<int> element_lids;
+    for (const auto& element : elements)
+        element_lids.push_back(mesh->elementLocalId(element));
+
+    auto tag = [&](const int lid, const int v) {
+        return 10.0 * mesh->elementGlobalId(lid) + v;
+    };
+
+    {
+        const Mesh::WallDistanceCache cache(
+            mesh, file_name, element_lids, num_value, parameter_hash);
+        std::vector<double> values;
+        for (const int lid : element_lids)
+        {
+            for (int v = 0; v < num_value; ++v)
+                values.push_back(tag(lid, v));
+        }
+        cache.write(values);
+    }
+
+    std::reverse(element_lids.begin(), element_lids.end());
+    const Mesh::WallDistanceCache cache(
+        mesh, file_name, element_lids, num_value, parameter_hash);
+    std::vector<double> values;
+    EXPECT_TRUE(cache.read(values));
+    ASSERT_EQ(element_lids.size() * num_value, values.size());
+    for (std::size_t i = 0; i < element_lids.size(); ++i)
+    {
+        for (int v = 0; v < num_value; ++v)
+            EXPECT_EQ(tag(element_lids[i], v), values[i * num_value + v]);
+    }
+
+    // Different parameters do not match the file.
+    const Mesh::WallDistanceCache other_parameters(
+        mesh, file_name, element_lids, num_value, parameter_hash + 1);
+    EXPECT_NE(cache.hash(), other_parameters.hash());
+    EXPECT_FALSE(other_parameters.read(values));
+
+    // Different coordinates do not match the file.
+    auto other_mesh = buildMesh(2.0);
+    const Mesh::WallDistanceCache other_mesh_cache(
+        other_mesh, file_name, element_lids, num_value, parameter_hash);
+    EXPECT_FALSE(other_mesh_cache.read(values));
+
+    // A missing file is not an error.
+    const Mesh::WallDistanceCache missing(
+        mesh, "missing_" + file_name, element_lids, num_value, parameter_hash);
+    EXPECT_FALSE(missing.read(values));
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
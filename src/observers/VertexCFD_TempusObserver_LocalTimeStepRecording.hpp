@@ -0,0 +1,76 @@
+#ifndef VERTEXCFD_TEMPUSOBSERVER_LOCALTIMESTEPRECORDING_HPP
+#define VERTEXCFD_TEMPUSOBSERVER_LOCALTIMESTEPRECORDING_HPP
+
+#include "responses/VertexCFD_Response_LocalTimeStepMonitor.hpp"
+
+#include <Tempus_Integrator.hpp>
+#include <Tempus_IntegratorObserver.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+namespace VertexCFD
+{
+namespace TempusObserver
+{
+//---------------------------------------------------------------------------//
+// Record the local time step size only in the residual evaluations of the
+// nonlinear solve of a time step. The last residual evaluation of the solve
+// is at the converged state, which is the accepted state of single stage
+// implicit steppers. The residual evaluations made outside of the steps,
+// such as those of the response libraries and of the time step control, are
+// not recorded.
+//---------------------------------------------------------------------------//
+template<class Scalar>
+class LocalTimeStepRecording
+    : virtual public Tempus::IntegratorObserver<Scalar>
+{
+  public:
+    explicit LocalTimeStepRecording(
+        const Teuchos::RCP<Response::LocalTimeStepMonitor>& monitor);
+
+    /// Observe the beginning of the time integrator.
+    void observeStartIntegrator(
+        const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe the beginning of the time step loop.
+    void
+    observeStartTimeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe after the next time step size is selected. The
+    /// observer can choose to change the current integratorStatus.
+    void
+    observeNextTimeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe before Stepper takes step.
+    void observeBeforeTakeStep(
+        const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe after Stepper takes step.
+    void
+    observeAfterTakeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe after checking time step. Observer can still fail the time step
+    /// here.
+    void observeAfterCheckTimeStep(
+        const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe the end of the time step loop.
+    void
+    observeEndTimeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe the end of the time integrator.
+    void
+    observeEndIntegrator(const Tempus::Integrator<Scalar>& integrator) override;
+
+  private:
+    Teuchos::RCP<Response::LocalTimeStepMonitor> _monitor;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace TempusObserver
+} // end namespace VertexCFD
+
+#include "VertexCFD_TempusObserver_LocalTimeStepRecording_impl.hpp"
+
+#endif // end VERTEXCFD_TEMPUSOBSERVER_LOCALTIMESTEPRECORDING_HPP
@@ -0,0 +1,80 @@
+#ifndef VERTEXCFD_TEMPUSOBSERVER_LOCALTIMESTEPRECORDING_IMPL_HPP
+#define VERTEXCFD_TEMPUSOBSERVER_LOCALTIMESTEPRECORDING_IMPL_HPP
+
+namespace VertexCFD
+{
+namespace TempusObserver
+{
+//---------------------------------------------------------------------------//
+template<class Scalar>
+LocalTimeStepRecording<Scalar>::LocalTimeStepRecording(
+    const Teuchos::RCP<Response::LocalTimeStepMonitor>& monitor)
+    : _monitor(monitor)
+{
+    _monitor->setRecording(false);
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void LocalTimeStepRecording<Scalar>::observeStartIntegrator(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void LocalTimeStepRecording<Scalar>::observeStartTimeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void LocalTimeStepRecording<Scalar>::observeNextTimeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void LocalTimeStepRecording<Scalar>::observeBeforeTakeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+    _monitor->setRecording(true);
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void LocalTimeStepRecording<Scalar>::observeAfterTakeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+    _monitor->setRecording(false);
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void LocalTimeStepRecording<Scalar>::observeAfterCheckTimeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void LocalTimeStepRecording<Scalar>::observeEndTimeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void LocalTimeStepRecording<Scalar>::observeEndIntegrator(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace TempusObserver
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_TEMPUSOBSERVER_LOCALTIMESTEPRECORDING_IMPL_HPP
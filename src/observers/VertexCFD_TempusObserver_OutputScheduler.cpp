@@ -0,0 +1,243 @@
+#include "VertexCFD_TempusObserver_OutputScheduler.hpp"
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_CommHelpers.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace TempusObserver
+{
+namespace
+{
+// Tolerance for reaching an output time, relative to the time magnitude.
+double timeTolerance(const double time)
+{
+    return 1.0e-10 * std::max(1.0, std::abs(time));
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+OutputScheduler::OutputScheduler(
+    const Teuchos::RCP<const Teuchos::Comm<int>>& comm,
+    const Teuchos::ParameterList& params,
+    const std::string& prefix,
+    const int default_frequency)
+    : _comm(comm)
+    , _frequency(0)
+    , _time_interval(0.0)
+    , _wall_clock_interval(0.0)
+    , _count(0)
+    , _count_spaced(false)
+    , _land_on_times(false)
+    , _init_time(0.0)
+    , _next_interval_time(std::numeric_limits<double>::max())
+    , _next_scheduled_time(0)
+    , _num_outputs(0)
+    , _last_output_clock(std::chrono::steady_clock::now())
+{
+    if (params.isType<double>(prefix + " Time Interval"))
+    {
+        _time_interval = params.get<double>(prefix + " Time Interval");
+        if (_time_interval <= 0.0)
+        {
+            throw std::runtime_error("'" + prefix
+                                     + " Time Interval' must be positive");
+        }
+    }
+
+    if (params.isType<double>(prefix + " Wall Clock Interval"))
+    {
+        _wall_clock_interval
+            = params.get<double>(prefix + " Wall Clock Interval");
+        if (_wall_clock_interval <= 0.0)
+        {
+            throw std::runtime_error(
+                "'" + prefix + " Wall Clock Interval' must be positive");
+        }
+    }
+
+    if (params.isType<Teuchos::Array<double>>(prefix + " Times"))
+    {
+        const auto times
+            = params.get<Teuchos::Array<double>>(prefix + " Times");
+        _times.assign(times.begin(), times.end());
+        std::sort(_times.begin(), _times.end());
+    }
+
+    if (params.isType<int>(prefix + " Count"))
+    {
+        _count = params.get<int>(prefix + " Count");
+        if (_count <= 0)
+        {
+            throw std::runtime_error("'" + prefix
+                                     + " Count' must be positive");
+        }
+    }
+
+    if (params.isType<bool>(prefix + " Land On Output Times"))
+    {
+        _land_on_times = params.get<bool>(prefix + " Land On Output Times");
+    }
+
+    if (params.isType<int>(prefix + " Frequency"))
+    {
+        _frequency = params.get<int>(prefix + " Frequency");
+        if (_frequency <= 0)
+        {
+            throw std::runtime_error("'" + prefix
+                                     + " Frequency' must be positive");
+        }
+    }
+
+    // The count only spaces the outputs evenly when no other criterion is
+    // set, otherwise it limits the outputs of the other criteria.
+    const bool time_scheduled = _time_interval > 0.0
+                                || _wall_clock_interval > 0.0
+                                || !_times.empty();
+    _count_spaced = _count > 0 && _frequency == 0 && !time_scheduled;
+
+    // Fall back to the default step frequency only when output is not
+    // otherwise scheduled.
+    if (_frequency == 0 && !time_scheduled && _count == 0)
+        _frequency = default_frequency;
+}
+
+//---------------------------------------------------------------------------//
+void OutputScheduler::initialize(const double init_time,
+                                 const double final_time)
+{
+    _init_time = init_time;
+    if (_time_interval > 0.0)
+        _next_interval_time = init_time + _time_interval;
+    _scheduled_times = scheduledTimes(init_time, final_time);
+    _next_scheduled_time = 0;
+    _num_outputs = 0;
+    _last_output_clock = std::chrono::steady_clock::now();
+}
+
+//---------------------------------------------------------------------------//
+bool OutputScheduler::isDue(const int index, const double time) const
+{
+    if (budgetReached())
+        return false;
+
+    const bool step_due = _frequency > 0 && 0 == index % _frequency;
+    const bool time_due = isTimeDue(time);
+    return step_due || time_due;
+}
+
+//---------------------------------------------------------------------------//
+bool OutputScheduler::isTimeDue(const double time) const
+{
+    if (budgetReached())
+        return false;
+
+    const double tolerance = timeTolerance(time);
+    bool due = false;
+
+    if (_time_interval > 0.0 && time >= _next_interval_time - tolerance)
+        due = true;
+
+    if (_next_scheduled_time < _scheduled_times.size()
+        && time >= _scheduled_times[_next_scheduled_time] - tolerance)
+    {
+        due = true;
+    }
+
+    // Use the clock on rank 0 so that all ranks agree.
+    if (_wall_clock_interval > 0.0)
+    {
+        const std::chrono::duration<double> elapsed
+            = std::chrono::steady_clock::now() - _last_output_clock;
+        int clock_due = elapsed.count() >= _wall_clock_interval;
+        Teuchos::broadcast(*_comm, 0, &clock_due);
+        if (clock_due)
+            due = true;
+    }
+
+    return due;
+}
+
+//---------------------------------------------------------------------------//
+void OutputScheduler::recordOutput(const double time)
+{
+    const double tolerance = timeTolerance(time);
+
+    // The output of the initial state does not count towards the limit.
+    if (time > _init_time + tolerance)
+        ++_num_outputs;
+
+    // Move to the first interval time after this output. Computing the
+    // interval number avoids accumulating round-off.
+    if (_time_interval > 0.0)
+    {
+        const double intervals
+            = std::floor((time + tolerance - _init_time) / _time_interval);
+        _next_interval_time = _init_time + (intervals + 1.0) * _time_interval;
+    }
+
+    while (_next_scheduled_time < _scheduled_times.size()
+           && _scheduled_times[_next_scheduled_time] <= time + tolerance)
+    {
+        ++_next_scheduled_time;
+    }
+
+    _last_output_clock = std::chrono::steady_clock::now();
+}
+
+//---------------------------------------------------------------------------//
+double OutputScheduler::nextLandingTime(const double time) const
+{
+    double next_time = std::numeric_limits<double>::max();
+    if (!_land_on_times || budgetReached())
+        return next_time;
+
+    const double tolerance = timeTolerance(time);
+    if (_time_interval > 0.0)
+    {
+        const double intervals
+            = std::floor((time + tolerance - _init_time) / _time_interval);
+        next_time = _init_time + (intervals + 1.0) * _time_interval;
+    }
+
+    const auto scheduled = std::upper_bound(
+        _scheduled_times.begin(), _scheduled_times.end(), time + tolerance);
+    if (scheduled != _scheduled_times.end())
+        next_time = std::min(next_time, *scheduled);
+
+    return next_time;
+}
+
+//---------------------------------------------------------------------------//
+// Listed and counted output times after the initial time.
+std::vector<double>
+OutputScheduler::scheduledTimes(const double init_time,
+                                const double final_time) const
+{
+    std::vector<double> times;
+    const double tolerance = timeTolerance(init_time);
+    for (const double t : _times)
+    {
+        if (t > init_time + tolerance)
+            times.push_back(t);
+    }
+    if (_count_spaced)
+    {
+        for (int i = 1; i <= _count; ++i)
+            times.push_back(init_time + i * (final_time - init_time) / _count);
+    }
+
+    std::sort(times.begin(), times.end());
+    times.erase(std::unique(times.begin(), times.end()), times.end());
+    return times;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace TempusObserver
+} // end namespace VertexCFD
@@ -0,0 +1,92 @@
+#ifndef VERTEXCFD_TEMPUSOBSERVER_OUTPUTSCHEDULER_HPP
+#define VERTEXCFD_TEMPUSOBSERVER_OUTPUTSCHEDULER_HPP
+
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace TempusObserver
+{
+//---------------------------------------------------------------------------//
+// Decides when an observer writes output. Output is due when any of the
+// following criteria is met:
+//
+//   "<prefix> Frequency"            - every given number of time steps
+//   "<prefix> Time Interval"        - every given simulation time interval
+//   "<prefix> Wall Clock Interval"  - every given number of wall clock seconds
+//   "<prefix> Times"                - at each listed simulation time
+//
+// "<prefix> Count" limits the total number of outputs after the initial time
+// over all criteria. Without any other criterion the outputs are evenly
+// spaced over the simulation time.
+//
+// Time based output is written at the first step reaching the output time.
+// With "<prefix> Land On Output Times" the time step control also shortens
+// the time step to land exactly on the next interval, listed or counted time.
+//---------------------------------------------------------------------------//
+class OutputScheduler
+{
+  public:
+    // The default frequency is used when no frequency is given and no other
+    // criterion is set. The wall clock interval is decided on the first rank
+    // of the given communicator.
+    OutputScheduler(const Teuchos::RCP<const Teuchos::Comm<int>>& comm,
+                    const Teuchos::ParameterList& params,
+                    const std::string& prefix,
+                    const int default_frequency);
+
+    // Set the simulation time span. Called at the start of integration.
+    void initialize(const double init_time, const double final_time);
+
+    // Whether output is due at the given time step. Collective when a wall
+    // clock interval is set.
+    bool isDue(const int index, const double time) const;
+
+    // Whether output is due based on the time criteria only. Collective when
+    // a wall clock interval is set.
+    bool isTimeDue(const double time) const;
+
+    // Record that output was written at the given time.
+    void recordOutput(const double time);
+
+    // Next simulation time after the given time that the time step control
+    // should land on. The maximum double value unless landing on output
+    // times was requested and output is still scheduled.
+    double nextLandingTime(const double time) const;
+
+  private:
+    Teuchos::RCP<const Teuchos::Comm<int>> _comm;
+    int _frequency;
+    double _time_interval;
+    double _wall_clock_interval;
+    std::vector<double> _times;
+    int _count;
+    bool _count_spaced;
+    bool _land_on_times;
+
+    double _init_time;
+    double _next_interval_time;
+    std::vector<double> _scheduled_times;
+    std::size_t _next_scheduled_time;
+    int _num_outputs;
+    std::chrono::steady_clock::time_point _last_output_clock;
+
+    bool budgetReached() const { return _count > 0 && _num_outputs >= _count; }
+
+    std::vector<double> scheduledTimes(const double init_time,
+                                       const double final_time) const;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace TempusObserver
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_TEMPUSOBSERVER_OUTPUTSCHEDULER_HPP
@@ -1,12 +1,16 @@
 #ifndef VERTEXCFD_TEMPUSOBSERVER_RESPONSEOUTPUT_HPP
 #define VERTEXCFD_TEMPUSOBSERVER_RESPONSEOUTPUT_HPP
 
+#include "VertexCFD_TempusObserver_OutputScheduler.hpp"
+
 #include "responses/VertexCFD_ResponseManager.hpp"
+#include "responses/VertexCFD_Response_TimeSeriesWriter.hpp"
 
 #include <Tempus_Integrator.hpp>
 #include <Tempus_IntegratorObserver.hpp>
 
 #include <Teuchos_FancyOStream.hpp>
+#include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 
 #include <vector>
@@ -20,8 +24,14 @@ template<class Scalar>
 class ResponseOutput : virtual public Tempus::IntegratorObserver<Scalar>
 {
   public:
+    // The output frequencies are given per response. The time based output
+    // schedule applies to all responses. With a "Time Series File" the
+    // output values are also written to a time series file, and "Console
+    // Output" may be disabled.
     ResponseOutput(Teuchos::RCP<Response::ResponseManager> response_manager,
-                   std::vector<int> output_freq);
+                   std::vector<int> output_freq,
+                   const Teuchos::ParameterList& output_params,
+                   const Teuchos::RCP<const Teuchos::Comm<int>>& comm);
 
     /// Observe the beginning of the time integrator.
     void observeStartIntegrator(
@@ -57,13 +67,23 @@ class ResponseOutput : virtual public Tempus::IntegratorObserver<Scalar>
     void
     observeEndIntegrator(const Tempus::Integrator<Scalar>& integrator) override;
 
+    /// Output schedule of this observer.
+    Teuchos::RCP<const OutputScheduler> outputScheduler() const
+    {
+        return _scheduler;
+    }
+
   private:
     Teuchos::FancyOStream _ostream;
     Teuchos::RCP<Response::ResponseManager> _response_manager;
     std::vector<int> _output_freq;
+    Teuchos::RCP<OutputScheduler> _scheduler;
+    bool _console_output;
+    Teuchos::RCP<Response::TimeSeriesWriter> _time_series;
 
     void outputResponses(const Tempus::Integrator<Scalar>& integrator,
-                         const int current_index = 0);
+                         const int current_index = 0,
+                         const bool time_due = false);
 };
 
 //---------------------------------------------------------------------------//
@@ -3,6 +3,8 @@
 
 #include <iomanip>
 #include <iostream>
+#include <limits>
+#include <string>
 #include <utility>
 
 namespace VertexCFD
@@ -13,13 +15,46 @@ namespace TempusObserver
 template<class Scalar>
 ResponseOutput<Scalar>::ResponseOutput(
     Teuchos::RCP<Response::ResponseManager> response_manager,
-    std::vector<int> output_freq)
+    std::vector<int> output_freq,
+    const Teuchos::ParameterList& output_params,
+    const Teuchos::RCP<const Teuchos::Comm<int>>& comm)
     : _ostream(Teuchos::rcp(&std::cout, false))
     , _response_manager(response_manager)
     , _output_freq(std::move(output_freq))
+    , _scheduler(
+          Teuchos::rcp(new OutputScheduler(comm, output_params, "Output", 0)))
+    , _console_output(true)
 {
     _ostream.setShowProcRank(false);
     _ostream.setOutputToRootOnly(0);
+
+    if (output_params.isType<bool>("Console Output"))
+        _console_output = output_params.get<bool>("Console Output");
+
+    // Buffer the response values of the output steps and write them to a
+    // time series file in blocks.
+    if (output_params.isType<std::string>("Time Series File"))
+    {
+        const int buffer_rows
+            = output_params.isType<int>("Time Series Buffer Size")
+                  ? output_params.get<int>("Time Series Buffer Size")
+                  : 100;
+        const bool asynchronous
+            = output_params.isType<bool>("Asynchronous Time Series Write")
+                  ? output_params.get<bool>("Asynchronous Time Series Write")
+                  : true;
+
+        std::vector<std::string> names;
+        for (int i = 0; i < _response_manager->numResponses(); ++i)
+            names.push_back(_response_manager->name(i));
+
+        _time_series = Teuchos::rcp(new Response::TimeSeriesWriter(
+            comm,
+            output_params.get<std::string>("Time Series File"),
+            names,
+            buffer_rows,
+            asynchronous));
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -27,6 +62,9 @@ template<class Scalar>
 void ResponseOutput<Scalar>::observeStartIntegrator(
     const Tempus::Integrator<Scalar>& integrator)
 {
+    _scheduler->initialize(integrator.getTime(),
+                           integrator.getTimeStepControl()->getFinalTime());
+
     // When the initial time index is zero, this will output all responses.
     // Otherwise, output will depend on specified frequencies.
     outputResponses(integrator, integrator.getIndex());
@@ -72,8 +110,13 @@ template<class Scalar>
 void ResponseOutput<Scalar>::observeEndTimeStep(
     const Tempus::Integrator<Scalar>& integrator)
 {
-    // Output responses at specified frequencies based on time step index.
-    outputResponses(integrator, integrator.getIndex());
+    // Output responses at specified frequencies based on time step index,
+    // and all responses at scheduled times.
+    const auto time = integrator.getTime();
+    const bool time_due = _scheduler->isTimeDue(time);
+    outputResponses(integrator, integrator.getIndex(), time_due);
+    if (time_due)
+        _scheduler->recordOutput(time);
 }
 
 //---------------------------------------------------------------------------//
@@ -83,12 +126,20 @@ void ResponseOutput<Scalar>::observeEndIntegrator(
 {
     // Output all responses unconditionally.
     outputResponses(integrator);
+
+    if (Teuchos::nonnull(_time_series))
+    {
+        _time_series->flush();
+        _time_series->finishWrites();
+    }
 }
 
 //---------------------------------------------------------------------------//
 template<class Scalar>
 void ResponseOutput<Scalar>::outputResponses(
-    const Tempus::Integrator<Scalar>& integrator, const int current_index)
+    const Tempus::Integrator<Scalar>& integrator,
+    const int current_index,
+    const bool time_due)
 {
     const int num_resp = _response_manager->numResponses();
 
@@ -102,7 +153,7 @@ void ResponseOutput<Scalar>::outputResponses(
     int num_outputs = 0;
     for (int i = 0; i < num_resp; ++i)
     {
-        if (0 == current_index % _output_freq[i])
+        if (time_due || 0 == current_index % _output_freq[i])
         {
             _response_manager->activateResponse(i);
             ++num_outputs;
@@ -117,11 +168,29 @@ void ResponseOutput<Scalar>::outputResponses(
     const auto state = integrator.getSolutionHistory()->getCurrentState();
     _response_manager->evaluateResponses(state->getX(), state->getXDot());
 
+    // Add the output values to the time series. Responses that are not
+    // output at this step are stored as NaN.
+    if (Teuchos::nonnull(_time_series))
+    {
+        std::vector<double> values(num_resp,
+                                   std::numeric_limits<double>::quiet_NaN());
+        for (int i = 0; i < num_resp; ++i)
+        {
+            if (time_due || 0 == current_index % _output_freq[i])
+                values[i] = _response_manager->value(i);
+        }
+        _time_series->addRow(
+            integrator.getIndex(), integrator.getTime(), values);
+    }
+
+    if (!_console_output)
+        return;
+
     // Outupt the integrated values.
     _ostream << "Scalar Responses:\n";
     for (int i = 0; i < num_resp; ++i)
     {
-        if (0 == current_index % _output_freq[i])
+        if (time_due || 0 == current_index % _output_freq[i])
         {
             const auto& name = _response_manager->name(i);
             const auto value = _response_manager->value(i);
@@ -0,0 +1,96 @@
+#ifndef VERTEXCFD_TEMPUSOBSERVER_UPDATEEXTERNALFIELDS_HPP
+#define VERTEXCFD_TEMPUSOBSERVER_UPDATEEXTERNALFIELDS_HPP
+
+#include "drivers/VertexCFD_ExternalFieldsManager.hpp"
+
+#include <Tempus_Integrator.hpp>
+#include <Tempus_IntegratorObserver.hpp>
+
+#include <Panzer_Traits.hpp>
+
+#include <Teuchos_ParameterList.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <vector>
+
+namespace VertexCFD
+{
+namespace TempusObserver
+{
+//---------------------------------------------------------------------------//
+// Update the external fields from a time series of restart files of the
+// external simulation. Each sublist of the update parameters gives the
+// "Time" from which a state is used and its "Restart Data File Name" and
+// "Restart DOF Map File Name". At the start of each time step the latest
+// state whose time is not after the current time is read, if it was not
+// read already.
+//---------------------------------------------------------------------------//
+template<class Scalar>
+class UpdateExternalFields : virtual public Tempus::IntegratorObserver<Scalar>
+{
+  public:
+    UpdateExternalFields(
+        const Teuchos::RCP<ExternalFieldsManager<panzer::Traits>>&
+            external_fields_manager,
+        const Teuchos::ParameterList& update_params);
+
+    /// Observe the beginning of the time integrator.
+    void observeStartIntegrator(
+        const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe the beginning of the time step loop.
+    void
+    observeStartTimeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe after the next time step size is selected. The
+    /// observer can choose to change the current integratorStatus.
+    void
+    observeNextTimeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe before Stepper takes step.
+    void
+    observeBeforeTakeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe after Stepper takes step.
+    void
+    observeAfterTakeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe after checking time step. Observer can still fail the time step
+    /// here.
+    void observeAfterCheckTimeStep(
+        const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe the end of the time step loop.
+    void
+    observeEndTimeStep(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Observe the end of the time integrator.
+    void
+    observeEndIntegrator(const Tempus::Integrator<Scalar>& integrator) override;
+
+    /// Read the latest state for the given time if it was not read already.
+    /// Returns the index of the current state, or -1 if none was read.
+    /// Collective.
+    int updateFields(const Scalar time);
+
+  private:
+    struct Update
+    {
+        Scalar time;
+        Teuchos::ParameterList read_restart_params;
+    };
+
+    Teuchos::RCP<ExternalFieldsManager<panzer::Traits>>
+        _external_fields_manager;
+    std::vector<Update> _updates;
+    int _current = -1;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace TempusObserver
+} // end namespace VertexCFD
+
+#include "VertexCFD_TempusObserver_UpdateExternalFields_impl.hpp"
+
+#endif // end VERTEXCFD_TEMPUSOBSERVER_UPDATEEXTERNALFIELDS_HPP
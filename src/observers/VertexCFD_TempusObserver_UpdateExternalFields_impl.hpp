@@ -0,0 +1,128 @@
+#ifndef VERTEXCFD_TEMPUSOBSERVER_UPDATEEXTERNALFIELDS_IMPL_HPP
+#define VERTEXCFD_TEMPUSOBSERVER_UPDATEEXTERNALFIELDS_IMPL_HPP
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace VertexCFD
+{
+namespace TempusObserver
+{
+//---------------------------------------------------------------------------//
+template<class Scalar>
+UpdateExternalFields<Scalar>::UpdateExternalFields(
+    const Teuchos::RCP<ExternalFieldsManager<panzer::Traits>>&
+        external_fields_manager,
+    const Teuchos::ParameterList& update_params)
+    : _external_fields_manager(external_fields_manager)
+{
+    for (auto itr = update_params.begin(); itr != update_params.end(); ++itr)
+    {
+        const auto& name = itr->first;
+        if (!update_params.isSublist(name))
+            continue;
+
+        const auto& params = update_params.sublist(name);
+        if (!params.isType<double>("Time"))
+        {
+            throw std::runtime_error("External field update '" + name
+                                     + "' has no time");
+        }
+        Update update;
+        update.time = params.get<double>("Time");
+        update.read_restart_params = params;
+        update.read_restart_params.remove("Time");
+        _updates.push_back(update);
+    }
+
+    std::stable_sort(
+        _updates.begin(), _updates.end(), [](const auto& a, const auto& b) {
+            return a.time < b.time;
+        });
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void UpdateExternalFields<Scalar>::observeStartIntegrator(
+    const Tempus::Integrator<Scalar>& integrator)
+{
+    updateFields(integrator.getTime());
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void UpdateExternalFields<Scalar>::observeStartTimeStep(
+    const Tempus::Integrator<Scalar>& integrator)
+{
+    updateFields(integrator.getTime());
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void UpdateExternalFields<Scalar>::observeNextTimeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void UpdateExternalFields<Scalar>::observeBeforeTakeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void UpdateExternalFields<Scalar>::observeAfterTakeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void UpdateExternalFields<Scalar>::observeAfterCheckTimeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void UpdateExternalFields<Scalar>::observeEndTimeStep(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+void UpdateExternalFields<Scalar>::observeEndIntegrator(
+    const Tempus::Integrator<Scalar>&)
+{
+}
+
+//---------------------------------------------------------------------------//
+template<class Scalar>
+int UpdateExternalFields<Scalar>::updateFields(const Scalar time)
+{
+    // Skip the intermediate states if several are due at once.
+    int latest = _current;
+    while (latest + 1 < static_cast<int>(_updates.size())
+           && _updates[latest + 1].time <= time)
+    {
+        ++latest;
+    }
+
+    if (latest != _current)
+    {
+        _external_fields_manager->update(_updates[latest].read_restart_params);
+        _current = latest;
+    }
+    return _current;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace TempusObserver
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_TEMPUSOBSERVER_UPDATEEXTERNALFIELDS_IMPL_HPP
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_TEMPUSOBSERVER_WRITEMATRIX_IMPL_HPP
 #define VERTEXCFD_TEMPUSOBSERVER_WRITEMATRIX_IMPL_HPP
 
+#include "linear_solvers/VertexCFD_LinearSolvers_JacobianFreeOperator.hpp"
+
 #include <string>
 #include <vector>
 
@@ -243,6 +245,13 @@ WriteMatrix<Scalar>::tryExtractForwardOp(
             = Teuchos::rcp_const_cast<SolverType>(derived_solver);
         auto fwd_opsrc = nonconst_derived_solver->extract_fwdOpSrc();
         jacobian_op = fwd_opsrc->getOp();
+
+        // With Jacobian-free Newton-Krylov write the assembled Jacobian used
+        // for preconditioning.
+        auto jfnk_op = Teuchos::rcp_dynamic_cast<
+            const LinearSolvers::JacobianFreeOperator>(jacobian_op);
+        if (jfnk_op)
+            jacobian_op = jfnk_op->preconditionerOp();
     }
 
     return jacobian_op;
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_TEMPUSOBSERVER_WRITERESTART_HPP
 #define VERTEXCFD_TEMPUSOBSERVER_WRITERESTART_HPP
 
+#include "VertexCFD_TempusObserver_OutputScheduler.hpp"
+
 #include "mesh/VertexCFD_Mesh_Restart.hpp"
 
 #include <Tempus_Integrator.hpp>
@@ -24,7 +26,8 @@ class WriteRestart : virtual public Tempus::IntegratorObserver<Scalar>
 {
   public:
     WriteRestart(const Teuchos::RCP<Mesh::RestartWriter>& restart_writer,
-                 const Teuchos::ParameterList& output_params);
+                 const Teuchos::ParameterList& output_params,
+                 const Teuchos::RCP<const Teuchos::Comm<int>>& comm);
 
     /// Observe the beginning of the time integrator.
     void observeStartIntegrator(
@@ -60,12 +63,18 @@ class WriteRestart : virtual public Tempus::IntegratorObserver<Scalar>
     void
     observeEndIntegrator(const Tempus::Integrator<Scalar>& integrator) override;
 
+    /// Output schedule of this observer.
+    Teuchos::RCP<const OutputScheduler> outputScheduler() const
+    {
+        return _scheduler;
+    }
+
   private:
     void writeSolution(const Tempus::Integrator<Scalar>& integrator);
 
   private:
     Teuchos::RCP<Mesh::RestartWriter> _restart_writer;
-    int _write_frequency = 1;
+    Teuchos::RCP<OutputScheduler> _scheduler;
     int _last_index = -1;
 };
 
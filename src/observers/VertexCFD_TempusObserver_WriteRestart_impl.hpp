@@ -12,21 +12,21 @@ namespace TempusObserver
 template<class Scalar>
 WriteRestart<Scalar>::WriteRestart(
     const Teuchos::RCP<Mesh::RestartWriter>& restart_writer,
-    const Teuchos::ParameterList& output_params)
+    const Teuchos::ParameterList& output_params,
+    const Teuchos::RCP<const Teuchos::Comm<int>>& comm)
     : _restart_writer(restart_writer)
+    , _scheduler(Teuchos::rcp(
+          new OutputScheduler(comm, output_params, "Restart Write", 1)))
 {
-    if (output_params.isType<int>("Restart Write Frequency"))
-    {
-        _write_frequency
-            = output_params.template get<int>("Restart Write Frequency");
-    }
 }
 
 //---------------------------------------------------------------------------//
 template<class Scalar>
 void WriteRestart<Scalar>::observeStartIntegrator(
-    const Tempus::Integrator<Scalar>&)
+    const Tempus::Integrator<Scalar>& integrator)
 {
+    _scheduler->initialize(integrator.getTime(),
+                           integrator.getTimeStepControl()->getFinalTime());
 }
 
 //---------------------------------------------------------------------------//
@@ -66,8 +66,8 @@ template<class Scalar>
 void WriteRestart<Scalar>::observeEndTimeStep(
     const Tempus::Integrator<Scalar>& integrator)
 {
-    // Only write solution at specified time step intervals.
-    if (0 == integrator.getIndex() % _write_frequency)
+    // Only write solution at scheduled time steps.
+    if (_scheduler->isDue(integrator.getIndex(), integrator.getTime()))
     {
         writeSolution(integrator);
     }
@@ -84,6 +84,9 @@ void WriteRestart<Scalar>::observeEndIntegrator(
     {
         writeSolution(integrator);
     }
+
+    // Wait for any asynchronous writes still in flight.
+    _restart_writer->finishWrites();
 }
 
 //---------------------------------------------------------------------------//
@@ -97,6 +100,7 @@ void WriteRestart<Scalar>::writeSolution(
         = integrator.getSolutionHistory()->findState(time)->getXDot();
     _last_index = integrator.getIndex();
     _restart_writer->writeSolution(solution, solution_dot, _last_index, time);
+    _scheduler->recordOutput(time);
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_TEMPUSOBSERVER_WRITETOEXODUS_HPP
 #define VERTEXCFD_TEMPUSOBSERVER_WRITETOEXODUS_HPP
 
+#include "VertexCFD_TempusObserver_OutputScheduler.hpp"
+
 #include "mesh/VertexCFD_Mesh_ExodusWriter.hpp"
 
 #include <Tempus_Integrator.hpp>
@@ -24,7 +26,8 @@ class WriteToExodus : virtual public Tempus::IntegratorObserver<Scalar>
 {
   public:
     WriteToExodus(const Teuchos::RCP<Mesh::ExodusWriter>& exodus_writer,
-                  const Teuchos::ParameterList& output_params);
+                  const Teuchos::ParameterList& output_params,
+                  const Teuchos::RCP<const Teuchos::Comm<int>>& comm);
 
     /// Observe the beginning of the time integrator.
     void observeStartIntegrator(
@@ -60,12 +63,18 @@ class WriteToExodus : virtual public Tempus::IntegratorObserver<Scalar>
     void
     observeEndIntegrator(const Tempus::Integrator<Scalar>& integrator) override;
 
+    /// Output schedule of this observer.
+    Teuchos::RCP<const OutputScheduler> outputScheduler() const
+    {
+        return _scheduler;
+    }
+
   private:
     void writeSolution(const Tempus::Integrator<Scalar>& integrator);
 
   private:
     Teuchos::RCP<Mesh::ExodusWriter> _exodus_writer;
-    int _write_frequency;
+    Teuchos::RCP<OutputScheduler> _scheduler;
     int _last_index = -1;
 };
 
@@ -12,12 +12,12 @@ namespace TempusObserver
 template<class Scalar>
 WriteToExodus<Scalar>::WriteToExodus(
     const Teuchos::RCP<Mesh::ExodusWriter>& exodus_writer,
-    const Teuchos::ParameterList& output_params)
+    const Teuchos::ParameterList& output_params,
+    const Teuchos::RCP<const Teuchos::Comm<int>>& comm)
     : _exodus_writer(exodus_writer)
-    , _write_frequency(1)
+    , _scheduler(Teuchos::rcp(
+          new OutputScheduler(comm, output_params, "Exodus Write", 1)))
 {
-    _write_frequency
-        = output_params.template get<int>("Exodus Write Frequency");
 }
 
 //---------------------------------------------------------------------------//
@@ -25,6 +25,9 @@ template<class Scalar>
 void WriteToExodus<Scalar>::observeStartIntegrator(
     const Tempus::Integrator<Scalar>& integrator)
 {
+    _scheduler->initialize(integrator.getTime(),
+                           integrator.getTimeStepControl()->getFinalTime());
+
     // Write out initial conditions.
     writeSolution(integrator);
 }
@@ -68,8 +71,8 @@ template<class Scalar>
 void WriteToExodus<Scalar>::observeEndTimeStep(
     const Tempus::Integrator<Scalar>& integrator)
 {
-    // Only write solution at specified time step intervals.
-    if (0 == integrator.getIndex() % _write_frequency)
+    // Only write solution at scheduled time steps.
+    if (_scheduler->isDue(integrator.getIndex(), integrator.getTime()))
     {
         writeSolution(integrator);
     }
@@ -99,6 +102,7 @@ void WriteToExodus<Scalar>::writeSolution(
     const auto solution = state->getX();
     const auto solution_dot = state->getXDot();
     _exodus_writer->writeSolution(solution, solution_dot, time, time_step);
+    _scheduler->recordOutput(time);
     _last_index = integrator.getIndex();
 }
 
@@ -60,6 +60,7 @@ GlobalCFL<Scalar>::GlobalCFL(const Teuchos::ParameterList& user_params,
     this->setCurrentCFL(_cfl_init);
 
     _response_manager.addMinValueResponse("global_cfl_time_step", "local_dt");
+    this->setLocalTimeStepMonitor(user_params);
 
     // For the new Tempus::TimeStepControlStrategy interface, we need to
     // set a few base class member variables. In particular, incorrect
@@ -81,9 +82,13 @@ void GlobalCFL<Scalar>::setNextTimeStep(
     auto working_state = solution_history->getWorkingState();
 
     // Get minimum time step that ensures CFL <= 1
-    _response_manager.evaluateResponses(working_state->getX(),
-                                        working_state->getXDot());
-    const double dt_cfl1 = _response_manager.value();
+    double dt_cfl1;
+    if (!this->recordedLocalTimeStep(*working_state, dt_cfl1))
+    {
+        _response_manager.evaluateResponses(working_state->getX(),
+                                            working_state->getXDot());
+        dt_cfl1 = _response_manager.value();
+    }
 
     // Compute linear weight based on input parameters
     double wt;
@@ -135,6 +140,7 @@ void GlobalCFL<Scalar>::setNextTimeStep(
     {
         dt = tsc.getMaxTimeStep();
     }
+    dt = this->landOnOutputTimes(solution_history->getCurrentTime(), dt);
     working_state->setTimeStep(dt);
     working_state->setTime(solution_history->getCurrentTime() + dt);
 
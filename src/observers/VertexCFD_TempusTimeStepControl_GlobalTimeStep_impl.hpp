@@ -21,6 +21,7 @@ GlobalTimeStep<Scalar>::GlobalTimeStep(
     , _response_manager(physics_manager)
 {
     _response_manager.addMinValueResponse("global_cfl_time_step", "local_dt");
+    this->setLocalTimeStepMonitor(user_params);
 
     // For the new Tempus::TimeStepControlStrategy interface, we need to
     // set a few base class member variables. In particular, incorrect
@@ -42,9 +43,13 @@ void GlobalTimeStep<Scalar>::setNextTimeStep(
     auto working_state = solution_history->getWorkingState();
 
     // Get minimum time step that ensures CFL <= 1
-    _response_manager.evaluateResponses(working_state->getX(),
-                                        working_state->getXDot());
-    const double dt_cfl1 = _response_manager.value();
+    double dt_cfl1;
+    if (!this->recordedLocalTimeStep(*working_state, dt_cfl1))
+    {
+        _response_manager.evaluateResponses(working_state->getX(),
+                                            working_state->getXDot());
+        dt_cfl1 = _response_manager.value();
+    }
 
     // Get time step index (1-based) and compute linear weight
     const auto dt_index = working_state->getIndex() - 1;
@@ -57,10 +62,12 @@ void GlobalTimeStep<Scalar>::setNextTimeStep(
     const double dt_init
         = std::max(tsc.getMinTimeStep(), tsc.getInitTimeStep());
     const double dt_final = tsc.getMaxTimeStep();
-    const double dt = (1.0 - wt) * dt_init + wt * dt_final;
+    const double time = solution_history->getCurrentState()->getTime();
+    const double dt
+        = this->landOnOutputTimes(time, (1.0 - wt) * dt_init + wt * dt_final);
 
     working_state->setTimeStep(dt);
-    working_state->setTime(solution_history->getCurrentState()->getTime() + dt);
+    working_state->setTime(time + dt);
 
     // Save current CFL so it may be accessed elsewhere
     this->setCurrentCFL(dt / dt_cfl1);
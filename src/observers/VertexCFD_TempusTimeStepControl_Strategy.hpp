@@ -1,11 +1,18 @@
 #ifndef VERTEXCFD_TEMPUSTIMESTEPCONTROL_STRATEGY_HPP
 #define VERTEXCFD_TEMPUSTIMESTEPCONTROL_STRATEGY_HPP
 
+#include "VertexCFD_TempusObserver_OutputScheduler.hpp"
+
+#include "responses/VertexCFD_Response_LocalTimeStepMonitor.hpp"
+
+#include <Tempus_SolutionState.hpp>
 #include <Tempus_TimeStepControlStrategy.hpp>
 
 #include <Teuchos_ParameterList.hpp>
 #include <Teuchos_RCP.hpp>
 
+#include <vector>
+
 namespace VertexCFD
 {
 namespace TempusTimeStepControl
@@ -18,11 +25,62 @@ class Strategy : virtual public Tempus::TimeStepControlStrategy<Scalar>
     virtual ~Strategy() = default;
     double currentCFL() const { return _cfl_current; }
 
+    // Shorten the time steps to land on the output times of the given
+    // schedule.
+    void addOutputScheduler(
+        const Teuchos::RCP<const TempusObserver::OutputScheduler>& scheduler)
+    {
+        _output_schedulers.push_back(scheduler);
+    }
+
   protected:
     void setCurrentCFL(const double cfl) { _cfl_current = cfl; }
 
+    // Use the local time step size recorded during residual evaluations if
+    // the driver created a monitor for it.
+    void setLocalTimeStepMonitor(const Teuchos::ParameterList& user_params)
+    {
+        using monitor_type = Teuchos::RCP<Response::LocalTimeStepMonitor>;
+        if (user_params.isType<monitor_type>("Local Time Step Monitor"))
+        {
+            _local_dt_monitor
+                = user_params.get<monitor_type>("Local Time Step Monitor");
+        }
+    }
+
+    // Get the minimum local time step size of the last residual evaluation.
+    // Returns false if it is not available and the local time step size
+    // response must be evaluated instead. The recorded value is not used
+    // after a failed step since the last residual was evaluated at the
+    // rejected solution. Collective.
+    bool recordedLocalTimeStep(const Tempus::SolutionState<Scalar>& state,
+                               double& local_dt)
+    {
+        if (Teuchos::is_null(_local_dt_monitor))
+            return false;
+        const bool recorded = _local_dt_monitor->globalMinimum(local_dt);
+        return recorded && state.getNConsecutiveFailures() == 0;
+    }
+
+    // Shorten the time step from the given time so that it does not step
+    // over the next output time of any schedule.
+    double landOnOutputTimes(const double time, const double dt) const
+    {
+        double landing_dt = dt;
+        for (const auto& scheduler : _output_schedulers)
+        {
+            const double next_time = scheduler->nextLandingTime(time);
+            if (next_time < time + landing_dt)
+                landing_dt = next_time - time;
+        }
+        return landing_dt;
+    }
+
   private:
     double _cfl_current = 0.0;
+    Teuchos::RCP<Response::LocalTimeStepMonitor> _local_dt_monitor;
+    std::vector<Teuchos::RCP<const TempusObserver::OutputScheduler>>
+        _output_schedulers;
 };
 
 //---------------------------------------------------------------------------//
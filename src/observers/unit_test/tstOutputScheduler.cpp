@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+
+#include "observers/VertexCFD_TempusObserver_OutputScheduler.hpp"
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_ParameterList.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+Teuchos::RCP<const Teuchos::Comm<int>> comm()
+{
+    return Teuchos::DefaultComm<int>::getComm();
+}
+
+//---------------------------------------------------------------------------//
+// Step through the given times and return the indices at which output was
+// written.
+std::vector<int> outputSteps(TempusObserver::OutputScheduler& scheduler,
+                             const std::vector<double>& times)
+{
+    scheduler.initialize(times.front(), times.back());
+    std::vector<int> steps;
+    for (std::size_t i = 1; i < times.size(); ++i)
+    {
+        if (scheduler.isDue(i, times[i]))
+        {
+            scheduler.recordOutput(times[i]);
+            steps.push_back(i);
+        }
+    }
+    return steps;
+}
+
+//---------------------------------------------------------------------------//
+TEST(OutputScheduler, default_frequency)
+{
+    Teuchos::ParameterList params;
+    TempusObserver::OutputScheduler scheduler(
+        comm(), params, "Exodus Write", 2);
+    const std::vector<double> times = {0.0, 0.1, 0.2, 0.3, 0.4, 0.5};
+    EXPECT_EQ(std::vector<int>({2, 4}), outputSteps(scheduler, times));
+    EXPECT_EQ(std::numeric_limits<double>::max(),
+              scheduler.nextLandingTime(0.1));
+}
+
+//---------------------------------------------------------------------------//
+TEST(OutputScheduler, time_interval)
+{
+    // Time steps growing in size as with a CFL ramp.
+    Teuchos::ParameterList params;
+    params.set("Exodus Write Time Interval", 0.25);
+    TempusObserver::OutputScheduler scheduler(
+        comm(), params, "Exodus Write", 1);
+    const std::vector<double> times
+        = {0.0, 0.01, 0.02, 0.04, 0.08, 0.16, 0.32, 0.64, 0.7, 1.0};
+    EXPECT_EQ(std::vector<int>({6, 7, 9}), outputSteps(scheduler, times));
+}
+
+//---------------------------------------------------------------------------//
+TEST(OutputScheduler, frequency_and_time_interval)
+{
+    Teuchos::ParameterList params;
+    params.set("Restart Write Frequency", 4);
+    params.set("Restart Write Time Interval", 0.25);
+    TempusObserver::OutputScheduler scheduler(
+        comm(), params, "Restart Write", 1);
+    const std::vector<double> times
+        = {0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.55, 0.6, 0.65, 0.7};
+    EXPECT_EQ(std::vector<int>({3, 4, 5, 8}), outputSteps(scheduler, times));
+}
+
+//---------------------------------------------------------------------------//
+TEST(OutputScheduler, times_and_count)
+{
+    Teuchos::ParameterList params;
+    params.set("Output Times", Teuchos::Array<double>({0.35, 0.05, -1.0}));
+    params.set("Output Count", 2);
+    params.set("Output Land On Output Times", true);
+    TempusObserver::OutputScheduler scheduler(comm(), params, "Output", 0);
+    const std::vector<double> times = {0.0, 0.05, 0.2, 0.3, 0.5, 0.9, 1.0};
+    scheduler.initialize(times.front(), times.back());
+    EXPECT_FALSE(scheduler.isTimeDue(0.04));
+    EXPECT_TRUE(scheduler.isTimeDue(0.05));
+    scheduler.recordOutput(0.05);
+    EXPECT_FALSE(scheduler.isTimeDue(0.3));
+    EXPECT_EQ(0.35, scheduler.nextLandingTime(0.3));
+    EXPECT_TRUE(scheduler.isTimeDue(0.5));
+    scheduler.recordOutput(0.5);
+
+    // The count limits the output to two times.
+    EXPECT_FALSE(scheduler.isTimeDue(1.0));
+    EXPECT_EQ(std::numeric_limits<double>::max(),
+              scheduler.nextLandingTime(0.5));
+}
+
+//---------------------------------------------------------------------------//
+TEST(OutputScheduler, count)
+{
+    Teuchos::ParameterList params;
+    params.set("Output Count", 2);
+    params.set("Output Land On Output Times", true);
+    TempusObserver::OutputScheduler scheduler(comm(), params, "Output", 0);
+    scheduler.initialize(0.0, 1.0);
+    EXPECT_FALSE(scheduler.isTimeDue(0.4));
+    EXPECT_EQ(0.5, scheduler.nextLandingTime(0.4));
+
+    // The output of the initial state does not count.
+    scheduler.recordOutput(0.0);
+    EXPECT_TRUE(scheduler.isTimeDue(0.5));
+    scheduler.recordOutput(0.5);
+    EXPECT_EQ(1.0, scheduler.nextLandingTime(0.5));
+    EXPECT_TRUE(scheduler.isTimeDue(1.0));
+    scheduler.recordOutput(1.0);
+    EXPECT_EQ(std::numeric_limits<double>::max(),
+              scheduler.nextLandingTime(1.0));
+}
+
+//---------------------------------------------------------------------------//
+// The count limits the total number of outputs of all criteria.
+TEST(OutputScheduler, frequency_and_count)
+{
+    Teuchos::ParameterList params;
+    params.set("Exodus Write Frequency", 1);
+    params.set("Exodus Write Count", 3);
+    TempusObserver::OutputScheduler scheduler(
+        comm(), params, "Exodus Write", 1);
+    const std::vector<double> times = {0.0, 0.1, 0.2, 0.3, 0.4, 0.5};
+    EXPECT_EQ(std::vector<int>({1, 2, 3}), outputSteps(scheduler, times));
+}
+
+//---------------------------------------------------------------------------//
+TEST(OutputScheduler, interval_landing_times)
+{
+    Teuchos::ParameterList params;
+    params.set("Output Time Interval", 0.5);
+    params.set("Output Land On Output Times", true);
+    TempusObserver::OutputScheduler scheduler(comm(), params, "Output", 0);
+    scheduler.initialize(1.0, 1.0e6);
+
+    // Only the next interval time is computed, however small the interval
+    // is relative to the simulation time.
+    EXPECT_EQ(1.5, scheduler.nextLandingTime(1.0));
+    EXPECT_EQ(2.0, scheduler.nextLandingTime(1.7));
+    EXPECT_EQ(2.5, scheduler.nextLandingTime(2.0));
+}
+
+//---------------------------------------------------------------------------//
+TEST(OutputScheduler, wall_clock_interval)
+{
+    Teuchos::ParameterList params;
+    params.set("Output Wall Clock Interval", 1.0e6);
+    TempusObserver::OutputScheduler scheduler(comm(), params, "Output", 0);
+    scheduler.initialize(0.0, 1.0);
+    EXPECT_FALSE(scheduler.isDue(1, 0.5));
+}
+
+//---------------------------------------------------------------------------//
+TEST(OutputScheduler, invalid_parameters)
+{
+    Teuchos::ParameterList params;
+    params.set("Output Time Interval", -1.0);
+    EXPECT_THROW(TempusObserver::OutputScheduler(comm(), params, "Output", 0),
+                 std::runtime_error);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
@@ -155,6 +155,58 @@ void ResponseManager::addProbeResponse(
     addResponseFromBuilder(name, workset_descriptors, builder);
 }
 
+//---------------------------------------------------------------------------//
+void ResponseManager::addProbeArrayResponse(
+    const std::string& name,
+    const std::vector<std::string>& field_names,
+    const std::vector<Teuchos::Array<double>>& points)
+{
+    addProbeArrayResponse(
+        name, field_names, points, _default_workset_descriptors);
+}
+
+//---------------------------------------------------------------------------//
+void ResponseManager::addProbeArrayResponse(
+    const std::string& name,
+    const std::vector<std::string>& field_names,
+    const std::vector<Teuchos::Array<double>>& points,
+    const std::vector<panzer::WorksetDescriptor>& workset_descriptors)
+{
+    // Probes are located in the element blocks of the workset descriptors.
+    std::vector<std::string> element_blocks;
+    for (const auto& descriptor : workset_descriptors)
+    {
+        const auto& block = descriptor.getElementBlock();
+        if (std::find(element_blocks.begin(), element_blocks.end(), block)
+            == element_blocks.end())
+        {
+            element_blocks.push_back(block);
+        }
+    }
+
+    const int array = _probe_arrays.size();
+    _probe_arrays.emplace_back(Teuchos::rcp(
+        new ProbeArray(_physics_manager->meshManager()->mesh(),
+                       _physics_manager->dofManager(),
+                       _physics_manager->linearObjectFactory(),
+                       field_names,
+                       points,
+                       element_blocks)));
+
+    const int num_fields = field_names.size();
+    const int num_probes = points.size();
+    for (int field = 0; field < num_fields; ++field)
+    {
+        for (int probe = 0; probe < num_probes; ++probe)
+        {
+            const std::string value_name = name + " "
+                                           + std::to_string(probe + 1)
+                                           + " - " + field_names[field];
+            addResponse(value_name, -1, Teuchos::null, {array, probe, field});
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 template<class Builder>
 void ResponseManager::addResponseFromBuilder(
@@ -173,10 +225,25 @@ void ResponseManager::addResponseFromBuilder(
     const int response_index
         = model_evaluator->addFlexibleResponse(name, workset_desc, builder);
 
-    _resp_vectors.emplace_back(
-        Thyra::createMember(model_evaluator->get_g_space(response_index)));
+    addResponse(
+        name,
+        response_index,
+        Thyra::createMember(model_evaluator->get_g_space(response_index)),
+        {-1, -1, -1});
+}
+
+//---------------------------------------------------------------------------//
+void ResponseManager::addResponse(
+    const std::string& name,
+    const int response_index,
+    const Teuchos::RCP<Thyra::VectorBase<double>>& resp_vector,
+    const ProbeValue& probe_value)
+{
+    _resp_vectors.emplace_back(resp_vector);
+    _probe_values.emplace_back(probe_value);
 
     _index_map.emplace_back(response_index);
+    _names.emplace_back(name);
     _name_map.emplace(name, _num_responses);
     _is_active.emplace_back(true);
 
@@ -227,17 +294,37 @@ void ResponseManager::evaluateResponses(
     in_args.set_x(x);
     in_args.set_x_dot(x_dot);
 
-    // Set output vector for each active response.
+    // Set output vector for each active response and find the probe arrays
+    // with active values.
+    bool evaluate_model = false;
+    std::vector<bool> evaluate_probes(_probe_arrays.size(), false);
     for (int i = 0; i < _num_responses; ++i)
     {
         if (_is_active[i])
         {
-            out_args.set_g(_index_map[i], _resp_vectors[i]);
+            if (_index_map[i] >= 0)
+            {
+                out_args.set_g(_index_map[i], _resp_vectors[i]);
+                evaluate_model = true;
+            }
+            else
+            {
+                evaluate_probes[_probe_values[i].array] = true;
+            }
         }
     }
 
     // Evaluate the response.
-    model_evaluator->evalModel(in_args, out_args);
+    if (evaluate_model)
+        model_evaluator->evalModel(in_args, out_args);
+
+    // Evaluate the probe arrays.
+    const int num_arrays = _probe_arrays.size();
+    for (int a = 0; a < num_arrays; ++a)
+    {
+        if (evaluate_probes[a])
+            _probe_arrays[a]->evaluate(x);
+    }
 
     // Extract the value and insert it into the parameter library.
     for (int i = 0; i < _num_responses; ++i)
@@ -263,12 +350,18 @@ int ResponseManager::globalIndex(const std::string& name) const
 //---------------------------------------------------------------------------//
 const std::string& ResponseManager::name(const int index) const
 {
-    return _physics_manager->modelEvaluator()->get_g_name(globalIndex(index));
+    return _names.at(index);
 }
 
 //---------------------------------------------------------------------------//
 double ResponseManager::value(const int index) const
 {
+    if (_index_map.at(index) < 0)
+    {
+        const auto& probe_value = _probe_values[index];
+        return _probe_arrays[probe_value.array]->value(probe_value.probe,
+                                                       probe_value.field);
+    }
     return Thyra::get_ele(*_resp_vectors.at(index), 0);
 }
 
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_RESPONSEMANAGER_HPP
 #define VERTEXCFD_RESPONSEMANAGER_HPP
 
+#include "VertexCFD_Response_ProbeArray.hpp"
+
 #include "drivers/VertexCFD_PhysicsManager.hpp"
 
 #include <Panzer_WorksetDescriptor.hpp>
@@ -49,6 +51,20 @@ class ResponseManager
     void addProbeResponse(const std::string& name,
                           const std::string& field_name,
                           const Teuchos::Array<double>& point);
+
+    // Add a response for each field at each probe point, named
+    // "<name> <probe number> - <field name>" and ordered by field and then by
+    // probe. The probes are located once and all values are computed from
+    // the solution vector without a model evaluation.
+    void addProbeArrayResponse(
+        const std::string& name,
+        const std::vector<std::string>& field_names,
+        const std::vector<Teuchos::Array<double>>& points,
+        const std::vector<panzer::WorksetDescriptor>& workset_descriptors);
+    void addProbeArrayResponse(
+        const std::string& name,
+        const std::vector<std::string>& field_names,
+        const std::vector<Teuchos::Array<double>>& points);
     void activateResponse(const int index = 0);
     void activateResponse(const std::string& name);
     void deactivateAll();
@@ -57,6 +73,9 @@ class ResponseManager
                       const Teuchos::RCP<Thyra::VectorBase<double>>& x_dot);
 
     int numResponses() const;
+
+    // Index of the response in the model evaluator. Probe array responses
+    // are not model evaluator responses and have index -1.
     int globalIndex(const int index = 0) const;
     int globalIndex(const std::string& name) const;
     const std::string& name(const int index = 0) const;
@@ -64,14 +83,30 @@ class ResponseManager
     double value(const std::string& name) const;
 
   private:
+    // Location of a probe array response value.
+    struct ProbeValue
+    {
+        int array;
+        int probe;
+        int field;
+    };
+
     int _num_responses;
     Teuchos::RCP<PhysicsManager> _physics_manager;
     std::vector<panzer::WorksetDescriptor> _default_workset_descriptors;
     std::vector<int> _index_map;
+    std::vector<std::string> _names;
     std::unordered_map<std::string, int> _name_map;
     std::vector<Teuchos::RCP<Thyra::VectorBase<double>>> _resp_vectors;
+    std::vector<ProbeValue> _probe_values;
+    std::vector<Teuchos::RCP<ProbeArray>> _probe_arrays;
     std::vector<bool> _is_active;
 
+    void addResponse(const std::string& name,
+                     const int response_index,
+                     const Teuchos::RCP<Thyra::VectorBase<double>>& resp_vector,
+                     const ProbeValue& probe_value);
+
     void addExtremeValueResponse(
         const bool use_max,
         const std::string& name,
@@ -0,0 +1,67 @@
+#ifndef VERTEXCFD_RESPONSE_LOCALTIMESTEPMINIMUM_HPP
+#define VERTEXCFD_RESPONSE_LOCALTIMESTEPMINIMUM_HPP
+
+#include "responses/VertexCFD_Response_LocalTimeStepMonitor.hpp"
+
+#include <Panzer_Dimension.hpp>
+#include <Panzer_Evaluator_WithBaseImpl.hpp>
+#include <Panzer_IntegrationRule.hpp>
+#include <Panzer_Traits.hpp>
+
+#include <Phalanx_Evaluator_Derived.hpp>
+#include <Phalanx_FieldManager.hpp>
+#include <Phalanx_MDField.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <string>
+
+namespace VertexCFD
+{
+namespace Response
+{
+//---------------------------------------------------------------------------//
+// Record the minimum of the local time step size of each residual workset
+// evaluation in a LocalTimeStepMonitor while the monitor is recording. The
+// evaluated dummy field must be required by the field manager for this
+// evaluator to run.
+//
+// The monitor only records during the nonlinear solve of a time step, and
+// each evaluation replaces the previous one, so the recorded minimum is the
+// one of the last residual evaluation of the solve, at the converged state.
+// Requiring the local time step size still adds the local_dt closure and its
+// dependencies, such as the element length, to every residual evaluation.
+// The recording is therefore only cheaper than the separate response
+// evaluation it replaces when few residuals are evaluated per time step.
+//---------------------------------------------------------------------------//
+template<class Traits>
+class LocalTimeStepMinimum
+    : public panzer::EvaluatorWithBaseImpl<Traits>,
+      public PHX::EvaluatorDerived<panzer::Traits::Residual, Traits>
+{
+  public:
+    LocalTimeStepMinimum(const panzer::IntegrationRule& ir,
+                         const std::string& block_id,
+                         const Teuchos::RCP<LocalTimeStepMonitor>& monitor);
+
+    void preEvaluate(typename Traits::PreEvalData d) override;
+
+    void evaluateFields(typename Traits::EvalData d) override;
+
+  public:
+    PHX::MDField<double, panzer::Dummy> _local_dt_minimum;
+
+  private:
+    PHX::MDField<const double, panzer::Cell, panzer::Point> _local_dt;
+    std::string _block_id;
+    Teuchos::RCP<LocalTimeStepMonitor> _monitor;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Response
+} // end namespace VertexCFD
+
+#include "VertexCFD_Response_LocalTimeStepMinimum_impl.hpp"
+
+#endif // end VERTEXCFD_RESPONSE_LOCALTIMESTEPMINIMUM_HPP
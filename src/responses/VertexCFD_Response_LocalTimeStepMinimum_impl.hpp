@@ -0,0 +1,69 @@
+#ifndef VERTEXCFD_RESPONSE_LOCALTIMESTEPMINIMUM_IMPL_HPP
+#define VERTEXCFD_RESPONSE_LOCALTIMESTEPMINIMUM_IMPL_HPP
+
+#include <Phalanx_DataLayout_MDALayout.hpp>
+
+#include <Kokkos_Core.hpp>
+
+namespace VertexCFD
+{
+namespace Response
+{
+//---------------------------------------------------------------------------//
+template<class Traits>
+LocalTimeStepMinimum<Traits>::LocalTimeStepMinimum(
+    const panzer::IntegrationRule& ir,
+    const std::string& block_id,
+    const Teuchos::RCP<LocalTimeStepMonitor>& monitor)
+    : _local_dt_minimum(
+        "local_dt_minimum",
+        Teuchos::rcp(new PHX::MDALayout<panzer::Dummy>(0)))
+    , _local_dt("local_dt", ir.dl_scalar)
+    , _block_id(block_id)
+    , _monitor(monitor)
+{
+    this->addEvaluatedField(_local_dt_minimum);
+    this->addDependentField(_local_dt);
+
+    this->setName("Local Time Step Minimum");
+}
+
+//---------------------------------------------------------------------------//
+template<class Traits>
+void LocalTimeStepMinimum<Traits>::preEvaluate(typename Traits::PreEvalData)
+{
+    if (_monitor->recording())
+        _monitor->reset(_block_id);
+}
+
+//---------------------------------------------------------------------------//
+template<class Traits>
+void LocalTimeStepMinimum<Traits>::evaluateFields(
+    typename Traits::EvalData workset)
+{
+    if (!_monitor->recording())
+        return;
+
+    const auto local_dt = _local_dt.get_static_view();
+    const int num_point = local_dt.extent(1);
+    double minimum;
+    Kokkos::parallel_reduce(
+        this->getName(),
+        Kokkos::RangePolicy<PHX::exec_space>(0, workset.num_cells),
+        KOKKOS_LAMBDA(const int cell, double& cell_minimum) {
+            for (int point = 0; point < num_point; ++point)
+            {
+                if (local_dt(cell, point) < cell_minimum)
+                    cell_minimum = local_dt(cell, point);
+            }
+        },
+        Kokkos::Min<double>(minimum));
+    _monitor->update(_block_id, minimum);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Response
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_RESPONSE_LOCALTIMESTEPMINIMUM_IMPL_HPP
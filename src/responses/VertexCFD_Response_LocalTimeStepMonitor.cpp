@@ -0,0 +1,58 @@
+#include "VertexCFD_Response_LocalTimeStepMonitor.hpp"
+
+#include <Teuchos_CommHelpers.hpp>
+
+#include <algorithm>
+#include <limits>
+
+namespace VertexCFD
+{
+namespace Response
+{
+//---------------------------------------------------------------------------//
+LocalTimeStepMonitor::LocalTimeStepMonitor(
+    const Teuchos::RCP<const Teuchos::Comm<int>>& comm)
+    : _comm(comm)
+    , _recording(false)
+{
+}
+
+//---------------------------------------------------------------------------//
+void LocalTimeStepMonitor::reset(const std::string& block_id)
+{
+    _block_minimum[block_id] = std::numeric_limits<double>::max();
+}
+
+//---------------------------------------------------------------------------//
+void LocalTimeStepMonitor::update(const std::string& block_id,
+                                  const double local_dt)
+{
+    auto& minimum
+        = _block_minimum.emplace(block_id, std::numeric_limits<double>::max())
+              .first->second;
+    minimum = std::min(minimum, local_dt);
+}
+
+//---------------------------------------------------------------------------//
+bool LocalTimeStepMonitor::globalMinimum(double& local_dt)
+{
+    int recorded = _block_minimum.empty() ? 0 : 1;
+    double minimum = std::numeric_limits<double>::max();
+    for (const auto& block : _block_minimum)
+        minimum = std::min(minimum, block.second);
+    _block_minimum.clear();
+
+    int global_recorded;
+    Teuchos::reduceAll(*_comm,
+                       Teuchos::REDUCE_MIN,
+                       recorded,
+                       Teuchos::outArg(global_recorded));
+    Teuchos::reduceAll(
+        *_comm, Teuchos::REDUCE_MIN, minimum, Teuchos::outArg(local_dt));
+    return global_recorded == 1;
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Response
+} // end namespace VertexCFD
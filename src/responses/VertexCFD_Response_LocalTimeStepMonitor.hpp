@@ -0,0 +1,56 @@
+#ifndef VERTEXCFD_RESPONSE_LOCALTIMESTEPMONITOR_HPP
+#define VERTEXCFD_RESPONSE_LOCALTIMESTEPMONITOR_HPP
+
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <string>
+#include <unordered_map>
+
+namespace VertexCFD
+{
+namespace Response
+{
+//---------------------------------------------------------------------------//
+// Records the minimum local time step size computed during residual
+// evaluations so the time step control can use it without evaluating the
+// local time step size response. Each element block keeps the minimum of
+// its most recent evaluation. Evaluations are only recorded while recording
+// is enabled, which the LocalTimeStepRecording observer restricts to the
+// nonlinear solve of each time step.
+//---------------------------------------------------------------------------//
+class LocalTimeStepMonitor
+{
+  public:
+    explicit LocalTimeStepMonitor(
+        const Teuchos::RCP<const Teuchos::Comm<int>>& comm);
+
+    // Enable or disable the recording of evaluations.
+    void setRecording(const bool recording) { _recording = recording; }
+
+    // Whether evaluations are currently recorded.
+    bool recording() const { return _recording; }
+
+    // Start recording a new evaluation of an element block.
+    void reset(const std::string& block_id);
+
+    // Record the minimum local time step size of a workset.
+    void update(const std::string& block_id, const double local_dt);
+
+    // Get the global minimum over the element blocks and clear the recorded
+    // values. Returns false if no evaluation was recorded on some rank.
+    // Collective.
+    bool globalMinimum(double& local_dt);
+
+  private:
+    Teuchos::RCP<const Teuchos::Comm<int>> _comm;
+    bool _recording;
+    std::unordered_map<std::string, double> _block_minimum;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Response
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_RESPONSE_LOCALTIMESTEPMONITOR_HPP
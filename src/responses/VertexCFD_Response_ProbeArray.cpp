@@ -0,0 +1,111 @@
+#include "VertexCFD_Response_ProbeArray.hpp"
+
+#include <Thyra_SpmdVectorBase.hpp>
+
+#include <Teuchos_DefaultMpiComm.hpp>
+
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace Response
+{
+//---------------------------------------------------------------------------//
+ProbeArray::ProbeArray(
+    const Teuchos::RCP<const panzer_stk::STK_Interface>& mesh,
+    const Teuchos::RCP<const panzer::GlobalIndexer>& dof_manager,
+    const Teuchos::RCP<const panzer::LinearObjFactory<panzer::Traits>>&
+        linear_object_factory,
+    const std::vector<std::string>& field_names,
+    const std::vector<Teuchos::Array<double>>& points,
+    const std::vector<std::string>& element_blocks)
+    : _num_probes(points.size())
+    , _num_fields(field_names.size())
+{
+    // Get the MPI communicator.
+    auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+        dof_manager->getComm());
+    _comm = Teuchos::getRawMpiComm(*comm);
+    int comm_rank;
+    MPI_Comm_rank(_comm, &comm_rank);
+
+    const int num_space_dim = mesh->getDimension();
+    for (int p = 0; p < _num_probes; ++p)
+    {
+        if (static_cast<int>(points[p].size()) != num_space_dim)
+        {
+            throw std::runtime_error(
+                "Probe " + std::to_string(p + 1) + " has "
+                + std::to_string(points[p].size())
+                + " coordinates in a mesh of dimension "
+                + std::to_string(num_space_dim));
+        }
+    }
+
+    // The probes are only given by the first rank and must be inside the
+    // mesh.
+    const int num_points = comm_rank == 0 ? _num_probes : 0;
+    Kokkos::View<double**, Kokkos::HostSpace> target_points(
+        "probe_points", num_points, num_space_dim);
+    for (int p = 0; p < num_points; ++p)
+    {
+        for (int dim = 0; dim < num_space_dim; ++dim)
+            target_points(p, dim) = points[p][dim];
+    }
+    _interpolation = Teuchos::rcp(new Mesh::FieldInterpolation(
+        mesh, dof_manager, field_names, target_points, element_blocks, 1.0e-8,
+        false));
+
+    _ged = linear_object_factory->buildReadOnlyDomainContainer();
+    _probe_values = Kokkos::View<double**, PHX::Device>(
+        "probe_values", num_points, _num_fields);
+    _values.assign(_num_probes * _num_fields, 0.0);
+}
+
+//---------------------------------------------------------------------------//
+void ProbeArray::evaluate(
+    const Teuchos::RCP<const Thyra::VectorBase<double>>& x)
+{
+    // Gather the ghosted solution.
+    _ged->setOwnedVector(x);
+    _ged->globalToGhost(0);
+    auto ghosted_vector
+        = Teuchos::rcp_dynamic_cast<const Thyra::SpmdVectorBase<double>>(
+            _ged->getGhostedVector(), true);
+    auto ghosted_data_host = ghosted_vector->getLocalSubVector();
+
+    // Thyra only provides the ghosted data via a host-side array, which is
+    // copied to the device in one transfer.
+    if (_ghosted_data.extent(0)
+        != static_cast<std::size_t>(ghosted_data_host.subDim()))
+    {
+        _ghosted_data = Kokkos::View<double*, PHX::Device>(
+            "probe_ghosted_data", ghosted_data_host.subDim());
+    }
+    Kokkos::View<const double*, Kokkos::HostSpace, Kokkos::MemoryUnmanaged>
+        ghosted_data_view(ghosted_data_host.values().get(),
+                          ghosted_data_host.subDim());
+    Kokkos::deep_copy(_ghosted_data, ghosted_data_view);
+
+    // Interpolate the values to the first rank and broadcast them.
+    _interpolation->interpolate(_ghosted_data, _probe_values);
+    const auto probe_values_host = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), _probe_values);
+    for (std::size_t p = 0; p < probe_values_host.extent(0); ++p)
+    {
+        for (int f = 0; f < _num_fields; ++f)
+            _values[p * _num_fields + f] = probe_values_host(p, f);
+    }
+    MPI_Bcast(_values.data(), _values.size(), MPI_DOUBLE, 0, _comm);
+}
+
+//---------------------------------------------------------------------------//
+double ProbeArray::value(const int probe, const int field) const
+{
+    return _values.at(probe * _num_fields + field);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Response
+} // end namespace VertexCFD
@@ -0,0 +1,84 @@
+#ifndef VERTEXCFD_RESPONSE_PROBEARRAY_HPP
+#define VERTEXCFD_RESPONSE_PROBEARRAY_HPP
+
+#include "mesh/VertexCFD_Mesh_FieldInterpolation.hpp"
+
+#include <Panzer_GlobalIndexer.hpp>
+#include <Panzer_LinearObjFactory.hpp>
+#include <Panzer_ReadOnlyVector_GlobalEvaluationData.hpp>
+#include <Panzer_STK_Interface.hpp>
+#include <Panzer_Traits.hpp>
+
+#include <Phalanx_KokkosDeviceTypes.hpp>
+
+#include <Thyra_VectorBase.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Response
+{
+//---------------------------------------------------------------------------//
+// Point values of a set of solution fields at a set of probe points.
+//
+// The probes are located once at construction with a field interpolation
+// from the solution mesh, with the probe points given by the first rank.
+// Evaluating all fields at all probes gathers the ghosted solution,
+// interpolates it on the device and broadcasts the values from the first
+// rank.
+//---------------------------------------------------------------------------//
+class ProbeArray
+{
+  public:
+    // Locate the probes in the given element blocks, or all element blocks
+    // if none are given. Throws on all ranks if a probe is not in any
+    // element or if a field is not defined in the element block containing a
+    // probe. Collective.
+    ProbeArray(
+        const Teuchos::RCP<const panzer_stk::STK_Interface>& mesh,
+        const Teuchos::RCP<const panzer::GlobalIndexer>& dof_manager,
+        const Teuchos::RCP<const panzer::LinearObjFactory<panzer::Traits>>&
+            linear_object_factory,
+        const std::vector<std::string>& field_names,
+        const std::vector<Teuchos::Array<double>>& points,
+        const std::vector<std::string>& element_blocks);
+
+    int numProbes() const { return _num_probes; }
+    int numFields() const { return _num_fields; }
+
+    // Evaluate all fields at all probes. Collective.
+    void evaluate(const Teuchos::RCP<const Thyra::VectorBase<double>>& x);
+
+    // Value of a field at a probe from the last evaluation.
+    double value(const int probe, const int field) const;
+
+  private:
+    MPI_Comm _comm;
+    int _num_probes;
+    int _num_fields;
+
+    Teuchos::RCP<Mesh::FieldInterpolation> _interpolation;
+    Teuchos::RCP<panzer::ReadOnlyVector_GlobalEvaluationData> _ged;
+
+    // Ghosted solution and probe values (probe,field) on the device.
+    Kokkos::View<double*, PHX::Device> _ghosted_data;
+    Kokkos::View<double**, PHX::Device> _probe_values;
+
+    std::vector<double> _values;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Response
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_RESPONSE_PROBEARRAY_HPP
@@ -0,0 +1,211 @@
+#include "VertexCFD_Response_TimeSeriesWriter.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace VertexCFD
+{
+namespace Response
+{
+namespace
+{
+// Version 2.0 of the .npy format stores the header length in 4 bytes so the
+// header can hold many response names.
+constexpr char npy_magic[] = "\x93NUMPY\x02\x00";
+constexpr std::size_t npy_magic_size = 8;
+constexpr std::size_t npy_prefix_size = npy_magic_size + 4;
+
+// The data starts at a multiple of this alignment.
+constexpr std::size_t npy_alignment = 64;
+
+// Number of digits reserved for the row count in the header.
+constexpr std::size_t max_row_digits = 20;
+
+//---------------------------------------------------------------------------//
+// Quote a name as a Python string literal.
+std::string quote(const std::string& name)
+{
+    std::string quoted = "'";
+    for (const char c : name)
+    {
+        if (c == '\\' || c == '\'')
+            quoted += '\\';
+        quoted += c;
+    }
+    return quoted + "'";
+}
+
+//---------------------------------------------------------------------------//
+bool littleEndian()
+{
+    const std::uint16_t value = 1;
+    unsigned char byte;
+    std::memcpy(&byte, &value, 1);
+    return byte == 1;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+TimeSeriesWriter::TimeSeriesWriter(
+    const Teuchos::RCP<const Teuchos::Comm<int>>& comm,
+    const std::string& file_name,
+    const std::vector<std::string>& response_names,
+    const int buffer_rows,
+    const bool asynchronous)
+    : _is_root(comm->getRank() == 0)
+    , _file_name(file_name)
+    , _buffer_rows(buffer_rows)
+    , _asynchronous(asynchronous)
+    , _header_size(0)
+    , _num_rows(0)
+{
+    if (buffer_rows <= 0)
+        throw std::runtime_error("Time series buffer size must be positive");
+
+    _columns.reserve(response_names.size() + 2);
+    _columns.push_back("index");
+    _columns.push_back("time");
+    _columns.insert(
+        _columns.end(), response_names.begin(), response_names.end());
+
+    if (!_is_root)
+        return;
+
+    // Reserve room in the header for the largest row count.
+    const std::size_t size = npy_prefix_size
+                             + header(0).size() + max_row_digits;
+    _header_size = (size + npy_alignment - 1) / npy_alignment * npy_alignment;
+
+    std::ofstream file(_file_name, std::ios::binary | std::ios::trunc);
+    if (!file)
+    {
+        throw std::runtime_error("Could not create time series file "
+                                 + _file_name);
+    }
+    const auto h = header(0);
+    file.write(h.data(), h.size());
+}
+
+//---------------------------------------------------------------------------//
+TimeSeriesWriter::~TimeSeriesWriter()
+{
+    if (_pending_write.valid())
+        _pending_write.wait();
+    if (_is_root && !_buffer.empty())
+        writeRows(_buffer);
+}
+
+//---------------------------------------------------------------------------//
+void TimeSeriesWriter::addRow(const int index,
+                              const double time,
+                              const std::vector<double>& values)
+{
+    if (!_is_root)
+        return;
+
+    if (values.size() + 2 != _columns.size())
+    {
+        throw std::logic_error(
+            "Number of time series values does not match the number of "
+            "responses");
+    }
+
+    _buffer.push_back(index);
+    _buffer.push_back(time);
+    _buffer.insert(_buffer.end(), values.begin(), values.end());
+
+    if (_buffer.size() >= _buffer_rows * _columns.size())
+        flush();
+}
+
+//---------------------------------------------------------------------------//
+void TimeSeriesWriter::flush()
+{
+    if (!_is_root || _buffer.empty())
+        return;
+
+    if (_asynchronous)
+    {
+        // Only one block is written at a time so the rows stay in order.
+        finishWrites();
+        _pending_write = std::async(
+            std::launch::async,
+            [this, rows = std::move(_buffer)]() { writeRows(rows); });
+        _buffer.clear();
+    }
+    else
+    {
+        writeRows(_buffer);
+        _buffer.clear();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void TimeSeriesWriter::finishWrites()
+{
+    // Rethrows any exception raised by the file write.
+    if (_pending_write.valid())
+        _pending_write.get();
+}
+
+//---------------------------------------------------------------------------//
+// Header of the file with the given row count, padded to the reserved size.
+std::string TimeSeriesWriter::header(const std::size_t num_rows) const
+{
+    const std::string type = littleEndian() ? "'<f8'" : "'>f8'";
+    std::string dict = "{'descr': [";
+    for (const auto& column : _columns)
+        dict += "(" + quote(column) + ", " + type + "), ";
+    dict += "], 'fortran_order': False, 'shape': (" + std::to_string(num_rows)
+            + ",), }";
+
+    // The header is padded with spaces and ends with a newline.
+    const std::size_t dict_size
+        = _header_size > 0 ? _header_size - npy_prefix_size : dict.size() + 1;
+    dict.resize(dict_size - 1, ' ');
+    dict += '\n';
+
+    const std::uint32_t length = dict.size();
+    std::string h(npy_magic, npy_magic_size);
+    for (int i = 0; i < 4; ++i)
+        h += static_cast<char>((length >> (8 * i)) & 0xff);
+    return h + dict;
+}
+
+//---------------------------------------------------------------------------//
+// Append rows to the file and then update the row count so that the header
+// never describes rows that were not written.
+void TimeSeriesWriter::writeRows(const std::vector<double>& rows)
+{
+    std::fstream file(_file_name,
+                      std::ios::binary | std::ios::in | std::ios::out);
+    if (!file)
+    {
+        throw std::runtime_error("Could not open time series file "
+                                 + _file_name);
+    }
+
+    const std::size_t row_bytes = _columns.size() * sizeof(double);
+    file.seekp(_header_size + _num_rows * row_bytes);
+    file.write(reinterpret_cast<const char*>(rows.data()),
+               rows.size() * sizeof(double));
+    file.flush();
+
+    _num_rows += rows.size() / _columns.size();
+    const auto h = header(_num_rows);
+    file.seekp(0);
+    file.write(h.data(), h.size());
+    if (!file)
+    {
+        throw std::runtime_error("Could not write time series file "
+                                 + _file_name);
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Response
+} // end namespace VertexCFD
@@ -0,0 +1,76 @@
+#ifndef VERTEXCFD_RESPONSE_TIMESERIESWRITER_HPP
+#define VERTEXCFD_RESPONSE_TIMESERIESWRITER_HPP
+
+#include <Teuchos_Comm.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <cstddef>
+#include <future>
+#include <string>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Response
+{
+//---------------------------------------------------------------------------//
+// Writes a time series of scalar responses to a NumPy .npy file on the root
+// rank. Each row holds the time step index, the time and one value per
+// response as a record of doubles with named fields, so the file can be read
+// with
+//
+//   data = numpy.load(file_name)
+//   data["time"], data["<response name>"]
+//
+// Rows are buffered in memory and appended to the file in blocks. The header
+// is rewritten with the new row count after each block so the file is always
+// readable. In asynchronous mode the blocks are written on a background
+// thread.
+//---------------------------------------------------------------------------//
+class TimeSeriesWriter
+{
+  public:
+    // Create the file with the given response names and no rows.
+    TimeSeriesWriter(const Teuchos::RCP<const Teuchos::Comm<int>>& comm,
+                     const std::string& file_name,
+                     const std::vector<std::string>& response_names,
+                     const int buffer_rows,
+                     const bool asynchronous);
+
+    // Writes the remaining rows.
+    ~TimeSeriesWriter();
+
+    // Add a row of response values. Values of responses not evaluated at
+    // this step should be NaN. Starts writing the buffered rows when the
+    // buffer is full.
+    void addRow(const int index,
+                const double time,
+                const std::vector<double>& values);
+
+    // Start writing the buffered rows.
+    void flush();
+
+    // Complete the pending asynchronous write, if any.
+    void finishWrites();
+
+  private:
+    std::string header(const std::size_t num_rows) const;
+    void writeRows(const std::vector<double>& rows);
+
+    bool _is_root;
+    std::string _file_name;
+    std::vector<std::string> _columns;
+    std::size_t _buffer_rows;
+    bool _asynchronous;
+    std::size_t _header_size;
+    std::size_t _num_rows;
+    std::vector<double> _buffer;
+    std::future<void> _pending_write;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Response
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_RESPONSE_TIMESERIESWRITER_HPP
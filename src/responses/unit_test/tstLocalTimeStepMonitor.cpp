@@ -0,0 +1,117 @@
+#include "VertexCFD_ResponseUnitTestConfig.hpp"
+
+#include "drivers/VertexCFD_InitialConditionManager.hpp"
+#include "drivers/VertexCFD_MeshManager.hpp"
+#include "drivers/VertexCFD_PhysicsManager.hpp"
+#include "parameters/VertexCFD_ParameterDatabase.hpp"
+#include "responses/VertexCFD_Response_LocalTimeStepMonitor.hpp"
+
+#include <Thyra_VectorStdOps.hpp>
+
+#include <Teuchos_DefaultComm.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+TEST(LocalTimeStepMonitor, GlobalMinimum)
+{
+    const auto comm = Teuchos::DefaultComm<int>::getComm();
+    const int rank = comm->getRank();
+    Response::LocalTimeStepMonitor monitor(comm);
+
+    // Nothing recorded yet.
+    double local_dt = 0.0;
+    EXPECT_FALSE(monitor.globalMinimum(local_dt));
+
+    // Record two blocks over several worksets.
+    monitor.reset("block1");
+    monitor.update("block1", 2.0 + rank);
+    monitor.update("block1", 0.5 + rank);
+    monitor.reset("block2");
+    monitor.update("block2", 1.0 + rank);
+    EXPECT_TRUE(monitor.globalMinimum(local_dt));
+    EXPECT_DOUBLE_EQ(0.5, local_dt);
+
+    // A new evaluation of a block replaces its previous minimum.
+    monitor.update("block1", 0.1);
+    monitor.reset("block1");
+    monitor.update("block1", 3.0);
+    EXPECT_TRUE(monitor.globalMinimum(local_dt));
+    EXPECT_DOUBLE_EQ(3.0, local_dt);
+
+    // Recorded values are cleared after each query.
+    EXPECT_FALSE(monitor.globalMinimum(local_dt));
+}
+
+//---------------------------------------------------------------------------//
+// The equation set registers the recording evaluator in the residual field
+// managers if the user data holds a monitor, which records while enabled.
+// The test input has a uniform velocity (2, 3) on 1/8 x 1/4 elements and a
+// single integration point at the element centers, where the element length
+// is exact, so the local time step size is 1 / (2 * 8 + 3 * 4) everywhere.
+TEST(LocalTimeStepMonitor, EquationSet)
+{
+    auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+        Teuchos::DefaultComm<int>::getComm());
+
+    const std::string location = VERTEXCFD_RESPONSE_TEST_DATA_DIR;
+    auto parameter_db = Teuchos::rcp(new Parameter::ParameterDatabase(
+        comm, location + "local_time_step_test.xml"));
+
+    auto monitor = Teuchos::rcp(new Response::LocalTimeStepMonitor(comm));
+    parameter_db->userParameters()->set("Local Time Step Monitor", monitor);
+
+    auto mesh_manager = Teuchos::rcp(new MeshManager(*parameter_db, comm));
+    auto physics_manager = Teuchos::rcp(new PhysicsManager(
+        std::integral_constant<int, 2>{}, parameter_db, mesh_manager));
+    physics_manager->setupModel();
+
+    InitialConditionManager ic_manager(parameter_db, mesh_manager);
+    Teuchos::RCP<Thyra::VectorBase<double>> x;
+    Teuchos::RCP<Thyra::VectorBase<double>> x_dot;
+    ic_manager.applyInitialConditions(
+        std::integral_constant<int, 2>{}, *physics_manager, x, x_dot);
+
+    auto model = physics_manager->modelEvaluator();
+    auto in_args = model->createInArgs();
+    in_args.set_x(x);
+    in_args.set_x_dot(x_dot);
+    in_args.set_alpha(0.0);
+    in_args.set_beta(1.0);
+    in_args.set_t(0.0);
+
+    // A residual evaluation outside of the recording window does not record
+    // the local time step size.
+    auto residual_out_args = model->createOutArgs();
+    residual_out_args.set_f(Thyra::createMember(model->get_f_space()));
+    model->evalModel(in_args, residual_out_args);
+    double local_dt = 0.0;
+    EXPECT_FALSE(monitor->globalMinimum(local_dt));
+
+    // Neither does a Jacobian evaluation while recording.
+    monitor->setRecording(true);
+    auto jacobian_out_args = model->createOutArgs();
+    jacobian_out_args.set_W_op(model->create_W_op());
+    model->evalModel(in_args, jacobian_out_args);
+    EXPECT_FALSE(monitor->globalMinimum(local_dt));
+
+    // A residual evaluation does.
+    model->evalModel(in_args, residual_out_args);
+    EXPECT_TRUE(monitor->globalMinimum(local_dt));
+    EXPECT_NEAR(1.0 / 28.0, local_dt, 1.0e-12);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
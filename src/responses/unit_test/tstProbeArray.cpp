@@ -0,0 +1,222 @@
+#include <responses/VertexCFD_Response_ProbeArray.hpp>
+
+#include <Panzer_DOFManager.hpp>
+#include <Panzer_NodalFieldPattern.hpp>
+#include <Panzer_STKConnManager.hpp>
+#include <Panzer_STK_SquareQuadMeshFactory.hpp>
+#include <Panzer_TpetraLinearObjFactory.hpp>
+
+#include <Thyra_SpmdVectorBase.hpp>
+#include <Thyra_VectorStdOps.hpp>
+
+#include <Shards_CellTopology.hpp>
+
+#include <Teuchos_Array.hpp>
+#include <Teuchos_DefaultMpiComm.hpp>
+#include <Teuchos_RCP.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Linear fields, which are exactly represented by the nodal basis.
+double linearField(const int field, const double* x)
+{
+    return field == 0 ? 1.0 + 2.0 * x[0] - 3.0 * x[1]
+                      : -0.5 + x[0] + 4.0 * x[1];
+}
+
+//---------------------------------------------------------------------------//
+// Two element blocks on [0,2]x[0,1]. The fields u and v are defined in both
+// blocks and the field w only in the second block.
+struct Fixture
+{
+    Teuchos::RCP<panzer_stk::STK_Interface> mesh;
+    Teuchos::RCP<panzer::DOFManager> dof_manager;
+    Teuchos::RCP<panzer::LinearObjFactory<panzer::Traits>>
+        linear_object_factory;
+    Teuchos::RCP<Thyra::VectorBase<double>> x;
+
+    Fixture()
+    {
+        auto mesh_factory
+            = Teuchos::rcp(new panzer_stk::SquareQuadMeshFactory());
+        auto mesh_params = Teuchos::parameterList();
+        mesh_params->set("X Blocks", 2);
+        mesh_params->set("Y Blocks", 1);
+        mesh_params->set("X0", 0.0);
+        mesh_params->set("Y0", 0.0);
+        mesh_params->set("Xf", 2.0);
+        mesh_params->set("Yf", 1.0);
+        mesh_params->set("X Elements", 4);
+        mesh_params->set("Y Elements", 4);
+        mesh_factory->setParameterList(mesh_params);
+        mesh = mesh_factory->buildUncommitedMesh(MPI_COMM_WORLD);
+        mesh_factory->completeMeshConstruction(*mesh, MPI_COMM_WORLD);
+
+        auto conn_manager = Teuchos::rcp(new panzer_stk::STKConnManager(mesh));
+        dof_manager = Teuchos::rcp(
+            new panzer::DOFManager(conn_manager, MPI_COMM_WORLD));
+        shards::CellTopology cell_topo(
+            shards::getCellTopologyData<shards::Quadrilateral<4>>());
+        auto field_pattern
+            = Teuchos::rcp(new panzer::NodalFieldPattern(cell_topo));
+        for (const std::string block : {"eblock-0_0", "eblock-1_0"})
+        {
+            dof_manager->addField(block, "u", field_pattern);
+            dof_manager->addField(block, "v", field_pattern);
+        }
+        dof_manager->addField("eblock-1_0", "w", field_pattern);
+        dof_manager->buildGlobalUnknowns();
+
+        auto comm = Teuchos::rcp_dynamic_cast<const Teuchos::MpiComm<int>>(
+            dof_manager->getComm());
+        linear_object_factory = Teuchos::rcp(
+            new panzer::TpetraLinearObjFactory<panzer::Traits,
+                                               double,
+                                               int,
+                                               panzer::GlobalOrdinal>(
+                comm, dof_manager));
+        x = Thyra::createMember(*linear_object_factory->getThyraDomainSpace());
+        Thyra::assign(x.ptr(), 0.0);
+
+        // Set the owned values of u and v to the linear fields.
+        std::vector<panzer::GlobalOrdinal> owned_gids;
+        dof_manager->getOwnedIndices(owned_gids);
+        std::unordered_map<panzer::GlobalOrdinal, int> global_to_local;
+        for (std::size_t i = 0; i < owned_gids.size(); ++i)
+            global_to_local.insert({owned_gids[i], i});
+
+        auto x_data
+            = Teuchos::rcp_dynamic_cast<Thyra::SpmdVectorBase<double>>(x, true)
+                  ->getNonconstLocalData();
+        const auto& coord_field = mesh->getCoordinatesField();
+        auto bulk = mesh->getBulkData();
+        std::vector<panzer::GlobalOrdinal> element_gids;
+        for (const std::string block : {"eblock-0_0", "eblock-1_0"})
+        {
+            std::vector<stk::mesh::Entity> elements;
+            mesh->getMyElements(block, elements);
+            for (const auto& element : elements)
+            {
+                dof_manager->getElementGIDs(
+                    mesh->elementLocalId(element), element_gids, block);
+                const stk::mesh::Entity* nodes = bulk->begin_nodes(element);
+                for (int f = 0; f < 2; ++f)
+                {
+                    const int field_num
+                        = dof_manager->getFieldNum(f == 0 ? "u" : "v");
+                    const auto& offsets
+                        = dof_manager->getGIDFieldOffsets(block, field_num);
+                    for (std::size_t n = 0; n < offsets.size(); ++n)
+                    {
+                        auto itr
+                            = global_to_local.find(element_gids[offsets[n]]);
+                        if (itr == global_to_local.end())
+                            continue;
+                        const double* node_coords
+                            = stk::mesh::field_data(coord_field, nodes[n]);
+                        x_data[itr->second] = linearField(f, node_coords);
+                    }
+                }
+            }
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Probes in an element, on an element edge, at a mesh corner and on the
+// interface between the element blocks. On more than one rank the probes
+// are owned by different ranks.
+TEST(ProbeArray, linear_fields)
+{
+    Fixture fixture;
+
+    const std::vector<std::vector<double>> coords
+        = {{0.3, 0.7}, {0.5, 0.3}, {2.0, 1.0}, {1.0, 0.4}};
+    std::vector<Teuchos::Array<double>> points;
+    for (const auto& c : coords)
+        points.push_back(Teuchos::Array<double>(c));
+
+    Response::ProbeArray probes(fixture.mesh,
+                                fixture.dof_manager,
+                                fixture.linear_object_factory,
+                                {"u", "v"},
+                                points,
+                                {});
+    EXPECT_EQ(4, probes.numProbes());
+    EXPECT_EQ(2, probes.numFields());
+
+    probes.evaluate(fixture.x);
+    for (int p = 0; p < 4; ++p)
+    {
+        for (int f = 0; f < 2; ++f)
+        {
+            EXPECT_NEAR(
+                linearField(f, coords[p].data()), probes.value(p, f), 1e-12);
+        }
+    }
+
+    // The values are updated with the solution.
+    Thyra::scale(2.0, fixture.x.ptr());
+    probes.evaluate(fixture.x);
+    for (int p = 0; p < 4; ++p)
+    {
+        for (int f = 0; f < 2; ++f)
+        {
+            EXPECT_NEAR(2.0 * linearField(f, coords[p].data()),
+                        probes.value(p, f),
+                        1e-12);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// A probe field missing from the block containing a probe throws on all
+// ranks, not only on the rank owning the probe.
+TEST(ProbeArray, missing_field)
+{
+    Fixture fixture;
+
+    std::vector<Teuchos::Array<double>> points(2, Teuchos::Array<double>(2));
+    points[0][0] = 1.6;
+    points[0][1] = 0.2;
+    points[1][0] = 0.3;
+    points[1][1] = 0.7;
+    EXPECT_THROW(Response::ProbeArray(fixture.mesh,
+                                      fixture.dof_manager,
+                                      fixture.linear_object_factory,
+                                      {"w"},
+                                      points,
+                                      {}),
+                 std::runtime_error);
+
+    // The field is defined when the probes are restricted to its block.
+    points.pop_back();
+    Response::ProbeArray probes(fixture.mesh,
+                                fixture.dof_manager,
+                                fixture.linear_object_factory,
+                                {"w"},
+                                points,
+                                {"eblock-1_0"});
+    probes.evaluate(fixture.x);
+    EXPECT_EQ(0.0, probes.value(0, 0));
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
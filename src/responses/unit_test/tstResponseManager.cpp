@@ -18,7 +18,9 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 //---------------------------------------------------------------------------//
 // TESTS
@@ -331,5 +333,61 @@ TEST(MultipleResponseManagers, NameLookupBug)
     EXPECT_DOUBLE_EQ(6.0, pl->getRealValue<Eval>("v integral"));
 }
 
+//---------------------------------------------------------------------------//
+// Probe arrays evaluate every field at every probe without a model
+// evaluation, including probes on element boundaries and mesh corners.
+TEST(ResponseManager, ProbeArray)
+{
+    Helper helper(2);
+    auto& physics_manager = helper.physics_manager;
+
+    Response::ResponseManager response_manager(physics_manager);
+    response_manager.addFunctionalResponse("u integral", "velocity_0");
+
+    std::vector<Teuchos::Array<double>> points(3, Teuchos::Array<double>(2));
+    points[0][0] = 0.21875;
+    points[0][1] = 1.5625;
+    points[1][0] = 0.5;
+    points[1][1] = 1.0;
+    points[2][0] = 1.0;
+    points[2][1] = 2.0;
+    response_manager.addProbeArrayResponse(
+        "probe", {"velocity_0", "velocity_1"}, points);
+
+    EXPECT_EQ(7, response_manager.numResponses());
+    EXPECT_EQ(0, response_manager.globalIndex("u integral"));
+    EXPECT_EQ(-1, response_manager.globalIndex("probe 1 - velocity_0"));
+    EXPECT_EQ("probe 3 - velocity_0", response_manager.name(3));
+    EXPECT_EQ("probe 1 - velocity_1", response_manager.name(4));
+
+    // Points outside of the mesh are not allowed.
+    std::vector<Teuchos::Array<double>> outside(1, Teuchos::Array<double>(2));
+    outside[0][0] = 1.5;
+    outside[0][1] = 1.0;
+    EXPECT_THROW(response_manager.addProbeArrayResponse(
+                     "outside", {"velocity_0"}, outside),
+                 std::runtime_error);
+
+    // Only evaluate the probe values.
+    auto [x, x_dot] = helper.getSolutionVectors();
+    response_manager.deactivateAll();
+    for (int i = 1; i < 7; ++i)
+        response_manager.activateResponse(i);
+    response_manager.evaluateResponses(x, x_dot);
+
+    for (int i = 1; i <= 3; ++i)
+    {
+        const std::string probe = "probe " + std::to_string(i);
+        EXPECT_NEAR(
+            2.0, response_manager.value(probe + " - velocity_0"), 1e-12);
+        EXPECT_NEAR(
+            3.0, response_manager.value(probe + " - velocity_1"), 1e-12);
+    }
+
+    auto pl = physics_manager->globalData()->pl;
+    using Eval = panzer::Traits::Residual;
+    EXPECT_NEAR(3.0, pl->getRealValue<Eval>("probe 2 - velocity_1"), 1e-12);
+}
+
 } // namespace Test
 } // namespace VertexCFD
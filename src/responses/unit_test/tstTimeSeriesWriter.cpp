@@ -0,0 +1,124 @@
+#include "responses/VertexCFD_Response_TimeSeriesWriter.hpp"
+
+#include <Teuchos_DefaultComm.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <vector>
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+namespace VertexCFD
+{
+namespace Test
+{
+//---------------------------------------------------------------------------//
+// Read the header and data of a time series file.
+void readTimeSeries(const std::string& file_name,
+                    std::string& header,
+                    std::vector<double>& data)
+{
+    std::ifstream file(file_name, std::ios::binary);
+    const std::string contents((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+    ASSERT_GE(contents.size(), 12);
+    EXPECT_EQ(std::string("\x93NUMPY\x02\x00", 8), contents.substr(0, 8));
+
+    std::uint32_t length = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        length |= static_cast<std::uint32_t>(
+                      static_cast<unsigned char>(contents[8 + i]))
+                  << (8 * i);
+    }
+    EXPECT_EQ(0, (12 + length) % 64);
+    header = contents.substr(12, length);
+    EXPECT_EQ('\n', header.back());
+
+    data.resize((contents.size() - 12 - length) / sizeof(double));
+    std::memcpy(data.data(),
+                contents.data() + 12 + length,
+                data.size() * sizeof(double));
+}
+
+//---------------------------------------------------------------------------//
+void testTimeSeries(const bool asynchronous)
+{
+    const auto comm = Teuchos::DefaultComm<int>::getComm();
+    const std::string file_name = "time_series_"
+                                  + std::to_string(asynchronous) + ".npy";
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    {
+        Response::TimeSeriesWriter writer(
+            comm, file_name, {"u integral", "probe 1 - u"}, 3, asynchronous);
+
+        // The file is readable before any rows are written.
+        if (comm->getRank() == 0)
+        {
+            std::string header;
+            std::vector<double> data;
+            readTimeSeries(file_name, header, data);
+            EXPECT_NE(std::string::npos, header.find("'shape': (0,)"));
+            EXPECT_NE(std::string::npos, header.find("('probe 1 - u', '"));
+            EXPECT_TRUE(data.empty());
+        }
+
+        for (int i = 0; i < 7; ++i)
+            writer.addRow(i, 0.5 * i, {1.0 * i, i % 2 ? nan : 2.0 * i});
+
+        // Two full blocks have been started.
+        writer.finishWrites();
+        if (comm->getRank() == 0)
+        {
+            std::string header;
+            std::vector<double> data;
+            readTimeSeries(file_name, header, data);
+            EXPECT_NE(std::string::npos, header.find("'shape': (6,)"));
+            EXPECT_EQ(24, data.size());
+        }
+    }
+    comm->barrier();
+
+    // The remaining row is written on destruction.
+    std::string header;
+    std::vector<double> data;
+    readTimeSeries(file_name, header, data);
+    EXPECT_NE(std::string::npos, header.find("'shape': (7,)"));
+    ASSERT_EQ(28, data.size());
+    for (int i = 0; i < 7; ++i)
+    {
+        EXPECT_EQ(i, data[4 * i]);
+        EXPECT_EQ(0.5 * i, data[4 * i + 1]);
+        EXPECT_EQ(1.0 * i, data[4 * i + 2]);
+        if (i % 2)
+            EXPECT_TRUE(std::isnan(data[4 * i + 3]));
+        else
+            EXPECT_EQ(2.0 * i, data[4 * i + 3]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+TEST(TimeSeriesWriter, Synchronous)
+{
+    testTimeSeries(false);
+}
+
+//---------------------------------------------------------------------------//
+TEST(TimeSeriesWriter, Asynchronous)
+{
+    testTimeSeries(true);
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Test
+} // end namespace VertexCFD
@@ -4,7 +4,7 @@ set(TEST_HARNESS_DIR ${CMAKE_SOURCE_DIR}/src/test_harness)
 ## Test Macro
 ##--------------------------------------------------------------------------##
 macro(VertexCFD_add_tests)
-  set(options OPTIONAL MPI)
+  set(options OPTIONAL MPI CELL_POINT_POLICIES)
   set(oneValueArgs)
   set(multiValueArgs LIBS NAMES)
   cmake_parse_arguments(VERTEXCFD_UNIT_TEST "${options}" "${oneValueArgs}"
@@ -35,46 +35,63 @@ macro(VertexCFD_add_tests)
     target_include_directories(${_target} PRIVATE ${_dir}
       ${CMAKE_CURRENT_BINARY_DIR} ${CMAKE_CURRENT_SOURCE_DIR} ${TEST_HARNESS_DIR})
     target_link_libraries(${_target} PRIVATE ${VERTEXCFD_UNIT_TEST_LIBS} GTest::gtest Kokkos::kokkos MPI::MPI_CXX )
-    if(VERTEXCFD_UNIT_TEST_MPI)
-      foreach(_procs ${VERTEXCFD_UNIT_TEST_MPIEXEC_NUMPROCS})
-        # NOTE: When moving to CMake 3.10+ make sure to use MPIEXEC_EXECUTABLE instead
-        if(_device STREQUAL PTHREAD OR _device STREQUAL OPENMP)
-          foreach(_threads ${VERTEXCFD_UNIT_TEST_NUMTHREADS})
-            math(EXPR _total_threads "${_procs} * ${_threads}")
-            if(_total_threads GREATER MPIEXEC_MAX_NUMPROCS)
-              break()
-            endif()
-            set(_test_name ${_target}_np_${_procs}_nt_${_threads})
+    # Tests of closure kernels run with each cell point execution policy.
+    if(VERTEXCFD_UNIT_TEST_CELL_POINT_POLICIES)
+      target_compile_definitions(${_target} PRIVATE
+        VERTEXCFD_TEST_CELL_POINT_POLICY)
+      set(_policies Team MDRange)
+    else()
+      set(_policies Default)
+    endif()
+    foreach(_policy ${_policies})
+      set(_name ${_target})
+      set(_test_args ${gtest_args})
+      if(VERTEXCFD_UNIT_TEST_CELL_POINT_POLICIES)
+        string(TOLOWER ${_policy} _policy_suffix)
+        set(_name ${_target}_${_policy_suffix})
+        list(APPEND _test_args --cell-point-policy=${_policy})
+      endif()
+      if(VERTEXCFD_UNIT_TEST_MPI)
+        foreach(_procs ${VERTEXCFD_UNIT_TEST_MPIEXEC_NUMPROCS})
+          # NOTE: When moving to CMake 3.10+ make sure to use MPIEXEC_EXECUTABLE instead
+          if(_device STREQUAL PTHREAD OR _device STREQUAL OPENMP)
+            foreach(_threads ${VERTEXCFD_UNIT_TEST_NUMTHREADS})
+              math(EXPR _total_threads "${_procs} * ${_threads}")
+              if(_total_threads GREATER MPIEXEC_MAX_NUMPROCS)
+                break()
+              endif()
+              set(_test_name ${_name}_np_${_procs}_nt_${_threads})
+              add_test(NAME ${_test_name} COMMAND
+                ${MPIEXEC} ${MPIEXEC_NUMPROC_FLAG} ${_procs} ${MPIEXEC_PREFLAGS}
+                ${_target} ${MPIEXEC_POSTFLAGS} ${_test_args} --kokkos-num-threads=${_threads})
+              set_property(TEST ${_test_name} PROPERTY PROCESSORS ${_total_threads})
+              set_property(TEST ${_test_name} PROPERTY ENVIRONMENT "OMP_NUM_THREADS=${_threads}")
+            endforeach()
+          else()
+            set(_test_name ${_name}_np_${_procs})
             add_test(NAME ${_test_name} COMMAND
               ${MPIEXEC} ${MPIEXEC_NUMPROC_FLAG} ${_procs} ${MPIEXEC_PREFLAGS}
-              ${_target} ${MPIEXEC_POSTFLAGS} ${gtest_args} --kokkos-num-threads=${_threads})
-            set_property(TEST ${_test_name} PROPERTY PROCESSORS ${_total_threads})
+              ${_target} ${MPIEXEC_POSTFLAGS} ${_test_args} --kokkos-num-threads=1)
+            set_property(TEST ${_test_name} PROPERTY PROCESSORS ${_procs})
+          endif()
+        endforeach()
+      else()
+        if(_device STREQUAL OPENMP)
+          foreach(_threads ${VERTEXCFD_UNIT_TEST_NUMTHREADS})
+            set(_test_name ${_name}_nt_${_threads})
+            add_test(NAME ${_test_name} COMMAND
+              ${MPIEXEC} ${MPIEXEC_NUMPROC_FLAG} 1 ${MPIEXEC_PREFLAGS}
+              ${_target} ${MPIEXEC_POSTFLAGS} ${_test_args} --kokkos-num-threads=${_threads})
+            set_property(TEST ${_test_name} PROPERTY PROCESSORS ${_threads})
             set_property(TEST ${_test_name} PROPERTY ENVIRONMENT "OMP_NUM_THREADS=${_threads}")
           endforeach()
         else()
-          set(_test_name ${_target}_np_${_procs})
-          add_test(NAME ${_target}_np_${_procs} COMMAND
-            ${MPIEXEC} ${MPIEXEC_NUMPROC_FLAG} ${_procs} ${MPIEXEC_PREFLAGS}
-            ${_target} ${MPIEXEC_POSTFLAGS} ${gtest_args} --kokkos-num-threads=1)
-          set_property(TEST ${_test_name} PROPERTY PROCESSORS ${_procs})
-        endif()
-      endforeach()
-    else()
-      if(_device STREQUAL OPENMP)
-        foreach(_threads ${VERTEXCFD_UNIT_TEST_NUMTHREADS})
-          set(_test_name ${_target}_nt_${_threads})
-          add_test(NAME ${_target}_nt_${_threads} COMMAND
+          add_test(NAME ${_name} COMMAND
             ${MPIEXEC} ${MPIEXEC_NUMPROC_FLAG} 1 ${MPIEXEC_PREFLAGS}
-            ${_target} ${MPIEXEC_POSTFLAGS} ${gtest_args} --kokkos-num-threads=${_threads})
-          set_property(TEST ${_test_name} PROPERTY PROCESSORS ${_threads})
-          set_property(TEST ${_test_name} PROPERTY ENVIRONMENT "OMP_NUM_THREADS=${_threads}")
-        endforeach()
-      else()
-        add_test(NAME ${_target} COMMAND
-          ${MPIEXEC} ${MPIEXEC_NUMPROC_FLAG} 1 ${MPIEXEC_PREFLAGS}
-          ${_target} ${MPIEXEC_POSTFLAGS} ${gtest_args} --kokkos-num-threads=1)
-        set_property(TEST ${_target} PROPERTY PROCESSORS 1)
+            ${_target} ${MPIEXEC_POSTFLAGS} ${_test_args} --kokkos-num-threads=1)
+          set_property(TEST ${_name} PROPERTY PROCESSORS 1)
+        endif()
       endif()
-    endif()
+    endforeach()
   endforeach()
 endmacro()
@@ -180,6 +180,25 @@ struct EvaluatorTestFixture
         fm->requireField<EvalType>(field.fieldTag());
     }
 
+    // Move the cell nodes and update the integration and basis values of the
+    // workset.
+    void setCoordinates(const host_coords_view host_coords)
+    {
+#if TRILINOS_MAJOR_MINOR_VERSION >= 140500
+        auto& node_coords = workset->cell_node_coordinates;
+#else
+        auto& node_coords = workset->cell_vertex_coordinates;
+#endif
+        Kokkos::deep_copy(node_coords.get_static_view(), host_coords);
+        int_values->evaluateValues(node_coords);
+        basis_values->evaluateValues(int_values->cub_points,
+                                     int_values->jac,
+                                     int_values->jac_det,
+                                     int_values->jac_inv,
+                                     int_values->weighted_measure,
+                                     int_values->node_coordinates);
+    }
+
     // Set time.
     void setTime(const double& time) { workset->time = time; }
 
@@ -189,25 +208,40 @@ struct EvaluatorTestFixture
         workset->step_size = step_size;
     }
 
-    // Evaluate.
-    template<class EvalType>
-    void evaluate()
+    // Allocate the fields of the registered evaluators. The Jacobian scalar
+    // type has the given number of derivatives.
+    void setup(const int derivative_dimension = 4)
     {
         panzer::Traits::SD setup_data;
         auto worksets = Teuchos::rcp(new std::vector<panzer::Workset>);
         worksets->push_back(*workset);
         setup_data.worksets_ = worksets;
         std::vector<PHX::index_size_type> derivative_dimensions;
-        derivative_dimensions.push_back(4);
+        derivative_dimensions.push_back(derivative_dimension);
         fm->setKokkosExtendedDataTypeDimensions<panzer::Traits::Jacobian>(
             derivative_dimensions);
         fm->postRegistrationSetup(setup_data);
+    }
+
+    // Evaluate the registered evaluators. The fields must have been
+    // allocated with setup().
+    template<class EvalType>
+    void evaluateFields()
+    {
         panzer::Traits::PED ped;
         fm->preEvaluate<EvalType>(ped);
         fm->evaluateFields<EvalType>(*workset);
         fm->postEvaluate<EvalType>(0);
     }
 
+    // Evaluate.
+    template<class EvalType>
+    void evaluate()
+    {
+        setup();
+        evaluateFields<EvalType>();
+    }
+
     // Get a test field on the host to test after evaluation.
     template<class EvalType, class Field>
     auto getTestFieldData(const Field& field) const
@@ -2,13 +2,35 @@
 
 #include <Kokkos_Core.hpp>
 
+#ifdef VERTEXCFD_TEST_CELL_POINT_POLICY
+#include <VertexCFD_Utils_CellPointPolicy.hpp>
+#endif
+
 #include <mpi.h>
 
+#include <string>
+
 int main(int argc, char* argv[])
 {
     MPI_Init(&argc, &argv);
     Kokkos::initialize(argc, argv);
     ::testing::InitGoogleTest(&argc, argv);
+
+#ifdef VERTEXCFD_TEST_CELL_POINT_POLICY
+    // Execution policy of the closure kernels, so that the tests of the
+    // closures cover both policies independently of the build default.
+    const std::string policy_flag = "--cell-point-policy=";
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg.compare(0, policy_flag.size(), policy_flag) == 0)
+        {
+            VertexCFD::Utils::CellPointPolicy::inst().setType(
+                arg.substr(policy_flag.size()));
+        }
+    }
+#endif
+
     int return_val = RUN_ALL_TESTS();
     Kokkos::finalize();
     MPI_Finalize();
@@ -58,6 +58,27 @@ struct TestData : public panzer::EvaluatorWithBaseImpl<panzer::Traits>,
     }
 };
 
+//---------------------------------------------------------------------------//
+// Workset time
+template<class EvalType>
+struct TimeData : public panzer::EvaluatorWithBaseImpl<panzer::Traits>,
+                  public PHX::EvaluatorDerived<EvalType, panzer::Traits>
+{
+    PHX::MDField<double, panzer::Cell, panzer::Point> _time;
+
+    TimeData(const panzer::IntegrationRule& ir)
+        : _time("time", ir.dl_scalar)
+    {
+        this->addEvaluatedField(_time);
+        this->setName("TimeData");
+    }
+
+    void evaluateFields(typename panzer::Traits::EvalData workset) override
+    {
+        _time.deep_copy(workset.time);
+    }
+};
+
 //---------------------------------------------------------------------------//
 template<class EvalType>
 void test2D_default_cell()
@@ -374,6 +395,33 @@ void test_custom_cell()
     EXPECT_EQ(1.0, grad_basis_result(0, 2, 0, 1));
 }
 
+//---------------------------------------------------------------------------//
+template<class EvalType>
+void test_repeated_evaluation()
+{
+    // Setup test fixture.
+    const int num_space_dim = 2;
+    const int integration_order = 1;
+    const int basis_order = 1;
+    EvaluatorTestFixture test_fixture(
+        num_space_dim, integration_order, basis_order);
+
+    auto test_eval = Teuchos::rcp(new TimeData<EvalType>(*test_fixture.ir));
+    test_fixture.registerEvaluator<EvalType>(test_eval);
+    test_fixture.registerTestField<EvalType>(test_eval->_time);
+
+    // Allocate the fields once and evaluate them several times.
+    test_fixture.setup(8);
+    for (const double time : {0.5, 1.5})
+    {
+        test_fixture.setTime(time);
+        test_fixture.evaluateFields<EvalType>();
+        auto time_result
+            = test_fixture.getTestFieldData<EvalType>(test_eval->_time);
+        EXPECT_EQ(time, time_result(0, 0));
+    }
+}
+
 //---------------------------------------------------------------------------//
 TEST(EvaluatorTestHarness, residual_test_2d_default_cell)
 {
@@ -410,6 +458,18 @@ TEST(EvaluatorTestHarness, jacobian_test_custom_cell)
     test_custom_cell<panzer::Traits::Jacobian>();
 }
 
+//---------------------------------------------------------------------------//
+TEST(EvaluatorTestHarness, residual_test_repeated_evaluation)
+{
+    test_repeated_evaluation<panzer::Traits::Residual>();
+}
+
+//---------------------------------------------------------------------------//
+TEST(EvaluatorTestHarness, jacobian_test_repeated_evaluation)
+{
+    test_repeated_evaluation<panzer::Traits::Jacobian>();
+}
+
 //---------------------------------------------------------------------------//
 TEST(EvaluatorTestHarness, default_cell_bad_space_dim)
 {
@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_TURBULENCEBOUNDARYEDDYVISCOSITY_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_TURBULENCEBOUNDARYEDDYVISCOSITY_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
+
 #include <Panzer_HierarchicParallelism.hpp>
 
 namespace VertexCFD
@@ -52,32 +54,26 @@ template<class EvalType, class Traits>
 void TurbulenceBoundaryEddyViscosity<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _boundary_nu_t.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 TurbulenceBoundaryEddyViscosity<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _boundary_nu_t.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Set boundary nu_t according to BC type
-            if (_wall_func)
-            {
-                _boundary_nu_t(cell, point) = _wall_func_nu_t(cell, point);
-            }
-            else
-            {
-                _boundary_nu_t(cell, point) = _interior_nu_t(cell, point);
-            }
-        });
+    // Set boundary nu_t according to BC type
+    if (_wall_func)
+    {
+        _boundary_nu_t(cell, point) = _wall_func_nu_t(cell, point);
+    }
+    else
+    {
+        _boundary_nu_t(cell, point) = _interior_nu_t(cell, point);
+    }
 }
 
 //---------------------------------------------------------------------------//
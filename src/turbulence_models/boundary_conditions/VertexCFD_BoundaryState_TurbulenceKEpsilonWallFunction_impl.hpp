@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_TURBULENCEKEPSILONWALLFUNCTION_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_TURBULENCEKEPSILONWALLFUNCTION_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
@@ -84,113 +85,108 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void TurbulenceKEpsilonWallFunction<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _grad_k.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 TurbulenceKEpsilonWallFunction<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _grad_k.extent(1);
     const double max_tol = 1e-10;
 
     using std::pow;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Calculate velocity magnitude
-            scalar_type mag_u = 0.0;
+    // Calculate velocity magnitude
+    scalar_type mag_u = 0.0;
 
-            for (int d = 0; d < num_space_dim; d++)
-            {
-                mag_u += pow(_velocity[d](cell, point), 2.0);
-            }
+    for (int d = 0; d < num_space_dim; d++)
+    {
+        mag_u += pow(_velocity[d](cell, point), 2.0);
+    }
 
-            mag_u = pow(SmoothMath::max(mag_u, max_tol, 0.0), 0.5);
+    mag_u = pow(SmoothMath::max(mag_u, max_tol, 0.0), 0.5);
 
-            // Set turbulent kinetic energy boundary using Neumann condition
-            _boundary_k(cell, point) = _k(cell, point);
+    // Set turbulent kinetic energy boundary using Neumann condition
+    _boundary_k(cell, point) = _k(cell, point);
 
-            for (int d = 0; d < num_space_dim; ++d)
-            {
-                _boundary_grad_k(cell, point, d) = _grad_k(cell, point, d);
-
-                // Subtract boundary normal component
-                for (int grad_dim = 0; grad_dim < num_space_dim; ++grad_dim)
-                {
-                    _boundary_grad_k(cell, point, d)
-                        -= _grad_k(cell, point, grad_dim)
-                           * _normals(cell, point, grad_dim)
-                           * _normals(cell, point, d);
-                }
-            }
+    for (int d = 0; d < num_space_dim; ++d)
+    {
+        _boundary_grad_k(cell, point, d) = _grad_k(cell, point, d);
 
-            // Calculate friction velocity and nu_t at the wall as suggested
-            // by Kuzmin et al. (2007)
-            const scalar_type u_tau = SmoothMath::max(
-                pow(_C_mu, 0.25)
-                    * pow(SmoothMath::max(_k(cell, point), max_tol, 0.0), 0.5),
-                mag_u / _yp_tr,
-                0.0);
+        // Subtract boundary normal component
+        for (int grad_dim = 0; grad_dim < num_space_dim; ++grad_dim)
+        {
+            _boundary_grad_k(cell, point, d)
+                -= _grad_k(cell, point, grad_dim)
+                   * _normals(cell, point, grad_dim)
+                   * _normals(cell, point, d);
+        }
+    }
 
-            const double nu_t_w = _kappa * _yp_tr * _nu;
+    // Calculate friction velocity and nu_t at the wall as suggested
+    // by Kuzmin et al. (2007)
+    const scalar_type u_tau = SmoothMath::max(
+        pow(_C_mu, 0.25)
+            * pow(SmoothMath::max(_k(cell, point), max_tol, 0.0), 0.5),
+        mag_u / _yp_tr,
+        0.0);
 
-            // Set epsilon and nu_t at boundary according to user setting
-            if (_neumann)
-            {
-                // Set epsilon boundary equal to interior value
-                _boundary_e(cell, point) = _e(cell, point);
-
-                // Calculate boundary gradient
-                for (int d = 0; d < num_space_dim; ++d)
-                {
-                    _boundary_grad_e(cell, point, d)
-                        = _grad_e(cell, point, d)
-                          + (_kappa * pow(u_tau, 5.0) / pow(nu_t_w, 2.0))
-                                * _normals(cell, point, d);
-
-                    // Subtract interior boundary normal component
-                    for (int grad_dim = 0; grad_dim < num_space_dim; ++grad_dim)
-                    {
-                        _boundary_grad_e(cell, point, d)
-                            -= _grad_e(cell, point, grad_dim)
-                               * _normals(cell, point, grad_dim)
-                               * _normals(cell, point, d);
-                    }
-                }
-
-                // Set boundary nu_t to analytical solution
-                _wall_func_nu_t(cell, point) = nu_t_w;
-            }
-            else
+    const double nu_t_w = _kappa * _yp_tr * _nu;
+
+    // Set epsilon and nu_t at boundary according to user setting
+    if (_neumann)
+    {
+        // Set epsilon boundary equal to interior value
+        _boundary_e(cell, point) = _e(cell, point);
+
+        // Calculate boundary gradient
+        for (int d = 0; d < num_space_dim; ++d)
+        {
+            _boundary_grad_e(cell, point, d)
+                = _grad_e(cell, point, d)
+                  + (_kappa * pow(u_tau, 5.0) / pow(nu_t_w, 2.0))
+                        * _normals(cell, point, d);
+
+            // Subtract interior boundary normal component
+            for (int grad_dim = 0; grad_dim < num_space_dim; ++grad_dim)
             {
-                // Calculate epsilon boundary value
-                _boundary_e(cell, point) = pow(u_tau, 4.0) / nu_t_w;
-
-                // Set boundary gradient equal to interior gradient
-                for (int d = 0; d < num_space_dim; ++d)
-                {
-                    _boundary_grad_e(cell, point, d) = _grad_e(cell, point, d);
-                }
-
-                // Calculate boundary nu_t with standard k-epsilon form
-                _wall_func_nu_t(cell, point)
-                    = _C_mu * pow(_k(cell, point), 2.0)
-                      / SmoothMath::max(_e(cell, point), max_tol, 0.0);
+                _boundary_grad_e(cell, point, d)
+                    -= _grad_e(cell, point, grad_dim)
+                       * _normals(cell, point, grad_dim)
+                       * _normals(cell, point, d);
             }
+        }
+
+        // Set boundary nu_t to analytical solution
+        _wall_func_nu_t(cell, point) = nu_t_w;
+    }
+    else
+    {
+        // Calculate epsilon boundary value
+        _boundary_e(cell, point) = pow(u_tau, 4.0) / nu_t_w;
+
+        // Set boundary gradient equal to interior gradient
+        for (int d = 0; d < num_space_dim; ++d)
+        {
+            _boundary_grad_e(cell, point, d) = _grad_e(cell, point, d);
+        }
+
+        // Calculate boundary nu_t with standard k-epsilon form
+        _wall_func_nu_t(cell, point)
+            = _C_mu * pow(_k(cell, point), 2.0)
+              / SmoothMath::max(_e(cell, point), max_tol, 0.0);
+    }
 
-            // Fill in boundary friction velocity and y+ fields for
-            // post-processing
-            _boundary_u_tau(cell, point) = u_tau;
-            _boundary_y_plus(cell, point) = _yp_tr;
+    // Fill in boundary friction velocity and y+ fields for
+    // post-processing
+    _boundary_u_tau(cell, point) = u_tau;
+    _boundary_y_plus(cell, point) = _yp_tr;
 
-            // TODO: define TKE production term at boundary to enforce P = D?
-        });
+    // TODO: define TKE production term at boundary to enforce P = D?
 }
 
 //---------------------------------------------------------------------------//
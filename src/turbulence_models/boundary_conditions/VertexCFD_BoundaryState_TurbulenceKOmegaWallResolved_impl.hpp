@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_BOUNDARYSTATE_TURBULENCEKOMEGAWALLRESOLVED_IMPL_HPP
 #define VERTEXCFD_BOUNDARYSTATE_TURBULENCEKOMEGAWALLRESOLVED_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
+
 #include <Panzer_HierarchicParallelism.hpp>
 
 namespace VertexCFD
@@ -57,19 +59,17 @@ void TurbulenceKOmegaWallResolved<EvalType, Traits>::evaluateFields(
 {
     _time = workset.time;
 
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _grad_k.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 TurbulenceKOmegaWallResolved<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _grad_k.extent(1);
     using std::pow;
 
     double omega_wall = _omega_wall;
@@ -81,31 +81,28 @@ TurbulenceKOmegaWallResolved<EvalType, Traits>::operator()(
                      * pow(_omega_wall, _time / _omega_ramp_time);
     }
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            // Assign boundary values
-            _boundary_k(cell, point) = _k(cell, point);
-            _boundary_w(cell, point) = omega_wall;
-
-            // Assign boundary gradients
-            for (int d = 0; d < _num_grad_dim; ++d)
-            {
-                _boundary_grad_k(cell, point, d) = _grad_k(cell, point, d);
-                _boundary_grad_w(cell, point, d) = _grad_w(cell, point, d);
-            }
-
-            // Subtract wall normal component from grad(k)
-            for (int d = 0; d < _num_grad_dim; ++d)
-            {
-                for (int grad_dim = 0; grad_dim < _num_grad_dim; ++grad_dim)
-                {
-                    _boundary_grad_k(cell, point, d)
-                        -= _grad_k(cell, point, grad_dim)
-                           * _normals(cell, point, grad_dim)
-                           * _normals(cell, point, d);
-                }
-            }
-        });
+    // Assign boundary values
+    _boundary_k(cell, point) = _k(cell, point);
+    _boundary_w(cell, point) = omega_wall;
+
+    // Assign boundary gradients
+    for (int d = 0; d < _num_grad_dim; ++d)
+    {
+        _boundary_grad_k(cell, point, d) = _grad_k(cell, point, d);
+        _boundary_grad_w(cell, point, d) = _grad_w(cell, point, d);
+    }
+
+    // Subtract wall normal component from grad(k)
+    for (int d = 0; d < _num_grad_dim; ++d)
+    {
+        for (int grad_dim = 0; grad_dim < _num_grad_dim; ++grad_dim)
+        {
+            _boundary_grad_k(cell, point, d)
+                -= _grad_k(cell, point, grad_dim)
+                   * _normals(cell, point, grad_dim)
+                   * _normals(cell, point, d);
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
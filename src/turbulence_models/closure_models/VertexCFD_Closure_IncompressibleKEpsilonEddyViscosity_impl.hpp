@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEKEPSILONEDDYVISCOSITY_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLEKEPSILONEDDYVISCOSITY_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -36,29 +37,24 @@ template<class EvalType, class Traits>
 void IncompressibleKEpsilonEddyViscosity<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _nu_t.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleKEpsilonEddyViscosity<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _nu_t.extent(1);
     const auto max_tol = 1.0e-10;
     using std::pow;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            _nu_t(cell, point)
-                = _C_nu * pow(_turb_kinetic_energy(cell, point), 2.0)
-                  / SmoothMath::max(
-                      _turb_dissipation_rate(cell, point), max_tol, 0.0);
-        });
+    _nu_t(cell, point)
+        = _C_nu * pow(_turb_kinetic_energy(cell, point), 2.0)
+          / SmoothMath::max(
+              _turb_dissipation_rate(cell, point), max_tol, 0.0);
 }
 
 //---------------------------------------------------------------------------//
@@ -32,8 +32,7 @@ class IncompressibleKEpsilonSource
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   private:
     PHX::MDField<const scalar_type, panzer::Cell, panzer::Point> _nu_t;
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEKEPSILONDIFFUSIVITYCOEFFICIENT_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLEKEPSILONDIFFUSIVITYCOEFFICIENT_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -67,31 +68,26 @@ template<class EvalType, class Traits>
 void IncompressibleKOmegaDiffusivityCoefficient<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _diffusivity_var_k.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleKOmegaDiffusivityCoefficient<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _diffusivity_var_k.extent(1);
     const double k_tol = 1e-20;
     const double w_tol = 1e-10;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            const scalar_type turb_ratio
-                = SmoothMath::max(_turb_kinetic_energy(cell, point), k_tol, 0.0)
-                  / SmoothMath::max(
-                      _turb_specific_dissipation_rate(cell, point), w_tol, 0.0);
-            _diffusivity_var_k(cell, point) = _nu + _sigma_k * turb_ratio;
-            _diffusivity_var_w(cell, point) = _nu + _sigma_w * turb_ratio;
-        });
+    const scalar_type turb_ratio
+        = SmoothMath::max(_turb_kinetic_energy(cell, point), k_tol, 0.0)
+          / SmoothMath::max(
+              _turb_specific_dissipation_rate(cell, point), w_tol, 0.0);
+    _diffusivity_var_k(cell, point) = _nu + _sigma_k * turb_ratio;
+    _diffusivity_var_w(cell, point) = _nu + _sigma_w * turb_ratio;
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEKOMEGASOURCE_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLEKOMEGASOURCE_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 #include "utils/VertexCFD_Utils_VectorField.hpp"
 
@@ -103,117 +104,112 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleKOmegaSource<EvalType, Traits, NumSpaceDim>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _nu_t.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleKOmegaSource<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _nu_t.extent(1);
     const double max_tol = 1.0e-10;
     using std::abs;
     using std::pow;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            scalar_type Sij_Sij = 0.0;
-            for (int i = 0; i < num_space_dim; ++i)
-            {
-                Sij_Sij += pow(_grad_velocity[i](cell, point, i), 2.0);
-                for (int j = i + 1; j < num_space_dim; ++j)
-                {
-                    Sij_Sij += 0.5
-                               * pow(_grad_velocity[i](cell, point, j)
-                                         + _grad_velocity[j](cell, point, i),
-                                     2.0);
-                }
-            }
+    scalar_type Sij_Sij = 0.0;
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        Sij_Sij += pow(_grad_velocity[i](cell, point, i), 2.0);
+        for (int j = i + 1; j < num_space_dim; ++j)
+        {
+            Sij_Sij += 0.5
+                       * pow(_grad_velocity[i](cell, point, j)
+                                 + _grad_velocity[j](cell, point, i),
+                             2.0);
+        }
+    }
 
-            scalar_type chi_w = 0.0;
-            for (int i = 0; i < num_space_dim; ++i)
+    scalar_type chi_w = 0.0;
+    for (int i = 0; i < num_space_dim; ++i)
+    {
+        for (int j = 0; j < num_space_dim; ++j)
+        {
+            for (int k = 0; k < num_space_dim; ++k)
             {
-                for (int j = 0; j < num_space_dim; ++j)
-                {
-                    for (int k = 0; k < num_space_dim; ++k)
-                    {
-                        chi_w += 0.125
-                                 * (_grad_velocity[i](cell, point, j)
-                                    - _grad_velocity[j](cell, point, i))
-                                 * (_grad_velocity[j](cell, point, k)
-                                    - _grad_velocity[k](cell, point, j))
-                                 * (_grad_velocity[i](cell, point, k)
-                                    + _grad_velocity[k](cell, point, i));
-                    }
-                }
+                chi_w += 0.125
+                         * (_grad_velocity[i](cell, point, j)
+                            - _grad_velocity[j](cell, point, i))
+                         * (_grad_velocity[j](cell, point, k)
+                            - _grad_velocity[k](cell, point, j))
+                         * (_grad_velocity[i](cell, point, k)
+                            + _grad_velocity[k](cell, point, i));
             }
+        }
+    }
 
-            chi_w = abs(
-                chi_w
-                / SmoothMath::max(
-                    pow(_beta_star
-                            * _turb_specific_dissipation_rate(cell, point),
-                        3.0),
-                    max_tol,
-                    0.0));
+    chi_w = abs(
+        chi_w
+        / SmoothMath::max(
+            pow(_beta_star
+                    * _turb_specific_dissipation_rate(cell, point),
+                3.0),
+            max_tol,
+            0.0));
 
-            const scalar_type f_beta = (1.0 + 85.0 * chi_w)
-                                       / (1.0 + 100.0 * chi_w);
+    const scalar_type f_beta = (1.0 + 85.0 * chi_w)
+                               / (1.0 + 100.0 * chi_w);
 
-            // Turbulent kinetic energy terms
-            _k_prod(cell, point) = 2.0 * _nu_t(cell, point) * Sij_Sij;
+    // Turbulent kinetic energy terms
+    _k_prod(cell, point) = 2.0 * _nu_t(cell, point) * Sij_Sij;
 
-            _k_dest(cell, point)
-                = -_beta_star * _turb_specific_dissipation_rate(cell, point)
-                  * _turb_kinetic_energy(cell, point);
+    _k_dest(cell, point)
+        = -_beta_star * _turb_specific_dissipation_rate(cell, point)
+          * _turb_kinetic_energy(cell, point);
 
-            if (_limit_production)
-            {
-                // The limiter term is -20 times the k destruction term
-                _k_prod(cell, point) = SmoothMath::min(
-                    _k_prod(cell, point), -20.0 * _k_dest(cell, point), 0.0);
-            }
+    if (_limit_production)
+    {
+        // The limiter term is -20 times the k destruction term
+        _k_prod(cell, point) = SmoothMath::min(
+            _k_prod(cell, point), -20.0 * _k_dest(cell, point), 0.0);
+    }
 
-            _k_source(cell, point) = _k_prod(cell, point)
-                                     + _k_dest(cell, point);
-
-            // Turbulent dissipation rate terms
-            _w_prod(cell, point)
-                = _gamma * _turb_specific_dissipation_rate(cell, point) * 2.0
-                  * _nu_t(cell, point) * Sij_Sij
-                  / SmoothMath::max(
-                      _turb_kinetic_energy(cell, point), max_tol, 0.0);
-            _w_dest(cell, point)
-                = -_beta_0 * f_beta
-                  * pow(_turb_specific_dissipation_rate(cell, point), 2);
-
-            // Compute the cross diffusion term
-            _w_cross(cell, point) = 0.0;
-            scalar_type dkdxj_dwdxj = 0.0;
-            for (int j = 0; j < num_space_dim; ++j)
-            {
-                dkdxj_dwdxj
-                    += _grad_turb_kinetic_energy(cell, point, j)
-                       * _grad_turb_specific_dissipation_rate(cell, point, j);
-            }
-            if (dkdxj_dwdxj > 0.0)
-            {
-                _w_cross(cell, point)
-                    = _sigma_d * dkdxj_dwdxj
-                      / SmoothMath::max(
-                          _turb_specific_dissipation_rate(cell, point),
-                          max_tol,
-                          0.0);
-            }
+    _k_source(cell, point) = _k_prod(cell, point)
+                             + _k_dest(cell, point);
+
+    // Turbulent dissipation rate terms
+    _w_prod(cell, point)
+        = _gamma * _turb_specific_dissipation_rate(cell, point) * 2.0
+          * _nu_t(cell, point) * Sij_Sij
+          / SmoothMath::max(
+              _turb_kinetic_energy(cell, point), max_tol, 0.0);
+    _w_dest(cell, point)
+        = -_beta_0 * f_beta
+          * pow(_turb_specific_dissipation_rate(cell, point), 2);
+
+    // Compute the cross diffusion term
+    _w_cross(cell, point) = 0.0;
+    scalar_type dkdxj_dwdxj = 0.0;
+    for (int j = 0; j < num_space_dim; ++j)
+    {
+        dkdxj_dwdxj
+            += _grad_turb_kinetic_energy(cell, point, j)
+               * _grad_turb_specific_dissipation_rate(cell, point, j);
+    }
+    if (dkdxj_dwdxj > 0.0)
+    {
+        _w_cross(cell, point)
+            = _sigma_d * dkdxj_dwdxj
+              / SmoothMath::max(
+                  _turb_specific_dissipation_rate(cell, point),
+                  max_tol,
+                  0.0);
+    }
 
-            _w_source(cell, point) = _w_prod(cell, point) + _w_dest(cell, point)
-                                     + _w_cross(cell, point);
-        });
+    _w_source(cell, point) = _w_prod(cell, point) + _w_dest(cell, point)
+                             + _w_cross(cell, point);
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLESSTDIFFUSIVITYCOEFFICIENT_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLESSTDIFFUSIVITYCOEFFICIENT_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -78,33 +79,27 @@ template<class EvalType, class Traits>
 void IncompressibleSSTDiffusivityCoefficient<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _diffusivity_var_k.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleSSTDiffusivityCoefficient<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _diffusivity_var_k.extent(1);
-
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            _diffusivity_var_k(cell, point)
-                = _nu
-                  + (_sigma_k1 * _sst_blending_function(cell, point)
-                     + _sigma_k2 * (1.0 - _sst_blending_function(cell, point)))
-                        * _nu_t(cell, point);
-            _diffusivity_var_w(cell, point)
-                = _nu
-                  + (_sigma_w1 * _sst_blending_function(cell, point)
-                     + _sigma_w2 * (1.0 - _sst_blending_function(cell, point)))
-                        * _nu_t(cell, point);
-        });
+    _diffusivity_var_k(cell, point)
+        = _nu
+          + (_sigma_k1 * _sst_blending_function(cell, point)
+             + _sigma_k2 * (1.0 - _sst_blending_function(cell, point)))
+                * _nu_t(cell, point);
+    _diffusivity_var_w(cell, point)
+        = _nu
+          + (_sigma_w1 * _sst_blending_function(cell, point)
+             + _sigma_w2 * (1.0 - _sst_blending_function(cell, point)))
+                * _nu_t(cell, point);
 }
 
 //---------------------------------------------------------------------------//
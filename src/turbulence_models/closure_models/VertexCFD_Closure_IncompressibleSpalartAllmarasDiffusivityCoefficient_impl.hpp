@@ -1,6 +1,8 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLESPALARTALLMARASDIFFUSIVITYCOEFFICIENT_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLESPALARTALLMARASDIFFUSIVITYCOEFFICIENT_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
+
 #include <Panzer_HierarchicParallelism.hpp>
 
 namespace VertexCFD
@@ -37,31 +39,26 @@ template<class EvalType, class Traits>
 void IncompressibleSpalartAllmarasDiffusivityCoefficient<EvalType, Traits>::
     evaluateFields(typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _diffusivity_var.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleSpalartAllmarasDiffusivityCoefficient<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _diffusivity_var.extent(1);
     using std::pow;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            const scalar_type xi3 = pow(_sa_var(cell, point) / _nu, 3.0);
-            const scalar_type f_n = _sa_var(cell, point) < 0.0
-                                        ? (_cn1 + xi3) / (_cn1 - xi3)
-                                        : _one;
+    const scalar_type xi3 = pow(_sa_var(cell, point) / _nu, 3.0);
+    const scalar_type f_n = _sa_var(cell, point) < 0.0
+                                ? (_cn1 + xi3) / (_cn1 - xi3)
+                                : _one;
 
-            _diffusivity_var(cell, point) = (_nu + _sa_var(cell, point) * f_n)
-                                            / _sigma;
-        });
+    _diffusivity_var(cell, point) = (_nu + _sa_var(cell, point) * f_n)
+                                    / _sigma;
 }
 
 //---------------------------------------------------------------------------//
@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLESPALARTALLMARASEDDYVISCOSITY_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLESPALARTALLMARASEDDYVISCOSITY_IMPL_HPP
 
+#include "utils/VertexCFD_Utils_CellPointPolicy.hpp"
 #include "utils/VertexCFD_Utils_SmoothMath.hpp"
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -37,35 +38,30 @@ template<class EvalType, class Traits>
 void IncompressibleSpalartAllmarasEddyViscosity<EvalType, Traits>::evaluateFields(
     typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _nu_t.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleSpalartAllmarasEddyViscosity<EvalType, Traits>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _nu_t.extent(1);
     using std::pow;
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            const auto sa_var = _sa_var(cell, point);
-            if (sa_var >= 0.0)
-            {
-                const scalar_type xi3 = pow(sa_var / _nu, 3.0);
-                const scalar_type f_v1 = xi3 / (xi3 + _cv1 * _cv1 * _cv1);
-                _nu_t(cell, point) = sa_var * f_v1;
-            }
-            else
-            {
-                _nu_t(cell, point) = 0.0;
-            }
-        });
+    const auto sa_var = _sa_var(cell, point);
+    if (sa_var >= 0.0)
+    {
+        const scalar_type xi3 = pow(sa_var / _nu, 3.0);
+        const scalar_type f_v1 = xi3 / (xi3 + _cv1 * _cv1 * _cv1);
+        _nu_t(cell, point) = sa_var * f_v1;
+    }
+    else
+    {
+        _nu_t(cell, point) = 0.0;
+    }
 }
 
 //---------------------------------------------------------------------------//
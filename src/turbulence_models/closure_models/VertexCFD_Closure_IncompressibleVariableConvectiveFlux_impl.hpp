@@ -1,6 +1,7 @@
 #ifndef VERTEXCFD_CLOSURE_INCOMPRESSIBLEVARIABLECONVECTIVEFLUX_IMPL_HPP
 #define VERTEXCFD_CLOSURE_INCOMPRESSIBLEVARIABLECONVECTIVEFLUX_IMPL_HPP
 
+#include <utils/VertexCFD_Utils_CellPointPolicy.hpp>
 #include <utils/VertexCFD_Utils_VectorField.hpp>
 
 #include <Panzer_HierarchicParallelism.hpp>
@@ -42,29 +43,24 @@ template<class EvalType, class Traits, int NumSpaceDim>
 void IncompressibleVariableConvectiveFlux<EvalType, Traits, NumSpaceDim>::
     evaluateFields(typename Traits::EvalData workset)
 {
-    auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
-        workset.num_cells);
-    Kokkos::parallel_for(this->getName(), policy, *this);
+    const int num_point = _var_flux.extent(1);
+    Utils::parallelForCellPoints<EvalType>(
+        this->getName(), workset.num_cells, num_point, *this);
 }
 
 //---------------------------------------------------------------------------//
 template<class EvalType, class Traits, int NumSpaceDim>
 KOKKOS_INLINE_FUNCTION void
 IncompressibleVariableConvectiveFlux<EvalType, Traits, NumSpaceDim>::operator()(
-    const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    const int cell, const int point) const
 {
-    const int cell = team.league_rank();
-    const int num_point = _var_flux.extent(1);
     const int num_grad_dim = _var_flux.extent(2);
 
-    Kokkos::parallel_for(
-        Kokkos::TeamThreadRange(team, 0, num_point), [&](const int point) {
-            for (int dim = 0; dim < num_grad_dim; ++dim)
-            {
-                _var_flux(cell, point, dim) = _var(cell, point)
-                                              * _velocity[dim](cell, point);
-            }
-        });
+    for (int dim = 0; dim < num_grad_dim; ++dim)
+    {
+        _var_flux(cell, point, dim) = _var(cell, point)
+                                      * _velocity[dim](cell, point);
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -33,8 +33,7 @@ class IncompressibleWALEEddyViscosity
     void evaluateFields(typename Traits::EvalData workset) override;
 
     KOKKOS_INLINE_FUNCTION
-    void operator()(
-        const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const;
+    void operator()(const int cell, const int point) const;
 
   private:
     PHX::MDField<const double, panzer::Cell, panzer::Point, panzer::Dim>
@@ -0,0 +1,123 @@
+#ifndef VERTEXCFD_UTILS_CELLPOINTPOLICY_HPP
+#define VERTEXCFD_UTILS_CELLPOINTPOLICY_HPP
+
+#include <VertexCFD_Utils_config.hpp>
+
+#include <Panzer_HierarchicParallelism.hpp>
+
+#include <Phalanx_KokkosDeviceTypes.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace VertexCFD
+{
+namespace Utils
+{
+//---------------------------------------------------------------------------//
+// Execution policy of the kernels evaluating a closure at each point of each
+// cell of a workset. The team policy launches one team per cell with the
+// points distributed over the threads of the team, which suits devices. The
+// MD range policy distributes tiles of (cell,point) over the threads, so the
+// point loop of host backends is not serialized and can be vectorized.
+//
+// The default is selected at build time with
+// VertexCFD_ENABLE_CELL_POINT_MDRANGE and can be changed at run time.
+//---------------------------------------------------------------------------//
+class CellPointPolicy
+{
+  public:
+    enum class Type
+    {
+        Team,
+        MDRange
+    };
+
+    static CellPointPolicy& inst()
+    {
+        static CellPointPolicy policy;
+        return policy;
+    }
+
+    Type type() const { return _type; }
+
+    void setType(const Type type) { _type = type; }
+
+    // Set the type from its name, "Team" or "MDRange".
+    void setType(const std::string& name)
+    {
+        if (name == "Team")
+            _type = Type::Team;
+        else if (name == "MDRange")
+            _type = Type::MDRange;
+        else
+            throw std::runtime_error("Unknown cell point policy: " + name);
+    }
+
+  private:
+    CellPointPolicy()
+#ifdef VertexCFD_ENABLE_CELL_POINT_MDRANGE
+        : _type(Type::MDRange)
+#else
+        : _type(Type::Team)
+#endif
+    {
+    }
+
+    Type _type;
+};
+
+//---------------------------------------------------------------------------//
+// Team functor calling a (cell,point) functor over the points of a cell.
+template<class Functor>
+struct CellPointTeamFunctor
+{
+    Functor functor;
+    int num_point;
+
+    KOKKOS_INLINE_FUNCTION
+    void
+    operator()(const Kokkos::TeamPolicy<PHX::exec_space>::member_type& team) const
+    {
+        const int cell = team.league_rank();
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(team, 0, num_point),
+            [&](const int point) { functor(cell, point); });
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Call functor(cell,point) for all points of the cells of a workset with the
+// selected policy. The scalar type of the evaluation type sizes the team
+// policy for Sacado types.
+template<class EvalType, class Functor>
+void parallelForCellPoints(const std::string& name,
+                           const int num_cell,
+                           const int num_point,
+                           const Functor& functor)
+{
+    using scalar_type = typename EvalType::ScalarT;
+
+    if (CellPointPolicy::inst().type() == CellPointPolicy::Type::MDRange)
+    {
+        Kokkos::MDRangePolicy<PHX::exec_space, Kokkos::Rank<2>> policy(
+            {0, 0}, {num_cell, num_point});
+        Kokkos::parallel_for(name, policy, functor);
+    }
+    else
+    {
+        auto policy = panzer::HP::inst().teamPolicy<scalar_type, PHX::Device>(
+            num_cell);
+        Kokkos::parallel_for(
+            name, policy, CellPointTeamFunctor<Functor>{functor, num_point});
+    }
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Utils
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_UTILS_CELLPOINTPOLICY_HPP
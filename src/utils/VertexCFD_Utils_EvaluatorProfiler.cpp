@@ -0,0 +1,273 @@
+#include "VertexCFD_Utils_EvaluatorProfiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace VertexCFD
+{
+namespace Utils
+{
+//---------------------------------------------------------------------------//
+EvaluatorProfiler& EvaluatorProfiler::inst()
+{
+    static EvaluatorProfiler profiler;
+    return profiler;
+}
+
+//---------------------------------------------------------------------------//
+void EvaluatorProfiler::add(const std::string& evaluator,
+                            const std::string& evaluation_type,
+                            const double seconds,
+                            const double bytes)
+{
+    auto& data = _data[std::make_pair(evaluator, evaluation_type)];
+    ++data.calls;
+    data.seconds += seconds;
+    data.bytes += bytes;
+}
+
+//---------------------------------------------------------------------------//
+std::vector<EvaluatorProfiler::GlobalData>
+EvaluatorProfiler::gather(MPI_Comm comm) const
+{
+    int comm_rank = 0;
+    int comm_size = 1;
+    MPI_Comm_rank(comm, &comm_rank);
+    MPI_Comm_size(comm, &comm_size);
+
+    // Serialize the local data as one line per entry with tab separated
+    // values. The backslashes, tabs and newlines of the names are escaped.
+    auto escape = [](const std::string& name) {
+        std::string escaped;
+        for (const char c : name)
+        {
+            if (c == '\\')
+                escaped += "\\\\";
+            else if (c == '\t')
+                escaped += "\\t";
+            else if (c == '\n')
+                escaped += "\\n";
+            else
+                escaped += c;
+        }
+        return escaped;
+    };
+    auto unescape = [](const std::string& escaped) {
+        std::string name;
+        for (std::size_t i = 0; i < escaped.size(); ++i)
+        {
+            if (escaped[i] == '\\' && i + 1 < escaped.size())
+            {
+                ++i;
+                if (escaped[i] == 't')
+                    name += '\t';
+                else if (escaped[i] == 'n')
+                    name += '\n';
+                else
+                    name += escaped[i];
+            }
+            else
+            {
+                name += escaped[i];
+            }
+        }
+        return name;
+    };
+
+    std::ostringstream local_stream;
+    local_stream << std::setprecision(17);
+    for (const auto& entry : _data)
+    {
+        local_stream << escape(entry.first.first) << '\t'
+                     << escape(entry.first.second) << '\t'
+                     << entry.second.calls << '\t'
+                     << entry.second.seconds << '\t' << entry.second.bytes
+                     << '\n';
+    }
+    const std::string local_string = local_stream.str();
+
+    // Gather the serialized data on rank 0.
+    int local_size = local_string.size();
+    std::vector<int> sizes(comm_size, 0);
+    MPI_Gather(&local_size, 1, MPI_INT, sizes.data(), 1, MPI_INT, 0, comm);
+
+    std::vector<int> offsets(comm_size, 0);
+    for (int rank = 1; rank < comm_size; ++rank)
+        offsets[rank] = offsets[rank - 1] + sizes[rank - 1];
+    std::string global_string(
+        comm_rank == 0 ? offsets.back() + sizes.back() : 0, '\0');
+    MPI_Gatherv(local_string.data(),
+                local_size,
+                MPI_CHAR,
+                &global_string[0],
+                sizes.data(),
+                offsets.data(),
+                MPI_CHAR,
+                0,
+                comm);
+
+    std::vector<GlobalData> result;
+    if (comm_rank != 0)
+        return result;
+
+    // Sum the calls, time and bytes over the ranks and keep the data of the
+    // rank with the maximum time.
+    std::map<std::pair<std::string, std::string>, GlobalData> global_data;
+    std::istringstream global_stream(global_string);
+    std::string line;
+    while (std::getline(global_stream, line))
+    {
+        std::istringstream line_stream(line);
+        std::string evaluator;
+        std::string evaluation_type;
+        std::string value;
+        std::getline(line_stream, evaluator, '\t');
+        std::getline(line_stream, evaluation_type, '\t');
+        evaluator = unescape(evaluator);
+        evaluation_type = unescape(evaluation_type);
+
+        auto& data = global_data[std::make_pair(evaluator, evaluation_type)];
+        data.evaluator = evaluator;
+        data.evaluation_type = evaluation_type;
+        std::getline(line_stream, value, '\t');
+        const long long calls = std::stoll(value);
+        std::getline(line_stream, value, '\t');
+        const double seconds = std::stod(value);
+        std::getline(line_stream, value, '\t');
+        const double bytes = std::stod(value);
+
+        data.calls += calls;
+        data.total_seconds += seconds;
+        data.bytes += bytes;
+        if (seconds >= data.max_seconds)
+        {
+            data.max_seconds = seconds;
+            data.max_calls = calls;
+            data.max_bytes = bytes;
+        }
+    }
+
+    for (const auto& entry : global_data)
+        result.push_back(entry.second);
+    std::sort(result.begin(),
+              result.end(),
+              [](const GlobalData& a, const GlobalData& b) {
+                  return a.max_seconds > b.max_seconds;
+              });
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+void EvaluatorProfiler::report(MPI_Comm comm, std::ostream& os) const
+{
+    const auto data = this->gather(comm);
+
+    int comm_rank = 0;
+    MPI_Comm_rank(comm, &comm_rank);
+    if (comm_rank != 0)
+        return;
+
+    double total_seconds = 0.0;
+    std::size_t name_width = 9;
+    for (const auto& entry : data)
+    {
+        total_seconds += entry.max_seconds;
+        name_width = std::max(name_width, entry.evaluator.size());
+    }
+
+    // All columns are the data of the slowest rank of each evaluator so that
+    // the time per call and the bandwidth are consistent with the time.
+    os << "\nEvaluator timers (slowest rank of each evaluator)\n";
+    os << std::left << std::setw(name_width + 2) << "Evaluator"
+       << std::setw(10) << "Type" << std::right << std::setw(12) << "Calls"
+       << std::setw(14) << "Time [s]" << std::setw(10) << "Fraction"
+       << std::setw(14) << "Time/Call [s]" << std::setw(12) << "GB/s"
+       << "\n";
+    for (const auto& entry : data)
+    {
+        const double fraction
+            = total_seconds > 0.0 ? entry.max_seconds / total_seconds : 0.0;
+        const double time_per_call
+            = entry.max_calls > 0 ? entry.max_seconds / entry.max_calls : 0.0;
+        const double bandwidth
+            = entry.max_seconds > 0.0
+                  ? 1.0e-9 * entry.max_bytes / entry.max_seconds
+                  : 0.0;
+        os << std::left << std::setw(name_width + 2) << entry.evaluator
+           << std::setw(10) << entry.evaluation_type << std::right
+           << std::setw(12) << entry.max_calls << std::scientific
+           << std::setprecision(4) << std::setw(14) << entry.max_seconds
+           << std::fixed << std::setprecision(4) << std::setw(10) << fraction
+           << std::scientific << std::setprecision(4) << std::setw(14)
+           << time_per_call << std::fixed << std::setprecision(3)
+           << std::setw(12) << bandwidth << "\n";
+    }
+    os << std::defaultfloat;
+}
+
+//---------------------------------------------------------------------------//
+void EvaluatorProfiler::writeJson(MPI_Comm comm,
+                                  const std::string& file_name) const
+{
+    const auto data = this->gather(comm);
+
+    int comm_rank = 0;
+    MPI_Comm_rank(comm, &comm_rank);
+    if (comm_rank != 0)
+        return;
+
+    std::ofstream file(file_name);
+    if (!file)
+    {
+        throw std::runtime_error("Unable to open evaluator timers file: "
+                                 + file_name);
+    }
+
+    // Escape the characters of a name that are not valid in a JSON string.
+    auto json_string = [](const std::string& name) {
+        std::string escaped = "\"";
+        for (const char c : name)
+        {
+            if (c == '\t')
+            {
+                escaped += "\\t";
+            }
+            else if (c == '\n')
+            {
+                escaped += "\\n";
+            }
+            else
+            {
+                if (c == '"' || c == '\\')
+                    escaped += '\\';
+                escaped += c;
+            }
+        }
+        return escaped + "\"";
+    };
+
+    file << std::setprecision(17);
+    file << "[\n";
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+        const auto& entry = data[i];
+        file << "  {\"evaluator\": " << json_string(entry.evaluator)
+             << ", \"evaluation_type\": "
+             << json_string(entry.evaluation_type)
+             << ", \"calls\": " << entry.calls
+             << ", \"max_calls\": " << entry.max_calls
+             << ", \"max_time\": " << entry.max_seconds
+             << ", \"total_time\": " << entry.total_seconds
+             << ", \"bytes\": " << entry.bytes << "}"
+             << (i + 1 < data.size() ? "," : "") << "\n";
+    }
+    file << "]\n";
+}
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Utils
+} // end namespace VertexCFD
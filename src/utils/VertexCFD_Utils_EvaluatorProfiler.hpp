@@ -0,0 +1,353 @@
+#ifndef VERTEXCFD_UTILS_EVALUATORPROFILER_HPP
+#define VERTEXCFD_UTILS_EVALUATORPROFILER_HPP
+
+#include <Panzer_Traits.hpp>
+#include <Panzer_Workset.hpp>
+
+#include <Phalanx_DataLayout.hpp>
+#include <Phalanx_Evaluator.hpp>
+#include <Phalanx_FieldManager.hpp>
+#include <Phalanx_FieldTag.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Timer.hpp>
+
+#include <mpi.h>
+
+#include <any>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Utils
+{
+//---------------------------------------------------------------------------//
+// Kernel time, number of invocations and estimated memory traffic of the
+// evaluators for each evaluation type. Profiling is disabled by default and
+// adds a fence before and after each timed evaluator when enabled.
+//---------------------------------------------------------------------------//
+class EvaluatorProfiler
+{
+  public:
+    struct Data
+    {
+        long long calls = 0;
+        double seconds = 0.0;
+        double bytes = 0.0;
+    };
+
+    static EvaluatorProfiler& inst();
+
+    bool enabled() const { return _enabled; }
+
+    void setEnabled(const bool enabled) { _enabled = enabled; }
+
+    // Number of derivatives of the scalar type of the Jacobian evaluation,
+    // used to estimate the size of the fields.
+    int derivativeDimension() const { return _derivative_dimension; }
+
+    void setDerivativeDimension(const int dim) { _derivative_dimension = dim; }
+
+    // Add a timed invocation of an evaluator.
+    void add(const std::string& evaluator,
+             const std::string& evaluation_type,
+             const double seconds,
+             const double bytes);
+
+    // Clear the recorded data.
+    void clear() { _data.clear(); }
+
+    // Data recorded on this rank for each (evaluator, evaluation type).
+    const std::map<std::pair<std::string, std::string>, Data>& data() const
+    {
+        return _data;
+    }
+
+    // Print the data of the slowest rank of each evaluator, ranked by time.
+    // Only rank 0 prints.
+    void report(MPI_Comm comm, std::ostream& os) const;
+
+    // Write the data of all ranks to a JSON file. Only rank 0 writes.
+    void writeJson(MPI_Comm comm, const std::string& file_name) const;
+
+  private:
+    EvaluatorProfiler() = default;
+
+    struct GlobalData
+    {
+        std::string evaluator;
+        std::string evaluation_type;
+        long long calls = 0;
+        double max_seconds = 0.0;
+        double total_seconds = 0.0;
+        double bytes = 0.0;
+
+        // Calls and bytes of the rank with the maximum time.
+        long long max_calls = 0;
+        double max_bytes = 0.0;
+    };
+
+    // Gather the data of all ranks on rank 0, sorted by decreasing maximum
+    // time. The result is empty on the other ranks.
+    std::vector<GlobalData> gather(MPI_Comm comm) const;
+
+    bool _enabled = false;
+    int _derivative_dimension = 0;
+    std::map<std::pair<std::string, std::string>, Data> _data;
+};
+
+//---------------------------------------------------------------------------//
+// Name of an evaluation type.
+template<class EvalType>
+std::string evaluationTypeName()
+{
+    if (std::is_same<EvalType, panzer::Traits::Residual>::value)
+        return "Residual";
+    else if (std::is_same<EvalType, panzer::Traits::Jacobian>::value)
+        return "Jacobian";
+    else if (std::is_same<EvalType, panzer::Traits::Tangent>::value)
+        return "Tangent";
+    return typeid(EvalType).name();
+}
+
+//---------------------------------------------------------------------------//
+// Estimated number of bytes read and written by an evaluator for a workset
+// of num_cell cells. Each field is counted once.
+template<class EvalType, class Evaluator>
+double evaluatorFieldBytes(const Evaluator& evaluator, const int num_cell)
+{
+    double bytes = 0.0;
+    if constexpr (std::is_base_of<PHX::Evaluator<panzer::Traits>,
+                                  Evaluator>::value)
+    {
+        const int num_derivative
+            = std::is_same<typename EvalType::ScalarT, double>::value
+                  ? 0
+                  : EvaluatorProfiler::inst().derivativeDimension();
+
+        auto add_fields = [&](const auto& tags) {
+            for (const auto& tag : tags)
+            {
+                const auto& layout = tag->dataLayout();
+                if (layout.rank() == 0 || layout.extent(0) == 0)
+                    continue;
+                const double entries = static_cast<double>(layout.size())
+                                       * num_cell / layout.extent(0);
+                const int scalar_size
+                    = tag->dataTypeInfo() == typeid(double)
+                          ? 1
+                          : 1 + num_derivative;
+                bytes += entries * scalar_size * sizeof(double);
+            }
+        };
+        add_fields(evaluator.evaluatedFields());
+        add_fields(evaluator.contributedFields());
+        add_fields(evaluator.dependentFields());
+    }
+    return bytes;
+}
+
+//---------------------------------------------------------------------------//
+// Time the kernels launched during the lifetime of this object and record
+// them for an evaluator.
+template<class EvalType>
+class EvaluatorTimer
+{
+  public:
+    template<class Evaluator>
+    EvaluatorTimer(const std::string& name,
+                   const Evaluator& evaluator,
+                   const int num_cell)
+        : _enabled(EvaluatorProfiler::inst().enabled())
+        , _bytes(0.0)
+    {
+        if (_enabled)
+        {
+            _name = name;
+            _bytes = evaluatorFieldBytes<EvalType>(evaluator, num_cell);
+            Kokkos::fence();
+            _timer.reset();
+        }
+    }
+
+    ~EvaluatorTimer()
+    {
+        if (_enabled)
+        {
+            Kokkos::fence();
+            EvaluatorProfiler::inst().add(_name,
+                                          evaluationTypeName<EvalType>(),
+                                          _timer.seconds(),
+                                          _bytes);
+        }
+    }
+
+    EvaluatorTimer(const EvaluatorTimer&) = delete;
+    EvaluatorTimer& operator=(const EvaluatorTimer&) = delete;
+
+  private:
+    bool _enabled;
+    double _bytes;
+    std::string _name;
+    Kokkos::Timer _timer;
+};
+
+//---------------------------------------------------------------------------//
+// Evaluator recording the time of the evaluation of another evaluator. All
+// other calls are forwarded to the wrapped evaluator.
+template<class EvalType>
+class ProfiledEvaluator : public PHX::Evaluator<panzer::Traits>
+{
+  public:
+    using Traits = panzer::Traits;
+
+    explicit ProfiledEvaluator(
+        const Teuchos::RCP<PHX::Evaluator<Traits>>& evaluator)
+        : _evaluator(evaluator)
+    {
+    }
+
+    void postRegistrationSetup(typename Traits::SetupData d,
+                               PHX::FieldManager<Traits>& fm) override
+    {
+        _evaluator->postRegistrationSetup(d, fm);
+    }
+
+    const std::vector<Teuchos::RCP<PHX::FieldTag>>&
+    evaluatedFields() const override
+    {
+        return _evaluator->evaluatedFields();
+    }
+
+    const std::vector<Teuchos::RCP<PHX::FieldTag>>&
+    contributedFields() const override
+    {
+        return _evaluator->contributedFields();
+    }
+
+    const std::vector<Teuchos::RCP<PHX::FieldTag>>&
+    dependentFields() const override
+    {
+        return _evaluator->dependentFields();
+    }
+
+    const std::vector<Teuchos::RCP<PHX::FieldTag>>&
+    unsharedFields() const override
+    {
+        return _evaluator->unsharedFields();
+    }
+
+    void evaluateFields(typename Traits::EvalData d) override
+    {
+        EvaluatorTimer<EvalType> timer(
+            _evaluator->getName(), *_evaluator, d.num_cells);
+        _evaluator->evaluateFields(d);
+    }
+
+#ifdef PHX_ENABLE_KOKKOS_AMT
+    Kokkos::Future<void, PHX::exec_space>
+    createTask(Kokkos::TaskScheduler<PHX::exec_space>& policy,
+               const int& work_size,
+               const std::vector<Kokkos::Future<void, PHX::exec_space>>&
+                   dependent_futures,
+               typename Traits::EvalData d) override
+    {
+        return _evaluator->createTask(policy, work_size, dependent_futures, d);
+    }
+
+    unsigned taskSize() const override { return _evaluator->taskSize(); }
+#endif
+
+    void preEvaluate(typename Traits::PreEvalData d) override
+    {
+        _evaluator->preEvaluate(d);
+    }
+
+    void postEvaluate(typename Traits::PostEvalData d) override
+    {
+        _evaluator->postEvaluate(d);
+    }
+
+    const std::string& getName() const override
+    {
+        return _evaluator->getName();
+    }
+
+    void bindField(const PHX::FieldTag& ft, const std::any& f) override
+    {
+        _evaluator->bindField(ft, f);
+    }
+
+    PHX::DeviceEvaluator<Traits>* createDeviceEvaluator() const override
+    {
+        return _evaluator->createDeviceEvaluator();
+    }
+
+    void rebuildDeviceEvaluator(PHX::DeviceEvaluator<Traits>* e) const override
+    {
+        _evaluator->rebuildDeviceEvaluator(e);
+    }
+
+    void deleteDeviceEvaluator(PHX::DeviceEvaluator<Traits>* e) const override
+    {
+        _evaluator->deleteDeviceEvaluator(e);
+    }
+
+    void printFinalizedEvaluator(std::ostream& os) const override
+    {
+        _evaluator->printFinalizedEvaluator(os);
+    }
+
+  private:
+    Teuchos::RCP<PHX::Evaluator<Traits>> _evaluator;
+};
+
+//---------------------------------------------------------------------------//
+// Wrap an evaluator in a ProfiledEvaluator when profiling is enabled and
+// return it unchanged otherwise. Profiling must be enabled before the
+// evaluators are built.
+template<class EvalType>
+Teuchos::RCP<PHX::Evaluator<panzer::Traits>> profiledEvaluator(
+    const Teuchos::RCP<PHX::Evaluator<panzer::Traits>>& evaluator)
+{
+    if (!EvaluatorProfiler::inst().enabled())
+        return evaluator;
+    return Teuchos::rcp(new ProfiledEvaluator<EvalType>(evaluator));
+}
+
+//---------------------------------------------------------------------------//
+// Equation set or boundary condition base that registers the evaluators of
+// the derived class through profiledEvaluator(). The constructors of the
+// Panzer base are inherited.
+template<class Base>
+class ProfiledRegistrar : public Base
+{
+  public:
+    using Base::Base;
+
+  protected:
+    template<class EvalType>
+    void registerEvaluator(
+        PHX::FieldManager<panzer::Traits>& fm,
+        const Teuchos::RCP<PHX::Evaluator<panzer::Traits>>& op) const
+    {
+        Base::template registerEvaluator<EvalType>(
+            fm, profiledEvaluator<EvalType>(op));
+    }
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Utils
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_UTILS_EVALUATORPROFILER_HPP
@@ -0,0 +1,102 @@
+#ifndef VERTEXCFD_UTILS_WORKSETFIELDCACHE_HPP
+#define VERTEXCFD_UTILS_WORKSETFIELDCACHE_HPP
+
+#include <Panzer_Workset.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace VertexCFD
+{
+namespace Utils
+{
+//---------------------------------------------------------------------------//
+// Values of an evaluated field for each workset of an element block. This is
+// used by evaluators whose fields only depend on the mesh geometry: the field
+// is computed once per workset and copied from the cache in subsequent
+// evaluations. Worksets are matched by their identifier.
+//---------------------------------------------------------------------------//
+template<class FieldType>
+class WorksetFieldCache
+{
+  public:
+    using field_view_type = std::decay_t<decltype(
+        std::declval<const FieldType&>().get_static_view())>;
+    using view_type
+        = Kokkos::View<typename field_view_type::non_const_data_type,
+                       typename field_view_type::array_layout,
+                       typename field_view_type::device_type>;
+
+    // Store the identifiers of the non-empty worksets. The storage of a
+    // workset is allocated with the layout of the field when it is stored.
+    void initialize(const std::vector<panzer::Workset>& worksets)
+    {
+        _workset_id.clear();
+        _values.clear();
+        for (const auto& workset : worksets)
+        {
+            if (workset.num_cells > 0)
+                _workset_id.push_back(workset.getIdentifier());
+        }
+        _values.resize(_workset_id.size());
+    }
+
+    // Store the field values of a workset. Worksets that were not given
+    // at initialization are not stored.
+    void store(const panzer::Workset& workset, const FieldType& field)
+    {
+        const int index = this->index(workset);
+        if (index < 0)
+            return;
+
+        if (!_values[index].is_allocated())
+        {
+            _values[index] = view_type(
+                Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                                   field.fieldTag().name() + "_cache"),
+                field.get_static_view().layout());
+        }
+        Kokkos::deep_copy(_values[index], field.get_static_view());
+    }
+
+    // Copy the stored values of a workset into the field. Returns false if
+    // the workset has not been stored.
+    bool load(const panzer::Workset& workset, const FieldType& field) const
+    {
+        const int index = this->index(workset);
+        if (index < 0 || !_values[index].is_allocated())
+            return false;
+
+        Kokkos::deep_copy(field.get_static_view(), _values[index]);
+        return true;
+    }
+
+  private:
+    int index(const panzer::Workset& workset) const
+    {
+        if (workset.num_cells > 0)
+        {
+            const std::size_t id = workset.getIdentifier();
+            for (std::size_t i = 0; i < _workset_id.size(); ++i)
+            {
+                if (_workset_id[i] == id)
+                    return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    std::vector<std::size_t> _workset_id;
+    std::vector<view_type> _values;
+};
+
+//---------------------------------------------------------------------------//
+
+} // end namespace Utils
+} // end namespace VertexCFD
+
+#endif // end VERTEXCFD_UTILS_WORKSETFIELDCACHE_HPP
@@ -0,0 +1,87 @@
+#include <VertexCFD_Utils_CellPointPolicy.hpp>
+
+#include <Panzer_Traits.hpp>
+
+#include <Phalanx_KokkosDeviceTypes.hpp>
+
+#include <Kokkos_Core.hpp>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace VertexCFD;
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+struct CellPointFunctor
+{
+    Kokkos::View<double**, PHX::mem_space> values;
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const int cell, const int point) const
+    {
+        values(cell, point) += 10.0 * cell + point;
+    }
+};
+
+//---------------------------------------------------------------------------//
+void policyTest(const Utils::CellPointPolicy::Type type)
+{
+    const int num_cell = 7;
+    const int num_point = 5;
+    Kokkos::View<double**, PHX::mem_space> values(
+        "values", num_cell, num_point);
+
+    auto& policy = Utils::CellPointPolicy::inst();
+    const auto default_type = policy.type();
+    policy.setType(type);
+    Utils::parallelForCellPoints<panzer::Traits::Residual>(
+        "cell_point_test", num_cell, num_point, CellPointFunctor{values});
+    policy.setType(default_type);
+
+    // Each point is visited exactly once.
+    auto values_host
+        = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+    for (int cell = 0; cell < num_cell; ++cell)
+    {
+        for (int point = 0; point < num_point; ++point)
+        {
+            EXPECT_DOUBLE_EQ(10.0 * cell + point, values_host(cell, point));
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST(CellPointPolicy, team)
+{
+    policyTest(Utils::CellPointPolicy::Type::Team);
+}
+
+//---------------------------------------------------------------------------//
+TEST(CellPointPolicy, mdRange)
+{
+    policyTest(Utils::CellPointPolicy::Type::MDRange);
+}
+
+//---------------------------------------------------------------------------//
+TEST(CellPointPolicy, setType)
+{
+    auto& policy = Utils::CellPointPolicy::inst();
+    const auto default_type = policy.type();
+
+    policy.setType("MDRange");
+    EXPECT_TRUE(policy.type() == Utils::CellPointPolicy::Type::MDRange);
+    policy.setType("Team");
+    EXPECT_TRUE(policy.type() == Utils::CellPointPolicy::Type::Team);
+    EXPECT_THROW(policy.setType("Vector"), std::runtime_error);
+    EXPECT_TRUE(policy.type() == Utils::CellPointPolicy::Type::Team);
+
+    policy.setType(default_type);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace Test
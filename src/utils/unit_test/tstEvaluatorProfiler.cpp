@@ -0,0 +1,196 @@
+#include <VertexCFD_Utils_EvaluatorProfiler.hpp>
+
+#include <Panzer_Traits.hpp>
+#include <Panzer_Workset.hpp>
+
+#include <Phalanx_Evaluator_Derived.hpp>
+#include <Phalanx_Evaluator_WithBaseImpl.hpp>
+
+#include <Teuchos_RCP.hpp>
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+using namespace VertexCFD;
+
+namespace Test
+{
+//---------------------------------------------------------------------------//
+struct NotAnEvaluator
+{
+};
+
+//---------------------------------------------------------------------------//
+class EmptyEvaluator
+    : public PHX::EvaluatorWithBaseImpl<panzer::Traits>,
+      public PHX::EvaluatorDerived<panzer::Traits::Residual, panzer::Traits>
+{
+  public:
+    EmptyEvaluator() { this->setName("Empty Evaluator"); }
+
+    void evaluateFields(typename panzer::Traits::EvalData) override {}
+};
+
+//---------------------------------------------------------------------------//
+void recordTest()
+{
+    auto& profiler = Utils::EvaluatorProfiler::inst();
+    profiler.clear();
+
+    // Nothing is recorded while disabled.
+    profiler.setEnabled(false);
+    {
+        Utils::EvaluatorTimer<panzer::Traits::Residual> timer(
+            "Disabled", NotAnEvaluator{}, 10);
+    }
+    EXPECT_TRUE(profiler.data().empty());
+
+    profiler.setEnabled(true);
+    for (int i = 0; i < 3; ++i)
+    {
+        Utils::EvaluatorTimer<panzer::Traits::Residual> timer(
+            "Closure A", NotAnEvaluator{}, 10);
+    }
+    {
+        Utils::EvaluatorTimer<panzer::Traits::Jacobian> timer(
+            "Closure A", NotAnEvaluator{}, 10);
+    }
+    profiler.add("Closure B", "Residual", 2.0, 100.0);
+    profiler.add("Closure B", "Residual", 1.0, 50.0);
+    profiler.setEnabled(false);
+
+    const auto& data = profiler.data();
+    EXPECT_EQ(3u, data.size());
+
+    const auto& a_residual = data.at(std::make_pair("Closure A", "Residual"));
+    EXPECT_EQ(3, a_residual.calls);
+    EXPECT_LE(0.0, a_residual.seconds);
+    EXPECT_EQ(0.0, a_residual.bytes);
+
+    const auto& a_jacobian = data.at(std::make_pair("Closure A", "Jacobian"));
+    EXPECT_EQ(1, a_jacobian.calls);
+
+    const auto& b_residual = data.at(std::make_pair("Closure B", "Residual"));
+    EXPECT_EQ(2, b_residual.calls);
+    EXPECT_DOUBLE_EQ(3.0, b_residual.seconds);
+    EXPECT_DOUBLE_EQ(150.0, b_residual.bytes);
+}
+
+//---------------------------------------------------------------------------//
+void outputTest()
+{
+    auto& profiler = Utils::EvaluatorProfiler::inst();
+    profiler.clear();
+    profiler.add("Closure \"A\"", "Residual", 1.0, 1.0e9);
+    profiler.add("Closure B", "Jacobian", 3.0, 1.0e9);
+    profiler.add("Closure\tC\n\\", "Residual", 0.5, 1.0e9);
+
+    int comm_rank = 0;
+    int comm_size = 1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &comm_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &comm_size);
+
+    // The slowest evaluator is listed first.
+    std::ostringstream os;
+    profiler.report(MPI_COMM_WORLD, os);
+    const std::string table = os.str();
+    if (comm_rank == 0)
+    {
+        const auto pos_a = table.find("Closure \"A\"");
+        const auto pos_b = table.find("Closure B");
+        ASSERT_NE(std::string::npos, pos_a);
+        ASSERT_NE(std::string::npos, pos_b);
+        EXPECT_LT(pos_b, pos_a);
+    }
+    else
+    {
+        EXPECT_TRUE(table.empty());
+    }
+
+    // The calls are summed over the ranks and reported for the slowest rank.
+    const std::string file_name = "evaluator_profiler_test.json";
+    profiler.writeJson(MPI_COMM_WORLD, file_name);
+    if (comm_rank == 0)
+    {
+        std::ifstream file(file_name);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string json = buffer.str();
+        EXPECT_NE(std::string::npos,
+                  json.find("\"evaluator\": \"Closure \\\"A\\\"\""));
+        EXPECT_NE(std::string::npos,
+                  json.find("\"calls\": " + std::to_string(comm_size)));
+        EXPECT_NE(std::string::npos, json.find("\"max_calls\": 1,"));
+        EXPECT_LT(json.find("Closure B"), json.find("Closure \\\"A\\\""));
+
+        // Tabs, newlines and backslashes in the names are kept.
+        EXPECT_NE(std::string::npos,
+                  json.find("\"evaluator\": \"Closure\\tC\\n\\\\\""));
+        std::remove(file_name.c_str());
+    }
+
+    profiler.clear();
+}
+
+//---------------------------------------------------------------------------//
+void profiledEvaluatorTest()
+{
+    auto& profiler = Utils::EvaluatorProfiler::inst();
+    profiler.clear();
+
+    // Evaluators are not wrapped while profiling is disabled.
+    Teuchos::RCP<PHX::Evaluator<panzer::Traits>> eval
+        = Teuchos::rcp(new EmptyEvaluator);
+    profiler.setEnabled(false);
+    auto wrapped = Utils::profiledEvaluator<panzer::Traits::Residual>(eval);
+    EXPECT_EQ(eval.get(), wrapped.get());
+
+    // The wrapped evaluator forwards its name and records its evaluations.
+    profiler.setEnabled(true);
+    wrapped = Utils::profiledEvaluator<panzer::Traits::Residual>(eval);
+    EXPECT_NE(eval.get(), wrapped.get());
+    EXPECT_EQ("Empty Evaluator", wrapped->getName());
+
+    panzer::Workset workset;
+    workset.num_cells = 4;
+    wrapped->evaluateFields(workset);
+    wrapped->evaluateFields(workset);
+    profiler.setEnabled(false);
+
+    const auto& data = profiler.data();
+    ASSERT_EQ(1u, data.size());
+    EXPECT_EQ(2,
+              data.at(std::make_pair("Empty Evaluator", "Residual")).calls);
+
+    profiler.clear();
+}
+
+//---------------------------------------------------------------------------//
+// RUN TESTS
+//---------------------------------------------------------------------------//
+TEST(EvaluatorProfiler, record)
+{
+    recordTest();
+}
+
+//---------------------------------------------------------------------------//
+TEST(EvaluatorProfiler, output)
+{
+    outputTest();
+}
+
+//---------------------------------------------------------------------------//
+TEST(EvaluatorProfiler, profiledEvaluator)
+{
+    profiledEvaluatorTest();
+}
+
+//---------------------------------------------------------------------------//
+} // namespace Test